@@ -0,0 +1,180 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_array_ptr.cpp
+// - Purpose: This file implements google benchmark cases for array_ptr in
+//            memory.hpp, paired with std::unique_ptr<T[]> and std::vector
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../include/memory.hpp"
+#include "../include/string.hpp"
+
+#if CSLT_SIMD_SSE2
+    #include <emmintrin.h>
+#endif
+// ================================================================================
+// ================================================================================
+// REALLOC BENCHMARKS
+
+// Grows an array one doubling at a time up to range(0) elements
+static void BM_ArrayPtrRealloc(benchmark::State& state) {
+    const cslt::size_t limit = static_cast<cslt::size_t>(state.range(0));
+    for (auto _ : state) {
+        cslt::array_ptr<double> arr(1);
+        for (cslt::size_t len = 2; len <= limit; len *= 2)
+            arr.realloc(len);
+        benchmark::DoNotOptimize(arr.data());
+    }
+}
+BENCHMARK(BM_ArrayPtrRealloc)->Range(64, 1 << 16);
+// --------------------------------------------------------------------------------
+
+static void BM_StdUniqueArrayRealloc(benchmark::State& state) {
+    const std::size_t limit = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        std::unique_ptr<double[]> arr(new double[1]());
+        std::size_t size = 1;
+        for (std::size_t len = 2; len <= limit; len *= 2) {
+            std::unique_ptr<double[]> block(new double[len]());
+            std::copy(arr.get(), arr.get() + size, block.get());
+            arr = std::move(block);
+            size = len;
+        }
+        benchmark::DoNotOptimize(arr.get());
+    }
+}
+BENCHMARK(BM_StdUniqueArrayRealloc)->Range(64, 1 << 16);
+// --------------------------------------------------------------------------------
+
+static void BM_StdVectorResize(benchmark::State& state) {
+    const std::size_t limit = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        std::vector<double> arr(1);
+        for (std::size_t len = 2; len <= limit; len *= 2)
+            arr.resize(len);
+        benchmark::DoNotOptimize(arr.data());
+    }
+}
+BENCHMARK(BM_StdVectorResize)->Range(64, 1 << 16);
+// --------------------------------------------------------------------------------
+
+// String is trivially relocatable, so each doubling copies bytes instead of moving
+static void BM_ArrayPtrReallocString(benchmark::State& state) {
+    const cslt::size_t limit = static_cast<cslt::size_t>(state.range(0));
+    for (auto _ : state) {
+        cslt::array_ptr<cslt::String> arr(1);
+        arr[0] = cslt::String("a string longer than the inline buffer");
+        for (cslt::size_t len = 2; len <= limit; len *= 2)
+            arr.realloc(len);
+        benchmark::DoNotOptimize(arr.data());
+    }
+}
+BENCHMARK(BM_ArrayPtrReallocString)->Range(64, 1 << 14);
+// --------------------------------------------------------------------------------
+
+static void BM_StdVectorResizeString(benchmark::State& state) {
+    const std::size_t limit = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        std::vector<std::string> arr(1, std::string("a string longer than the inline buffer"));
+        for (std::size_t len = 2; len <= limit; len *= 2)
+            arr.resize(len);
+        benchmark::DoNotOptimize(arr.data());
+    }
+}
+BENCHMARK(BM_StdVectorResizeString)->Range(64, 1 << 14);
+// ================================================================================
+// ================================================================================
+// ITERATION BENCHMARKS
+
+static void BM_ArrayPtrIndexSum(benchmark::State& state) {
+    const cslt::size_t len = static_cast<cslt::size_t>(state.range(0));
+    cslt::array_ptr<double> arr(len);
+    for (cslt::size_t i = 0; i < len; ++i)
+        arr[i] = static_cast<double>(i);
+    for (auto _ : state) {
+        double sum = 0.0;
+        for (cslt::size_t i = 0; i < len; ++i)
+            sum += arr[i];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ArrayPtrIndexSum)->Arg(4096);
+// --------------------------------------------------------------------------------
+
+static void BM_StdVectorIndexSum(benchmark::State& state) {
+    const std::size_t len = static_cast<std::size_t>(state.range(0));
+    std::vector<double> arr(len);
+    for (std::size_t i = 0; i < len; ++i)
+        arr[i] = static_cast<double>(i);
+    for (auto _ : state) {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < len; ++i)
+            sum += arr[i];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdVectorIndexSum)->Arg(4096);
+// ================================================================================
+// ================================================================================
+// ALIGNED LOAD BENCHMARKS
+//
+// The lengths are not multiples of the vector width.  The padded block lets the
+// aligned loop finish with one full load; the plain block needs unaligned loads
+// and a scalar tail.
+
+#if CSLT_SIMD_SSE2
+static void BM_AlignedArrayPtrVectorSum(benchmark::State& state) {
+    const cslt::size_t len = static_cast<cslt::size_t>(state.range(0));
+    cslt::aligned_array_ptr<float> arr(len);
+    for (cslt::size_t i = 0; i < len; ++i)
+        arr[i] = 1.0f;
+    const float* data = arr.get();
+    for (auto _ : state) {
+        __m128 sum = _mm_setzero_ps();
+        for (cslt::size_t i = 0; i < len; i += 4)
+            sum = _mm_add_ps(sum, _mm_load_ps(data + i));
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AlignedArrayPtrVectorSum)->Arg(1023)->Arg(4099);
+// --------------------------------------------------------------------------------
+
+static void BM_ArrayPtrVectorSum(benchmark::State& state) {
+    const cslt::size_t len = static_cast<cslt::size_t>(state.range(0));
+    cslt::array_ptr<float> arr(len);
+    for (cslt::size_t i = 0; i < len; ++i)
+        arr[i] = 1.0f;
+    const float* data = arr.get();
+    for (auto _ : state) {
+        __m128 sum = _mm_setzero_ps();
+        cslt::size_t i = 0;
+        for (; i + 4 <= len; i += 4)
+            sum = _mm_add_ps(sum, _mm_loadu_ps(data + i));
+        float tail = 0.0f;
+        for (; i < len; ++i)
+            tail += data[i];
+        benchmark::DoNotOptimize(sum);
+        benchmark::DoNotOptimize(tail);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ArrayPtrVectorSum)->Arg(1023)->Arg(4099);
+#endif
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,212 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_concurrent_queue.cpp
+// - Purpose: This file implements google benchmark cases for concurrent_queue.hpp,
+//            each paired with a queue built on one mutex and condition variable
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../include/concurrent_queue.hpp"
+
+// The queue pipeline stages use today: one deque behind one lock
+template <typename T>
+class locked_queue {
+private:
+    std::mutex lock;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+    std::deque<T> items;
+    std::size_t limit;
+
+public:
+    explicit locked_queue(std::size_t capacity) : limit(capacity) {}
+
+    void push(T&& value) {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            not_full.wait(guard, [this] {return items.size() < limit;});
+            items.push_back(std::move(value));
+        }
+        not_empty.notify_one();
+    }
+
+    void pop(T& value) {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            not_empty.wait(guard, [this] {return !items.empty();});
+            value = std::move(items.front());
+            items.pop_front();
+        }
+        not_full.notify_one();
+    }
+};
+// ================================================================================
+// ================================================================================
+// THROUGHPUT BENCHMARKS: 1 << 20 unique_ptr messages through a 1024 slot queue
+
+static const int messages = 1 << 20;
+static const cslt::size_t queue_capacity = 1024;
+static const cslt::size_t batch_size = 32;
+
+using message = cslt::unique_ptr<int>;
+
+// Every producer moves its share in, every consumer drains its share out
+template <typename Queue, typename Produce, typename Consume>
+static void run_pipeline(benchmark::State& state, int producers, int consumers,
+                         Produce produce, Consume consume) {
+    // Messages are allocated up front, so the timing covers only the hand-off
+    std::vector<message> source;
+    std::vector<message> sink;
+    source.reserve(static_cast<std::size_t>(messages));
+    sink.reserve(static_cast<std::size_t>(messages));
+    for (int i = 0; i < messages; ++i) {
+        source.push_back(message(new int(i)));
+        sink.push_back(message(nullptr));
+    }
+    for (auto _ : state) {
+        Queue queue(queue_capacity);
+        std::vector<std::thread> threads;
+        const int per_producer = messages / producers;
+        const int per_consumer = messages / consumers;
+        for (int p = 0; p < producers; ++p)
+            threads.emplace_back([&, p] {
+                produce(queue, source.data() + p * per_producer, per_producer);
+            });
+        for (int c = 0; c < consumers; ++c)
+            threads.emplace_back([&, c] {
+                consume(queue, sink.data() + c * per_consumer, per_consumer);
+            });
+        for (std::thread& thread : threads)
+            thread.join();
+        // The consumers now hold every message; they are the next run's source
+        source.swap(sink);
+    }
+    state.SetItemsProcessed(state.iterations() * messages);
+}
+// --------------------------------------------------------------------------------
+
+template <typename Queue>
+static void push_each(Queue& queue, message* first, int count) {
+    for (int i = 0; i < count; ++i)
+        queue.push(cslt::move(first[i]));
+}
+
+template <typename Queue>
+static void pop_each(Queue& queue, message* first, int count) {
+    for (int i = 0; i < count; ++i)
+        queue.pop(first[i]);
+}
+
+template <typename Queue>
+static void push_batched(Queue& queue, message* first, int count) {
+    for (int i = 0; i < count; i += static_cast<int>(batch_size))
+        queue.push_n(first + i, batch_size);
+}
+
+template <typename Queue>
+static void pop_batched(Queue& queue, message* first, int count) {
+    for (int i = 0; i < count;)
+        i += static_cast<int>(queue.pop_n(first + i, static_cast<cslt::size_t>(count - i)));
+}
+// --------------------------------------------------------------------------------
+
+static void BM_SpscQueue1P1C(benchmark::State& state) {
+    using queue = cslt::spsc_queue<message>;
+    run_pipeline<queue>(state, 1, 1, push_each<queue>, pop_each<queue>);
+}
+BENCHMARK(BM_SpscQueue1P1C)->UseRealTime()->Unit(benchmark::kMillisecond);
+// --------------------------------------------------------------------------------
+
+static void BM_SpscQueue1P1CBatched(benchmark::State& state) {
+    using queue = cslt::spsc_queue<message>;
+    run_pipeline<queue>(state, 1, 1, push_batched<queue>, pop_batched<queue>);
+}
+BENCHMARK(BM_SpscQueue1P1CBatched)->UseRealTime()->Unit(benchmark::kMillisecond);
+// --------------------------------------------------------------------------------
+
+// Arg is the number of producers and of consumers
+static void BM_MpmcQueueNPNC(benchmark::State& state) {
+    using queue = cslt::mpmc_queue<message>;
+    const int threads = static_cast<int>(state.range(0));
+    run_pipeline<queue>(state, threads, threads, push_each<queue>, pop_each<queue>);
+}
+BENCHMARK(BM_MpmcQueueNPNC)->Arg(1)->Arg(2)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+// --------------------------------------------------------------------------------
+
+static void BM_MpmcQueueNPNCBatched(benchmark::State& state) {
+    using queue = cslt::mpmc_queue<message>;
+    const int threads = static_cast<int>(state.range(0));
+    run_pipeline<queue>(state, threads, threads, push_batched<queue>, pop_batched<queue>);
+}
+BENCHMARK(BM_MpmcQueueNPNCBatched)->Arg(1)->Arg(2)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+// --------------------------------------------------------------------------------
+
+static void BM_LockedQueueNPNC(benchmark::State& state) {
+    using queue = locked_queue<message>;
+    const int threads = static_cast<int>(state.range(0));
+    run_pipeline<queue>(state, threads, threads, push_each<queue>, pop_each<queue>);
+}
+BENCHMARK(BM_LockedQueueNPNC)->Arg(1)->Arg(2)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+// ================================================================================
+// ================================================================================
+// LATENCY BENCHMARKS: one message bounced between two threads and back
+
+// Each iteration is one round trip through a pair of queues
+template <typename Queue>
+static void run_ping_pong(benchmark::State& state) {
+    Queue ping(2);
+    Queue pong(2);
+    std::thread echo([&ping, &pong] {
+        message value(nullptr);
+        for (;;) {
+            ping.pop(value);
+            if (!value)
+                return;
+            pong.push(cslt::move(value));
+        }
+    });
+    message value(new int(0));
+    for (auto _ : state) {
+        ping.push(cslt::move(value));
+        pong.pop(value);
+    }
+    // A null message stops the echo thread
+    ping.push(message(nullptr));
+    echo.join();
+    state.SetItemsProcessed(state.iterations());
+}
+// --------------------------------------------------------------------------------
+
+static void BM_SpscQueueRoundTrip(benchmark::State& state) {
+    run_ping_pong<cslt::spsc_queue<message>>(state);
+}
+BENCHMARK(BM_SpscQueueRoundTrip)->UseRealTime();
+// --------------------------------------------------------------------------------
+
+static void BM_MpmcQueueRoundTrip(benchmark::State& state) {
+    run_ping_pong<cslt::mpmc_queue<message>>(state);
+}
+BENCHMARK(BM_MpmcQueueRoundTrip)->UseRealTime();
+// --------------------------------------------------------------------------------
+
+static void BM_LockedQueueRoundTrip(benchmark::State& state) {
+    run_ping_pong<locked_queue<message>>(state);
+}
+BENCHMARK(BM_LockedQueueRoundTrip)->UseRealTime();
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,100 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_except.cpp
+// - Purpose: This file implements google benchmark cases for except.hpp, each
+//            paired with the matching std:: exception
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <stdexcept>
+#include "../include/except.hpp"
+// ================================================================================
+// ================================================================================
+// THROW AND CATCH BENCHMARKS
+
+static void BM_ThrowLiteral(benchmark::State& state) {
+    for (auto _ : state) {
+        try {
+            throw cslt::out_of_range(CSLT_LITERAL("Index out of range"));
+        } catch (const cslt::exception& e) {
+            benchmark::DoNotOptimize(e.what());
+        }
+    }
+}
+BENCHMARK(BM_ThrowLiteral);
+// --------------------------------------------------------------------------------
+
+static void BM_StdThrowLiteral(benchmark::State& state) {
+    for (auto _ : state) {
+        try {
+            throw std::out_of_range("Index out of range");
+        } catch (const std::exception& e) {
+            benchmark::DoNotOptimize(e.what());
+        }
+    }
+}
+BENCHMARK(BM_StdThrowLiteral);
+// --------------------------------------------------------------------------------
+
+static void BM_ThrowFormatted(benchmark::State& state) {
+    char text[64];
+    std::snprintf(text, sizeof(text), "index %d out of range", 42);
+    for (auto _ : state) {
+        try {
+            throw cslt::out_of_range(text);
+        } catch (const cslt::exception& e) {
+            benchmark::DoNotOptimize(e.what());
+        }
+    }
+}
+BENCHMARK(BM_ThrowFormatted);
+// --------------------------------------------------------------------------------
+
+static void BM_StdThrowFormatted(benchmark::State& state) {
+    char text[64];
+    std::snprintf(text, sizeof(text), "index %d out of range", 42);
+    for (auto _ : state) {
+        try {
+            throw std::out_of_range(text);
+        } catch (const std::exception& e) {
+            benchmark::DoNotOptimize(e.what());
+        }
+    }
+}
+BENCHMARK(BM_StdThrowFormatted);
+// ================================================================================
+// ================================================================================
+// COPY BENCHMARKS
+
+static void BM_ExceptionCopy(benchmark::State& state) {
+    char text[] = "a message that was built at run time";
+    const cslt::runtime_error original(text);
+    for (auto _ : state) {
+        cslt::runtime_error copy(original);
+        benchmark::DoNotOptimize(copy.what());
+    }
+}
+BENCHMARK(BM_ExceptionCopy);
+// --------------------------------------------------------------------------------
+
+static void BM_StdExceptionCopy(benchmark::State& state) {
+    char text[] = "a message that was built at run time";
+    const std::runtime_error original(text);
+    for (auto _ : state) {
+        std::runtime_error copy(original);
+        benchmark::DoNotOptimize(copy.what());
+    }
+}
+BENCHMARK(BM_StdExceptionCopy);
+// ================================================================================
+// ================================================================================
+// eof
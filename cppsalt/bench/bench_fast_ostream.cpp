@@ -0,0 +1,145 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_fast_ostream.cpp
+// - Purpose: This file implements google benchmark cases for fast_ostream.hpp,
+//            each paired with the same record written by std::ostream or snprintf
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "../include/fast_ostream.hpp"
+#include "../include/charconv.hpp"
+
+#if defined(_WIN32)
+    #define CSLT_BENCH_NULL_DEVICE "NUL"
+#else
+    #define CSLT_BENCH_NULL_DEVICE "/dev/null"
+#endif
+
+// Every case writes the same log record per iteration:
+// "request id=<i> status=200 bytes=<n> seconds=<t>\n"
+static const double seconds_taken = 0.0123456;
+// ================================================================================
+// ================================================================================
+// RECORD BENCHMARKS, writing to the null device
+
+static void BM_FastOstreamPrint(benchmark::State& state) {
+    std::FILE* sink = std::fopen(CSLT_BENCH_NULL_DEVICE, "w");
+    {
+        cslt::fast_ostream os(fileno(sink));
+        long i = 0;
+        for (auto _ : state) {
+            os.println(CSLT_FORMAT("request id={} status={} bytes={} seconds={}"),
+                       i, 200, i * 37, cslt::fixed(seconds_taken, 6));
+            ++i;
+        }
+    }
+    std::fclose(sink);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FastOstreamPrint);
+// --------------------------------------------------------------------------------
+
+static void BM_FastOstreamShift(benchmark::State& state) {
+    std::FILE* sink = std::fopen(CSLT_BENCH_NULL_DEVICE, "w");
+    {
+        cslt::fast_ostream os(fileno(sink));
+        long i = 0;
+        for (auto _ : state) {
+            os << "request id=" << i << " status=" << 200 << " bytes=" << i * 37
+               << " seconds=" << cslt::fixed(seconds_taken, 6) << '\n';
+            ++i;
+        }
+    }
+    std::fclose(sink);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FastOstreamShift);
+// --------------------------------------------------------------------------------
+
+static void BM_StdOfstream(benchmark::State& state) {
+    std::ofstream os(CSLT_BENCH_NULL_DEVICE);
+    os.precision(6);
+    os << std::fixed;
+    long i = 0;
+    for (auto _ : state) {
+        os << "request id=" << i << " status=" << 200 << " bytes=" << i * 37
+           << " seconds=" << seconds_taken << '\n';
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StdOfstream);
+// --------------------------------------------------------------------------------
+
+static void BM_Fprintf(benchmark::State& state) {
+    std::FILE* sink = std::fopen(CSLT_BENCH_NULL_DEVICE, "w");
+    long i = 0;
+    for (auto _ : state) {
+        std::fprintf(sink, "request id=%ld status=%d bytes=%ld seconds=%.6f\n",
+                     i, 200, i * 37, seconds_taken);
+        ++i;
+    }
+    std::fclose(sink);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Fprintf);
+// ================================================================================
+// ================================================================================
+// CONVERSION BENCHMARKS
+
+static void BM_ToCharsInteger(benchmark::State& state) {
+    char text[cslt::max_integer_chars];
+    std::uint64_t value = 1234567;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cslt::to_chars(text, text + sizeof(text), value).ptr);
+        value += 7919;
+    }
+}
+BENCHMARK(BM_ToCharsInteger);
+// --------------------------------------------------------------------------------
+
+static void BM_SnprintfInteger(benchmark::State& state) {
+    char text[cslt::max_integer_chars + 1];
+    unsigned long long value = 1234567;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::snprintf(text, sizeof(text), "%llu", value));
+        value += 7919;
+    }
+}
+BENCHMARK(BM_SnprintfInteger);
+// --------------------------------------------------------------------------------
+
+static void BM_ToCharsFixed(benchmark::State& state) {
+    char text[cslt::max_double_chars];
+    double value = 0.0123456;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cslt::to_chars(text, text + sizeof(text), value, 6).ptr);
+        value += 1.25;
+    }
+}
+BENCHMARK(BM_ToCharsFixed);
+// --------------------------------------------------------------------------------
+
+static void BM_SnprintfFixed(benchmark::State& state) {
+    char text[cslt::max_double_chars];
+    double value = 0.0123456;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::snprintf(text, sizeof(text), "%.6f", value));
+        value += 1.25;
+    }
+}
+BENCHMARK(BM_SnprintfFixed);
+// ================================================================================
+// ================================================================================
+// eof
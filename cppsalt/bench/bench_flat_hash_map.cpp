@@ -0,0 +1,195 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_flat_hash_map.cpp
+// - Purpose: This file implements google benchmark cases for flat_hash_map.hpp,
+//            each paired with std::unordered_map
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../include/flat_hash_map.hpp"
+#include "../include/string.hpp"
+
+// Lookups run from 1e3 entries, which stay in cache, to 1e8 entries, which
+// need several gigabytes for the std::unordered_map case
+#define MAP_SIZES RangeMultiplier(10)->Range(1000, 100000000)->Unit(benchmark::kNanosecond)
+
+// Distinct keys in a shuffled order, so that neither the insertion nor the
+// lookup order follows the memory layout
+static std::vector<std::uint64_t> make_keys(std::size_t count) {
+    std::vector<std::uint64_t> keys(count);
+    std::mt19937_64 gen(12345);
+    for (std::size_t i = 0; i < count; ++i)
+        keys[i] = (static_cast<std::uint64_t>(i) << 20) ^ (gen() & 0xFFFFF);
+    std::shuffle(keys.begin(), keys.end(), gen);
+    return keys;
+}
+
+static std::vector<std::string> make_names(std::size_t count) {
+    std::vector<std::string> names(count);
+    for (std::size_t i = 0; i < count; ++i)
+        names[i] = "service.endpoint.request_counter." + std::to_string(i * 7919);
+    return names;
+}
+// ================================================================================
+// ================================================================================
+// LOOKUP BENCHMARKS
+
+static void BM_FlatHashMapFind(benchmark::State& state) {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::uint64_t> keys = make_keys(count);
+    cslt::flat_hash_map<std::uint64_t, std::uint64_t> map;
+    map.reserve(count);
+    for (std::uint64_t key : keys)
+        map[key] = key;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(keys[i])->second);
+        if (++i == count)
+            i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FlatHashMapFind)->MAP_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StdUnorderedMapFind(benchmark::State& state) {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::uint64_t> keys = make_keys(count);
+    std::unordered_map<std::uint64_t, std::uint64_t> map;
+    map.reserve(count);
+    for (std::uint64_t key : keys)
+        map[key] = key;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(keys[i])->second);
+        if (++i == count)
+            i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StdUnorderedMapFind)->MAP_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_FlatHashMapFindMiss(benchmark::State& state) {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::uint64_t> keys = make_keys(count);
+    cslt::flat_hash_map<std::uint64_t, std::uint64_t> map;
+    map.reserve(count);
+    for (std::uint64_t key : keys)
+        map[key] = key;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        // The low 20 bits of a stored key never exceed 0xFFFFF
+        benchmark::DoNotOptimize(map.find(keys[i] | (std::uint64_t(1) << 63)) == map.end());
+        if (++i == count)
+            i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FlatHashMapFindMiss)->MAP_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StdUnorderedMapFindMiss(benchmark::State& state) {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::uint64_t> keys = make_keys(count);
+    std::unordered_map<std::uint64_t, std::uint64_t> map;
+    map.reserve(count);
+    for (std::uint64_t key : keys)
+        map[key] = key;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(keys[i] | (std::uint64_t(1) << 63)) == map.end());
+        if (++i == count)
+            i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StdUnorderedMapFindMiss)->MAP_SIZES;
+// ================================================================================
+// ================================================================================
+// INSERT BENCHMARKS
+
+static void BM_FlatHashMapInsert(benchmark::State& state) {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::uint64_t> keys = make_keys(count);
+    for (auto _ : state) {
+        cslt::flat_hash_map<std::uint64_t, std::uint64_t> map;
+        for (std::uint64_t key : keys)
+            map[key] = key;
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_FlatHashMapInsert)->RangeMultiplier(10)->Range(1000, 1000000);
+// --------------------------------------------------------------------------------
+
+static void BM_StdUnorderedMapInsert(benchmark::State& state) {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::uint64_t> keys = make_keys(count);
+    for (auto _ : state) {
+        std::unordered_map<std::uint64_t, std::uint64_t> map;
+        for (std::uint64_t key : keys)
+            map[key] = key;
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_StdUnorderedMapInsert)->RangeMultiplier(10)->Range(1000, 1000000);
+// ================================================================================
+// ================================================================================
+// STRING KEY BENCHMARKS
+//
+// Lookups are made with a const char*, as they would be with a key parsed out
+// of a request.  The std:: map must build a std::string for each one.
+
+static void BM_FlatHashMapFindCharPointer(benchmark::State& state) {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::string> names = make_names(count);
+    cslt::flat_hash_map<cslt::String, std::size_t> map;
+    map.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        map[cslt::String(names[i].c_str())] = i;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(names[i].c_str())->second);
+        if (++i == count)
+            i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FlatHashMapFindCharPointer)->RangeMultiplier(10)->Range(1000, 1000000);
+// --------------------------------------------------------------------------------
+
+static void BM_StdUnorderedMapFindCharPointer(benchmark::State& state) {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::string> names = make_names(count);
+    std::unordered_map<std::string, std::size_t> map;
+    map.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        map[names[i]] = i;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(names[i].c_str())->second);
+        if (++i == count)
+            i = 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StdUnorderedMapFindCharPointer)->RangeMultiplier(10)->Range(1000, 1000000);
+// ================================================================================
+// ================================================================================
+// eof
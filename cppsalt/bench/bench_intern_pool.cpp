@@ -0,0 +1,184 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_intern_pool.cpp
+// - Purpose: This file implements google benchmark cases for intern_pool.hpp,
+//            each paired with the same work on String and std::string keys
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../include/flat_hash_map.hpp"
+#include "../include/intern_pool.hpp"
+#include "../include/string.hpp"
+#include "../include/vec.hpp"
+
+// A few thousand labels, each used by many records in a random order
+static const std::size_t label_count = 4096;
+static const std::size_t record_count = 1 << 16;
+
+static std::vector<std::string> make_labels() {
+    std::vector<std::string> labels(label_count);
+    for (std::size_t i = 0; i < label_count; ++i)
+        labels[i] = "service.route.request_latency." + std::to_string(i * 7919);
+    return labels;
+}
+
+static std::vector<cslt::string_view> make_views(const std::vector<std::string>& labels) {
+    std::vector<cslt::string_view> views;
+    for (const std::string& label : labels)
+        views.push_back(cslt::string_view(label.data(), label.size()));
+    return views;
+}
+
+static std::vector<std::size_t> make_order() {
+    std::vector<std::size_t> order(record_count);
+    std::mt19937_64 gen(12345);
+    for (std::size_t& index : order)
+        index = static_cast<std::size_t>(gen() % label_count);
+    return order;
+}
+// ================================================================================
+// ================================================================================
+// MAP LOOKUP BENCHMARKS: one lookup per record, keyed by label
+
+static void BM_StringKeyLookup(benchmark::State& state) {
+    const std::vector<std::string> labels = make_labels();
+    cslt::flat_hash_map<cslt::String, int> map;
+    for (std::size_t i = 0; i < label_count; ++i)
+        map[cslt::String(labels[i].c_str())] = static_cast<int>(i);
+    cslt::vector<cslt::String> records;
+    for (std::size_t index : make_order())
+        records.push_back(cslt::String(labels[index].c_str()));
+    cslt::size_t bytes = 0;
+    for (const cslt::String& key : records)
+        bytes += sizeof(cslt::String) + key.memory();
+    for (auto _ : state) {
+        long sum = 0;
+        for (const cslt::String& key : records)
+            sum += map.find(key)->second;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * record_count);
+    state.counters["key_bytes"] = static_cast<double>(bytes);
+}
+BENCHMARK(BM_StringKeyLookup);
+// --------------------------------------------------------------------------------
+
+static void BM_InternedKeyLookup(benchmark::State& state) {
+    const std::vector<std::string> labels = make_labels();
+    cslt::intern_pool pool;
+    cslt::flat_hash_map<cslt::interned_string, int> map;
+    for (std::size_t i = 0; i < label_count; ++i)
+        map[pool.intern(labels[i].c_str())] = static_cast<int>(i);
+    cslt::vector<cslt::interned_string> records;
+    for (std::size_t index : make_order())
+        records.push_back(pool.intern(labels[index].c_str()));
+    for (auto _ : state) {
+        long sum = 0;
+        for (cslt::interned_string key : records)
+            sum += map.find(key)->second;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * record_count);
+    state.counters["key_bytes"] = static_cast<double>(records.size() * sizeof(cslt::interned_string) + pool.memory());
+}
+BENCHMARK(BM_InternedKeyLookup);
+// --------------------------------------------------------------------------------
+
+static void BM_StdStringKeyLookup(benchmark::State& state) {
+    const std::vector<std::string> labels = make_labels();
+    std::unordered_map<std::string, int> map;
+    for (std::size_t i = 0; i < label_count; ++i)
+        map[labels[i]] = static_cast<int>(i);
+    std::vector<std::string> records;
+    for (std::size_t index : make_order())
+        records.push_back(labels[index]);
+    for (auto _ : state) {
+        long sum = 0;
+        for (const std::string& key : records)
+            sum += map.find(key)->second;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * record_count);
+}
+BENCHMARK(BM_StdStringKeyLookup);
+// ================================================================================
+// ================================================================================
+// EQUALITY BENCHMARKS: count the records whose label matches the one before
+
+static void BM_StringEquality(benchmark::State& state) {
+    const std::vector<std::string> labels = make_labels();
+    cslt::vector<cslt::String> records;
+    for (std::size_t index : make_order())
+        records.push_back(cslt::String(labels[index % 4].c_str()));
+    for (auto _ : state) {
+        int same = 0;
+        for (cslt::size_t i = 1; i < records.size(); ++i)
+            same += records[i] == records[i - 1];
+        benchmark::DoNotOptimize(same);
+    }
+    state.SetItemsProcessed(state.iterations() * record_count);
+}
+BENCHMARK(BM_StringEquality);
+// --------------------------------------------------------------------------------
+
+static void BM_InternedEquality(benchmark::State& state) {
+    const std::vector<std::string> labels = make_labels();
+    cslt::intern_pool pool;
+    cslt::vector<cslt::interned_string> records;
+    for (std::size_t index : make_order())
+        records.push_back(pool.intern(labels[index % 4].c_str()));
+    for (auto _ : state) {
+        int same = 0;
+        for (cslt::size_t i = 1; i < records.size(); ++i)
+            same += records[i] == records[i - 1];
+        benchmark::DoNotOptimize(same);
+    }
+    state.SetItemsProcessed(state.iterations() * record_count);
+}
+BENCHMARK(BM_InternedEquality);
+// ================================================================================
+// ================================================================================
+// INTERN BENCHMARKS: turn incoming text into handles for labels already seen
+
+static cslt::intern_pool shared_pool;
+
+static void BM_InternPresent(benchmark::State& state) {
+    const std::vector<std::string> labels = make_labels();
+    const std::vector<cslt::string_view> views = make_views(labels);
+    if (state.thread_index() == 0)
+        shared_pool.seed(views.begin(), views.end());
+    const std::vector<std::size_t> order = make_order();
+    std::size_t i = static_cast<std::size_t>(state.thread_index()) * 977;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(shared_pool.intern(views[order[i++ % record_count]]));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_InternPresent)->Threads(1)->Threads(4);
+// --------------------------------------------------------------------------------
+
+static void BM_SeedPool(benchmark::State& state) {
+    const std::vector<std::string> labels = make_labels();
+    const std::vector<cslt::string_view> views = make_views(labels);
+    for (auto _ : state) {
+        cslt::intern_pool pool;
+        pool.seed(views.begin(), views.end());
+        benchmark::DoNotOptimize(pool.size());
+    }
+    state.SetItemsProcessed(state.iterations() * label_count);
+}
+BENCHMARK(BM_SeedPool);
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,124 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_line_reader.cpp
+// - Purpose: This file implements google benchmark cases for line_reader.hpp,
+//            each paired with std::getline over the same text
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include <string>
+#include "../include/line_reader.hpp"
+
+// 64 MiB of CSV records between 20 and 120 characters long
+static const std::string& csv_text() {
+    static const std::string text = [] {
+        std::string out;
+        out.reserve(64u << 20);
+        for (unsigned i = 0; out.size() < (64u << 20); ++i) {
+            out += std::to_string(i) + ",2024-01-01," + std::string(10 + (i * 7919) % 90, 'v') + ",ok\n";
+        }
+        return out;
+    }();
+    return text;
+}
+// ================================================================================
+// ================================================================================
+// LINE SPLITTING BENCHMARKS
+
+static void BM_LineReaderMemory(benchmark::State& state) {
+    const std::string& text = csv_text();
+    for (auto _ : state) {
+        cslt::line_reader reader(cslt::string_view(text.data(), text.size()));
+        cslt::size_t total = 0;
+        reader.for_each([&total](cslt::string_view record) {total += record.size();});
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+BENCHMARK(BM_LineReaderMemory)->Unit(benchmark::kMillisecond);
+// --------------------------------------------------------------------------------
+
+static void BM_LineReaderStream(benchmark::State& state) {
+    const std::string& text = csv_text();
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::istringstream in(text);
+        state.ResumeTiming();
+        cslt::line_reader reader(in);
+        cslt::size_t total = 0;
+        reader.for_each([&total](cslt::string_view record) {total += record.size();});
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+BENCHMARK(BM_LineReaderStream)->Unit(benchmark::kMillisecond);
+// --------------------------------------------------------------------------------
+
+static void BM_StdGetline(benchmark::State& state) {
+    const std::string& text = csv_text();
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::istringstream in(text);
+        state.ResumeTiming();
+        std::string line;
+        cslt::size_t total = 0;
+        while (std::getline(in, line))
+            total += line.size();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+BENCHMARK(BM_StdGetline)->Unit(benchmark::kMillisecond);
+// ================================================================================
+// ================================================================================
+// FIELD SPLITTING BENCHMARKS
+
+static void BM_LineReaderSplitFields(benchmark::State& state) {
+    const std::string& text = csv_text();
+    for (auto _ : state) {
+        cslt::line_reader reader(cslt::string_view(text.data(), text.size()));
+        cslt::string_view fields[4];
+        cslt::size_t total = 0;
+        reader.for_each([&](cslt::string_view record) {
+            cslt::split_fields(record, ',', fields, 4);
+            total += fields[2].size();
+        });
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+BENCHMARK(BM_LineReaderSplitFields)->Unit(benchmark::kMillisecond);
+// --------------------------------------------------------------------------------
+
+static void BM_StdGetlineSplitFields(benchmark::State& state) {
+    const std::string& text = csv_text();
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::istringstream in(text);
+        state.ResumeTiming();
+        std::string line;
+        std::string fields[4];
+        cslt::size_t total = 0;
+        while (std::getline(in, line)) {
+            std::istringstream record(line);
+            for (std::string& field : fields)
+                std::getline(record, field, ',');
+            total += fields[2].size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+BENCHMARK(BM_StdGetlineSplitFields)->Unit(benchmark::kMillisecond);
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,162 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_parallel_algorithm.cpp
+// - Purpose: This file implements google benchmark cases for parallel_algorithm.hpp,
+//            sweeping element counts and thread counts against the serial std
+//            algorithms
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include "../include/parallel_algorithm.hpp"
+#include "../include/vec.hpp"
+
+// Each case takes range(0) elements and range(1) workers
+static void sweep(benchmark::internal::Benchmark* bench) {
+    for (int64_t count : {1 << 16, 1 << 20, 1 << 23})
+        for (int64_t threads : {1, 2, 4, 8})
+            bench->Args({count, threads});
+}
+
+static void serial_sweep(benchmark::internal::Benchmark* bench) {
+    for (int64_t count : {1 << 16, 1 << 20, 1 << 23})
+        bench->Args({count});
+}
+
+static cslt::vector<std::uint64_t> random_keys(cslt::size_t num) {
+    std::mt19937_64 engine(42);
+    cslt::vector<std::uint64_t> keys;
+    for (cslt::size_t i = 0; i < num; ++i)
+        keys.push_back(engine());
+    return keys;
+}
+// ================================================================================
+// ================================================================================
+// SORT BENCHMARKS
+
+static void BM_ParSort(benchmark::State& state) {
+    const cslt::vector<std::uint64_t> source = random_keys(static_cast<cslt::size_t>(state.range(0)));
+    cslt::thread_pool pool(static_cast<cslt::size_t>(state.range(1)));
+    cslt::par::policy p;
+    p.pool = &pool;
+    cslt::vector<std::uint64_t> keys;
+    for (auto _ : state) {
+        state.PauseTiming();
+        keys = source;
+        state.ResumeTiming();
+        cslt::par::sort(keys, std::less<>(), p);
+        benchmark::DoNotOptimize(keys.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParSort)->Apply(sweep)->UseRealTime()->Unit(benchmark::kMillisecond);
+// --------------------------------------------------------------------------------
+
+static void BM_ParRadixSort(benchmark::State& state) {
+    const cslt::vector<std::uint64_t> source = random_keys(static_cast<cslt::size_t>(state.range(0)));
+    cslt::thread_pool pool(static_cast<cslt::size_t>(state.range(1)));
+    cslt::par::policy p;
+    p.pool = &pool;
+    cslt::vector<std::uint64_t> keys;
+    for (auto _ : state) {
+        state.PauseTiming();
+        keys = source;
+        state.ResumeTiming();
+        cslt::par::radix_sort(keys, p);
+        benchmark::DoNotOptimize(keys.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParRadixSort)->Apply(sweep)->UseRealTime()->Unit(benchmark::kMillisecond);
+// --------------------------------------------------------------------------------
+
+static void BM_StdSort(benchmark::State& state) {
+    const cslt::vector<std::uint64_t> source = random_keys(static_cast<cslt::size_t>(state.range(0)));
+    cslt::vector<std::uint64_t> keys;
+    for (auto _ : state) {
+        state.PauseTiming();
+        keys = source;
+        state.ResumeTiming();
+        std::sort(keys.begin(), keys.end());
+        benchmark::DoNotOptimize(keys.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdSort)->Apply(serial_sweep)->UseRealTime()->Unit(benchmark::kMillisecond);
+// ================================================================================
+// ================================================================================
+// REDUCE AND SCAN BENCHMARKS
+
+static void BM_ParReduce(benchmark::State& state) {
+    const cslt::size_t num = static_cast<cslt::size_t>(state.range(0));
+    cslt::vector<double> values;
+    for (cslt::size_t i = 0; i < num; ++i)
+        values.push_back(static_cast<double>(i % 1000) * 0.5);
+    cslt::thread_pool pool(static_cast<cslt::size_t>(state.range(1)));
+    cslt::par::policy p;
+    p.pool = &pool;
+    p.deterministic = true;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cslt::par::reduce(values, 0.0, std::plus<>(), p));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(double)));
+}
+BENCHMARK(BM_ParReduce)->Apply(sweep)->UseRealTime();
+// --------------------------------------------------------------------------------
+
+static void BM_StdAccumulate(benchmark::State& state) {
+    const cslt::size_t num = static_cast<cslt::size_t>(state.range(0));
+    cslt::vector<double> values;
+    for (cslt::size_t i = 0; i < num; ++i)
+        values.push_back(static_cast<double>(i % 1000) * 0.5);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::accumulate(values.begin(), values.end(), 0.0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(double)));
+}
+BENCHMARK(BM_StdAccumulate)->Apply(serial_sweep)->UseRealTime();
+// --------------------------------------------------------------------------------
+
+static void BM_ParInclusiveScan(benchmark::State& state) {
+    const cslt::size_t num = static_cast<cslt::size_t>(state.range(0));
+    cslt::vector<std::int64_t> values;
+    for (cslt::size_t i = 0; i < num; ++i)
+        values.push_back(static_cast<std::int64_t>(i % 13));
+    cslt::array_ptr<std::int64_t> out(num);
+    cslt::thread_pool pool(static_cast<cslt::size_t>(state.range(1)));
+    cslt::par::policy p;
+    p.pool = &pool;
+    for (auto _ : state) {
+        cslt::par::inclusive_scan(values, out, std::plus<>(), p);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(std::int64_t)));
+}
+BENCHMARK(BM_ParInclusiveScan)->Apply(sweep)->UseRealTime();
+// --------------------------------------------------------------------------------
+
+static void BM_StdPartialSum(benchmark::State& state) {
+    const cslt::size_t num = static_cast<cslt::size_t>(state.range(0));
+    cslt::vector<std::int64_t> values;
+    for (cslt::size_t i = 0; i < num; ++i)
+        values.push_back(static_cast<std::int64_t>(i % 13));
+    cslt::array_ptr<std::int64_t> out(num);
+    for (auto _ : state) {
+        std::partial_sum(values.begin(), values.end(), out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(std::int64_t)));
+}
+BENCHMARK(BM_StdPartialSum)->Apply(serial_sweep)->UseRealTime();
+// ================================================================================
+// ================================================================================
+// eof
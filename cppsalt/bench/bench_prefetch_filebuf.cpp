@@ -0,0 +1,135 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_prefetch_filebuf.cpp
+// - Purpose: This file implements google benchmark cases for prefetch_filebuf.hpp,
+//            each paired with std::ifstream doing the same reads and work
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+#include "../include/prefetch_filebuf.hpp"
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+static const char bench_path[] = "cslt_bench_prefetch.dat";
+static const std::size_t file_size = 64u << 20;
+static const std::size_t block_size = 1u << 20;
+
+// Writes the file once; each read then starts from a cold page cache where
+// the system allows it, so the reads wait on the disk
+static void prepare_file() {
+    static const bool written = [] {
+        std::vector<char> data(file_size);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<char>('a' + i % 26);
+        std::ofstream out(bench_path, std::ios::binary);
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+        return true;
+    }();
+    (void)written;
+#if !defined(_WIN32) && defined(POSIX_FADV_DONTNEED)
+    const int fd = ::open(bench_path, O_RDONLY);
+    if (fd >= 0) {
+        ::fdatasync(fd);
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+#endif
+}
+
+// Parsing stand in: a dependent hash over every byte, a few cycles each
+static std::uint64_t work(const char* data, std::size_t num, std::uint64_t hash) {
+    for (std::size_t i = 0; i < num; ++i)
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ull;
+    return hash;
+}
+// ================================================================================
+// ================================================================================
+// READ AND WORK BENCHMARKS
+//
+// The read-ahead thread overlaps the reads with the work only when it has a
+// core of its own; on a single core both cases take the sum of the two.
+
+static void BM_PrefetchFilebufWork(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        prepare_file();
+        state.ResumeTiming();
+        cslt::prefetch_filebuf buf(bench_path, block_size, static_cast<cslt::size_t>(state.range(0)));
+        std::uint64_t hash = 14695981039346656037ull;
+        for (cslt::span<const char> block = buf.next_block(); !block.empty(); block = buf.next_block())
+            hash = work(block.data(), block.size(), hash);
+        benchmark::DoNotOptimize(hash);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(file_size));
+}
+BENCHMARK(BM_PrefetchFilebufWork)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
+// --------------------------------------------------------------------------------
+
+static void BM_StdIfstreamWork(benchmark::State& state) {
+    std::vector<char> block(block_size);
+    for (auto _ : state) {
+        state.PauseTiming();
+        prepare_file();
+        state.ResumeTiming();
+        std::ifstream in(bench_path, std::ios::binary);
+        std::uint64_t hash = 14695981039346656037ull;
+        while (in.read(block.data(), static_cast<std::streamsize>(block.size())) || in.gcount() > 0)
+            hash = work(block.data(), static_cast<std::size_t>(in.gcount()), hash);
+        benchmark::DoNotOptimize(hash);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(file_size));
+}
+BENCHMARK(BM_StdIfstreamWork)->Unit(benchmark::kMillisecond)->UseRealTime();
+// ================================================================================
+// ================================================================================
+// READ ONLY BENCHMARKS, where read-ahead has nothing to overlap with
+
+static void BM_PrefetchFilebufRead(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        prepare_file();
+        state.ResumeTiming();
+        cslt::prefetch_filebuf buf(bench_path, block_size);
+        std::size_t total = 0;
+        for (cslt::span<const char> block = buf.next_block(); !block.empty(); block = buf.next_block())
+            total += block.size();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(file_size));
+}
+BENCHMARK(BM_PrefetchFilebufRead)->Unit(benchmark::kMillisecond)->UseRealTime();
+// --------------------------------------------------------------------------------
+
+static void BM_StdIfstreamRead(benchmark::State& state) {
+    std::vector<char> block(block_size);
+    for (auto _ : state) {
+        state.PauseTiming();
+        prepare_file();
+        state.ResumeTiming();
+        std::ifstream in(bench_path, std::ios::binary);
+        std::size_t total = 0;
+        while (in.read(block.data(), static_cast<std::streamsize>(block.size())) || in.gcount() > 0)
+            total += static_cast<std::size_t>(in.gcount());
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(file_size));
+}
+BENCHMARK(BM_StdIfstreamRead)->Unit(benchmark::kMillisecond)->UseRealTime();
+// ================================================================================
+// ================================================================================
+// eof
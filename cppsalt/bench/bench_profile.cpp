@@ -0,0 +1,100 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_profile.cpp
+// - Purpose: This file implements google benchmark cases for profile.hpp,
+//            measuring what a probe adds to the code it times
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdint>
+#include "../include/profile.hpp"
+// ================================================================================
+// ================================================================================
+// CLOCK BENCHMARKS
+
+static void BM_ProfileTicks(benchmark::State& state) {
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cslt::profile::ticks());
+}
+BENCHMARK(BM_ProfileTicks);
+// --------------------------------------------------------------------------------
+
+static void BM_SteadyClockNow(benchmark::State& state) {
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::chrono::steady_clock::now());
+}
+BENCHMARK(BM_SteadyClockNow);
+// ================================================================================
+// ================================================================================
+// RECORDING BENCHMARKS
+
+// Both clock readings and the histogram update; nothing when CSLT_PROFILE is 0
+static void BM_ProfileScopedTimer(benchmark::State& state) {
+    const cslt::profile::probe_id id = cslt::profile::register_probe("bench.timer");
+    for (auto _ : state) {
+        cslt::profile::scoped_timer timer(id);
+        benchmark::ClobberMemory();
+    }
+    state.SetLabel(cslt::profile::enabled ? "enabled" : "disabled");
+}
+BENCHMARK(BM_ProfileScopedTimer);
+// --------------------------------------------------------------------------------
+
+static void BM_ProfileScopeMacro(benchmark::State& state) {
+    for (auto _ : state) {
+        CSLT_PROFILE_SCOPE("bench.macro");
+        benchmark::ClobberMemory();
+    }
+    state.SetLabel(cslt::profile::enabled ? "enabled" : "disabled");
+}
+BENCHMARK(BM_ProfileScopeMacro);
+// --------------------------------------------------------------------------------
+
+// The same measurement made by hand with steady_clock into a local histogram
+static void BM_SteadyClockHistogram(benchmark::State& state) {
+    cslt::profile::histogram h;
+    for (auto _ : state) {
+        const auto start = std::chrono::steady_clock::now();
+        benchmark::ClobberMemory();
+        const auto stop = std::chrono::steady_clock::now();
+        h.record(static_cast<std::uint64_t>((stop - start).count()));
+    }
+    benchmark::DoNotOptimize(h.count());
+}
+BENCHMARK(BM_SteadyClockHistogram);
+// --------------------------------------------------------------------------------
+
+static void BM_HistogramRecord(benchmark::State& state) {
+    cslt::profile::histogram h;
+    std::uint64_t value = 1;
+    for (auto _ : state) {
+        h.record(value);
+        value = value * 5 % 100003;
+    }
+    benchmark::DoNotOptimize(h.count());
+}
+BENCHMARK(BM_HistogramRecord);
+// ================================================================================
+// ================================================================================
+// REPORT BENCHMARKS
+
+static void BM_ProfilePercentile(benchmark::State& state) {
+    cslt::profile::histogram h;
+    for (std::uint64_t value = 1; value < 100000; value += 7)
+        h.record(value);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(h.percentile(99.9));
+}
+BENCHMARK(BM_ProfilePercentile);
+// ================================================================================
+// ================================================================================
+// eof
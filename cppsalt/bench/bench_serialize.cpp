@@ -0,0 +1,208 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_serialize.cpp
+// - Purpose: This file implements google benchmark cases for serialize.hpp,
+//            each paired with the same data written through std::ostringstream
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../include/serialize.hpp"
+// ================================================================================
+// ================================================================================
+// NUMERIC ARRAY BENCHMARKS: Arg doubles
+
+static cslt::vector<double> make_values(cslt::size_t count) {
+    cslt::vector<double> values(count);
+    for (cslt::size_t i = 0; i < count; ++i)
+        values.push_back(static_cast<double>(i) * 0.37);
+    return values;
+}
+// --------------------------------------------------------------------------------
+
+static void BM_SerializeDoubles(benchmark::State& state) {
+    const cslt::vector<double> values = make_values(static_cast<cslt::size_t>(state.range(0)));
+    for (auto _ : state) {
+        cslt::vector<char> bytes = cslt::serialize(values);
+        benchmark::DoNotOptimize(bytes.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * 8);
+}
+BENCHMARK(BM_SerializeDoubles)->Arg(1 << 10)->Arg(1 << 16);
+// --------------------------------------------------------------------------------
+
+static void BM_OstringstreamDoubles(benchmark::State& state) {
+    const cslt::vector<double> values = make_values(static_cast<cslt::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::ostringstream out;
+        out.precision(17);
+        out << values.size();
+        for (double value : values)
+            out << ' ' << value;
+        std::string text = out.str();
+        benchmark::DoNotOptimize(text.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * 8);
+}
+BENCHMARK(BM_OstringstreamDoubles)->Arg(1 << 10)->Arg(1 << 16);
+// --------------------------------------------------------------------------------
+
+static void BM_DeserializeDoubles(benchmark::State& state) {
+    const cslt::vector<char> bytes = cslt::serialize(make_values(static_cast<cslt::size_t>(state.range(0))));
+    for (auto _ : state) {
+        cslt::vector<double> values = cslt::deserialize<cslt::vector<double>>(bytes);
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * 8);
+}
+BENCHMARK(BM_DeserializeDoubles)->Arg(1 << 10)->Arg(1 << 16);
+// --------------------------------------------------------------------------------
+
+static void BM_ViewDoubles(benchmark::State& state) {
+    const cslt::vector<char> bytes = cslt::serialize(make_values(static_cast<cslt::size_t>(state.range(0))));
+    for (auto _ : state) {
+        cslt::span<const double> values = cslt::deserialize_view<cslt::vector<double>>(bytes);
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * 8);
+}
+BENCHMARK(BM_ViewDoubles)->Arg(1 << 10)->Arg(1 << 16);
+// --------------------------------------------------------------------------------
+
+static void BM_IstringstreamDoubles(benchmark::State& state) {
+    const cslt::vector<double> source = make_values(static_cast<cslt::size_t>(state.range(0)));
+    std::ostringstream out;
+    out.precision(17);
+    out << source.size();
+    for (double value : source)
+        out << ' ' << value;
+    const std::string text = out.str();
+    for (auto _ : state) {
+        std::istringstream in(text);
+        std::size_t count = 0;
+        in >> count;
+        std::vector<double> values(count);
+        for (double& value : values)
+            in >> value;
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * 8);
+}
+BENCHMARK(BM_IstringstreamDoubles)->Arg(1 << 10)->Arg(1 << 16);
+// ================================================================================
+// ================================================================================
+// RECORD BENCHMARKS: 4096 pairs of a name and a short vector of doubles
+
+using record = cslt::pair<cslt::String, cslt::vector<double>>;
+static const cslt::size_t records = 4096;
+
+static cslt::vector<record> make_records() {
+    cslt::vector<record> rows(records);
+    for (cslt::size_t i = 0; i < records; ++i) {
+        cslt::vector<double> values(4);
+        for (cslt::size_t j = 0; j < i % 5; ++j)
+            values.push_back(static_cast<double>(i + j));
+        rows.push_back(record(cslt::String(std::to_string(i * 7919).c_str()), cslt::move(values)));
+    }
+    return rows;
+}
+// --------------------------------------------------------------------------------
+
+static void write_text(std::ostringstream& out, const cslt::vector<record>& rows) {
+    out.precision(17);
+    out << rows.size() << '\n';
+    for (const record& row : rows) {
+        out << row.first.c_string() << ' ' << row.second.size();
+        for (double value : row.second)
+            out << ' ' << value;
+        out << '\n';
+    }
+}
+// --------------------------------------------------------------------------------
+
+static void BM_SerializeRecords(benchmark::State& state) {
+    const cslt::vector<record> rows = make_records();
+    for (auto _ : state) {
+        cslt::vector<char> bytes = cslt::serialize(rows);
+        benchmark::DoNotOptimize(bytes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * records);
+}
+BENCHMARK(BM_SerializeRecords);
+// --------------------------------------------------------------------------------
+
+static void BM_OstringstreamRecords(benchmark::State& state) {
+    const cslt::vector<record> rows = make_records();
+    for (auto _ : state) {
+        std::ostringstream out;
+        write_text(out, rows);
+        std::string text = out.str();
+        benchmark::DoNotOptimize(text.data());
+    }
+    state.SetItemsProcessed(state.iterations() * records);
+}
+BENCHMARK(BM_OstringstreamRecords);
+// --------------------------------------------------------------------------------
+
+static void BM_DeserializeRecords(benchmark::State& state) {
+    const cslt::vector<char> bytes = cslt::serialize(make_records());
+    for (auto _ : state) {
+        cslt::vector<record> rows = cslt::deserialize<cslt::vector<record>>(bytes);
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetItemsProcessed(state.iterations() * records);
+}
+BENCHMARK(BM_DeserializeRecords);
+// --------------------------------------------------------------------------------
+
+// Visits every name and value through the view, so the whole buffer is read
+static void BM_ViewRecords(benchmark::State& state) {
+    const cslt::vector<char> bytes = cslt::serialize(make_records());
+    for (auto _ : state) {
+        double sum = 0.0;
+        for (const auto& row : cslt::deserialize_view<cslt::vector<record>>(bytes)) {
+            sum += static_cast<double>(row.first.size());
+            for (double value : row.second)
+                sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * records);
+}
+BENCHMARK(BM_ViewRecords);
+// --------------------------------------------------------------------------------
+
+static void BM_IstringstreamRecords(benchmark::State& state) {
+    std::ostringstream out;
+    write_text(out, make_records());
+    const std::string text = out.str();
+    for (auto _ : state) {
+        std::istringstream in(text);
+        std::size_t count = 0;
+        in >> count;
+        std::vector<std::pair<std::string, std::vector<double>>> rows(count);
+        for (auto& row : rows) {
+            std::size_t len = 0;
+            in >> row.first >> len;
+            row.second.resize(len);
+            for (double& value : row.second)
+                in >> value;
+        }
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetItemsProcessed(state.iterations() * records);
+}
+BENCHMARK(BM_IstringstreamRecords);
+// ================================================================================
+// ================================================================================
+// eof
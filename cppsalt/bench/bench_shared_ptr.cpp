@@ -0,0 +1,198 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_shared_ptr.cpp
+// - Purpose: This file implements google benchmark cases for the reference
+//            counted pointers in memory.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <mutex>
+#include "../include/memory.hpp"
+
+// Every thread copies and destroys the same pointer, so all of them contend
+// for the cache line that holds the reference count
+static cslt::shared_ptr<int> shared_target;
+static std::shared_ptr<int> std_target;
+// ================================================================================
+// ================================================================================
+// CONTENTION BENCHMARKS
+
+static void BM_SharedPtrCopyContended(benchmark::State& state) {
+    if (state.thread_index() == 0)
+        shared_target = cslt::make_shared<int>(1);
+    for (auto _ : state) {
+        cslt::shared_ptr<int> copy(shared_target);
+        benchmark::DoNotOptimize(copy);
+    }
+    if (state.thread_index() == 0)
+        shared_target.reset();
+}
+BENCHMARK(BM_SharedPtrCopyContended)->ThreadRange(1, 64)->UseRealTime();
+// --------------------------------------------------------------------------------
+
+static void BM_StdSharedPtrCopyContended(benchmark::State& state) {
+    if (state.thread_index() == 0)
+        std_target = std::make_shared<int>(1);
+    for (auto _ : state) {
+        std::shared_ptr<int> copy(std_target);
+        benchmark::DoNotOptimize(copy);
+    }
+    if (state.thread_index() == 0)
+        std_target.reset();
+}
+BENCHMARK(BM_StdSharedPtrCopyContended)->ThreadRange(1, 64)->UseRealTime();
+// --------------------------------------------------------------------------------
+
+// Each thread copies its own pointer, which measures the cost of the atomic
+// instructions without cache line sharing
+static void BM_SharedPtrCopyPrivate(benchmark::State& state) {
+    cslt::shared_ptr<int> local = cslt::make_shared<int>(1);
+    for (auto _ : state) {
+        cslt::shared_ptr<int> copy(local);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_SharedPtrCopyPrivate)->ThreadRange(1, 64)->UseRealTime();
+// ================================================================================
+// ================================================================================
+// SNAPSHOT BENCHMARKS
+
+static cslt::atomic_shared_ptr<int> atomic_snapshot;
+static cslt::shared_ptr<int> locked_snapshot;
+static std::mutex snapshot_mutex;
+// --------------------------------------------------------------------------------
+
+// Thread 0 publishes a new snapshot on every iteration while the others read
+static void BM_AtomicSharedPtrSnapshot(benchmark::State& state) {
+    if (state.thread_index() == 0)
+        atomic_snapshot.store(cslt::make_shared<int>(0));
+    int version = 0;
+    for (auto _ : state) {
+        if (state.thread_index() == 0 && state.threads() > 1) {
+            atomic_snapshot.store(cslt::make_shared<int>(++version));
+        } else {
+            cslt::shared_ptr<int> snap = atomic_snapshot.load();
+            benchmark::DoNotOptimize(*snap);
+        }
+    }
+    if (state.thread_index() == 0)
+        atomic_snapshot.store(cslt::shared_ptr<int>());
+}
+BENCHMARK(BM_AtomicSharedPtrSnapshot)->ThreadRange(1, 64)->UseRealTime();
+// --------------------------------------------------------------------------------
+
+static void BM_MutexSharedPtrSnapshot(benchmark::State& state) {
+    if (state.thread_index() == 0)
+        locked_snapshot = cslt::make_shared<int>(0);
+    int version = 0;
+    for (auto _ : state) {
+        if (state.thread_index() == 0 && state.threads() > 1) {
+            cslt::shared_ptr<int> next = cslt::make_shared<int>(++version);
+            std::lock_guard<std::mutex> guard(snapshot_mutex);
+            locked_snapshot.swap(next);
+        } else {
+            cslt::shared_ptr<int> snap;
+            {
+                std::lock_guard<std::mutex> guard(snapshot_mutex);
+                snap = locked_snapshot;
+            }
+            benchmark::DoNotOptimize(*snap);
+        }
+    }
+    if (state.thread_index() == 0)
+        locked_snapshot.reset();
+}
+BENCHMARK(BM_MutexSharedPtrSnapshot)->ThreadRange(1, 64)->UseRealTime();
+// ================================================================================
+// ================================================================================
+// SINGLE THREAD BENCHMARKS
+
+static void BM_SharedPtrCopy(benchmark::State& state) {
+    cslt::shared_ptr<int> owner = cslt::make_shared<int>(1);
+    for (auto _ : state) {
+        cslt::shared_ptr<int> copy(owner);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_SharedPtrCopy);
+// --------------------------------------------------------------------------------
+
+static void BM_StdSharedPtrCopy(benchmark::State& state) {
+    std::shared_ptr<int> owner = std::make_shared<int>(1);
+    for (auto _ : state) {
+        std::shared_ptr<int> copy(owner);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_StdSharedPtrCopy);
+// --------------------------------------------------------------------------------
+
+static void BM_SharedPtrReset(benchmark::State& state) {
+    cslt::shared_ptr<int> ptr;
+    for (auto _ : state) {
+        ptr.reset(new int(1));
+        benchmark::DoNotOptimize(ptr);
+    }
+}
+BENCHMARK(BM_SharedPtrReset);
+// --------------------------------------------------------------------------------
+
+static void BM_StdSharedPtrReset(benchmark::State& state) {
+    std::shared_ptr<int> ptr;
+    for (auto _ : state) {
+        ptr.reset(new int(1));
+        benchmark::DoNotOptimize(ptr);
+    }
+}
+BENCHMARK(BM_StdSharedPtrReset);
+// --------------------------------------------------------------------------------
+
+static void BM_MakeShared(benchmark::State& state) {
+    for (auto _ : state) {
+        cslt::shared_ptr<int> ptr = cslt::make_shared<int>(1);
+        benchmark::DoNotOptimize(ptr);
+    }
+}
+BENCHMARK(BM_MakeShared);
+// --------------------------------------------------------------------------------
+
+static void BM_StdMakeShared(benchmark::State& state) {
+    for (auto _ : state) {
+        std::shared_ptr<int> ptr = std::make_shared<int>(1);
+        benchmark::DoNotOptimize(ptr);
+    }
+}
+BENCHMARK(BM_StdMakeShared);
+// --------------------------------------------------------------------------------
+
+static void BM_LocalSharedPtrCopy(benchmark::State& state) {
+    cslt::local_shared_ptr<int> local = cslt::make_local_shared<int>(1);
+    for (auto _ : state) {
+        cslt::local_shared_ptr<int> copy(local);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_LocalSharedPtrCopy);
+// --------------------------------------------------------------------------------
+
+static void BM_WeakPtrLock(benchmark::State& state) {
+    cslt::shared_ptr<int> owner = cslt::make_shared<int>(1);
+    cslt::weak_ptr<int> weak(owner);
+    for (auto _ : state) {
+        cslt::shared_ptr<int> locked = weak.lock();
+        benchmark::DoNotOptimize(locked);
+    }
+}
+BENCHMARK(BM_WeakPtrLock);
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,196 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_simd.cpp
+// - Purpose: This file implements google benchmark cases for simd.hpp, each
+//            paired with a plain loop and with the matching <numeric> or
+//            <algorithm> call
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include "../include/simd.hpp"
+
+// The first argument is a cslt::simd::kernel, the second the element count,
+// from a buffer that sits in L1 to one that spills out of L2
+#define KERNELS_AND_SIZES ArgsProduct({{0, 1, 2, 3, 4}, {4096, 1 << 20}})
+#define SIZES Arg(4096)->Arg(1 << 20)
+
+template <typename T>
+static std::vector<T> make_values(std::size_t len) {
+    std::vector<T> values(len);
+    for (std::size_t i = 0; i < len; ++i)
+        values[i] = static_cast<T>(static_cast<int>(i % 17) - 8);
+    return values;
+}
+
+// Selects the kernel named by the first argument, or skips the run
+static bool use_kernel(benchmark::State& state) {
+    const cslt::simd::kernel k = static_cast<cslt::simd::kernel>(state.range(0));
+    if (!cslt::simd::select_kernel(k)) {
+        state.SkipWithError("kernel not supported");
+        return false;
+    }
+    state.SetLabel(cslt::simd::kernel_name(k));
+    return true;
+}
+// ================================================================================
+// ================================================================================
+// SUM BENCHMARKS
+
+static void BM_SimdSumFloat(benchmark::State& state) {
+    if (!use_kernel(state))
+        return;
+    const std::vector<float> x = make_values<float>(static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cslt::simd::sum(x));
+    state.SetBytesProcessed(state.iterations() * state.range(1) * static_cast<int64_t>(sizeof(float)));
+}
+BENCHMARK(BM_SimdSumFloat)->KERNELS_AND_SIZES;
+// --------------------------------------------------------------------------------
+
+// Without -ffast-math the compiler must add in order and cannot vectorize
+static void BM_LoopSumFloat(benchmark::State& state) {
+    const std::vector<float> x = make_values<float>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        float total = 0.0f;
+        for (float value : x)
+            total += value;
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(float)));
+}
+BENCHMARK(BM_LoopSumFloat)->SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StdAccumulateFloat(benchmark::State& state) {
+    const std::vector<float> x = make_values<float>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::accumulate(x.begin(), x.end(), 0.0f));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(float)));
+}
+BENCHMARK(BM_StdAccumulateFloat)->SIZES;
+// ================================================================================
+// ================================================================================
+// DOT PRODUCT BENCHMARKS; two inputs, so twice the bytes per element
+
+static void BM_SimdDotDouble(benchmark::State& state) {
+    if (!use_kernel(state))
+        return;
+    const std::vector<double> x = make_values<double>(static_cast<std::size_t>(state.range(1)));
+    const std::vector<double> y = make_values<double>(static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cslt::simd::dot(x, y));
+    state.SetBytesProcessed(state.iterations() * state.range(1) * static_cast<int64_t>(2 * sizeof(double)));
+}
+BENCHMARK(BM_SimdDotDouble)->KERNELS_AND_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_LoopDotDouble(benchmark::State& state) {
+    const std::vector<double> x = make_values<double>(static_cast<std::size_t>(state.range(0)));
+    const std::vector<double> y = make_values<double>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        double total = 0.0;
+        for (std::size_t i = 0; i < x.size(); ++i)
+            total += x[i] * y[i];
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(2 * sizeof(double)));
+}
+BENCHMARK(BM_LoopDotDouble)->SIZES;
+// --------------------------------------------------------------------------------
+
+// std::transform_reduce is C++17; inner_product is the C++14 equivalent
+static void BM_StdInnerProductDouble(benchmark::State& state) {
+    const std::vector<double> x = make_values<double>(static_cast<std::size_t>(state.range(0)));
+    const std::vector<double> y = make_values<double>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::inner_product(x.begin(), x.end(), y.begin(), 0.0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(2 * sizeof(double)));
+}
+BENCHMARK(BM_StdInnerProductDouble)->SIZES;
+// ================================================================================
+// ================================================================================
+// AXPY BENCHMARKS; reads x and y and writes y
+
+static void BM_SimdAxpyFloat(benchmark::State& state) {
+    if (!use_kernel(state))
+        return;
+    const std::vector<float> x = make_values<float>(static_cast<std::size_t>(state.range(1)));
+    std::vector<float> y = make_values<float>(static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state) {
+        cslt::simd::axpy(0.5f, x, y);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(1) * static_cast<int64_t>(3 * sizeof(float)));
+}
+BENCHMARK(BM_SimdAxpyFloat)->KERNELS_AND_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StdTransformAxpyFloat(benchmark::State& state) {
+    const std::vector<float> x = make_values<float>(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> y = make_values<float>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::transform(x.begin(), x.end(), y.begin(), y.begin(),
+                       [](float a, float b) {return 0.5f * a + b;});
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(3 * sizeof(float)));
+}
+BENCHMARK(BM_StdTransformAxpyFloat)->SIZES;
+// ================================================================================
+// ================================================================================
+// COUNT BENCHMARKS
+
+static void BM_SimdCountIfInt(benchmark::State& state) {
+    if (!use_kernel(state))
+        return;
+    const std::vector<int> x = make_values<int>(static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cslt::simd::count_if(x, cslt::simd::compare::greater, 3));
+    state.SetBytesProcessed(state.iterations() * state.range(1) * static_cast<int64_t>(sizeof(int)));
+}
+BENCHMARK(BM_SimdCountIfInt)->KERNELS_AND_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StdCountIfInt(benchmark::State& state) {
+    const std::vector<int> x = make_values<int>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::count_if(x.begin(), x.end(), [](int e) {return e > 3;}));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(int)));
+}
+BENCHMARK(BM_StdCountIfInt)->SIZES;
+// ================================================================================
+// ================================================================================
+// MINIMUM BENCHMARKS
+
+static void BM_SimdMinFloat(benchmark::State& state) {
+    if (!use_kernel(state))
+        return;
+    const std::vector<float> x = make_values<float>(static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cslt::simd::min(x));
+    state.SetBytesProcessed(state.iterations() * state.range(1) * static_cast<int64_t>(sizeof(float)));
+}
+BENCHMARK(BM_SimdMinFloat)->KERNELS_AND_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StdMinElementFloat(benchmark::State& state) {
+    const std::vector<float> x = make_values<float>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(*std::min_element(x.begin(), x.end()));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(float)));
+}
+BENCHMARK(BM_StdMinElementFloat)->SIZES;
+// ================================================================================
+// ================================================================================
+// eof
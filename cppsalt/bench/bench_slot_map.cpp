@@ -0,0 +1,261 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_slot_map.cpp
+// - Purpose: This file implements google benchmark cases for slot_map.hpp,
+//            each paired with the same work on shared_ptr nodes and on
+//            std::unordered_map
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "../include/memory.hpp"
+#include "../include/slot_map.hpp"
+
+// A short lived entity, small enough that the cost of reaching it dominates
+namespace {
+    struct entity {
+        float x, y, z;
+        float vx, vy, vz;
+    };
+
+    const std::size_t entity_count = 1 << 16;
+
+    std::vector<std::size_t> make_picks(std::size_t num) {
+        std::vector<std::size_t> picks(num);
+        std::mt19937_64 gen(2026);
+        for (std::size_t& pick : picks)
+            pick = static_cast<std::size_t>(gen() % entity_count);
+        return picks;
+    }
+
+    entity make_entity(std::size_t i) {
+        const float f = static_cast<float>(i);
+        return entity{f, f, f, 1.0f, 0.5f, 0.25f};
+    }
+}
+// ================================================================================
+// ================================================================================
+// FILL BENCHMARKS: create every entity in an empty container
+
+static void BM_SlotMapFill(benchmark::State& state) {
+    const std::size_t num = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        cslt::slot_map<entity> map;
+        for (std::size_t i = 0; i < num; ++i)
+            benchmark::DoNotOptimize(map.insert(make_entity(i)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SlotMapFill)->RangeMultiplier(4)->Range(1 << 12, 1 << 18);
+// --------------------------------------------------------------------------------
+
+static void BM_SharedPtrFill(benchmark::State& state) {
+    const std::size_t num = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        std::vector<cslt::shared_ptr<entity>> entities;
+        for (std::size_t i = 0; i < num; ++i)
+            entities.push_back(cslt::make_shared<entity>(make_entity(i)));
+        benchmark::DoNotOptimize(entities.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SharedPtrFill)->RangeMultiplier(4)->Range(1 << 12, 1 << 18);
+// --------------------------------------------------------------------------------
+
+static void BM_UnorderedMapFill(benchmark::State& state) {
+    const std::size_t num = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        std::unordered_map<std::uint64_t, entity> map;
+        for (std::size_t i = 0; i < num; ++i)
+            map.emplace(static_cast<std::uint64_t>(i), make_entity(i));
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_UnorderedMapFill)->RangeMultiplier(4)->Range(1 << 12, 1 << 18);
+// ================================================================================
+// ================================================================================
+// CHURN BENCHMARKS: destroy a random entity and create a new one
+
+static void BM_SlotMapChurn(benchmark::State& state) {
+    cslt::slot_map<entity> map;
+    std::vector<cslt::slot_handle> handles;
+    for (std::size_t i = 0; i < entity_count; ++i)
+        handles.push_back(map.insert(make_entity(i)));
+    const std::vector<std::size_t> picks = make_picks(entity_count);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const std::size_t pick = picks[i++ % entity_count];
+        map.erase(handles[pick]);
+        handles[pick] = map.insert(make_entity(pick));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SlotMapChurn);
+// --------------------------------------------------------------------------------
+
+static void BM_SharedPtrChurn(benchmark::State& state) {
+    std::vector<cslt::shared_ptr<entity>> entities;
+    for (std::size_t i = 0; i < entity_count; ++i)
+        entities.push_back(cslt::make_shared<entity>(make_entity(i)));
+    const std::vector<std::size_t> picks = make_picks(entity_count);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const std::size_t pick = picks[i++ % entity_count];
+        entities[pick] = cslt::make_shared<entity>(make_entity(pick));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SharedPtrChurn);
+// --------------------------------------------------------------------------------
+
+static void BM_UnorderedMapChurn(benchmark::State& state) {
+    std::unordered_map<std::uint64_t, entity> map;
+    std::vector<std::uint64_t> ids;
+    std::uint64_t next_id = 0;
+    for (std::size_t i = 0; i < entity_count; ++i) {
+        map.emplace(next_id, make_entity(i));
+        ids.push_back(next_id++);
+    }
+    const std::vector<std::size_t> picks = make_picks(entity_count);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const std::size_t pick = picks[i++ % entity_count];
+        map.erase(ids[pick]);
+        map.emplace(next_id, make_entity(pick));
+        ids[pick] = next_id++;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_UnorderedMapChurn);
+// ================================================================================
+// ================================================================================
+// ITERATION BENCHMARKS: advance every entity by one step after heavy churn
+
+static void BM_SlotMapIterate(benchmark::State& state) {
+    cslt::slot_map<entity> map;
+    std::vector<cslt::slot_handle> handles;
+    for (std::size_t i = 0; i < entity_count; ++i)
+        handles.push_back(map.insert(make_entity(i)));
+    for (std::size_t pick : make_picks(entity_count)) {
+        map.erase(handles[pick]);
+        handles[pick] = map.insert(make_entity(pick));
+    }
+    for (auto _ : state) {
+        map.for_each([](entity& e) {e.x += e.vx; e.y += e.vy; e.z += e.vz;});
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * entity_count);
+}
+BENCHMARK(BM_SlotMapIterate);
+// --------------------------------------------------------------------------------
+
+static void BM_SharedPtrIterate(benchmark::State& state) {
+    std::vector<cslt::shared_ptr<entity>> entities;
+    for (std::size_t i = 0; i < entity_count; ++i)
+        entities.push_back(cslt::make_shared<entity>(make_entity(i)));
+    for (std::size_t pick : make_picks(entity_count))
+        entities[pick] = cslt::make_shared<entity>(make_entity(pick));
+    for (auto _ : state) {
+        for (const cslt::shared_ptr<entity>& ptr : entities) {
+            entity& e = *ptr;
+            e.x += e.vx; e.y += e.vy; e.z += e.vz;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * entity_count);
+}
+BENCHMARK(BM_SharedPtrIterate);
+// --------------------------------------------------------------------------------
+
+static void BM_UnorderedMapIterate(benchmark::State& state) {
+    std::unordered_map<std::uint64_t, entity> map;
+    std::vector<std::uint64_t> ids;
+    std::uint64_t next_id = 0;
+    for (std::size_t i = 0; i < entity_count; ++i) {
+        map.emplace(next_id, make_entity(i));
+        ids.push_back(next_id++);
+    }
+    for (std::size_t pick : make_picks(entity_count)) {
+        map.erase(ids[pick]);
+        map.emplace(next_id, make_entity(pick));
+        ids[pick] = next_id++;
+    }
+    for (auto _ : state) {
+        for (auto& entry : map) {
+            entity& e = entry.second;
+            e.x += e.vx; e.y += e.vy; e.z += e.vz;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * entity_count);
+}
+BENCHMARK(BM_UnorderedMapIterate);
+// ================================================================================
+// ================================================================================
+// LOOKUP BENCHMARKS: reach entities through their handles in random order
+
+static void BM_SlotMapLookup(benchmark::State& state) {
+    cslt::slot_map<entity> map;
+    std::vector<cslt::slot_handle> handles;
+    for (std::size_t i = 0; i < entity_count; ++i)
+        handles.push_back(map.insert(make_entity(i)));
+    const std::vector<std::size_t> picks = make_picks(entity_count);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (std::size_t pick : picks)
+            sum += map.get(handles[pick])->x;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * entity_count);
+}
+BENCHMARK(BM_SlotMapLookup);
+// --------------------------------------------------------------------------------
+
+// Taking a shared_ptr as the handle means a reference count round trip per use
+static void BM_SharedPtrLookup(benchmark::State& state) {
+    std::vector<cslt::shared_ptr<entity>> entities;
+    for (std::size_t i = 0; i < entity_count; ++i)
+        entities.push_back(cslt::make_shared<entity>(make_entity(i)));
+    const std::vector<std::size_t> picks = make_picks(entity_count);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (std::size_t pick : picks) {
+            const cslt::shared_ptr<entity> ref = entities[pick];
+            sum += ref->x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * entity_count);
+}
+BENCHMARK(BM_SharedPtrLookup);
+// --------------------------------------------------------------------------------
+
+static void BM_UnorderedMapLookup(benchmark::State& state) {
+    std::unordered_map<std::uint64_t, entity> map;
+    for (std::size_t i = 0; i < entity_count; ++i)
+        map.emplace(static_cast<std::uint64_t>(i), make_entity(i));
+    const std::vector<std::size_t> picks = make_picks(entity_count);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (std::size_t pick : picks)
+            sum += map.find(static_cast<std::uint64_t>(pick))->second.x;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * entity_count);
+}
+BENCHMARK(BM_UnorderedMapLookup);
+// ================================================================================
+// ================================================================================
+// eof
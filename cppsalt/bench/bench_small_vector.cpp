@@ -0,0 +1,102 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_small_vector.cpp
+// - Purpose: This file implements google benchmark cases for small_vector.hpp,
+//            each paired with vector and the matching std:: container
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "../include/small_vector.hpp"
+#include "../include/vec.hpp"
+// ================================================================================
+// ================================================================================
+// TINY VECTOR BENCHMARKS: build and sum a short-lived vector of Arg ints
+
+template <typename Vec>
+static void run_tiny(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        Vec vec;
+        for (int i = 0; i < count; ++i)
+            vec.push_back(i);
+        int sum = 0;
+        for (int value : vec)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+// --------------------------------------------------------------------------------
+
+static void BM_SmallVectorTiny(benchmark::State& state) {
+    run_tiny<cslt::small_vector<int, 8>>(state);
+}
+BENCHMARK(BM_SmallVectorTiny)->Arg(0)->Arg(4)->Arg(8)->Arg(16);
+// --------------------------------------------------------------------------------
+
+static void BM_StaticVectorTiny(benchmark::State& state) {
+    run_tiny<cslt::static_vector<int, 16>>(state);
+}
+BENCHMARK(BM_StaticVectorTiny)->Arg(0)->Arg(4)->Arg(8)->Arg(16);
+// --------------------------------------------------------------------------------
+
+static void BM_VectorTiny(benchmark::State& state) {
+    run_tiny<cslt::vector<int>>(state);
+}
+BENCHMARK(BM_VectorTiny)->Arg(0)->Arg(4)->Arg(8)->Arg(16);
+// --------------------------------------------------------------------------------
+
+static void BM_StdVectorTiny(benchmark::State& state) {
+    run_tiny<std::vector<int>>(state);
+}
+BENCHMARK(BM_StdVectorTiny)->Arg(0)->Arg(4)->Arg(8)->Arg(16);
+// ================================================================================
+// ================================================================================
+// NESTED BENCHMARKS: 4096 rows of up to 7 ints, the shape of an adjacency list
+
+static const int rows = 4096;
+
+template <typename Row>
+static void run_nested(benchmark::State& state) {
+    for (auto _ : state) {
+        cslt::vector<Row> table;
+        table.reserve(rows);
+        for (int r = 0; r < rows; ++r) {
+            table.emplace_back();
+            for (int i = 0; i < r % 8; ++i)
+                table[static_cast<cslt::size_t>(r)].push_back(i);
+        }
+        benchmark::DoNotOptimize(table.data());
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+// --------------------------------------------------------------------------------
+
+static void BM_SmallVectorNested(benchmark::State& state) {
+    run_nested<cslt::small_vector<int, 8>>(state);
+}
+BENCHMARK(BM_SmallVectorNested);
+// --------------------------------------------------------------------------------
+
+static void BM_VectorNested(benchmark::State& state) {
+    run_nested<cslt::vector<int>>(state);
+}
+BENCHMARK(BM_VectorNested);
+// --------------------------------------------------------------------------------
+
+static void BM_StdVectorNested(benchmark::State& state) {
+    run_nested<std::vector<int>>(state);
+}
+BENCHMARK(BM_StdVectorNested);
+// ================================================================================
+// ================================================================================
+// eof
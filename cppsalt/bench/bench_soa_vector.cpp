@@ -0,0 +1,115 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_soa_vector.cpp
+// - Purpose: This file implements google benchmark cases for soa_vector.hpp,
+//            each paired with a cslt::vector of structs doing the same work
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include "../include/soa_vector.hpp"
+#include "../include/vec.hpp"
+
+// A record of twelve fields, of which the scans below read two
+struct record {
+    double x, y, z;
+    double vx, vy, vz;
+    double mass, charge;
+    std::int64_t id, group, flags, stamp;
+};
+
+using record_columns = cslt::soa_vector<double, double, double, double, double, double,
+                                        double, double, std::int64_t, std::int64_t,
+                                        std::int64_t, std::int64_t>;
+
+static void fill(cslt::vector<record>& aos, record_columns& soa, cslt::size_t num) {
+    for (cslt::size_t i = 0; i < num; ++i) {
+        const double v = static_cast<double>(i % 1000);
+        const std::int64_t k = static_cast<std::int64_t>(i);
+        aos.push_back(record{v, v, v, v, v, v, v, v, k, k, k, k});
+        soa.push_back(v, v, v, v, v, v, v, v, k, k, k, k);
+    }
+}
+// ================================================================================
+// ================================================================================
+// PARTIAL SCAN BENCHMARKS, which sum x * mass; the struct layout drags the
+// other ten fields through the cache with every record
+
+static void BM_SoaVectorPartialScan(benchmark::State& state) {
+    const cslt::size_t num = static_cast<cslt::size_t>(state.range(0));
+    cslt::vector<record> aos;
+    record_columns soa;
+    fill(aos, soa, num);
+    const cslt::span<const double> x = static_cast<const record_columns&>(soa).column<0>();
+    const cslt::span<const double> mass = static_cast<const record_columns&>(soa).column<6>();
+    for (auto _ : state) {
+        double sum = 0.0;
+        for (cslt::size_t i = 0; i < num; ++i)
+            sum += x[i] * mass[i];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(num * 2 * sizeof(double)));
+}
+BENCHMARK(BM_SoaVectorPartialScan)->Arg(1 << 12)->Arg(1 << 20);
+// --------------------------------------------------------------------------------
+
+static void BM_VectorOfStructsPartialScan(benchmark::State& state) {
+    const cslt::size_t num = static_cast<cslt::size_t>(state.range(0));
+    cslt::vector<record> aos;
+    record_columns soa;
+    fill(aos, soa, num);
+    const record* data = aos.data();
+    for (auto _ : state) {
+        double sum = 0.0;
+        for (cslt::size_t i = 0; i < num; ++i)
+            sum += data[i].x * data[i].mass;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(num * 2 * sizeof(double)));
+}
+BENCHMARK(BM_VectorOfStructsPartialScan)->Arg(1 << 12)->Arg(1 << 20);
+// ================================================================================
+// ================================================================================
+// PUSH BACK BENCHMARKS, where each record lands in twelve columns
+
+static void BM_SoaVectorPushBack(benchmark::State& state) {
+    const cslt::size_t num = static_cast<cslt::size_t>(state.range(0));
+    for (auto _ : state) {
+        record_columns soa;
+        for (cslt::size_t i = 0; i < num; ++i) {
+            const double v = static_cast<double>(i);
+            const std::int64_t k = static_cast<std::int64_t>(i);
+            soa.push_back(v, v, v, v, v, v, v, v, k, k, k, k);
+        }
+        benchmark::DoNotOptimize(soa.data<0>());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num));
+}
+BENCHMARK(BM_SoaVectorPushBack)->Arg(1 << 16);
+// --------------------------------------------------------------------------------
+
+static void BM_VectorOfStructsPushBack(benchmark::State& state) {
+    const cslt::size_t num = static_cast<cslt::size_t>(state.range(0));
+    for (auto _ : state) {
+        cslt::vector<record> aos;
+        for (cslt::size_t i = 0; i < num; ++i) {
+            const double v = static_cast<double>(i);
+            const std::int64_t k = static_cast<std::int64_t>(i);
+            aos.push_back(record{v, v, v, v, v, v, v, v, k, k, k, k});
+        }
+        benchmark::DoNotOptimize(aos.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num));
+}
+BENCHMARK(BM_VectorOfStructsPushBack)->Arg(1 << 16);
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,121 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_string.cpp
+// - Purpose: This file implements google benchmark cases for string.hpp, each
+//            paired with std::string
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <utility>
+#include "../include/string.hpp"
+
+// Argument 0 selects a text that fits the inline buffer, 1 one that does not
+static const char* sample_text(int64_t which) {
+    return which == 0 ? "short text" : "a considerably longer text that needs a heap block";
+}
+// ================================================================================
+// ================================================================================
+// CONSTRUCTION BENCHMARKS
+
+static void BM_StringConstruct(benchmark::State& state) {
+    const char* text = sample_text(state.range(0));
+    for (auto _ : state) {
+        cslt::String str(text);
+        benchmark::DoNotOptimize(str.c_string());
+    }
+}
+BENCHMARK(BM_StringConstruct)->Arg(0)->Arg(1);
+// --------------------------------------------------------------------------------
+
+static void BM_StdStringConstruct(benchmark::State& state) {
+    const char* text = sample_text(state.range(0));
+    for (auto _ : state) {
+        std::string str(text);
+        benchmark::DoNotOptimize(str.c_str());
+    }
+}
+BENCHMARK(BM_StdStringConstruct)->Arg(0)->Arg(1);
+// ================================================================================
+// ================================================================================
+// COPY BENCHMARKS
+
+static void BM_StringCopy(benchmark::State& state) {
+    const cslt::String source(sample_text(state.range(0)));
+    for (auto _ : state) {
+        cslt::String copy(source);
+        benchmark::DoNotOptimize(copy.c_string());
+    }
+}
+BENCHMARK(BM_StringCopy)->Arg(0)->Arg(1);
+// --------------------------------------------------------------------------------
+
+static void BM_StdStringCopy(benchmark::State& state) {
+    const std::string source(sample_text(state.range(0)));
+    for (auto _ : state) {
+        std::string copy(source);
+        benchmark::DoNotOptimize(copy.c_str());
+    }
+}
+BENCHMARK(BM_StdStringCopy)->Arg(0)->Arg(1);
+// ================================================================================
+// ================================================================================
+// MOVE BENCHMARKS
+
+static void BM_StringMove(benchmark::State& state) {
+    cslt::String a(sample_text(state.range(0)));
+    cslt::String b;
+    for (auto _ : state) {
+        b = cslt::move(a);
+        a = cslt::move(b);
+        benchmark::DoNotOptimize(a.c_string());
+    }
+}
+BENCHMARK(BM_StringMove)->Arg(0)->Arg(1);
+// --------------------------------------------------------------------------------
+
+static void BM_StdStringMove(benchmark::State& state) {
+    std::string a(sample_text(state.range(0)));
+    std::string b;
+    for (auto _ : state) {
+        b = std::move(a);
+        a = std::move(b);
+        benchmark::DoNotOptimize(a.c_str());
+    }
+}
+BENCHMARK(BM_StdStringMove)->Arg(0)->Arg(1);
+// ================================================================================
+// ================================================================================
+// APPEND BENCHMARKS
+
+static void BM_StringAppend(benchmark::State& state) {
+    for (auto _ : state) {
+        cslt::String str;
+        for (int i = 0; i < 256; ++i)
+            str += "word ";
+        benchmark::DoNotOptimize(str.c_string());
+    }
+}
+BENCHMARK(BM_StringAppend);
+// --------------------------------------------------------------------------------
+
+static void BM_StdStringAppend(benchmark::State& state) {
+    for (auto _ : state) {
+        std::string str;
+        for (int i = 0; i < 256; ++i)
+            str += "word ";
+        benchmark::DoNotOptimize(str.c_str());
+    }
+}
+BENCHMARK(BM_StdStringAppend);
+// ================================================================================
+// ================================================================================
+// eof
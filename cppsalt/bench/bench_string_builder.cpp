@@ -0,0 +1,126 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_string_builder.cpp
+// - Purpose: This file implements google benchmark cases for string_builder.hpp,
+//            each paired with appending to a String or a std::string
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include <string>
+#include "../include/string_builder.hpp"
+#include "../include/string.hpp"
+#include "../include/memory_resource.hpp"
+
+// The total text built, from 64 KiB to 16 MiB
+#define BUILD_SIZES RangeMultiplier(16)->Range(1 << 16, 1 << 24)->Unit(benchmark::kMicrosecond)
+
+static const char piece[] = "{\"id\": 1234, \"name\": \"item\", \"tags\": [\"a\", \"b\"]},\n";
+static const std::size_t piece_len = sizeof(piece) - 1;
+// ================================================================================
+// ================================================================================
+// BUILD AND MATERIALIZE BENCHMARKS
+//
+// With the default resource glibc returns the freed chunks to the system at
+// the end of each iteration and faults them back in on the next, which can
+// dominate around 1 MiB; the arena case and MALLOC_TRIM_THRESHOLD_ show the
+// cost of the builder itself.
+
+static void BM_StringBuilderStr(benchmark::State& state) {
+    const std::size_t total = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        cslt::string_builder builder;
+        for (std::size_t n = 0; n < total; n += piece_len)
+            builder.append(piece, piece_len);
+        cslt::String text = builder.str();
+        benchmark::DoNotOptimize(text.c_string());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StringBuilderStr)->BUILD_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StringBuilderArenaStr(benchmark::State& state) {
+    const std::size_t total = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        cslt::monotonic_arena arena;
+        cslt::string_builder builder(&arena);
+        for (std::size_t n = 0; n < total; n += piece_len)
+            builder.append(piece, piece_len);
+        cslt::String text = builder.str();
+        benchmark::DoNotOptimize(text.c_string());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StringBuilderArenaStr)->BUILD_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StringAppend(benchmark::State& state) {
+    const std::size_t total = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        cslt::String text;
+        for (std::size_t n = 0; n < total; n += piece_len)
+            text.append(piece, piece_len);
+        benchmark::DoNotOptimize(text.c_string());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StringAppend)->BUILD_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StdStringAppend(benchmark::State& state) {
+    const std::size_t total = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        std::string text;
+        for (std::size_t n = 0; n < total; n += piece_len)
+            text.append(piece, piece_len);
+        benchmark::DoNotOptimize(text.c_str());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdStringAppend)->BUILD_SIZES;
+// ================================================================================
+// ================================================================================
+// BUILD AND WRITE BENCHMARKS, where the builder never joins its chunks
+
+static void BM_StringBuilderWriteTo(benchmark::State& state) {
+    const std::size_t total = static_cast<std::size_t>(state.range(0));
+    std::ostringstream os;
+    for (auto _ : state) {
+        os.str(std::string());
+        cslt::string_builder builder;
+        for (std::size_t n = 0; n < total; n += piece_len)
+            builder.append(piece, piece_len);
+        builder.write_to(os);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StringBuilderWriteTo)->BUILD_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StdStringWrite(benchmark::State& state) {
+    const std::size_t total = static_cast<std::size_t>(state.range(0));
+    std::ostringstream os;
+    for (auto _ : state) {
+        os.str(std::string());
+        std::string text;
+        for (std::size_t n = 0; n < total; n += piece_len)
+            text.append(piece, piece_len);
+        os.write(text.data(), static_cast<std::streamsize>(text.size()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdStringWrite)->BUILD_SIZES;
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,192 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_string_search.cpp
+// - Purpose: This file implements google benchmark cases for string_search.hpp,
+//            each paired with std::string or the C library
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <strings.h>
+#include "../include/string_search.hpp"
+#include "../include/string.hpp"
+
+// The first argument is a cslt::text::kernel, the second the haystack length,
+// from one cache line to a haystack that spills out of L2
+#define KERNELS_AND_SIZES ArgsProduct({{0, 1, 2, 3, 4}, {64, 4096, 1 << 20}})
+#define SIZES RangeMultiplier(64)->Range(64, 1 << 20)
+
+// Log-like text over the printable characters in which the needle, the
+// searched character and the separators occur only at the very end
+static std::string make_haystack(std::size_t len) {
+    static const char line[] = "2026-10-14 12:00:00 INFO request served path=/api/v1/items status=200 ";
+    std::string text;
+    text.reserve(len);
+    while (text.size() < len)
+        text.append(line, sizeof(line) - 1);
+    text.resize(len - 9);
+    text += "\t#needle#";
+    return text;
+}
+
+// Selects the kernel named by the first argument, or skips the run
+static bool use_kernel(benchmark::State& state) {
+    const cslt::text::kernel k = static_cast<cslt::text::kernel>(state.range(0));
+    if (!cslt::text::select_kernel(k)) {
+        state.SkipWithError("kernel not supported");
+        return false;
+    }
+    state.SetLabel(cslt::text::kernel_name(k));
+    return true;
+}
+// ================================================================================
+// ================================================================================
+// SINGLE CHARACTER BENCHMARKS
+
+static void BM_TextFindChar(benchmark::State& state) {
+    if (!use_kernel(state))
+        return;
+    const std::string text = make_haystack(static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cslt::text::find_char(text.data(), text.size(), '#'));
+    state.SetBytesProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_TextFindChar)->KERNELS_AND_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StdStringFindChar(benchmark::State& state) {
+    const std::string text = make_haystack(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(text.find('#'));
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdStringFindChar)->SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_TextRfindChar(benchmark::State& state) {
+    if (!use_kernel(state))
+        return;
+    std::string text = make_haystack(static_cast<std::size_t>(state.range(1)));
+    text[0] = '!';
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cslt::text::rfind_char(text.data(), text.size(), '!'));
+    state.SetBytesProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_TextRfindChar)->KERNELS_AND_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StdStringRfindChar(benchmark::State& state) {
+    std::string text = make_haystack(static_cast<std::size_t>(state.range(0)));
+    text[0] = '!';
+    for (auto _ : state)
+        benchmark::DoNotOptimize(text.rfind('!'));
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdStringRfindChar)->SIZES;
+// ================================================================================
+// ================================================================================
+// SUBSTRING BENCHMARKS
+
+static void BM_TextFind(benchmark::State& state) {
+    if (!use_kernel(state))
+        return;
+    const std::string text = make_haystack(static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cslt::text::find(text.data(), text.size(), "#needle#", 8));
+    state.SetBytesProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_TextFind)->KERNELS_AND_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StdStringFind(benchmark::State& state) {
+    const std::string text = make_haystack(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(text.find("#needle#"));
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdStringFind)->SIZES;
+// --------------------------------------------------------------------------------
+
+// A needle whose first character is common in the text, which defeats a
+// search that only looks for the first character
+static void BM_TextFindCommonFirst(benchmark::State& state) {
+    if (!use_kernel(state))
+        return;
+    const std::string text = make_haystack(static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cslt::text::find(text.data(), text.size(), "e#needle", 8));
+    state.SetBytesProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_TextFindCommonFirst)->KERNELS_AND_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StdStringFindCommonFirst(benchmark::State& state) {
+    const std::string text = make_haystack(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(text.find("e#needle"));
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdStringFindCommonFirst)->SIZES;
+// ================================================================================
+// ================================================================================
+// CHARACTER SET BENCHMARKS
+
+static void BM_TextFindFirstOf(benchmark::State& state) {
+    if (!use_kernel(state))
+        return;
+    const std::string text = make_haystack(static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cslt::text::find_first_of(text.data(), text.size(), "\t\r\n#", 4));
+    state.SetBytesProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_TextFindFirstOf)->KERNELS_AND_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StdStringFindFirstOf(benchmark::State& state) {
+    const std::string text = make_haystack(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(text.find_first_of("\t\r\n#"));
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdStringFindFirstOf)->SIZES;
+// ================================================================================
+// ================================================================================
+// CASE INSENSITIVE COMPARISON BENCHMARKS
+
+static void BM_TextCompareIcase(benchmark::State& state) {
+    if (!use_kernel(state))
+        return;
+    const std::string lower = make_haystack(static_cast<std::size_t>(state.range(1)));
+    std::string upper = lower;
+    for (char& chr : upper)
+        if (chr >= 'a' && chr <= 'z')
+            chr = static_cast<char>(chr - 0x20);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(cslt::text::compare_icase(lower.data(), upper.data(), lower.size()));
+    state.SetBytesProcessed(state.iterations() * state.range(1));
+}
+BENCHMARK(BM_TextCompareIcase)->KERNELS_AND_SIZES;
+// --------------------------------------------------------------------------------
+
+static void BM_StrncasecmpCompare(benchmark::State& state) {
+    const std::string lower = make_haystack(static_cast<std::size_t>(state.range(0)));
+    std::string upper = lower;
+    for (char& chr : upper)
+        if (chr >= 'a' && chr <= 'z')
+            chr = static_cast<char>(chr - 0x20);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(strncasecmp(lower.data(), upper.data(), lower.size()));
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StrncasecmpCompare)->SIZES;
+// ================================================================================
+// ================================================================================
+// eof
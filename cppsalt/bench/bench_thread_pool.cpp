@@ -0,0 +1,160 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_thread_pool.cpp
+// - Purpose: This file implements google benchmark cases for thread_pool.hpp,
+//            each paired with a pool built on one mutex and condition variable
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../include/thread_pool.hpp"
+
+// The pool this library's users write by hand: one queue behind one lock
+class locked_pool {
+private:
+    std::mutex lock;
+    std::condition_variable ready;
+    std::deque<std::function<void()>> tasks;
+    std::vector<std::thread> threads;
+    bool stopping = false;
+
+public:
+    explicit locked_pool(std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            threads.emplace_back([this] {
+                for (;;) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> guard(lock);
+                        ready.wait(guard, [this] {return stopping || !tasks.empty();});
+                        if (tasks.empty())
+                            return;
+                        task = std::move(tasks.front());
+                        tasks.pop_front();
+                    }
+                    task();
+                }
+            });
+        }
+    }
+
+    ~locked_pool() {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            stopping = true;
+        }
+        ready.notify_all();
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+
+    void submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            tasks.push_back(std::move(task));
+        }
+        ready.notify_one();
+    }
+};
+// ================================================================================
+// ================================================================================
+// TINY TASK BENCHMARKS: 100000 tasks that each bump a counter
+
+static const int tiny_tasks = 100000;
+
+// The tasks are submitted from a worker, so they land on its own deque
+static void BM_ThreadPoolTinyTasks(benchmark::State& state) {
+    cslt::thread_pool pool(static_cast<cslt::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::atomic<int> count{0};
+        pool.submit([&pool, &count] {
+            for (int i = 0; i < tiny_tasks; ++i)
+                pool.submit([&count] {count.fetch_add(1, std::memory_order_relaxed);});
+        }).get();
+        while (count.load() < tiny_tasks)
+            pool.run_pending_task();
+    }
+    state.SetItemsProcessed(state.iterations() * tiny_tasks);
+}
+BENCHMARK(BM_ThreadPoolTinyTasks)->Arg(1)->Arg(2)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+// --------------------------------------------------------------------------------
+
+// The same tasks submitted from outside, through the injection queue
+static void BM_ThreadPoolTinyTasksExternal(benchmark::State& state) {
+    cslt::thread_pool pool(static_cast<cslt::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::atomic<int> count{0};
+        for (int i = 0; i < tiny_tasks; ++i)
+            pool.submit([&count] {count.fetch_add(1, std::memory_order_relaxed);});
+        while (count.load() < tiny_tasks)
+            pool.run_pending_task();
+    }
+    state.SetItemsProcessed(state.iterations() * tiny_tasks);
+}
+BENCHMARK(BM_ThreadPoolTinyTasksExternal)->Arg(1)->Arg(2)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+// --------------------------------------------------------------------------------
+
+static void BM_LockedPoolTinyTasks(benchmark::State& state) {
+    locked_pool pool(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::atomic<int> count{0};
+        for (int i = 0; i < tiny_tasks; ++i)
+            pool.submit([&count] {count.fetch_add(1, std::memory_order_relaxed);});
+        while (count.load() < tiny_tasks)
+            std::this_thread::yield();
+    }
+    state.SetItemsProcessed(state.iterations() * tiny_tasks);
+}
+BENCHMARK(BM_LockedPoolTinyTasks)->Arg(1)->Arg(2)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+// ================================================================================
+// ================================================================================
+// PARALLEL_FOR BENCHMARKS: a sum of square roots over 1 << 22 indices
+
+static const cslt::size_t for_count = 1u << 22;
+
+static double root_sum(cslt::size_t begin, cslt::size_t end) {
+    double sum = 0.0;
+    for (cslt::size_t i = begin; i < end; ++i)
+        sum += __builtin_sqrt(static_cast<double>(i));
+    return sum;
+}
+// --------------------------------------------------------------------------------
+
+static void BM_ThreadPoolParallelFor(benchmark::State& state) {
+    cslt::thread_pool pool(static_cast<cslt::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::atomic<std::uint64_t> chunks{0};
+        pool.parallel_for(0, for_count, [&chunks](cslt::size_t begin, cslt::size_t end) {
+            benchmark::DoNotOptimize(root_sum(begin, end));
+            chunks.fetch_add(1, std::memory_order_relaxed);
+        });
+        benchmark::DoNotOptimize(chunks.load());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(for_count));
+}
+BENCHMARK(BM_ThreadPoolParallelFor)->Arg(1)->Arg(2)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+// --------------------------------------------------------------------------------
+
+static void BM_SerialFor(benchmark::State& state) {
+    for (auto _ : state)
+        benchmark::DoNotOptimize(root_sum(0, for_count));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(for_count));
+}
+BENCHMARK(BM_SerialFor)->UseRealTime()->Unit(benchmark::kMillisecond);
+// ================================================================================
+// ================================================================================
+// eof
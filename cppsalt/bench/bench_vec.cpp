@@ -0,0 +1,175 @@
+// ================================================================================
+// ================================================================================
+// - File:    bench_vec.cpp
+// - Purpose: This file implements google benchmark cases for vec.hpp, each
+//            paired with the matching std:: container
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin benchmarks
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "../include/vec.hpp"
+#include "../include/string.hpp"
+#include "../include/util.hpp"
+// ================================================================================
+// ================================================================================
+// PUSH_BACK BENCHMARKS
+
+static void BM_VectorPushBack(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        cslt::vector<int> vec;
+        for (int i = 0; i < count; ++i)
+            vec.push_back(i);
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_VectorPushBack)->Range(8, 1 << 16);
+// --------------------------------------------------------------------------------
+
+static void BM_StdVectorPushBack(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        std::vector<int> vec;
+        for (int i = 0; i < count; ++i)
+            vec.push_back(i);
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_StdVectorPushBack)->Range(8, 1 << 16);
+// ================================================================================
+// ================================================================================
+// RESERVE BENCHMARKS
+
+static void BM_VectorReservePushBack(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        cslt::vector<int> vec;
+        vec.reserve(count);
+        for (int i = 0; i < count; ++i)
+            vec.push_back(i);
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_VectorReservePushBack)->Range(8, 1 << 16);
+// --------------------------------------------------------------------------------
+
+static void BM_StdVectorReservePushBack(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        std::vector<int> vec;
+        vec.reserve(count);
+        for (int i = 0; i < count; ++i)
+            vec.push_back(i);
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_StdVectorReservePushBack)->Range(8, 1 << 16);
+// ================================================================================
+// ================================================================================
+// NON-TRIVIAL ELEMENT BENCHMARKS
+
+// Growth relocates every element, which for strings means a move per element
+static void BM_VectorPushBackString(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        cslt::vector<cslt::String> vec;
+        for (int i = 0; i < count; ++i)
+            vec.push_back(cslt::String("a string longer than the inline buffer"));
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_VectorPushBackString)->Range(8, 1 << 12);
+// --------------------------------------------------------------------------------
+
+static void BM_StdVectorPushBackString(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        std::vector<std::string> vec;
+        for (int i = 0; i < count; ++i)
+            vec.push_back(std::string("a string longer than the inline buffer"));
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_StdVectorPushBackString)->Range(8, 1 << 12);
+// ================================================================================
+// ================================================================================
+// RELOCATION BENCHMARKS
+
+// Each row owns a heap block, so growth either moves every row or copies its bytes
+static void BM_VectorGrowNested(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        cslt::vector<cslt::vector<int>> table;
+        for (int i = 0; i < count; ++i)
+            table.emplace_back(4);
+        benchmark::DoNotOptimize(table.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_VectorGrowNested)->Range(8, 1 << 12);
+// --------------------------------------------------------------------------------
+
+static void BM_StdVectorGrowNested(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        std::vector<std::vector<int>> table;
+        for (int i = 0; i < count; ++i) {
+            table.emplace_back();
+            table.back().reserve(4);
+        }
+        benchmark::DoNotOptimize(table.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_StdVectorGrowNested)->Range(8, 1 << 12);
+// --------------------------------------------------------------------------------
+
+// Reverses a vector of pairs in place, one swap of two heavy pairs per step
+static void BM_PairSwapReverse(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    cslt::vector<cslt::pair<cslt::String, cslt::vector<int>>> rows;
+    for (int i = 0; i < count; ++i)
+        rows.push_back(cslt::make_pair(cslt::String("a string longer than the inline buffer"),
+                                       cslt::vector<int>{i, i + 1}));
+    for (auto _ : state) {
+        for (cslt::size_t i = 0, j = rows.size() - 1; i < j; ++i, --j)
+            cslt::swap(rows[i], rows[j]);
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetItemsProcessed(state.iterations() * (count / 2));
+}
+BENCHMARK(BM_PairSwapReverse)->Arg(1 << 12);
+// --------------------------------------------------------------------------------
+
+static void BM_StdPairSwapReverse(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    std::vector<std::pair<std::string, std::vector<int>>> rows;
+    for (int i = 0; i < count; ++i)
+        rows.push_back(std::make_pair(std::string("a string longer than the inline buffer"),
+                                      std::vector<int>{i, i + 1}));
+    for (auto _ : state) {
+        for (std::size_t i = 0, j = rows.size() - 1; i < j; ++i, --j)
+            std::swap(rows[i], rows[j]);
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetItemsProcessed(state.iterations() * (count / 2));
+}
+BENCHMARK(BM_StdPairSwapReverse)->Arg(1 << 12);
+// ================================================================================
+// ================================================================================
+// eof
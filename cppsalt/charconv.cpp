@@ -0,0 +1,194 @@
+// ================================================================================
+// ================================================================================
+// - File:    charconv.cpp
+// - Purpose: Floating point conversions declared in charconv.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "include/charconv.hpp"
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <locale.h>
+
+#if defined(__APPLE__)
+    #include <xlocale.h>
+#endif
+
+namespace cslt {
+
+    const char digit_pairs[201] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+// ================================================================================
+// ================================================================================
+
+    namespace {
+        to_chars_result copy_out(char* first, char* last, const char* text, cslt::size_t num) noexcept {
+            if (static_cast<cslt::size_t>(last - first) < num)
+                return {last, std::errc::value_too_large};
+            std::memcpy(first, text, num);
+            return {first + num, std::errc()};
+        }
+// --------------------------------------------------------------------------------
+
+        // Writes inf, -inf or nan and returns true, or returns false for a finite value
+        bool special_value(char* first, char* last, double value, to_chars_result& result) noexcept {
+            if (std::isnan(value)) {
+                result = copy_out(first, last, "nan", 3);
+                return true;
+            }
+            if (std::isinf(value)) {
+                result = value < 0 ? copy_out(first, last, "-inf", 4) : copy_out(first, last, "inf", 3);
+                return true;
+            }
+            return false;
+        }
+// --------------------------------------------------------------------------------
+
+        // printf and strtod follow LC_NUMERIC, which may spell the decimal
+        // point as a comma.  c_numeric switches the calling thread to the C
+        // locale for its lifetime, so the text never depends on setlocale;
+        // the Windows CRT takes the locale as an argument instead
+#if defined(_WIN32)
+        _locale_t c_locale() noexcept {
+            static const _locale_t locale = _create_locale(LC_ALL, "C");
+            return locale;
+        }
+
+        class c_numeric {
+        public:
+            int print(char* text, cslt::size_t size, const char* format, int precision, double value) const noexcept {
+                return _snprintf_l(text, size, format, c_locale(), precision, value);
+            }
+            double read(const char* text) const noexcept {
+                return _strtod_l(text, nullptr, c_locale());
+            }
+        };
+#else
+        locale_t c_locale() noexcept {
+            static const locale_t locale = newlocale(LC_ALL_MASK, "C", locale_t(0));
+            return locale;
+        }
+
+        // A failed newlocale leaves a null handle, and uselocale with a null
+        // handle changes nothing, so the thread keeps its own locale
+        class c_numeric {
+        public:
+            c_numeric() noexcept : previous(uselocale(c_locale())) {}
+            ~c_numeric() { uselocale(previous); }
+            c_numeric(const c_numeric&) = delete;
+            c_numeric& operator=(const c_numeric&) = delete;
+
+            int print(char* text, cslt::size_t size, const char* format, int precision, double value) const noexcept {
+                return std::snprintf(text, size, format, precision, value);
+            }
+            double read(const char* text) const noexcept {
+                return std::strtod(text, nullptr);
+            }
+        private:
+            locale_t previous;
+        };
+#endif
+// --------------------------------------------------------------------------------
+
+        constexpr std::uint64_t powers_of_ten[10] = {
+            1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u
+        };
+    }
+// ================================================================================
+// ================================================================================
+
+    to_chars_result to_chars(char* first, char* last, double value) noexcept {
+        to_chars_result result;
+        if (special_value(first, last, value, result))
+            return result;
+        // 17 significant digits always round trip and the first precision
+        // that reads back exactly is the shortest.  Any decimal of up to
+        // DBL_DIG digits survives a trip through a normal double, so %.15g
+        // already drops to fewer digits when fewer suffice; a subnormal
+        // carries fewer bits, so its search starts from a single digit
+        const c_numeric numeric;
+        char text[max_double_chars];
+        int num = 0;
+        const int start = std::fpclassify(value) == FP_SUBNORMAL ? 1 : DBL_DIG;
+        for (int precision = start; precision <= 17; ++precision) {
+            num = numeric.print(text, sizeof(text), "%.*g", precision, value);
+            if (precision == 17 || numeric.read(text) == value)
+                break;
+        }
+        return copy_out(first, last, text, static_cast<cslt::size_t>(num));
+    }
+// --------------------------------------------------------------------------------
+
+    to_chars_result to_chars(char* first, char* last, double value, int precision) noexcept {
+        to_chars_result result;
+        if (special_value(first, last, value, result))
+            return result;
+        if (precision < 0)
+            precision = 0;
+        const double magnitude = std::fabs(value);
+        if (magnitude < 1e15 && precision <= 9) {
+            // The integer part is exact and so is the subtraction; a scaled
+            // fraction at or next to a half is left to printf, since the
+            // multiply may have rounded it onto or across the tie
+            std::uint64_t whole = static_cast<std::uint64_t>(magnitude);
+            const std::uint64_t scale = powers_of_ten[precision];
+            const double scaled = (magnitude - static_cast<double>(whole)) * static_cast<double>(scale);
+            const double rounded = std::nearbyint(scaled);
+            const double distance = std::fabs(scaled - rounded);
+            if (distance < 0.5 - 1e-6) {
+                std::uint64_t fraction = static_cast<std::uint64_t>(rounded);
+                if (fraction >= scale) {
+                    fraction -= scale;
+                    ++whole;
+                }
+                const unsigned whole_digits = decimal_digits(whole);
+                const cslt::size_t needed = (std::signbit(value) ? 1u : 0u) + whole_digits +
+                                            (precision != 0 ? 1u + static_cast<unsigned>(precision) : 0u);
+                if (static_cast<cslt::size_t>(last - first) < needed)
+                    return {last, std::errc::value_too_large};
+                if (std::signbit(value))
+                    *first++ = '-';
+                write_digits(first + whole_digits, whole);
+                first += whole_digits;
+                if (precision != 0) {
+                    *first++ = '.';
+                    // Leading zeros of the fraction, then its digits
+                    const unsigned fraction_digits = decimal_digits(fraction);
+                    std::memset(first, '0', static_cast<cslt::size_t>(precision) - fraction_digits);
+                    first += precision;
+                    write_digits(first, fraction);
+                }
+                return {first, std::errc()};
+            }
+        }
+        // Up to 309 integer digits for the largest double; the precision is
+        // capped so the text always fits
+        if (precision > 100)
+            precision = 100;
+        const c_numeric numeric;
+        char text[416];
+        const int num = numeric.print(text, sizeof(text), "%.*f", precision, value);
+        return copy_out(first, last, text, static_cast<cslt::size_t>(num));
+    }
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,81 @@
+// ================================================================================
+// ================================================================================
+// - File:    concurrent_queue.cpp
+// - Purpose: The sleep and wake calls behind the blocking queue operations
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "include/concurrent_queue.hpp"
+#include <climits>
+
+#if defined(__linux__)
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#else
+    #include <condition_variable>
+    #include <mutex>
+#endif
+
+namespace cslt {
+
+#if defined(__linux__)
+    void detail::event_count::_block(std::uint32_t key) noexcept {
+        // Returns at once if the epoch no longer holds key; a spurious return
+        // is checked again by the caller
+        ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&_epoch), FUTEX_WAIT_PRIVATE,
+                  key, nullptr, nullptr, 0);
+    }
+// --------------------------------------------------------------------------------
+
+    void detail::event_count::_wake(std::uint32_t count) noexcept {
+        const int waiters = count > static_cast<std::uint32_t>(INT_MAX) ? INT_MAX : static_cast<int>(count);
+        ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&_epoch), FUTEX_WAKE_PRIVATE,
+                  waiters, nullptr, nullptr, 0);
+    }
+#else
+    namespace {
+        // Sleepers share a few locks, chosen by the address they wait on
+        struct bucket {
+            std::mutex lock;
+            std::condition_variable wake;
+        };
+
+        constexpr cslt::size_t bucket_count = 16;
+
+        bucket& bucket_for(const void* address) noexcept {
+            static bucket buckets[bucket_count];
+            const std::uintptr_t bits = reinterpret_cast<std::uintptr_t>(address);
+            return buckets[(bits >> 6) % bucket_count];
+        }
+    } /* end of unnamed namespace */
+// --------------------------------------------------------------------------------
+
+    void detail::event_count::_block(std::uint32_t key) noexcept {
+        bucket& b = bucket_for(&_epoch);
+        std::unique_lock<std::mutex> guard(b.lock);
+        while (_epoch.load(std::memory_order_acquire) == key)
+            b.wake.wait(guard);
+    }
+// --------------------------------------------------------------------------------
+
+    void detail::event_count::_wake(std::uint32_t) noexcept {
+        bucket& b = bucket_for(&_epoch);
+        {
+            std::lock_guard<std::mutex> guard(b.lock);
+        }
+        // Other queues may share the bucket, so every sleeper checks its own epoch
+        b.wake.notify_all();
+    }
+#endif
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+// eof
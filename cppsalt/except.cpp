@@ -14,41 +14,72 @@
 // Include modules here
 
 #include "include/except.hpp"
+#include "include/instrument.hpp"
+#include "include/probe.hpp"
 #include "string.h"
+#include <new>
 
 namespace cslt {
 
-    exception::exception(const char* msg) {
-        unsigned int len = strlen(msg);
-        message = new char[len + 1];
-        message[len] = '\0';
-        strcpy(message, msg);
+    namespace {
+        const char fallback_text[] = "Exception message unavailable, out of memory";
     }
 // --------------------------------------------------------------------------------
 
-    exception::exception(const exception& other) {
-        message = new char[strlen(other.message) + 1];
-        strcpy(message, other.message);
+    void error_message::copy_text(const char* str) noexcept {
+        if (!str) {
+            text = "";
+            return;
+        }
+        CSLT_PROFILE_SCOPE("exception.message");
+        const std::size_t len = strlen(str);
+        void* raw = ::operator new(sizeof(buffer) + len + 1, std::nothrow);
+        if (!raw) {
+            text = fallback_text;
+            return;
+        }
+        CSLT_RECORD_ALLOC(exception, sizeof(buffer) + len + 1);
+        block = ::new (raw) buffer;
+        block->refs.store(1, std::memory_order_relaxed);
+        char* chars = reinterpret_cast<char*>(block + 1);
+        memcpy(chars, str, len + 1);
+        text = chars;
     }
 // --------------------------------------------------------------------------------
 
-    exception& exception::operator=(const exception& other) {
-        if (this != &other) {
-            delete[] message;
-            message = new char[strlen(other.message) + 1];
-            strcpy(message, other.message);
+    void error_message::release() noexcept {
+        if (block && block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            CSLT_RECORD_FREE(exception, sizeof(buffer) + strlen(text) + 1);
+            block->~buffer();
+            ::operator delete(block);
         }
-        return *this;
+        block = nullptr;
     }
+// ================================================================================
+// ================================================================================
+
+    exception::exception(error_message msg) noexcept : message(msg) {}
 // --------------------------------------------------------------------------------
 
-    exception::~exception() {
-        delete[] message;
-    }
+    exception::~exception() = default;
 // --------------------------------------------------------------------------------
 
     const char* exception::what() const noexcept {
-        return message;
+        return message.c_str();
+    }
+// ================================================================================
+// ================================================================================
+
+    // The instance holds a literal message, so neither creating nor copying it
+    // needs the heap
+    const bad_alloc& emergency_bad_alloc() noexcept {
+        static const bad_alloc instance;
+        return instance;
+    }
+// --------------------------------------------------------------------------------
+
+    void throw_bad_alloc() {
+        throw emergency_bad_alloc();
     }
 // ================================================================================
 // ================================================================================
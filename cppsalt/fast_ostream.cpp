@@ -0,0 +1,171 @@
+// ================================================================================
+// ================================================================================
+// - File:    fast_ostream.cpp
+// - Purpose: Buffer management and descriptor writes of fast_ostream
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "include/fast_ostream.hpp"
+#include "include/except.hpp"
+#include "include/string_search.hpp"
+#include <cerrno>
+#include <cstdio>
+
+#if defined(_WIN32)
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+namespace cslt {
+
+    constexpr cslt::size_t fast_ostream::default_buffer_size;
+    constexpr cslt::size_t fast_ostream::min_buffer_size;
+// ================================================================================
+// ================================================================================
+// PRIVATE FUNCTIONS
+
+    namespace {
+        [[noreturn]] void throw_write_error(int fd) {
+            char text[256];
+            std::snprintf(text, sizeof(text), "fast_ostream could not write to descriptor %d: %s",
+                          fd, std::strerror(errno));
+            throw cslt::system_error(text);
+        }
+    }
+
+    void fast_ostream::write_all(const char* data, cslt::size_t num) {
+        while (num != 0) {
+#if defined(_WIN32)
+            const unsigned part = num > 0x40000000u ? 0x40000000u : static_cast<unsigned>(num);
+            const int written = ::_write(fd, data, part);
+#else
+            const ssize_t written = ::write(fd, data, num);
+#endif
+            if (written < 0) {
+                if (errno == EINTR)
+                    continue;
+                throw_write_error(fd);
+            }
+            data += written;
+            num -= static_cast<cslt::size_t>(written);
+        }
+    }
+// --------------------------------------------------------------------------------
+
+    bool fast_ostream::make_room(const char* str, cslt::size_t num) {
+        char* const start = begin();
+        const cslt::size_t held = static_cast<cslt::size_t>(cursor - start);
+        if (num <= buffer.size() && held != 0) {
+            // Keeps the partial last line when the room it leaves is enough
+            const cslt::size_t line_end = text::rfind_char(start, held, '\n') + 1;
+            if (line_end != 0 && num <= buffer.size() - (held - line_end)) {
+                write_all(start, line_end);
+                const cslt::size_t rest = held - line_end;
+                std::memmove(start, start + line_end, rest);
+                cursor = start + rest;
+                scanned = cursor;
+                return true;
+            }
+        }
+        flush();
+        if (num <= buffer.size())
+            return true;
+        write_all(str, num);
+        return false;
+    }
+// --------------------------------------------------------------------------------
+
+    void fast_ostream::finish_slow() {
+        if (mode == flush_policy::each_write) {
+            flush();
+            return;
+        }
+        const cslt::size_t unscanned = static_cast<cslt::size_t>(cursor - scanned);
+        if (text::find_char(scanned, unscanned, '\n') != text::not_found)
+            flush();
+        else
+            scanned = cursor;
+    }
+// --------------------------------------------------------------------------------
+
+    void fast_ostream::append_value(fixed_format value) {
+        // Large magnitudes can produce hundreds of digits, so the text is
+        // converted on the stack unless the common short form fits directly
+        char* out = reserve(max_double_chars);
+        to_chars_result result = to_chars(out, limit, value.value, value.precision);
+        if (result.ec == std::errc()) {
+            cursor = result.ptr;
+            return;
+        }
+        char text[416];
+        result = to_chars(text, text + sizeof(text), value.value, value.precision);
+        append(text, static_cast<cslt::size_t>(result.ptr - text));
+    }
+// --------------------------------------------------------------------------------
+
+    void fast_ostream::append_value(hex_format value) {
+        static const char digits[] = "0123456789abcdef";
+        char* out = reserve(16);
+        cslt::size_t count = 1;
+        for (std::uint64_t rest = value.value >> 4; rest != 0; rest >>= 4)
+            ++count;
+        std::uint64_t rest = value.value;
+        for (cslt::size_t i = count; i != 0; --i) {
+            out[i - 1] = digits[rest & 0xf];
+            rest >>= 4;
+        }
+        cursor = out + count;
+    }
+// ================================================================================
+// ================================================================================
+// CONSTRUCTORS
+
+    fast_ostream::fast_ostream(int fd, cslt::size_t buffer_size, flush_policy policy)
+        : buffer(buffer_size > min_buffer_size ? buffer_size : min_buffer_size),
+          cursor(buffer.data()), limit(buffer.data() + buffer.size()), scanned(buffer.data()),
+          fd(fd), mode(policy) {}
+// --------------------------------------------------------------------------------
+
+    fast_ostream::~fast_ostream() {
+        try {
+            flush();
+        } catch (...) {
+        }
+    }
+// ================================================================================
+// ================================================================================
+// PUBLIC FUNCTIONS
+
+    void fast_ostream::flush() {
+        char* const start = begin();
+        const cslt::size_t held = static_cast<cslt::size_t>(cursor - start);
+        // The buffer is emptied first so a failed write does not repeat the
+        // text on the next flush
+        cursor = start;
+        scanned = start;
+        if (held != 0)
+            write_all(start, held);
+    }
+// --------------------------------------------------------------------------------
+
+    fast_ostream& fast_out() {
+        thread_local fast_ostream stream(1);
+        return stream;
+    }
+
+    fast_ostream& fast_err() {
+        thread_local fast_ostream stream(2, fast_ostream::min_buffer_size * 64, flush_policy::each_write);
+        return stream;
+    }
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,55 @@
+// ================================================================================
+// ================================================================================
+// - File:    hash.cpp
+// - Purpose: This file contains the byte hash used by cslt::hash
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "include/hash.hpp"
+
+namespace cslt {
+
+    cslt::size_t hash_bytes(const void* data, cslt::size_t num, std::uint64_t seed) noexcept {
+        const std::uint64_t m = 0xc6a4a7935bd1e995ULL;
+        const unsigned r = 47;
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        std::uint64_t h = seed ^ (static_cast<std::uint64_t>(num) * m);
+
+        // Whole words are read with memcpy, which compiles to a single
+        // unaligned load
+        const unsigned char* end = bytes + (num & ~cslt::size_t(7));
+        for (; bytes != end; bytes += 8) {
+            std::uint64_t k;
+            std::memcpy(&k, bytes, 8);
+            k *= m;
+            k ^= k >> r;
+            k *= m;
+            h ^= k;
+            h *= m;
+        }
+
+        const cslt::size_t tail = num & 7;
+        if (tail != 0) {
+            std::uint64_t k = 0;
+            std::memcpy(&k, bytes, tail);
+            h ^= k;
+            h *= m;
+        }
+
+        h ^= h >> r;
+        h *= m;
+        h ^= h >> r;
+        return static_cast<cslt::size_t>(h);
+    }
+
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,143 @@
+// ================================================================================
+// ================================================================================
+// - File:    charconv.hpp
+// - Purpose: Conversion of numbers to characters without allocating
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_charconv_HPP
+#define cslt_charconv_HPP
+
+#include "dtype.hpp"
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+#include <type_traits>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    /**
+     * @brief The end of the written characters, or std::errc::value_too_large
+     *        and last if they did not fit
+     */
+    struct to_chars_result {
+        char* ptr;
+        std::errc ec;
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief The characters "00" to "99" in order, so a pair of digits is one copy
+     */
+    extern const char digit_pairs[201];
+
+    /**
+     * @brief Enough room for any integer up to 64 bits, including the sign
+     */
+    constexpr cslt::size_t max_integer_chars = 20;
+
+    /**
+     * @brief Enough room for any output of to_chars for a double without a precision
+     */
+    constexpr cslt::size_t max_double_chars = 32;
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Returns the number of decimal digits in value, at least 1
+     */
+    inline unsigned decimal_digits(std::uint64_t value) noexcept {
+        unsigned count = 1;
+        for (;;) {
+            if (value < 10) return count;
+            if (value < 100) return count + 1;
+            if (value < 1000) return count + 2;
+            if (value < 10000) return count + 3;
+            value /= 10000;
+            count += 4;
+        }
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Writes the digits of value backwards so that the last lands before end
+     *
+     * end - first must be decimal_digits(value).
+     */
+    inline void write_digits(char* end, std::uint64_t value) noexcept {
+        while (value >= 100) {
+            const unsigned pair = static_cast<unsigned>(value % 100) * 2;
+            value /= 100;
+            end -= 2;
+            std::memcpy(end, digit_pairs + pair, 2);
+        }
+        if (value >= 10) {
+            std::memcpy(end - 2, digit_pairs + value * 2, 2);
+        } else {
+            end[-1] = static_cast<char>('0' + value);
+        }
+    }
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief Writes value in decimal to the range [first, last)
+     *
+     * As with std::to_chars, nothing is null terminated and no locale is
+     * consulted.  bool is not accepted, to avoid printing true as 1 by accident.
+     */
+    template <typename T>
+    std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, to_chars_result>
+    to_chars(char* first, char* last, T value) noexcept {
+        using unsigned_t = std::make_unsigned_t<T>;
+        std::uint64_t magnitude = static_cast<unsigned_t>(value);
+        const bool negative = value < 0;
+        if (negative)
+            magnitude = static_cast<unsigned_t>(unsigned_t(0) - static_cast<unsigned_t>(value));
+        const unsigned digits = decimal_digits(magnitude);
+        if (static_cast<cslt::size_t>(last - first) < digits + (negative ? 1u : 0u))
+            return {last, std::errc::value_too_large};
+        if (negative)
+            *first++ = '-';
+        write_digits(first + digits, magnitude);
+        return {first + digits, std::errc()};
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Writes the shortest decimal form of value that reads back as the same double
+     *
+     * The output follows printf's %g, so large and small magnitudes use an
+     * exponent, and is "inf", "-inf" or "nan" for the special values.  The
+     * conversion runs in the C locale whatever setlocale selected, so the
+     * decimal point is always a period, and subnormals such as 5e-324 get
+     * their shortest form too.  It is as exact as the C library's printf and
+     * strtod, which glibc, macOS and the Universal CRT round correctly; an
+     * older library that does not may write a digit more than needed.
+     */
+    to_chars_result to_chars(char* first, char* last, double value) noexcept;
+
+    /**
+     * @brief Writes value with exactly precision digits after the decimal point
+     *
+     * Values below 1e15 in magnitude with a precision of up to 9 are
+     * converted with integer arithmetic; the others fall back to snprintf's
+     * %f on a stack buffer in the C locale, with the precision capped at
+     * 100.  Neither allocates.
+     */
+    to_chars_result to_chars(char* first, char* last, double value, int precision) noexcept;
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_charconv_HPP */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,625 @@
+// ================================================================================
+// ================================================================================
+// - File:    concurrent_queue.hpp
+// - Purpose: Bounded lock-free ring buffer queues for handing work between threads
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_concurrent_queue_HPP
+#define cslt_concurrent_queue_HPP
+
+#include "dtype.hpp"
+#include "except.hpp"
+#include "memory.hpp"
+#include "probe.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    namespace detail {
+
+        /**
+         * @brief Lets a thread sleep until another reports progress, at the
+         *        cost of one fence and one load while nobody sleeps
+         *
+         * A waiter calls prepare_wait, checks its condition again and then
+         * either cancel_wait or wait.  A thread that changes the condition
+         * calls notify afterwards.  The epoch moves whenever a sleeper must be
+         * woken, and wait returns at once if it moved after prepare_wait, so a
+         * wakeup cannot fall between the check and the sleep.  On Linux the
+         * sleep is a futex on the epoch; elsewhere it is a condition variable.
+         */
+        class event_count {
+        private:
+            std::atomic<std::uint32_t> _epoch{0};
+            std::atomic<std::uint32_t> _waiters{0};
+
+            void _block(std::uint32_t key) noexcept;
+            void _wake(std::uint32_t count) noexcept;
+// ================================================================================
+
+        public:
+            std::uint32_t prepare_wait() noexcept {
+                _waiters.fetch_add(1, std::memory_order_seq_cst);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                return _epoch.load(std::memory_order_seq_cst);
+            }
+
+            void cancel_wait() noexcept {
+                _waiters.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Sleeps until notify moves the epoch past key
+             */
+            void wait(std::uint32_t key) noexcept {
+                while (_epoch.load(std::memory_order_acquire) == key)
+                    _block(key);
+                _waiters.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Wakes up to count sleepers, after the caller made its change visible
+             */
+            void notify(std::uint32_t count = 1) noexcept {
+                // Pairs with the fence in prepare_wait: either the waiter sees the
+                // change or we see the waiter
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (_waiters.load(std::memory_order_relaxed) != 0) {
+                    _epoch.fetch_add(1, std::memory_order_seq_cst);
+                    _wake(count);
+                }
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        // Failed attempts, yielding between them, before a blocking call sleeps
+        constexpr unsigned queue_spin_limit = 64;
+
+        /**
+         * @brief Repeats attempt until it succeeds, sleeping on event once spinning fails
+         */
+        template <typename Attempt>
+        void wait_until(event_count& event, Attempt attempt) {
+            // Only calls that have to wait are timed, so the uncontended path
+            // costs nothing extra
+            if (attempt())
+                return;
+            CSLT_PROFILE_SCOPE("queue.blocked");
+            unsigned spin = 0;
+            do {
+                if (spin < queue_spin_limit) {
+                    std::this_thread::yield();
+                    ++spin;
+                    continue;
+                }
+                const std::uint32_t key = event.prepare_wait();
+                if (attempt()) {
+                    event.cancel_wait();
+                    return;
+                }
+                event.wait(key);
+                spin = 0;
+            } while (!attempt());
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief The ring size for a requested capacity: a power of two, at least 2
+         */
+        inline cslt::size_t queue_ring_size(cslt::size_t capacity) {
+            cslt::size_t size = 2;
+            while (size < capacity) {
+                if (size > std::numeric_limits<cslt::size_t>::max() / 4)
+                    throw cslt::length_error(CSLT_LITERAL("Queue capacity is too large"));
+                size *= 2;
+            }
+            return size;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Uninitialized room for one T
+         */
+        template <typename T>
+        struct queue_storage {
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type bytes;
+
+            T* get() noexcept {return reinterpret_cast<T*>(&bytes);}
+        };
+    } /* end of detail namespace */
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief A bounded queue for exactly one producer thread and one consumer thread
+     *
+     * The ring holds its capacity rounded up to a power of two.  The head and
+     * tail indices sit on their own cache lines, and each side keeps a copy
+     * of the other's index, so it only reads the shared one when the ring
+     * looks full or empty.  The try_ calls never block; push and pop spin
+     * briefly and then sleep until the other side makes room or adds an item.
+     *
+     * Only the producer may call push, try_push, try_emplace, push_n and
+     * try_push_n, and only the consumer may call the pop functions.
+     *
+     * @tparam T A type with a noexcept move constructor and move assignment,
+     *           such as unique_ptr
+     */
+    template <typename T>
+    class spsc_queue {
+        static_assert(std::is_nothrow_move_constructible<T>::value &&
+                      std::is_nothrow_move_assignable<T>::value,
+                      "spsc_queue elements must move without throwing");
+    private:
+        using slot = detail::queue_storage<T>;
+
+        aligned_array_ptr<slot> _slots;
+        cslt::size_t _mask;
+
+        // The consumer's line
+        alignas(64) std::atomic<cslt::size_t> _head{0};
+        cslt::size_t _tail_cache = 0;
+
+        // The producer's line
+        alignas(64) std::atomic<cslt::size_t> _tail{0};
+        cslt::size_t _head_cache = 0;
+
+        alignas(64) detail::event_count _not_empty;
+        detail::event_count _not_full;
+// --------------------------------------------------------------------------------
+
+        T* _at(cslt::size_t index) noexcept {return _slots.data()[index & _mask].get();}
+
+        // Free slots as the producer sees them, rereading head when fewer than wanted
+        cslt::size_t _room(cslt::size_t tail, cslt::size_t wanted) noexcept {
+            cslt::size_t room = capacity() - (tail - _head_cache);
+            if (room < wanted) {
+                _head_cache = _head.load(std::memory_order_acquire);
+                room = capacity() - (tail - _head_cache);
+            }
+            return room;
+        }
+
+        // Waiting items as the consumer sees them, rereading tail when fewer than wanted
+        cslt::size_t _ready(cslt::size_t head, cslt::size_t wanted) noexcept {
+            cslt::size_t ready = _tail_cache - head;
+            if (ready < wanted) {
+                _tail_cache = _tail.load(std::memory_order_acquire);
+                ready = _tail_cache - head;
+            }
+            return ready;
+        }
+// ================================================================================
+
+    public:
+        /**
+         * @brief Creates an empty queue with room for at least capacity items
+         *
+         * @throws cslt::length_error if the capacity cannot be represented
+         */
+        explicit spsc_queue(cslt::size_t capacity)
+            : _slots(detail::queue_ring_size(capacity)), _mask(_slots.size() - 1) {}
+
+        spsc_queue(const spsc_queue&) = delete;
+        spsc_queue& operator=(const spsc_queue&) = delete;
+
+        ~spsc_queue() {
+            const cslt::size_t tail = _tail.load(std::memory_order_relaxed);
+            for (cslt::size_t i = _head.load(std::memory_order_relaxed); i != tail; ++i)
+                _at(i)->~T();
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Constructs an item at the tail from args if there is room
+         *
+         * @return false if the queue was full, in which case nothing was constructed
+         */
+        template <typename... Args>
+        bool try_emplace(Args&&... args) {
+            const cslt::size_t tail = _tail.load(std::memory_order_relaxed);
+            if (_room(tail, 1) == 0)
+                return false;
+            ::new (static_cast<void*>(_at(tail))) T(std::forward<Args>(args)...);
+            _tail.store(tail + 1, std::memory_order_release);
+            _not_empty.notify();
+            return true;
+        }
+
+        /**
+         * @brief Adds value if there is room; value is left untouched when the queue is full
+         */
+        bool try_push(T&& value) {return try_emplace(std::move(value));}
+        bool try_push(const T& value) {return try_emplace(value);}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Moves up to count items from first into the queue under one index update
+         *
+         * @return The number of items moved, which is less than count if the queue filled
+         */
+        template <typename InputIt>
+        cslt::size_t try_push_n(InputIt first, cslt::size_t count) {
+            const cslt::size_t tail = _tail.load(std::memory_order_relaxed);
+            const cslt::size_t room = _room(tail, count);
+            const cslt::size_t num = count < room ? count : room;
+            for (cslt::size_t i = 0; i < num; ++i, ++first)
+                ::new (static_cast<void*>(_at(tail + i))) T(std::move(*first));
+            if (num > 0) {
+                _tail.store(tail + num, std::memory_order_release);
+                _not_empty.notify();
+            }
+            return num;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Moves the oldest item into value
+         *
+         * @return false if the queue was empty
+         */
+        bool try_pop(T& value) noexcept {
+            const cslt::size_t head = _head.load(std::memory_order_relaxed);
+            if (_ready(head, 1) == 0)
+                return false;
+            T* item = _at(head);
+            value = std::move(*item);
+            item->~T();
+            _head.store(head + 1, std::memory_order_release);
+            _not_full.notify();
+            return true;
+        }
+
+        /**
+         * @brief Moves up to count of the oldest items to out under one index update
+         *
+         * @return The number of items moved
+         */
+        template <typename OutputIt>
+        cslt::size_t try_pop_n(OutputIt out, cslt::size_t count) {
+            const cslt::size_t head = _head.load(std::memory_order_relaxed);
+            const cslt::size_t ready = _ready(head, count);
+            const cslt::size_t num = count < ready ? count : ready;
+            for (cslt::size_t i = 0; i < num; ++i, ++out) {
+                T* item = _at(head + i);
+                *out = std::move(*item);
+                item->~T();
+            }
+            if (num > 0) {
+                _head.store(head + num, std::memory_order_release);
+                _not_full.notify();
+            }
+            return num;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Adds value, sleeping while the queue is full
+         */
+        void push(T&& value) {
+            detail::wait_until(_not_full, [this, &value] {return try_push(std::move(value));});
+        }
+
+        void push(const T& value) {
+            detail::wait_until(_not_full, [this, &value] {return try_push(value);});
+        }
+
+        /**
+         * @brief Moves all count items from first into the queue, sleeping while it is full
+         */
+        template <typename InputIt>
+        void push_n(InputIt first, cslt::size_t count) {
+            detail::wait_until(_not_full, [this, &first, &count] {
+                const cslt::size_t num = try_push_n(first, count);
+                std::advance(first, static_cast<std::ptrdiff_t>(num));
+                count -= num;
+                return count == 0;
+            });
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Moves the oldest item into value, sleeping while the queue is empty
+         */
+        void pop(T& value) {
+            detail::wait_until(_not_empty, [this, &value] {return try_pop(value);});
+        }
+
+        /**
+         * @brief Moves between 1 and count of the oldest items to out, sleeping
+         *        while the queue is empty
+         *
+         * @return The number of items moved
+         */
+        template <typename OutputIt>
+        cslt::size_t pop_n(OutputIt out, cslt::size_t count) {
+            cslt::size_t num = 0;
+            if (count > 0)
+                detail::wait_until(_not_empty, [&] {return (num = try_pop_n(out, count)) > 0;});
+            return num;
+        }
+// --------------------------------------------------------------------------------
+
+        cslt::size_t capacity() const noexcept {return _mask + 1;}
+
+        /**
+         * @brief The number of items, exact only while neither side is working
+         */
+        cslt::size_t size_approx() const noexcept {
+            const cslt::size_t head = _head.load(std::memory_order_acquire);
+            const cslt::size_t tail = _tail.load(std::memory_order_acquire);
+            return tail - head <= capacity() ? tail - head : 0;
+        }
+
+        bool empty() const noexcept {return size_approx() == 0;}
+    };
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief A bounded queue for any number of producer and consumer threads
+     *
+     * Every cell of the ring carries a sequence number that says whether it
+     * is free or full for the lap an index is on, after Dmitry Vyukov's
+     * design.  A thread claims a cell with one compare and swap on the head
+     * or tail, and the batched calls claim a run of ready cells with a single
+     * one.  A thread stalled between its claim and its sequence update only
+     * holds up the cell it claimed.
+     *
+     * @tparam T A type with a noexcept move constructor and move assignment,
+     *           such as unique_ptr
+     */
+    template <typename T>
+    class mpmc_queue {
+        static_assert(std::is_nothrow_move_constructible<T>::value &&
+                      std::is_nothrow_move_assignable<T>::value,
+                      "mpmc_queue elements must move without throwing");
+    private:
+        struct cell {
+            std::atomic<cslt::size_t> sequence;
+            detail::queue_storage<T> storage;
+        };
+
+        aligned_array_ptr<cell> _cells;
+        cslt::size_t _mask;
+
+        alignas(64) std::atomic<cslt::size_t> _tail{0};
+        alignas(64) std::atomic<cslt::size_t> _head{0};
+
+        alignas(64) detail::event_count _not_empty;
+        detail::event_count _not_full;
+// --------------------------------------------------------------------------------
+
+        cell& _at(cslt::size_t index) noexcept {return _cells.data()[index & _mask];}
+
+        static std::ptrdiff_t _lag(cslt::size_t sequence, cslt::size_t expected) noexcept {
+            return static_cast<std::ptrdiff_t>(sequence - expected);
+        }
+
+        /**
+         * @brief Claims up to count consecutive cells whose sequence is the
+         *        claiming index plus offset
+         *
+         * @return The number claimed, with first set to the index of the first
+         */
+        cslt::size_t _claim(std::atomic<cslt::size_t>& index, cslt::size_t offset,
+                            cslt::size_t count, cslt::size_t& first) noexcept {
+            cslt::size_t pos = index.load(std::memory_order_relaxed);
+            for (;;) {
+                const std::ptrdiff_t lag = _lag(_at(pos).sequence.load(std::memory_order_acquire), pos + offset);
+                if (lag < 0)
+                    return 0;
+                if (lag > 0) {
+                    pos = index.load(std::memory_order_relaxed);
+                    continue;
+                }
+                cslt::size_t num = 1;
+                while (num < count &&
+                       _at(pos + num).sequence.load(std::memory_order_acquire) == pos + num + offset)
+                    ++num;
+                if (index.compare_exchange_weak(pos, pos + num, std::memory_order_relaxed)) {
+                    first = pos;
+                    return num;
+                }
+            }
+        }
+// --------------------------------------------------------------------------------
+
+        // The cell is claimed, so the construction may not throw; a throwing one runs first
+        template <typename... Args>
+        bool _emplace(std::true_type, Args&&... args) {
+            cslt::size_t pos = 0;
+            if (_claim(_tail, 0, 1, pos) == 0)
+                return false;
+            cell& c = _at(pos);
+            ::new (static_cast<void*>(c.storage.get())) T(std::forward<Args>(args)...);
+            c.sequence.store(pos + 1, std::memory_order_release);
+            _not_empty.notify();
+            return true;
+        }
+
+        template <typename... Args>
+        bool _emplace(std::false_type, Args&&... args) {
+            T value(std::forward<Args>(args)...);
+            return _emplace(std::true_type(), std::move(value));
+        }
+// ================================================================================
+
+    public:
+        /**
+         * @brief Creates an empty queue with room for at least capacity items
+         *
+         * @throws cslt::length_error if the capacity cannot be represented
+         */
+        explicit mpmc_queue(cslt::size_t capacity)
+            : _cells(detail::queue_ring_size(capacity)), _mask(_cells.size() - 1) {
+            for (cslt::size_t i = 0; i <= _mask; ++i)
+                _cells.data()[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        mpmc_queue(const mpmc_queue&) = delete;
+        mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+        ~mpmc_queue() {
+            const cslt::size_t tail = _tail.load(std::memory_order_relaxed);
+            for (cslt::size_t i = _head.load(std::memory_order_relaxed); i != tail; ++i)
+                _at(i).storage.get()->~T();
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Constructs an item from args if there is room
+         *
+         * @return false if the queue was full
+         */
+        template <typename... Args>
+        bool try_emplace(Args&&... args) {
+            return _emplace(std::integral_constant<bool, std::is_nothrow_constructible<T, Args&&...>::value>(),
+                            std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Adds value if there is room; value is left untouched when the queue is full
+         */
+        bool try_push(T&& value) {return try_emplace(std::move(value));}
+        bool try_push(const T& value) {return try_emplace(value);}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Moves up to count items from first into consecutive free cells
+         *
+         * @return The number of items moved, which is less than count if the
+         *         queue filled or another producer claimed the next cell
+         */
+        template <typename InputIt>
+        cslt::size_t try_push_n(InputIt first, cslt::size_t count) {
+            cslt::size_t pos = 0;
+            const cslt::size_t num = count > 0 ? _claim(_tail, 0, count, pos) : 0;
+            for (cslt::size_t i = 0; i < num; ++i, ++first) {
+                cell& c = _at(pos + i);
+                ::new (static_cast<void*>(c.storage.get())) T(std::move(*first));
+                c.sequence.store(pos + i + 1, std::memory_order_release);
+            }
+            if (num > 0)
+                _not_empty.notify(static_cast<std::uint32_t>(num));
+            return num;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Moves the oldest item into value
+         *
+         * @return false if the queue was empty
+         */
+        bool try_pop(T& value) noexcept {
+            return try_pop_n(&value, 1) == 1;
+        }
+
+        /**
+         * @brief Moves up to count of the oldest items to out
+         *
+         * @return The number of items moved, which is less than count if the
+         *         queue emptied or a producer has not finished the next cell
+         */
+        template <typename OutputIt>
+        cslt::size_t try_pop_n(OutputIt out, cslt::size_t count) {
+            cslt::size_t pos = 0;
+            const cslt::size_t num = count > 0 ? _claim(_head, 1, count, pos) : 0;
+            for (cslt::size_t i = 0; i < num; ++i, ++out) {
+                cell& c = _at(pos + i);
+                T* item = c.storage.get();
+                *out = std::move(*item);
+                item->~T();
+                c.sequence.store(pos + i + _mask + 1, std::memory_order_release);
+            }
+            if (num > 0)
+                _not_full.notify(static_cast<std::uint32_t>(num));
+            return num;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Adds value, sleeping while the queue is full
+         */
+        void push(T&& value) {
+            detail::wait_until(_not_full, [this, &value] {return try_push(std::move(value));});
+        }
+
+        void push(const T& value) {
+            detail::wait_until(_not_full, [this, &value] {return try_push(value);});
+        }
+
+        /**
+         * @brief Moves all count items from first into the queue, sleeping while it is full
+         */
+        template <typename InputIt>
+        void push_n(InputIt first, cslt::size_t count) {
+            detail::wait_until(_not_full, [this, &first, &count] {
+                const cslt::size_t num = try_push_n(first, count);
+                std::advance(first, static_cast<std::ptrdiff_t>(num));
+                count -= num;
+                return count == 0;
+            });
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Moves the oldest item into value, sleeping while the queue is empty
+         */
+        void pop(T& value) {
+            detail::wait_until(_not_empty, [this, &value] {return try_pop(value);});
+        }
+
+        /**
+         * @brief Moves between 1 and count of the oldest items to out, sleeping
+         *        while the queue is empty
+         *
+         * @return The number of items moved
+         */
+        template <typename OutputIt>
+        cslt::size_t pop_n(OutputIt out, cslt::size_t count) {
+            cslt::size_t num = 0;
+            if (count > 0)
+                detail::wait_until(_not_empty, [&] {return (num = try_pop_n(out, count)) > 0;});
+            return num;
+        }
+// --------------------------------------------------------------------------------
+
+        cslt::size_t capacity() const noexcept {return _mask + 1;}
+
+        /**
+         * @brief The number of items claimed by producers and not yet by consumers
+         */
+        cslt::size_t size_approx() const noexcept {
+            const cslt::size_t head = _head.load(std::memory_order_acquire);
+            const cslt::size_t tail = _tail.load(std::memory_order_acquire);
+            return tail - head <= capacity() ? tail - head : 0;
+        }
+
+        bool empty() const noexcept {return size_approx() == 0;}
+    };
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_concurrent_queue_HPP */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,136 @@
+// ================================================================================
+// ================================================================================
+// - File:    config.hpp
+// - Purpose: Build configuration switches shared by the cslt containers
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_config_HPP
+#define cslt_config_HPP
+
+#include "except.hpp"
+#include <cassert>
+// ================================================================================
+// ================================================================================
+// BOUNDS CHECKING
+//
+// CSLT_BOUNDS_CHECK selects what operator[] of array_ptr and vector does with
+// an index past the end.  at() always throws cslt::out_of_range regardless of
+// the mode.
+//
+// - CSLT_BOUNDS_CHECKED   throws cslt::out_of_range
+// - CSLT_BOUNDS_ASSERT    calls assert, which does nothing once NDEBUG is set
+// - CSLT_BOUNDS_UNCHECKED performs no check, so loops can be vectorized
+//
+// Defining CSLT_HARDENED forces the checked mode.  Otherwise the checked mode
+// is used unless NDEBUG is defined, in which case indexing is unchecked.
+
+#define CSLT_BOUNDS_UNCHECKED 0
+#define CSLT_BOUNDS_ASSERT 1
+#define CSLT_BOUNDS_CHECKED 2
+
+#if defined(CSLT_HARDENED)
+    #undef CSLT_BOUNDS_CHECK
+    #define CSLT_BOUNDS_CHECK CSLT_BOUNDS_CHECKED
+#elif !defined(CSLT_BOUNDS_CHECK)
+    #if defined(NDEBUG)
+        #define CSLT_BOUNDS_CHECK CSLT_BOUNDS_UNCHECKED
+    #else
+        #define CSLT_BOUNDS_CHECK CSLT_BOUNDS_CHECKED
+    #endif
+#endif
+// --------------------------------------------------------------------------------
+
+#if CSLT_BOUNDS_CHECK == CSLT_BOUNDS_CHECKED
+    #define CSLT_CHECK_INDEX(index, len) \
+        do { if ((index) >= (len)) throw cslt::out_of_range(CSLT_LITERAL("Index out of range")); } while (0)
+#elif CSLT_BOUNDS_CHECK == CSLT_BOUNDS_ASSERT
+    #define CSLT_CHECK_INDEX(index, len) assert((index) < (len) && "Index out of range")
+#else
+    #define CSLT_CHECK_INDEX(index, len) ((void)0)
+#endif
+// ================================================================================
+// ================================================================================
+// SIMD
+//
+// CSLT_SIMD_SSE2 or CSLT_SIMD_NEON is set to 1 when the target supports that
+// instruction set, and the kernels that use it fall back to portable code
+// otherwise.  Defining CSLT_NO_SIMD forces the portable code everywhere.
+
+#if !defined(CSLT_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define CSLT_SIMD_SSE2 1
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+        #define CSLT_SIMD_NEON 1
+    #endif
+#endif
+
+#ifndef CSLT_SIMD_SSE2
+    #define CSLT_SIMD_SSE2 0
+#endif
+#ifndef CSLT_SIMD_NEON
+    #define CSLT_SIMD_NEON 0
+#endif
+// ================================================================================
+// ================================================================================
+// BYTE ORDER
+//
+// CSLT_LITTLE_ENDIAN is 1 when the target stores the least significant byte of
+// a word first.  Compilers that do not report the byte order are assumed to
+// target a little-endian machine, as every MSVC target does.
+
+#if !defined(CSLT_LITTLE_ENDIAN)
+    #if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        #define CSLT_LITTLE_ENDIAN 0
+    #else
+        #define CSLT_LITTLE_ENDIAN 1
+    #endif
+#endif
+// ================================================================================
+// ================================================================================
+// CONSTANT EVALUATION
+//
+// CSLT_CONSTANT_EVALUATED() is true while the compiler evaluates a constant
+// expression, which lets a constexpr function call an out-of-line kernel at
+// run time and keep a portable loop for compile time.  Compilers without the
+// builtin always take the portable loop.
+
+#if defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+        #define CSLT_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+    #endif
+#endif
+#if !defined(CSLT_CONSTANT_EVALUATED)
+    #if (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+        #define CSLT_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+    #else
+        #define CSLT_CONSTANT_EVALUATED() true
+    #endif
+#endif
+// ================================================================================
+// ================================================================================
+// INLINING
+//
+// CSLT_NOINLINE keeps a function out of line, for rare paths that would
+// otherwise be inlined into every caller of a hot one.
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define CSLT_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+    #define CSLT_NOINLINE __declspec(noinline)
+#else
+    #define CSLT_NOINLINE
+#endif
+// ================================================================================
+// ================================================================================
+#endif /* cslt_config_HPP */
+// ================================================================================
+// ================================================================================
+// eof
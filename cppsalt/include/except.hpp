@@ -15,10 +15,100 @@
 
 #ifndef except_HPP
 #define except_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+// ================================================================================
+// ================================================================================
+// Marks a string literal as a message that an exception keeps by pointer.
+// Pasting empty literals around str rejects anything but a literal.
+#define CSLT_LITERAL(str) (::cslt::literal_message{"" str ""})
 // ================================================================================
 // ================================================================================
 namespace cslt {
 
+// ================================================================================
+// ================================================================================
+    /**
+     * Text with static storage, which error_message keeps by pointer.  Build it
+     * with CSLT_LITERAL, which accepts only a string literal.
+     */
+    struct literal_message {
+        const char* text;
+    };
+
+    /**
+     * Class error_message
+     * Holds the text of an exception without copying it when it can be avoided.
+     *
+     * Text marked with CSLT_LITERAL is stored by pointer, so throwing with it
+     * never allocates.  Any other text, including a const char array, is
+     * copied once into an immutable buffer with an atomic reference count, so
+     * copying the message afterwards never allocates.  An unmarked array
+     * could be a local buffer that dies with the stack frame, and overload
+     * resolution cannot tell it from a literal.  If the buffer cannot be
+     * allocated a fixed fallback text is used rather than throwing.
+     */
+    class error_message {
+    private:
+        // The characters follow the header in the same allocation
+        struct buffer {
+            std::atomic<unsigned> refs;
+        };
+
+        const char* text;
+        buffer* block = nullptr;  // nullptr when text points to static storage
+// --------------------------------------------------------------------------------
+
+        void copy_text(const char* str) noexcept;
+
+        void release() noexcept;
+// ================================================================================
+
+    public:
+        /**
+         * Stores a pointer to a string literal
+         */
+        error_message(literal_message str) noexcept : text(str.text) {}
+// --------------------------------------------------------------------------------
+
+        /**
+         * Copies text that may change or go away after the exception is created
+         */
+        template <typename P, typename = typename std::enable_if<
+                                  std::is_same<P, const char*>::value || std::is_same<P, char*>::value>::type>
+        error_message(P str) noexcept : text(nullptr) {
+            copy_text(str);
+        }
+// --------------------------------------------------------------------------------
+
+        error_message(const error_message& other) noexcept : text(other.text), block(other.block) {
+            if (block)
+                block->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        error_message& operator=(const error_message& other) noexcept {
+            if (other.block)
+                other.block->refs.fetch_add(1, std::memory_order_relaxed);
+            release();
+            text = other.text;
+            block = other.block;
+            return *this;
+        }
+
+        ~error_message() {
+            release();
+        }
+// --------------------------------------------------------------------------------
+
+        const char* c_str() const noexcept {return text;}
+
+        /**
+         * Returns true if the text was copied into a reference counted buffer
+         */
+        bool is_shared() const noexcept {return block != nullptr;}
+    };
 // ================================================================================
 // ================================================================================
     /**
@@ -27,10 +117,12 @@ namespace cslt {
      *
      * This exception is thrown for any type of exception.
      * It holds an error message that can be retrieved using the what() method.
+     * Throwing an exception with a string literal message never allocates, and
+     * copying any exception only adjusts a reference count.
      */
     class exception {
     private:
-        char* message;  // Dynamically allocated message for the exception
+        error_message message;
 // ================================================================================
 
     public:
@@ -38,15 +130,15 @@ namespace cslt {
          * Constructor for exception exception.
          * @param msg The message for the exception. Defaults to a standard error message if not provided.
          */
-        explicit exception(const char* msg = "Exception raised!");
+        explicit exception(error_message msg = CSLT_LITERAL("Exception raised!")) noexcept;
 // --------------------------------------------------------------------------------
 
         /**
          * Copy constructor for exception.
-         * Creates a deep copy of another exception instance.
+         * Shares the message of another exception instance.
          * @param other The exception instance to be copied.
          */
-        exception(const exception& other);
+        exception(const exception& other) noexcept = default;
 // --------------------------------------------------------------------------------
 
         /**
@@ -55,12 +147,12 @@ namespace cslt {
          * @param other The exception instance to be copied.
          * @return Reference to the current instance.
          */
-        exception& operator=(const exception& other);
+        exception& operator=(const exception& other) noexcept = default;
 // --------------------------------------------------------------------------------
 
         /**
          * Destructor for exception.
-         * Frees the dynamically allocated message.
+         * Releases the message buffer if this is the last exception sharing it.
          */
         virtual ~exception();
 // --------------------------------------------------------------------------------
@@ -84,7 +176,7 @@ namespace cslt {
      */
     class logic_error : public exception {
     public:
-        explicit logic_error(const char* msg = "Logic Error Raised!") : exception(msg) {};
+        explicit logic_error(error_message msg = CSLT_LITERAL("Logic Error Raised!")) : exception(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -98,7 +190,7 @@ namespace cslt {
      */
     class invalid_argument : public logic_error {
     public:
-        explicit invalid_argument(const char *msg = "Invalid Argument Error Raised!") : logic_error(msg) {};
+        explicit invalid_argument(error_message msg = CSLT_LITERAL("Invalid Argument Error Raised!")) : logic_error(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -115,7 +207,7 @@ namespace cslt {
      */
     class domain_error : public logic_error {
     public:
-        explicit domain_error(const char *msg = "Domain Error Raised!") : logic_error(msg) {};
+        explicit domain_error(error_message msg = CSLT_LITERAL("Domain Error Raised!")) : logic_error(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -131,7 +223,7 @@ namespace cslt {
      */
     class length_error : public logic_error {
     public:
-        explicit length_error(const char *msg = "Length Error Raised!") : logic_error(msg) {};
+        explicit length_error(error_message msg = CSLT_LITERAL("Length Error Raised!")) : logic_error(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -148,7 +240,7 @@ namespace cslt {
      */
     class out_of_range : public logic_error {
     public:
-        explicit out_of_range(const char *msg = "Out of Range Error Raised!") : logic_error(msg) {};
+        explicit out_of_range(error_message msg = CSLT_LITERAL("Out of Range Error Raised!")) : logic_error(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -163,7 +255,7 @@ namespace cslt {
      */
     class future_error : public logic_error {
     public:
-        explicit future_error(const char *msg = "Future Error Raised!") : logic_error(msg) {};
+        explicit future_error(error_message msg = CSLT_LITERAL("Future Error Raised!")) : logic_error(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -177,7 +269,7 @@ namespace cslt {
      */
     class runtime_error: public exception {
     public:
-        explicit runtime_error(const char* msg = "Runtime Error Raised!") : exception(msg) {};
+        explicit runtime_error(error_message msg = CSLT_LITERAL("Runtime Error Raised!")) : exception(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -193,7 +285,7 @@ namespace cslt {
      */
     class range_error : public runtime_error {
     public:
-        explicit range_error(const char *msg = "Range Error Raised!") : runtime_error(msg) {};
+        explicit range_error(error_message msg = CSLT_LITERAL("Range Error Raised!")) : runtime_error(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -209,7 +301,7 @@ namespace cslt {
      */
     class overflow_error : public runtime_error {
     public:
-        explicit overflow_error(const char *msg = "Overflow Error Raised!") : runtime_error(msg) {};
+        explicit overflow_error(error_message msg = CSLT_LITERAL("Overflow Error Raised!")) : runtime_error(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -224,7 +316,7 @@ namespace cslt {
      */
     class underflow_error : public runtime_error {
     public:
-        explicit underflow_error(const char *msg = "Underflow Error Raised!") : runtime_error(msg) {};
+        explicit underflow_error(error_message msg = CSLT_LITERAL("Underflow Error Raised!")) : runtime_error(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -238,7 +330,7 @@ namespace cslt {
      */
     class regex_error : public runtime_error {
     public:
-        explicit regex_error(const char *msg = "Regex Error Raised!") : runtime_error(msg) {};
+        explicit regex_error(error_message msg = CSLT_LITERAL("Regex Error Raised!")) : runtime_error(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -254,7 +346,7 @@ namespace cslt {
      */
     class system_error : public runtime_error {
     public:
-        explicit system_error(const char *msg = "System Error Raised!") : runtime_error(msg) {};
+        explicit system_error(error_message msg = CSLT_LITERAL("System Error Raised!")) : runtime_error(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -265,21 +357,21 @@ namespace cslt {
      */
     class tx_exception : public runtime_error {
     public:
-        explicit tx_exception(const char *msg = "TX Exception Raised!") : runtime_error(msg) {};
+        explicit tx_exception(error_message msg = CSLT_LITERAL("TX Exception Raised!")) : runtime_error(msg) {};
     };
 // ================================================================================
 // ================================================================================
 
     class nonexistent_local_time : public runtime_error {
     public:
-        explicit nonexistent_local_time(const char *msg = "Nonexistent Local Time Error Raised!") : runtime_error(msg) {};
+        explicit nonexistent_local_time(error_message msg = CSLT_LITERAL("Nonexistent Local Time Error Raised!")) : runtime_error(msg) {};
     };
 // ================================================================================
 // ================================================================================
 
     class ambiguous_local_time : public runtime_error {
     public:
-        explicit ambiguous_local_time(const char *msg = "Ambiguous Local Time Error Raised!") : runtime_error(msg) {};
+        explicit ambiguous_local_time(error_message msg = CSLT_LITERAL("Ambiguous Local Time Error Raised!")) : runtime_error(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -293,7 +385,7 @@ namespace cslt {
      */
     class format_error : public runtime_error {
     public:
-        explicit format_error(const char *msg = "Format Error Raised!") : runtime_error(msg) {};
+        explicit format_error(error_message msg = CSLT_LITERAL("Format Error Raised!")) : runtime_error(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -308,7 +400,7 @@ namespace cslt {
      */
     class bad_typeid : public exception {
     public:
-        explicit bad_typeid(const char *msg = "Bad Type ID Error Raised!") : exception(msg) {};
+        explicit bad_typeid(error_message msg = CSLT_LITERAL("Bad Type ID Error Raised!")) : exception(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -326,7 +418,7 @@ namespace cslt {
      */
     class bad_cast : public exception {
     public:
-        explicit bad_cast(const char *msg = "Bad Cast Error Raised!") : exception(msg) {};
+        explicit bad_cast(error_message msg = CSLT_LITERAL("Bad Cast Error Raised!")) : exception(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -340,7 +432,7 @@ namespace cslt {
      */
     class bad_optional_access : public exception {
     public:
-        explicit bad_optional_access(const char *msg = "Bad Optional Access Error Raised!") : exception(msg) {};
+        explicit bad_optional_access(error_message msg = CSLT_LITERAL("Bad Optional Access Error Raised!")) : exception(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -354,7 +446,7 @@ namespace cslt {
      */
     class bad_expected_access : public exception {
     public:
-        explicit bad_expected_access(const char *msg = "Bad Expected Access Error Raised!") : exception(msg) {};
+        explicit bad_expected_access(error_message msg = CSLT_LITERAL("Bad Expected Access Error Raised!")) : exception(msg) {};
     };
 // ================================================================================ 
 // ================================================================================
@@ -368,7 +460,7 @@ namespace cslt {
      */
     class bad_weak_ptr : public exception {
     public:
-        explicit bad_weak_ptr(const char *msg = "Bad Weak Pointer Error Raised!") : exception(msg) {};
+        explicit bad_weak_ptr(error_message msg = CSLT_LITERAL("Bad Weak Pointer Error Raised!")) : exception(msg) {};
     };
 // ================================================================================
 // ================================================================================
@@ -382,7 +474,7 @@ namespace cslt {
      */
     class bad_function_call : public exception {
     public:
-        explicit bad_function_call(const char *msg = "Bad Function Call Error Raised!") : exception(msg) {}
+        explicit bad_function_call(error_message msg = CSLT_LITERAL("Bad Function Call Error Raised!")) : exception(msg) {}
     };
 // ================================================================================
 // ================================================================================
@@ -396,7 +488,7 @@ namespace cslt {
      */
     class bad_alloc : public exception {
     public:
-        explicit bad_alloc(const char *msg = "Memory Allocation Error Raised!") : exception(msg) {}
+        explicit bad_alloc(error_message msg = CSLT_LITERAL("Memory Allocation Error Raised!")) : exception(msg) {}
     };
 // ================================================================================
 // ================================================================================
@@ -413,8 +505,19 @@ namespace cslt {
      */
     class bad_array_new_length : public bad_alloc {
     public:
-        explicit bad_array_new_length(const char *msg = "Bad Array New Length Error Raised!") : bad_alloc(msg) {};
+        explicit bad_array_new_length(error_message msg = CSLT_LITERAL("Bad Array New Length Error Raised!")) : bad_alloc(msg) {};
     };
+// --------------------------------------------------------------------------------
+
+    /**
+     * Returns a bad_alloc that was created before main, for use when memory runs out
+     */
+    const bad_alloc& emergency_bad_alloc() noexcept;
+
+    /**
+     * Throws a copy of emergency_bad_alloc(), which copies no text
+     */
+    [[noreturn]] void throw_bad_alloc();
 // ================================================================================
 // ================================================================================
 
@@ -429,13 +532,13 @@ namespace cslt {
      */
     class bad_exception : public exception {
     public:
-        explicit bad_exception(const char *msg = "Bad Exception Error Raised!") : exception(msg) {}
+        explicit bad_exception(error_message msg = CSLT_LITERAL("Bad Exception Error Raised!")) : exception(msg) {}
     };
 // ================================================================================
 // ================================================================================
 
     class bad_variant_access : public exception {
-        explicit bad_variant_access(const char *msg = "Bad Variant Access Error Raised!") : exception(msg) {};
+        explicit bad_variant_access(error_message msg = CSLT_LITERAL("Bad Variant Access Error Raised!")) : exception(msg) {};
     };
 // ================================================================================
 // ================================================================================
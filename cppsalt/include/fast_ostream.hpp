@@ -0,0 +1,411 @@
+// ================================================================================
+// ================================================================================
+// - File:    fast_ostream.hpp
+// - Purpose: A buffered output sink on a file descriptor with checked format strings
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_fast_ostream_HPP
+#define cslt_fast_ostream_HPP
+
+#include "charconv.hpp"
+#include "dtype.hpp"
+#include "memory.hpp"
+#include "string_view.hpp"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+// ================================================================================
+// ================================================================================
+// FORMAT STRINGS
+//
+// CSLT_FORMAT("x = {}, y = {}") turns a string literal into a format_string
+// whose text is part of its type, so print() can count the {} fields and
+// check them against its arguments at compile time.  {{ and }} write a
+// single brace.  Fields take no specification; fixed() and hex() below wrap
+// an argument that needs one.
+
+namespace cslt {
+
+    /**
+     * @brief What the format text holds at a position
+     */
+    enum class format_token {
+        end,         // The end of the text
+        field,       // {}
+        open_brace,  // {{
+        close_brace, // }}
+        invalid      // A single { or } that is none of the above
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Returns the position of the first token at or after pos
+     */
+    constexpr cslt::size_t format_next_token(const char* text, cslt::size_t len, cslt::size_t pos) {
+        while (pos < len && text[pos] != '{' && text[pos] != '}')
+            ++pos;
+        return pos;
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Returns the kind of the token at pos, which format_next_token found
+     */
+    constexpr format_token format_token_at(const char* text, cslt::size_t len, cslt::size_t pos) {
+        return pos >= len ? format_token::end
+             : pos + 1 >= len ? format_token::invalid
+             : text[pos] == '{' && text[pos + 1] == '}' ? format_token::field
+             : text[pos] == '{' && text[pos + 1] == '{' ? format_token::open_brace
+             : text[pos] == '}' && text[pos + 1] == '}' ? format_token::close_brace
+             : format_token::invalid;
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Returns the number of {} fields, or -1 if a brace is unmatched
+     */
+    constexpr int format_field_count(const char* text, cslt::size_t len) {
+        int fields = 0;
+        cslt::size_t pos = format_next_token(text, len, 0);
+        while (pos < len) {
+            const format_token token = format_token_at(text, len, pos);
+            if (token == format_token::invalid)
+                return -1;
+            if (token == format_token::field)
+                ++fields;
+            pos = format_next_token(text, len, pos + 2);
+        }
+        return fields;
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief A format text known at compile time, made by CSLT_FORMAT
+     *
+     * S has static constexpr members text() and size() returning the literal
+     * and its length.
+     */
+    template <typename S>
+    struct format_string {
+        static constexpr int fields = format_field_count(S::text(), S::size());
+        static_assert(fields >= 0, "format string has a { or } that is not part of {}, {{ or }}");
+    };
+
+    template <typename S>
+    constexpr int format_string<S>::fields;
+} /* end of cslt namespace */
+
+#define CSLT_FORMAT(literal) \
+    ([] { \
+        struct cslt_format_text { \
+            static constexpr const char* text() {return literal;} \
+            static constexpr cslt::size_t size() {return sizeof(literal) - 1;} \
+        }; \
+        return cslt::format_string<cslt_format_text>(); \
+    }())
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    /**
+     * @brief When a fast_ostream passes its buffer to the descriptor
+     */
+    enum class flush_policy {
+        when_full,  // Only when the buffer fills, when flush() is called and on destruction
+        each_line,  // Also after any write that completes a line
+        each_write  // After every write or print, which still makes one call per print
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Writes value with precision digits after the decimal point
+     */
+    struct fixed_format {
+        double value;
+        int precision;
+    };
+
+    inline fixed_format fixed(double value, int precision) noexcept {return {value, precision};}
+
+    /**
+     * @brief Writes value in lower case hexadecimal with no prefix
+     */
+    struct hex_format {
+        std::uint64_t value;
+    };
+
+    template <typename T, typename = std::enable_if_t<std::is_integral<T>::value>>
+    hex_format hex(T value) noexcept {
+        return {static_cast<std::uint64_t>(static_cast<std::make_unsigned_t<T>>(value))};
+    }
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief A buffered writer on an open file descriptor
+     *
+     * std::ostream pays for a sentry, a locale lookup and a virtual call on
+     * every insertion, and cslt::cout shares one lock with every other
+     * thread.  A fast_ostream copies text into a buffer it owns, converts
+     * numbers straight into that buffer with to_chars, and hands it to the
+     * descriptor with one write call per flush.  Nothing is allocated after
+     * construction.
+     *
+     * A full buffer is flushed up to its last newline, and the partial line
+     * is kept for the next flush, so records written by separate streams on
+     * the same descriptor do not split each other.  A single write larger
+     * than the buffer goes to the descriptor directly.
+     *
+     * A stream is not thread safe; use one per thread, as fast_out() and
+     * fast_err() do.  Write errors throw cslt::system_error.
+     */
+    class fast_ostream {
+    private:
+        array_ptr<char> buffer;
+        char* cursor;
+        char* limit;
+        char* scanned;  // Text before this has been searched for a newline
+        int fd;
+        flush_policy mode;
+// --------------------------------------------------------------------------------
+
+        char* begin() const noexcept {return buffer.data();}
+
+        /**
+         * @brief Writes num characters to the descriptor, retrying partial writes
+         */
+        void write_all(const char* data, cslt::size_t num);
+
+        /**
+         * @brief Makes room when num characters do not fit, or writes them directly
+         *
+         * @returns true if the characters still need to be copied to the buffer
+         */
+        bool make_room(const char* str, cslt::size_t num);
+
+        /**
+         * @brief Applies the flush policy once a write or print is complete
+         */
+        void finish() {
+            if (mode != flush_policy::when_full)
+                finish_slow();
+        }
+        void finish_slow();
+// --------------------------------------------------------------------------------
+
+        void append(const char* str, cslt::size_t num) {
+            if (num > static_cast<cslt::size_t>(limit - cursor) && !make_room(str, num))
+                return;
+            std::memcpy(cursor, str, num);
+            cursor += num;
+        }
+
+        void append(char chr) {
+            if (cursor == limit)
+                make_room(&chr, 1);
+            *cursor++ = chr;
+        }
+
+        /**
+         * @brief Returns a pointer to at least num free characters of the buffer
+         */
+        char* reserve(cslt::size_t num) {
+            if (num > static_cast<cslt::size_t>(limit - cursor))
+                make_room(nullptr, num);
+            return cursor;
+        }
+
+        template <typename T>
+        void append_integer(T value) {
+            cursor = to_chars(reserve(max_integer_chars), limit, value).ptr;
+        }
+
+        void append_double(double value) {
+            cursor = to_chars(reserve(max_double_chars), limit, value).ptr;
+        }
+
+        void append_value(string_view view) {append(view.data(), view.size());}
+        void append_value(const char* str) {append_value(string_view(str));}
+        void append_value(char chr) {append(chr);}
+        void append_value(bool value) {
+            if (value)
+                append("true", 4);
+            else
+                append("false", 5);
+        }
+        void append_value(double value) {append_double(value);}
+        void append_value(float value) {append_double(value);}
+        void append_value(fixed_format value);
+        void append_value(hex_format value);
+
+        template <typename T>
+        std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                         !std::is_same<T, char>::value>
+        append_value(T value) {append_integer(value);}
+// --------------------------------------------------------------------------------
+
+        template <typename S, cslt::size_t Pos, typename... Args>
+        void print_from(const Args&... args) {
+            constexpr cslt::size_t token = format_next_token(S::text(), S::size(), Pos);
+            if (token != Pos)
+                append(S::text() + Pos, token - Pos);
+            print_token<S, token>(std::integral_constant<format_token,
+                                  format_token_at(S::text(), S::size(), token)>(), args...);
+        }
+
+        template <typename S, cslt::size_t Pos, typename... Args>
+        void print_token(std::integral_constant<format_token, format_token::end>, const Args&...) {}
+
+        template <typename S, cslt::size_t Pos, typename Arg, typename... Args>
+        void print_token(std::integral_constant<format_token, format_token::field>,
+                         const Arg& arg, const Args&... args) {
+            append_value(arg);
+            print_from<S, Pos + 2>(args...);
+        }
+
+        template <typename S, cslt::size_t Pos, typename... Args>
+        void print_token(std::integral_constant<format_token, format_token::open_brace>,
+                         const Args&... args) {
+            append('{');
+            print_from<S, Pos + 2>(args...);
+        }
+
+        template <typename S, cslt::size_t Pos, typename... Args>
+        void print_token(std::integral_constant<format_token, format_token::close_brace>,
+                         const Args&... args) {
+            append('}');
+            print_from<S, Pos + 2>(args...);
+        }
+// ================================================================================
+
+    public:
+        static constexpr cslt::size_t default_buffer_size = 65536;
+
+        /**
+         * @brief The smallest buffer, which always holds a converted number
+         */
+        static constexpr cslt::size_t min_buffer_size = 64;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Creates a stream on fd, which it does not close
+         *
+         * @param fd          An open file descriptor
+         * @param buffer_size The size of the buffer, raised to min_buffer_size if smaller
+         * @param policy      When the buffer is written to fd
+         */
+        explicit fast_ostream(int fd, cslt::size_t buffer_size = default_buffer_size,
+                              flush_policy policy = flush_policy::when_full);
+// --------------------------------------------------------------------------------
+
+        fast_ostream(const fast_ostream&) = delete;
+        fast_ostream& operator=(const fast_ostream&) = delete;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Flushes the buffer, ignoring any error since a destructor cannot report it
+         */
+        ~fast_ostream();
+// --------------------------------------------------------------------------------
+
+        fast_ostream& write(const char* str, cslt::size_t num) {
+            append(str, num);
+            finish();
+            return *this;
+        }
+
+        fast_ostream& put(char chr) {
+            append(chr);
+            finish();
+            return *this;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Writes one value: text, a character, a bool as true or
+         *        false, an integer, a double in its shortest exact form, or
+         *        the result of fixed() or hex()
+         */
+        template <typename T>
+        auto operator<<(const T& value) -> decltype(append_value(value), *this) {
+            append_value(value);
+            finish();
+            return *this;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Writes the format text with each {} replaced by the next argument
+         *
+         * The fields are counted at compile time, and a call with the wrong
+         * number of arguments does not compile.  The text between fields is
+         * copied with lengths that are also compile time constants.
+         */
+        template <typename S, typename... Args>
+        fast_ostream& print(format_string<S>, const Args&... args) {
+            static_assert(format_string<S>::fields == static_cast<int>(sizeof...(Args)),
+                          "the number of arguments does not match the {} fields of the format string");
+            print_from<S, 0>(args...);
+            finish();
+            return *this;
+        }
+
+        /**
+         * @brief print() followed by a newline
+         */
+        template <typename S, typename... Args>
+        fast_ostream& println(format_string<S>, const Args&... args) {
+            static_assert(format_string<S>::fields == static_cast<int>(sizeof...(Args)),
+                          "the number of arguments does not match the {} fields of the format string");
+            print_from<S, 0>(args...);
+            append('\n');
+            finish();
+            return *this;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Writes the whole buffer to the descriptor with one write call
+         */
+        void flush();
+// --------------------------------------------------------------------------------
+
+        cslt::size_t buffered() const noexcept {return static_cast<cslt::size_t>(cursor - begin());}
+        cslt::size_t capacity() const noexcept {return buffer.size();}
+        int descriptor() const noexcept {return fd;}
+        flush_policy policy() const noexcept {return mode;}
+        void policy(flush_policy policy) noexcept {mode = policy;}
+    };
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief The calling thread's buffered stream on standard output
+     *
+     * Each thread has its own stream, flushed when the buffer fills and when
+     * the thread exits; the main thread's is flushed at program exit.  Text
+     * written here and through cslt::cout or printf is not kept in order
+     * unless the stream is flushed in between.
+     */
+    fast_ostream& fast_out();
+
+    /**
+     * @brief The calling thread's stream on standard error, flushed after every write
+     */
+    fast_ostream& fast_err();
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_fast_ostream_HPP */
+// ================================================================================
+// ================================================================================
+// eof
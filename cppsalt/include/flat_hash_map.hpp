@@ -0,0 +1,955 @@
+// ================================================================================
+// ================================================================================
+// - File:    flat_hash_map.hpp
+// - Purpose: An open addressing hash map that stores its entries inline
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_flat_hash_map_HPP
+#define cslt_flat_hash_map_HPP
+
+#include "dtype.hpp"
+#include "config.hpp"
+#include "except.hpp"
+#include "hash.hpp"
+#include "instrument.hpp"
+#include "util.hpp"
+#include "memory.hpp"
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if CSLT_SIMD_SSE2
+    #include <emmintrin.h>
+#elif CSLT_SIMD_NEON
+    #include <arm_neon.h>
+#endif
+// ================================================================================
+// ================================================================================
+// CONTROL BYTES
+//
+// Every slot of the table has one control byte.  A full slot stores the low
+// seven bits of its hash, an empty or erased slot stores a negative marker.
+// Lookups compare sixteen control bytes at once and only touch the entries
+// whose tag matches.
+
+namespace cslt {
+
+    using ctrl_t = std::int8_t;
+
+    constexpr ctrl_t ctrl_empty = -128;
+    constexpr ctrl_t ctrl_deleted = -2;
+    constexpr cslt::size_t group_width = 16;
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief The positions of the matching control bytes in a group, lowest first
+     *
+     * SSE2 and the portable code produce one bit per byte.  NEON produces one
+     * bit in every four, which the shift undoes.
+     */
+    class group_mask {
+    private:
+    #if CSLT_SIMD_NEON
+        static constexpr unsigned shift = 2;
+    #else
+        static constexpr unsigned shift = 0;
+    #endif
+        std::uint64_t bits;
+// --------------------------------------------------------------------------------
+
+        static unsigned trailing_zeros(std::uint64_t value) noexcept {
+        #if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_ctzll(value));
+        #else
+            unsigned count = 0;
+            while (!(value & 1)) {
+                value >>= 1;
+                ++count;
+            }
+            return count;
+        #endif
+        }
+// --------------------------------------------------------------------------------
+
+    public:
+        explicit group_mask(std::uint64_t value) noexcept : bits(value) {}
+
+        explicit operator bool() const noexcept {return bits != 0;}
+
+        /**
+         * @brief Returns the offset of the first match; the mask must not be empty
+         */
+        unsigned lowest() const noexcept {return trailing_zeros(bits) >> shift;}
+
+        group_mask& operator++() noexcept {
+            bits &= bits - 1;
+            return *this;
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Sixteen consecutive control bytes, compared in one instruction
+     */
+    class ctrl_group {
+    private:
+    #if CSLT_SIMD_SSE2
+        __m128i ctrl;
+
+        static group_mask to_mask(__m128i matches) noexcept {
+            return group_mask(static_cast<std::uint32_t>(_mm_movemask_epi8(matches)));
+        }
+    #elif CSLT_SIMD_NEON
+        int8x16_t ctrl;
+
+        static group_mask to_mask(uint8x16_t matches) noexcept {
+            // Narrowing by four bits turns each byte into a nibble of the result
+            const uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+            return group_mask(vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ULL);
+        }
+    #else
+        ctrl_t ctrl[group_width];
+
+        template <typename Pred>
+        group_mask to_mask(Pred pred) const noexcept {
+            std::uint64_t bits = 0;
+            for (cslt::size_t i = 0; i < group_width; ++i)
+                if (pred(ctrl[i]))
+                    bits |= std::uint64_t(1) << i;
+            return group_mask(bits);
+        }
+    #endif
+// --------------------------------------------------------------------------------
+
+    public:
+    #if CSLT_SIMD_SSE2
+        explicit ctrl_group(const ctrl_t* pos) noexcept
+            : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+        group_mask match(ctrl_t tag) const noexcept {
+            return to_mask(_mm_cmpeq_epi8(_mm_set1_epi8(tag), ctrl));
+        }
+
+        group_mask match_empty() const noexcept {
+            return to_mask(_mm_cmpeq_epi8(_mm_set1_epi8(ctrl_empty), ctrl));
+        }
+
+        // Both markers are negative, so the sign bits alone pick them out
+        group_mask match_empty_or_deleted() const noexcept {
+            return group_mask(static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl)));
+        }
+    #elif CSLT_SIMD_NEON
+        explicit ctrl_group(const ctrl_t* pos) noexcept : ctrl(vld1q_s8(pos)) {}
+
+        group_mask match(ctrl_t tag) const noexcept {
+            return to_mask(vceqq_s8(ctrl, vdupq_n_s8(tag)));
+        }
+
+        group_mask match_empty() const noexcept {
+            return to_mask(vceqq_s8(ctrl, vdupq_n_s8(ctrl_empty)));
+        }
+
+        group_mask match_empty_or_deleted() const noexcept {
+            return to_mask(vcltq_s8(ctrl, vdupq_n_s8(0)));
+        }
+    #else
+        explicit ctrl_group(const ctrl_t* pos) noexcept {
+            std::memcpy(ctrl, pos, group_width);
+        }
+
+        group_mask match(ctrl_t tag) const noexcept {
+            return to_mask([tag](ctrl_t c) {return c == tag;});
+        }
+
+        group_mask match_empty() const noexcept {
+            return to_mask([](ctrl_t c) {return c == ctrl_empty;});
+        }
+
+        group_mask match_empty_or_deleted() const noexcept {
+            return to_mask([](ctrl_t c) {return c < 0;});
+        }
+    #endif
+    };
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief An open addressing hash map with its entries stored in one flat array
+     *
+     * Entries live directly in the table as pair<K, V>, next to an array of
+     * one byte tags, so a lookup reads a group of sixteen tags with SSE2 or
+     * NEON and then usually a single entry.  There are no per entry nodes.
+     * The table holds a power of two number of slots and grows by doubling
+     * once it is seven eighths full.  Erased slots become tombstones that are
+     * reused by later inserts and purged on the next rehash.
+     *
+     * Inserting may rehash, which moves every entry and invalidates all
+     * iterators, pointers and references.  Erasing invalidates only the
+     * iterators to the erased entry.  The key of an entry must not be changed
+     * through an iterator.
+     *
+     * A rehash that throws leaves the map as it was.  When the hasher is not
+     * noexcept, each rehash therefore hashes every entry into a temporary
+     * array before it moves any of them.
+     *
+     * When both Hash and KeyEqual define is_transparent, find, count, contains
+     * and erase accept any type they can hash and compare.  The defaults for
+     * String keys are transparent, so a map keyed by String may be searched
+     * with a const char* without building a temporary String.
+     *
+     * @tparam K The key type
+     * @tparam V The mapped type
+     * @tparam Hash The function object that hashes keys
+     * @tparam KeyEqual The function object that compares keys
+     * @tparam Alloc The allocator that provides the table
+     */
+    template <typename K, typename V, typename Hash = cslt::hash<K>, typename KeyEqual = cslt::equal_to<K>,
+              typename Alloc = cslt::allocator<cslt::pair<K, V>>>
+    class flat_hash_map {
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = cslt::pair<K, V>;
+        using size_type = cslt::size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using allocator_type = Alloc;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Forward iterator over the full slots of the table
+         */
+        template <typename Value>
+        class table_iterator {
+        private:
+            friend class flat_hash_map;
+
+            const ctrl_t* _ctrl = nullptr;
+            const ctrl_t* _end = nullptr;
+            Value* _slot = nullptr;
+
+            table_iterator(const ctrl_t* ctrl, const ctrl_t* end, Value* slot) noexcept
+                : _ctrl(ctrl), _end(end), _slot(slot) {}
+
+            void _skip_free() noexcept {
+                while (_ctrl != _end && *_ctrl < 0) {
+                    ++_ctrl;
+                    ++_slot;
+                }
+            }
+// --------------------------------------------------------------------------------
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename std::remove_const<Value>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            table_iterator() noexcept = default;
+
+            // An iterator converts to a const_iterator
+            template <typename Other, typename = std::enable_if_t<!std::is_same<Other, Value>::value &&
+                                                                  std::is_same<const Other, Value>::value>>
+            table_iterator(const table_iterator<Other>& other) noexcept
+                : _ctrl(other._ctrl), _end(other._end), _slot(other._slot) {}
+
+            reference operator*() const noexcept {return *_slot;}
+            pointer operator->() const noexcept {return _slot;}
+
+            table_iterator& operator++() noexcept {
+                ++_ctrl;
+                ++_slot;
+                _skip_free();
+                return *this;
+            }
+
+            table_iterator operator++(int) noexcept {
+                table_iterator old = *this;
+                ++*this;
+                return old;
+            }
+
+            bool operator==(const table_iterator& other) const noexcept {return _ctrl == other._ctrl;}
+            bool operator!=(const table_iterator& other) const noexcept {return _ctrl != other._ctrl;}
+
+            template <typename Other>
+            friend class table_iterator;
+        };
+
+        using iterator = table_iterator<value_type>;
+        using const_iterator = table_iterator<const value_type>;
+// ================================================================================
+// PRIVATE VARIABLE DEFINITIONS
+    private:
+        using alloc_traits = std::allocator_traits<Alloc>;
+
+        static constexpr size_type npos = static_cast<size_type>(-1);
+        static constexpr size_type min_capacity = group_width;
+
+        value_type* _slots = nullptr;
+        ctrl_t* _ctrl = nullptr;
+        size_type _size = 0;
+        size_type _capacity = 0;
+        size_type _growth_left = 0;
+        Hash _hash;
+        KeyEqual _eq;
+        Alloc _allocator;
+// ================================================================================
+// PRIVATE FUNCTION DEFINITIONS
+// --------------------------------------------------------------------------------
+// Split a hash into the probe start and the seven bit tag kept in the control byte
+
+        static size_type _h1(cslt::size_t hash) noexcept {return hash >> 7;}
+        static ctrl_t _h2(cslt::size_t hash) noexcept {return static_cast<ctrl_t>(hash & 0x7F);}
+
+        static size_type _growth_for(size_type capacity) noexcept {
+            return capacity - capacity / 8;
+        }
+// --------------------------------------------------------------------------------
+// The control bytes are stored after the slots in the same block.  The first
+// group_width - 1 bytes are mirrored past the end, so a group may be loaded at
+// any slot without wrapping.
+
+        static size_type _block_slots(size_type capacity) noexcept {
+            const size_type ctrl_bytes = capacity + group_width - 1;
+            return capacity + (ctrl_bytes + sizeof(value_type) - 1) / sizeof(value_type);
+        }
+
+        void _set_ctrl(size_type index, ctrl_t value) noexcept {
+            _ctrl[index] = value;
+            if (index < group_width - 1)
+                _ctrl[_capacity + index] = value;
+        }
+// --------------------------------------------------------------------------------
+// Walk the probe sequence of hash.  Groups are visited at triangular offsets,
+// which reaches every group of a power of two table.
+
+        template <typename Q>
+        size_type _find_index(const Q& key, cslt::size_t hash) const {
+            if (_size == 0)
+                return npos;
+            const size_type mask = _capacity - 1;
+            const ctrl_t tag = _h2(hash);
+            size_type pos = _h1(hash) & mask;
+            for (size_type step = group_width;; step += group_width) {
+                const ctrl_group group(_ctrl + pos);
+                for (group_mask match = group.match(tag); match; ++match) {
+                    const size_type index = (pos + match.lowest()) & mask;
+                    if (_eq(_slots[index].first, key))
+                        return index;
+                }
+                if (group.match_empty())
+                    return npos;
+                pos = (pos + step) & mask;
+            }
+        }
+
+        size_type _find_first_free(cslt::size_t hash) const noexcept {
+            const size_type mask = _capacity - 1;
+            size_type pos = _h1(hash) & mask;
+            for (size_type step = group_width;; step += group_width) {
+                const group_mask free = ctrl_group(_ctrl + pos).match_empty_or_deleted();
+                if (free)
+                    return (pos + free.lowest()) & mask;
+                pos = (pos + step) & mask;
+            }
+        }
+// --------------------------------------------------------------------------------
+// Construct a new entry for a key known to be absent.  The entry is built
+// before the control byte is written, so a throwing constructor leaves the
+// map unchanged.  When the table grows, the entry is built in the new table
+// before the old entries move, so args may refer to an element of this map.
+
+        template <typename... Args>
+        size_type _emplace_new(cslt::size_t hash, Args&&... args) {
+            size_type index = _capacity > 0 ? _find_first_free(hash) : 0;
+            if (_growth_left == 0 && (_capacity == 0 || _ctrl[index] != ctrl_deleted)) {
+                _grow([&] {
+                    index = _find_first_free(hash);
+                    alloc_traits::construct(_allocator, _slots + index, cslt::forward<Args>(args)...);
+                    _set_ctrl(index, _h2(hash));
+                });
+                --_growth_left;
+                ++_size;
+                return index;
+            }
+            alloc_traits::construct(_allocator, _slots + index, cslt::forward<Args>(args)...);
+            if (_ctrl[index] == ctrl_empty)
+                --_growth_left;
+            _set_ctrl(index, _h2(hash));
+            ++_size;
+            return index;
+        }
+// --------------------------------------------------------------------------------
+// Grow when out of room.  A table that is mostly tombstones is rebuilt at the
+// same size instead.
+
+        template <typename Place>
+        void _grow(Place place) {
+            if (_capacity == 0)
+                _rehash_to(min_capacity, place);
+            else if (_size <= _growth_for(_capacity) / 2)
+                _rehash_to(_capacity, place);
+            else
+                _rehash_to(_capacity * 2, place);
+        }
+// --------------------------------------------------------------------------------
+// Move every entry into a new table of capacity slots.  A hasher that may
+// throw is run over every entry before anything is moved, so that when it
+// throws the old table is still intact.  place() adds a new entry to the new
+// table while the old one is still alive.
+
+        void _rehash_to(size_type capacity) {
+            _rehash_to(capacity, []() noexcept {});
+        }
+
+        template <typename Place>
+        void _rehash_to(size_type capacity, Place place) {
+            _rehash_to(capacity, place, std::integral_constant<bool,
+                noexcept(std::declval<Hash&>()(std::declval<const K&>()))>());
+        }
+
+        template <typename Place>
+        void _rehash_to(size_type capacity, Place place, std::true_type) {
+            _move_to_table(capacity, [this](const value_type* old_slots, size_type i) noexcept {
+                return _hash(old_slots[i].first);
+            }, place);
+        }
+
+        template <typename Place>
+        void _rehash_to(size_type capacity, Place place, std::false_type) {
+            using hash_alloc = typename alloc_traits::template rebind_alloc<cslt::size_t>;
+            using hash_traits = typename alloc_traits::template rebind_traits<cslt::size_t>;
+            hash_alloc alloc(_allocator);
+            const size_type num = _capacity;
+            cslt::size_t* hashes = num > 0 ? hash_traits::allocate(alloc, num) : nullptr;
+            try {
+                for (size_type i = 0; i < num; ++i)
+                    if (_ctrl[i] >= 0)
+                        hashes[i] = _hash(_slots[i].first);
+                _move_to_table(capacity, [hashes](const value_type*, size_type i) noexcept {
+                    return hashes[i];
+                }, place);
+            } catch (...) {
+                if (hashes)
+                    hash_traits::deallocate(alloc, hashes, num);
+                throw;
+            }
+            if (hashes)
+                hash_traits::deallocate(alloc, hashes, num);
+        }
+// --------------------------------------------------------------------------------
+// hash_of(old_slots, i) returns the hash of old slot i without throwing, so
+// only place() and copying an entry can fail while the table is rebuilt
+
+        template <typename HashOf, typename Place>
+        void _move_to_table(size_type capacity, HashOf hash_of, Place place) {
+            const size_type block = _block_slots(capacity);
+            value_type* new_slots = alloc_traits::allocate(_allocator, block);
+            CSLT_RECORD_ALLOC(hash_map, block * sizeof(value_type));
+            ctrl_t* new_ctrl = reinterpret_cast<ctrl_t*>(new_slots + capacity);
+            std::memset(new_ctrl, ctrl_empty, capacity + group_width - 1);
+
+            value_type* old_slots = _slots;
+            ctrl_t* old_ctrl = _ctrl;
+            const size_type old_capacity = _capacity;
+            _slots = new_slots;
+            _ctrl = new_ctrl;
+            _capacity = capacity;
+            try {
+                place();
+                for (size_type i = 0; i < old_capacity; ++i) {
+                    if (old_ctrl[i] < 0)
+                        continue;
+                    const cslt::size_t hash = hash_of(old_slots, i);
+                    const size_type index = _find_first_free(hash);
+                    alloc_traits::construct(_allocator, _slots + index, cslt::move_if_noexcept(old_slots[i]));
+                    _set_ctrl(index, _h2(hash));
+                }
+            } catch (...) {
+                // Entries are only moved when moving cannot throw, so a
+                // throwing copy leaves the old table intact
+                for (size_type i = 0; i < _capacity; ++i)
+                    if (_ctrl[i] >= 0)
+                        alloc_traits::destroy(_allocator, _slots + i);
+                _deallocate(_slots, _capacity);
+                _slots = old_slots;
+                _ctrl = old_ctrl;
+                _capacity = old_capacity;
+                throw;
+            }
+
+            if (old_slots) {
+                _destroy_entries(old_slots, old_ctrl, old_capacity);
+                _deallocate(old_slots, old_capacity);
+                CSLT_RECORD_REALLOC(hash_map);
+            }
+            _growth_left = _growth_for(_capacity) - _size;
+        }
+// --------------------------------------------------------------------------------
+
+        void _destroy_entries(value_type* slots, const ctrl_t* ctrl, size_type capacity) noexcept {
+            if (std::is_trivially_destructible<value_type>::value)
+                return;
+            for (size_type i = 0; i < capacity; ++i)
+                if (ctrl[i] >= 0)
+                    alloc_traits::destroy(_allocator, slots + i);
+        }
+
+        void _deallocate(value_type* slots, size_type capacity) noexcept {
+            const size_type block = _block_slots(capacity);
+            alloc_traits::deallocate(_allocator, slots, block);
+            CSLT_RECORD_FREE(hash_map, block * sizeof(value_type));
+        }
+
+        void _free() noexcept {
+            if (_slots) {
+                _destroy_entries(_slots, _ctrl, _capacity);
+                _deallocate(_slots, _capacity);
+            }
+            _slots = nullptr;
+            _ctrl = nullptr;
+            _size = 0;
+            _capacity = 0;
+            _growth_left = 0;
+        }
+// --------------------------------------------------------------------------------
+// Erase the entry at index.  When the slot lies inside a run of fewer than
+// group_width occupied slots, no probe can have passed over it, so it becomes
+// empty again instead of a tombstone.
+
+        void _erase_at(size_type index) noexcept {
+            alloc_traits::destroy(_allocator, _slots + index);
+            --_size;
+            const size_type mask = _capacity - 1;
+            size_type run = 1;
+            for (size_type i = 1; i < group_width && _ctrl[(index + i) & mask] != ctrl_empty; ++i)
+                ++run;
+            for (size_type i = 1; i < group_width && _ctrl[(index - i) & mask] != ctrl_empty; ++i)
+                ++run;
+            if (run < group_width) {
+                _set_ctrl(index, ctrl_empty);
+                ++_growth_left;
+            } else {
+                _set_ctrl(index, ctrl_deleted);
+            }
+        }
+// --------------------------------------------------------------------------------
+
+        void _steal(flat_hash_map& other) noexcept {
+            _slots = other._slots;
+            _ctrl = other._ctrl;
+            _size = other._size;
+            _capacity = other._capacity;
+            _growth_left = other._growth_left;
+            other._slots = nullptr;
+            other._ctrl = nullptr;
+            other._size = 0;
+            other._capacity = 0;
+            other._growth_left = 0;
+        }
+
+        void _copy_entries(const flat_hash_map& other) {
+            reserve(other._size);
+            for (size_type i = 0; i < other._capacity; ++i)
+                if (other._ctrl[i] >= 0)
+                    _emplace_new(_hash(other._slots[i].first), other._slots[i]);
+        }
+
+        // The copy is built with the allocator the map keeps afterward, so its
+        // table can be adopted whether or not the allocator propagates
+        void _assign_allocator(const Alloc& alloc, std::true_type) {_allocator = alloc;}
+        void _assign_allocator(const Alloc&, std::false_type) noexcept {}
+
+        void _swap_allocator(flat_hash_map& other, std::true_type) noexcept {
+            cslt::swap(_allocator, other._allocator);
+        }
+        void _swap_allocator(flat_hash_map&, std::false_type) noexcept {}
+
+        void _move_assign(flat_hash_map& other, std::true_type) noexcept {
+            _free();
+            _allocator = cslt::move(other._allocator);
+            _steal(other);
+        }
+
+        // The allocator does not propagate, so the table can only be stolen
+        // when both allocators can free each other's memory
+        void _move_assign(flat_hash_map& other, std::false_type) {
+            if (_allocator == other._allocator) {
+                _free();
+                _steal(other);
+                return;
+            }
+            clear();
+            reserve(other._size);
+            for (size_type i = 0; i < other._capacity; ++i)
+                if (other._ctrl[i] >= 0)
+                    _emplace_new(_hash(other._slots[i].first), cslt::move(other._slots[i]));
+            other.clear();
+        }
+// --------------------------------------------------------------------------------
+
+        iterator _iterator_at(size_type index) noexcept {
+            return iterator(_ctrl + index, _ctrl + _capacity, _slots + index);
+        }
+
+        const_iterator _iterator_at(size_type index) const noexcept {
+            return const_iterator(_ctrl + index, _ctrl + _capacity, _slots + index);
+        }
+
+        template <typename H, typename E>
+        using enable_transparent = std::enable_if_t<is_transparent<H>::value && is_transparent<E>::value>;
+// ================================================================================
+// PUBLIC FUNCTION DEFINITIONS
+    public:
+// --------------------------------------------------------------------------------
+// Constructors, the default constructor does not allocate
+
+        flat_hash_map() : flat_hash_map(0) {}
+
+        explicit flat_hash_map(size_type capacity, const Hash& hash = Hash(),
+                               const KeyEqual& eq = KeyEqual(), const Alloc& alloc = Alloc())
+            : _hash(hash), _eq(eq), _allocator(alloc) {
+            if (capacity > 0)
+                reserve(capacity);
+        }
+
+        explicit flat_hash_map(const Alloc& alloc) : _allocator(alloc) {}
+
+        flat_hash_map(std::initializer_list<value_type> ilist, const Alloc& alloc = Alloc())
+            : _allocator(alloc) {
+            reserve(ilist.size());
+            for (const value_type& value : ilist)
+                insert(value);
+        }
+// --------------------------------------------------------------------------------
+// Copy constructor and assignment
+
+        flat_hash_map(const flat_hash_map& other)
+            : _hash(other._hash), _eq(other._eq),
+              _allocator(alloc_traits::select_on_container_copy_construction(other._allocator)) {
+            try {
+                _copy_entries(other);
+            } catch (...) {
+                _free();
+                throw;
+            }
+        }
+
+        flat_hash_map& operator=(const flat_hash_map& other) {
+            if (this != &other) {
+                using propagate = typename alloc_traits::propagate_on_container_copy_assignment;
+                flat_hash_map copy(0, other._hash, other._eq, propagate::value ? other._allocator : _allocator);
+                copy._copy_entries(other);
+                _free();
+                _hash = other._hash;
+                _eq = other._eq;
+                _assign_allocator(copy._allocator, propagate());
+                _steal(copy);
+            }
+            return *this;
+        }
+// --------------------------------------------------------------------------------
+// Move constructor and assignment
+
+        flat_hash_map(flat_hash_map&& other) noexcept
+            : _hash(cslt::move(other._hash)), _eq(cslt::move(other._eq)),
+              _allocator(cslt::move(other._allocator)) {
+            _steal(other);
+        }
+
+        flat_hash_map& operator=(flat_hash_map&& other)
+            noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                     alloc_traits::is_always_equal::value) {
+            if (this != &other) {
+                _hash = cslt::move(other._hash);
+                _eq = cslt::move(other._eq);
+                _move_assign(other, typename alloc_traits::propagate_on_container_move_assignment());
+            }
+            return *this;
+        }
+// --------------------------------------------------------------------------------
+
+        ~flat_hash_map() {
+            _free();
+        }
+// ================================================================================
+// Iterators
+
+        iterator begin() noexcept {
+            iterator it = _iterator_at(0);
+            it._skip_free();
+            return it;
+        }
+
+        const_iterator begin() const noexcept {
+            const_iterator it = _iterator_at(0);
+            it._skip_free();
+            return it;
+        }
+
+        iterator end() noexcept {return _iterator_at(_capacity);}
+        const_iterator end() const noexcept {return _iterator_at(_capacity);}
+        const_iterator cbegin() const noexcept {return begin();}
+        const_iterator cend() const noexcept {return end();}
+// ================================================================================
+// Capacity
+
+        size_type size() const noexcept {return _size;}
+        bool empty() const noexcept {return _size == 0;}
+
+        /**
+         * @brief Returns the number of slots in the table
+         */
+        size_type capacity() const noexcept {return _capacity;}
+
+        double load_factor() const noexcept {
+            return _capacity > 0 ? static_cast<double>(_size) / static_cast<double>(_capacity) : 0.0;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Sizes the table so that count entries fit without a rehash
+         */
+        void reserve(size_type count) {
+            size_type capacity = min_capacity;
+            while (_growth_for(capacity) < count)
+                capacity *= 2;
+            if (capacity > _capacity)
+                _rehash_to(capacity);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Destroys every entry and keeps the table
+         */
+        void clear() noexcept {
+            if (_capacity == 0)
+                return;
+            _destroy_entries(_slots, _ctrl, _capacity);
+            std::memset(_ctrl, ctrl_empty, _capacity + group_width - 1);
+            _size = 0;
+            _growth_left = _growth_for(_capacity);
+        }
+// ================================================================================
+// Lookup
+
+        iterator find(const K& key) {
+            const size_type index = _find_index(key, _hash(key));
+            return index == npos ? end() : _iterator_at(index);
+        }
+
+        const_iterator find(const K& key) const {
+            const size_type index = _find_index(key, _hash(key));
+            return index == npos ? end() : _iterator_at(index);
+        }
+
+        template <typename Q, typename H = Hash, typename E = KeyEqual, typename = enable_transparent<H, E>>
+        iterator find(const Q& key) {
+            const size_type index = _find_index(key, _hash(key));
+            return index == npos ? end() : _iterator_at(index);
+        }
+
+        template <typename Q, typename H = Hash, typename E = KeyEqual, typename = enable_transparent<H, E>>
+        const_iterator find(const Q& key) const {
+            const size_type index = _find_index(key, _hash(key));
+            return index == npos ? end() : _iterator_at(index);
+        }
+// --------------------------------------------------------------------------------
+
+        bool contains(const K& key) const {
+            return _find_index(key, _hash(key)) != npos;
+        }
+
+        template <typename Q, typename H = Hash, typename E = KeyEqual, typename = enable_transparent<H, E>>
+        bool contains(const Q& key) const {
+            return _find_index(key, _hash(key)) != npos;
+        }
+
+        size_type count(const K& key) const {return contains(key) ? 1 : 0;}
+
+        template <typename Q, typename H = Hash, typename E = KeyEqual, typename = enable_transparent<H, E>>
+        size_type count(const Q& key) const {return contains(key) ? 1 : 0;}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns the value mapped to key, throwing cslt::out_of_range if there is none
+         */
+        V& at(const K& key) {
+            const size_type index = _find_index(key, _hash(key));
+            if (index == npos)
+                throw cslt::out_of_range(CSLT_LITERAL("Key not found in flat_hash_map"));
+            return _slots[index].second;
+        }
+
+        const V& at(const K& key) const {
+            const size_type index = _find_index(key, _hash(key));
+            if (index == npos)
+                throw cslt::out_of_range(CSLT_LITERAL("Key not found in flat_hash_map"));
+            return _slots[index].second;
+        }
+// ================================================================================
+// Modifiers
+
+        /**
+         * @brief Inserts a value constructed from args unless key is present
+         *
+         * @return An iterator to the entry for key and true if it was inserted
+         */
+        template <typename... Args>
+        cslt::pair<iterator, bool> try_emplace(const K& key, Args&&... args) {
+            const cslt::size_t hash = _hash(key);
+            size_type index = _find_index(key, hash);
+            if (index != npos)
+                return cslt::pair<iterator, bool>(_iterator_at(index), false);
+            index = _emplace_new(hash, cslt::emplace_second, key, cslt::forward<Args>(args)...);
+            return cslt::pair<iterator, bool>(_iterator_at(index), true);
+        }
+
+        template <typename... Args>
+        cslt::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+            const cslt::size_t hash = _hash(key);
+            size_type index = _find_index(key, hash);
+            if (index != npos)
+                return cslt::pair<iterator, bool>(_iterator_at(index), false);
+            index = _emplace_new(hash, cslt::emplace_second, cslt::move(key), cslt::forward<Args>(args)...);
+            return cslt::pair<iterator, bool>(_iterator_at(index), true);
+        }
+// --------------------------------------------------------------------------------
+
+        cslt::pair<iterator, bool> insert(const value_type& value) {
+            return try_emplace(value.first, value.second);
+        }
+
+        cslt::pair<iterator, bool> insert(value_type&& value) {
+            return try_emplace(cslt::move(value.first), cslt::move(value.second));
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Inserts the pair built from args unless its key is present
+         *
+         * The pair is constructed before the lookup; try_emplace avoids that
+         * when the key is known.
+         */
+        template <typename... Args>
+        cslt::pair<iterator, bool> emplace(Args&&... args) {
+            return insert(value_type(cslt::forward<Args>(args)...));
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Inserts or replaces the value mapped to key
+         */
+        template <typename M>
+        cslt::pair<iterator, bool> insert_or_assign(const K& key, M&& value) {
+            cslt::pair<iterator, bool> result = try_emplace(key, cslt::forward<M>(value));
+            if (!result.second)
+                result.first->second = cslt::forward<M>(value);
+            return result;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns the value mapped to key, inserting a value initialized one if needed
+         */
+        V& operator[](const K& key) {
+            return try_emplace(key).first->second;
+        }
+
+        V& operator[](K&& key) {
+            return try_emplace(cslt::move(key)).first->second;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Removes the entry for key
+         *
+         * @return The number of entries removed, 0 or 1
+         */
+        size_type erase(const K& key) {
+            const size_type index = _find_index(key, _hash(key));
+            if (index == npos)
+                return 0;
+            _erase_at(index);
+            return 1;
+        }
+
+        template <typename Q, typename H = Hash, typename E = KeyEqual, typename = enable_transparent<H, E>>
+        size_type erase(const Q& key) {
+            const size_type index = _find_index(key, _hash(key));
+            if (index == npos)
+                return 0;
+            _erase_at(index);
+            return 1;
+        }
+
+        /**
+         * @brief Removes the entry at pos and returns an iterator to the next entry
+         */
+        iterator erase(const_iterator pos) {
+            const size_type index = static_cast<size_type>(pos._ctrl - _ctrl);
+            _erase_at(index);
+            iterator next = _iterator_at(index);
+            next._skip_free();
+            return next;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Exchanges the contents of two maps
+         *
+         * The allocators are exchanged only when the allocator sets
+         * propagate_on_container_swap.  Otherwise they must compare equal, as
+         * for the standard containers.
+         */
+        void swap(flat_hash_map& other) noexcept {
+            cslt::swap(_slots, other._slots);
+            cslt::swap(_ctrl, other._ctrl);
+            cslt::swap(_size, other._size);
+            cslt::swap(_capacity, other._capacity);
+            cslt::swap(_growth_left, other._growth_left);
+            cslt::swap(_hash, other._hash);
+            cslt::swap(_eq, other._eq);
+            _swap_allocator(other, typename alloc_traits::propagate_on_container_swap());
+        }
+// ================================================================================
+// Observers
+
+        hasher hash_function() const {return _hash;}
+        key_equal key_eq() const {return _eq;}
+        allocator_type get_allocator() const {return _allocator;}
+    };
+// ================================================================================
+// ================================================================================
+
+    namespace pmr {
+        /**
+         * @brief A flat_hash_map whose table comes from a memory_resource
+         */
+        template <typename K, typename V, typename Hash = cslt::hash<K>, typename KeyEqual = cslt::equal_to<K>>
+        using flat_hash_map = cslt::flat_hash_map<K, V, Hash, KeyEqual,
+                                                  cslt::polymorphic_allocator<cslt::pair<K, V>>>;
+    }
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_flat_hash_map_HPP */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,128 @@
+// ================================================================================
+// ================================================================================
+// - File:    hash.hpp
+// - Purpose: Hash and equality function objects used by the hashed containers
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_hash_HPP
+#define cslt_hash_HPP
+
+#include "dtype.hpp"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    /**
+     * @brief Hashes num bytes starting at data
+     *
+     * This is MurmurHash64A, which reads eight bytes per step.  Equal byte
+     * sequences always hash equal within one program; the values are not
+     * stable across platforms.
+     */
+    cslt::size_t hash_bytes(const void* data, cslt::size_t num, std::uint64_t seed = 0) noexcept;
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Spreads the bits of an integer over the whole word
+     *
+     * The hashed containers take their bucket from the high bits and a tag from
+     * the low bits, so even sequential keys must differ in both.
+     */
+    inline cslt::size_t hash_mix(std::uint64_t value) noexcept {
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33;
+        value *= 0xc4ceb9fe1a85ec53ULL;
+        value ^= value >> 33;
+        return static_cast<cslt::size_t>(value);
+    }
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief Function object that hashes a T
+     *
+     * Integers, enumerations, floating point values and pointers are provided.
+     * Other types may specialize hash<T>.  A specialization that defines
+     * is_transparent may also hash types that compare equal to a T, which lets
+     * a container look up a key without building a T.
+     */
+    template <typename T, typename Enable = void>
+    struct hash;
+
+    template <typename T>
+    struct hash<T, std::enable_if_t<std::is_integral<T>::value || std::is_enum<T>::value>> {
+        cslt::size_t operator()(T value) const noexcept {
+            return hash_mix(static_cast<std::uint64_t>(value));
+        }
+    };
+
+    template <typename T>
+    struct hash<T*> {
+        cslt::size_t operator()(T* value) const noexcept {
+            return hash_mix(reinterpret_cast<std::uintptr_t>(value));
+        }
+    };
+
+    template <typename T>
+    struct hash<T, std::enable_if_t<std::is_floating_point<T>::value>> {
+        cslt::size_t operator()(T value) const noexcept {
+            // 0.0 and -0.0 compare equal, so they must hash equal
+            if (value == T(0))
+                return hash_mix(0);
+            return hash_bytes(&value, sizeof(T));
+        }
+    };
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief Function object that compares two values with operator==
+     *
+     * equal_to<> compares values of any two types and is transparent.
+     */
+    template <typename T = void>
+    struct equal_to {
+        bool operator()(const T& lhs, const T& rhs) const {
+            return lhs == rhs;
+        }
+    };
+
+    template <>
+    struct equal_to<void> {
+        using is_transparent = void;
+
+        template <typename L, typename R>
+        bool operator()(const L& lhs, const R& rhs) const {
+            return lhs == rhs;
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief True when T declares is_transparent and so accepts keys of other types
+     */
+    template <typename T, typename = void>
+    struct is_transparent : std::false_type {};
+
+    template <typename T>
+    struct is_transparent<T, std::conditional_t<true, void, typename T::is_transparent>> : std::true_type {};
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_hash_HPP */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,149 @@
+// ================================================================================
+// ================================================================================
+// - File:    instrument.hpp
+// - Purpose: Optional allocation counters for the containers in the cslt namespace
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_instrument_HPP
+#define cslt_instrument_HPP
+
+#include <cstddef>
+#include <cstdint>
+// ================================================================================
+// ================================================================================
+// COMPILE TIME SWITCH
+//
+// Define CSLT_INSTRUMENT to 1, or configure with -DCSLT_INSTRUMENT=ON, to count
+// the allocations made by the library.  When it is 0 the CSLT_RECORD_ macros
+// expand to nothing and the snapshot functions return zeros.  Every
+// translation unit in a program must use the same setting.
+
+#ifndef CSLT_INSTRUMENT
+    #define CSLT_INSTRUMENT 0
+#endif
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+namespace instrument {
+
+    /**
+     * @brief The part of the library that made an allocation
+     */
+    enum class site : unsigned {
+        array_ptr,
+        vector,
+        string,
+        shared_ptr,
+        exception,
+        hash_map,
+        string_builder,
+        soa_vector,
+        small_vector,
+        slot_map,
+        count
+    };
+
+    constexpr std::size_t site_count = static_cast<std::size_t>(site::count);
+
+    constexpr bool enabled = CSLT_INSTRUMENT != 0;
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Running totals for one site
+     *
+     * A reallocation is a buffer replaced by a larger or smaller one; the
+     * allocation and free it involves are counted as well.
+     */
+    struct counters {
+        std::uint64_t allocations = 0;
+        std::uint64_t deallocations = 0;
+        std::uint64_t reallocations = 0;
+        std::uint64_t bytes_allocated = 0;
+        std::uint64_t bytes_freed = 0;
+
+        counters& operator+=(const counters& other) noexcept;
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief The counters of every site at one moment
+     */
+    struct snapshot {
+        counters sites[site_count];
+
+        const counters& operator[](site s) const noexcept {
+            return sites[static_cast<std::size_t>(s)];
+        }
+
+        counters total() const noexcept;
+    };
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief Adds to the counters of the calling thread
+     *
+     * These are called through the CSLT_RECORD_ macros so that they disappear
+     * when instrumentation is off.  Each thread writes only its own counters,
+     * so recording never takes a lock or a locked instruction.
+     */
+    void record_allocation(site s, std::size_t bytes) noexcept;
+    void record_deallocation(site s, std::size_t bytes) noexcept;
+    void record_reallocation(site s) noexcept;
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Returns the counters recorded by the calling thread
+     */
+    snapshot thread_snapshot() noexcept;
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Returns the counters of every thread, including threads that have exited
+     *
+     * The counters of running threads are read while they may still be
+     * changing, so the result is a consistent sample of each counter but not
+     * of all counters at one instant.
+     */
+    snapshot global_snapshot();
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Returns the name of a site, such as "vector"
+     */
+    const char* site_name(site s) noexcept;
+
+} /* end of instrument namespace */
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+
+#if CSLT_INSTRUMENT
+    #define CSLT_RECORD_ALLOC(where, bytes) \
+        ::cslt::instrument::record_allocation(::cslt::instrument::site::where, (bytes))
+    #define CSLT_RECORD_FREE(where, bytes) \
+        ::cslt::instrument::record_deallocation(::cslt::instrument::site::where, (bytes))
+    #define CSLT_RECORD_REALLOC(where) \
+        ::cslt::instrument::record_reallocation(::cslt::instrument::site::where)
+#else
+    // The size is named but not evaluated, so a parameter used only for
+    // counting does not become unused
+    #define CSLT_RECORD_ALLOC(where, bytes) ((void)sizeof(bytes))
+    #define CSLT_RECORD_FREE(where, bytes) ((void)sizeof(bytes))
+    #define CSLT_RECORD_REALLOC(where) ((void)0)
+#endif
+// ================================================================================
+// ================================================================================
+#endif /* cslt_instrument_HPP */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,240 @@
+// ================================================================================
+// ================================================================================
+// - File:    intern_pool.hpp
+// - Purpose: Deduplicated, pre-hashed strings compared by pointer
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_intern_pool_HPP
+#define cslt_intern_pool_HPP
+
+#include "dtype.hpp"
+#include "hash.hpp"
+#include "memory_resource.hpp"
+#include "string_view.hpp"
+#include <atomic>
+#include <cstring>
+#include <initializer_list>
+#include <mutex>
+#include <ostream>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    class intern_pool;
+
+    namespace detail {
+        // One interned string; the characters and a null terminator follow it
+        struct intern_entry {
+            cslt::size_t hash;
+            cslt::size_t len;
+
+            const char* text() const noexcept {return reinterpret_cast<const char*>(this + 1);}
+        };
+    }
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief A handle to a string stored once in an intern_pool
+     *
+     * A handle is one pointer.  Two handles from the same pool are equal exactly
+     * when their text is equal, so operator== compares the pointers and never
+     * the characters.  The hash of the text was computed when it was interned
+     * and is returned by hash() without touching the characters, and
+     * cslt::hash<interned_string> uses it, so a flat_hash_map keyed by
+     * interned_string neither hashes nor compares text.
+     *
+     * A default constructed handle refers to no string and views as empty.
+     * Handles from different pools must not be compared.  A handle is valid
+     * for the life of its pool.
+     */
+    class interned_string {
+    private:
+        const detail::intern_entry* _entry = nullptr;
+
+        explicit interned_string(const detail::intern_entry* entry) noexcept : _entry(entry) {}
+        friend class intern_pool;
+// ================================================================================
+
+    public:
+        constexpr interned_string() noexcept = default;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief True unless the handle was default constructed or came from a failed find
+         */
+        explicit operator bool() const noexcept {return _entry != nullptr;}
+
+        const char* data() const noexcept {return _entry ? _entry->text() : "";}
+        const char* c_str() const noexcept {return data();}
+        cslt::size_t size() const noexcept {return _entry ? _entry->len : 0;}
+        bool empty() const noexcept {return size() == 0;}
+        string_view view() const noexcept {return string_view(data(), size());}
+        operator string_view() const noexcept {return view();}
+
+        /**
+         * @brief The hash of the text, equal to cslt::hash<string_view> of view()
+         */
+        cslt::size_t hash() const noexcept {return _entry ? _entry->hash : 0;}
+// --------------------------------------------------------------------------------
+
+        friend bool operator==(interned_string lhs, interned_string rhs) noexcept {
+            return lhs._entry == rhs._entry;
+        }
+
+        friend bool operator!=(interned_string lhs, interned_string rhs) noexcept {
+            return lhs._entry != rhs._entry;
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    inline std::ostream& operator<<(std::ostream& os, interned_string str) {
+        return os << str.view();
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Returns the hash stored in the handle
+     */
+    template <>
+    struct hash<interned_string> {
+        cslt::size_t operator()(interned_string str) const noexcept {
+            return str.hash();
+        }
+    };
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief Stores each distinct string once and hands out interned_string handles
+     *
+     * The text and the lookup table live in a monotonic_arena, so interning
+     * makes no allocation of its own once the arena has room, and the pool
+     * releases all of its memory at once when it is destroyed.
+     *
+     * Every member function is thread safe.  Looking up a string that is
+     * already interned, through find or intern, takes no lock: the table is
+     * an open addressed array of atomic pointers in which an entry is
+     * published only after its text is written.  Adding a string takes a
+     * mutex.  When the table grows the new table is published whole and the
+     * old one is kept until the pool is destroyed, so a concurrent reader
+     * never sees a freed table.  The retired tables add at most the size of
+     * the current one.
+     */
+    class intern_pool {
+    private:
+        struct table {
+            cslt::size_t mask;
+            std::atomic<const detail::intern_entry*>* slots;
+        };
+
+        monotonic_arena _arena;
+        std::atomic<const table*> _table;
+        std::atomic<cslt::size_t> _count;
+        mutable std::mutex _mutex;
+// --------------------------------------------------------------------------------
+
+        static const detail::intern_entry* lookup(const table* tab, string_view text, cslt::size_t hash) noexcept {
+            cslt::size_t index = hash & tab->mask;
+            for (;;) {
+                const detail::intern_entry* entry = tab->slots[index].load(std::memory_order_acquire);
+                if (entry == nullptr)
+                    return nullptr;
+                if (entry->hash == hash && entry->len == text.size() &&
+                    (text.empty() || std::memcmp(entry->text(), text.data(), text.size()) == 0))
+                    return entry;
+                index = (index + 1) & tab->mask;
+            }
+        }
+
+        // The members below are called with _mutex held
+        const table* make_table(cslt::size_t capacity);
+        const table* grow_for(cslt::size_t count);
+        const detail::intern_entry* insert(string_view text, cslt::size_t hash);
+// ================================================================================
+
+    public:
+        /**
+         * @brief Creates a pool sized for expected strings, drawing memory from upstream
+         */
+        explicit intern_pool(cslt::size_t expected = 0, memory_resource* upstream = get_default_resource());
+
+        intern_pool(const intern_pool&) = delete;
+        intern_pool& operator=(const intern_pool&) = delete;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns the handle for text, storing a copy the first time it is seen
+         */
+        interned_string intern(string_view text);
+
+        /**
+         * @brief Returns the handle for text, or a null handle if it was never interned
+         *
+         * This never locks or allocates.  A string being interned by another
+         * thread at the same moment may not be found yet.
+         */
+        interned_string find(string_view text) const noexcept {
+            const cslt::size_t hash = hash_bytes(text.data(), text.size());
+            return interned_string(lookup(_table.load(std::memory_order_acquire), text, hash));
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Interns every string in [first, last) under one lock
+         *
+         * The table is grown once for the whole range, which suits loading a
+         * known set of labels at startup.  Each element must convert to
+         * string_view.
+         */
+        template <typename It>
+        void seed(It first, It last) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            cslt::size_t num = 0;
+            for (It it = first; it != last; ++it)
+                ++num;
+            grow_for(_count.load(std::memory_order_relaxed) + num);
+            for (; first != last; ++first) {
+                const string_view text(*first);
+                const cslt::size_t hash = hash_bytes(text.data(), text.size());
+                if (lookup(_table.load(std::memory_order_relaxed), text, hash) == nullptr)
+                    insert(text, hash);
+            }
+        }
+
+        void seed(std::initializer_list<string_view> texts) {
+            seed(texts.begin(), texts.end());
+        }
+
+        /**
+         * @brief Grows the table so that count strings fit without another rehash
+         */
+        void reserve(cslt::size_t count);
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief The number of distinct strings interned
+         */
+        cslt::size_t size() const noexcept {return _count.load(std::memory_order_acquire);}
+
+        /**
+         * @brief The bytes taken from the arena for text and tables
+         */
+        cslt::size_t memory() const;
+    };
+}
+// ================================================================================
+// ================================================================================
+#endif /* cslt_intern_pool_HPP */
+// ================================================================================
+// ================================================================================
+// eof
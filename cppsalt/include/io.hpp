@@ -19,6 +19,8 @@
 #include <sstream>  // For std::ostringstream, std::istring, std::stringstream
 #include <fstream>  // for std::ifstream, std::ofstream
 #include <streambuf>  // For std::streambuf
+#include "dtype.hpp"
+#include "string_view.hpp"
 
 namespace cslt {
     // Standard character streams
@@ -65,6 +67,121 @@ namespace cslt {
     class filebuf : public std::filebuf {};
 
     using std::endl;
+// ================================================================================
+// ================================================================================
+// MEMORY MAPPED FILES
+
+    /**
+     * @brief How a mapped file is expected to be read, passed to the kernel as a hint
+     */
+    enum class access_hint {
+        normal,      // No particular pattern
+        sequential,  // Read front to back; pages are read ahead and dropped early
+        random,      // Scattered reads; read ahead is disabled
+        willneed     // Start reading the whole file into the page cache now
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief A read-only memory mapping of an entire file
+     *
+     * The file contents are addressed directly in the page cache, so reading
+     * them costs no copy and no system call once the pages are resident.  The
+     * mapping is created with mmap on POSIX systems and MapViewOfFile on
+     * Windows.  An empty file opens successfully with a null data() and a
+     * size() of zero.  The object is movable but not copyable.
+     *
+     * Errors opening or mapping the file throw cslt::system_error.
+     */
+    class mapped_file {
+    private:
+        const char* _data = nullptr;
+        cslt::size_t _size = 0;
+        bool _open = false;
+// --------------------------------------------------------------------------------
+
+    public:
+        using value_type = char;
+        using size_type = cslt::size_t;
+        using const_iterator = const char*;
+
+        mapped_file() noexcept = default;
+
+        /**
+         * @brief Maps the file at path
+         *
+         * @param path The file to map
+         * @param hint The expected access pattern, sequential by default
+         */
+        explicit mapped_file(const char* path, access_hint hint = access_hint::sequential);
+
+        mapped_file(const mapped_file&) = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+        mapped_file(mapped_file&& other) noexcept;
+        mapped_file& operator=(mapped_file&& other) noexcept;
+        ~mapped_file();
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Maps the file at path, unmapping any file already open
+         */
+        void open(const char* path, access_hint hint = access_hint::sequential);
+
+        /**
+         * @brief Unmaps the file; pointers into it become invalid
+         */
+        void close() noexcept;
+
+        bool is_open() const noexcept {return _open;}
+// --------------------------------------------------------------------------------
+
+        const char* data() const noexcept {return _data;}
+        cslt::size_t size() const noexcept {return _size;}
+        bool empty() const noexcept {return _size == 0;}
+        const char* begin() const noexcept {return _data;}
+        const char* end() const noexcept {return _data + _size;}
+        char operator[](cslt::size_t index) const noexcept {return _data[index];}
+        string_view view() const noexcept {return string_view(_data, _size);}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Passes a new access hint for the whole mapping to the kernel
+         *
+         * Hints never change the contents and are ignored where unsupported.
+         */
+        void advise(access_hint hint) const noexcept;
+
+        /**
+         * @brief Asks the kernel to start reading num bytes from offset into memory
+         *
+         * A parser can call this for the region it will reach next while it
+         * works on the current one.
+         */
+        void will_need(cslt::size_t offset, cslt::size_t num) const noexcept;
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief A read-only stream buffer over a block of memory such as a mapped_file
+     *
+     * The get area is the memory itself, so an std::istream reading through
+     * this buffer takes characters straight from the mapping with no
+     * intermediate copy.  Seeking is supported in both directions.  The
+     * memory must outlive the buffer and is never written.
+     */
+    class mmap_streambuf : public std::streambuf {
+    public:
+        mmap_streambuf() noexcept = default;
+        mmap_streambuf(const char* data, cslt::size_t size) noexcept;
+        explicit mmap_streambuf(const mapped_file& file) noexcept;
+// --------------------------------------------------------------------------------
+
+    protected:
+        std::streamsize showmanyc() override;
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                         std::ios_base::openmode which = std::ios_base::in) override;
+        pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in) override;
+    };
 }
 // ================================================================================
 // ================================================================================
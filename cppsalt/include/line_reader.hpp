@@ -0,0 +1,205 @@
+// ================================================================================
+// ================================================================================
+// - File:    line_reader.hpp
+// - Purpose: Splits large text input into records and fields without copying them
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_line_reader_HPP
+#define cslt_line_reader_HPP
+
+#include "dtype.hpp"
+#include "io.hpp"
+#include "memory.hpp"
+#include "string_search.hpp"
+#include "string_view.hpp"
+#include <istream>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    /**
+     * @brief Reads delimited records from a stream, a mapped_file or a block of memory
+     *
+     * std::getline copies every line into a std::string.  A line_reader
+     * instead hands out string_views of each record where it already lies:
+     * in the mapping or memory it was given, or in a large block it reads
+     * from a stream.  Delimiters are found with the vector kernels of
+     * string_search.hpp, so splitting runs at close to memory bandwidth.
+     *
+     * A record that crosses the end of a block is moved to the front of the
+     * buffer before the next block is read after it, and the buffer grows
+     * when a single record is longer than a block, so every record is
+     * returned whole.  The view returned by next() is valid until the next
+     * call to next() when reading a stream, and for the life of the memory
+     * otherwise.
+     *
+     * A last record without a delimiter is still returned.  With the default
+     * newline delimiter a carriage return before the newline is removed, so
+     * files with Windows line endings read the same.
+     */
+    class line_reader {
+    private:
+        std::streambuf* source = nullptr;
+        array_ptr<char> buffer;
+        const char* cursor = nullptr;
+        const char* limit = nullptr;
+        const char* scanned = nullptr;  // No delimiter lies in [cursor, scanned)
+        cslt::size_t count = 0;
+        char delim;
+        bool strip_cr;
+        bool exhausted;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Moves the partial record to the front of the buffer and reads after it
+         *
+         * @returns false once the stream has no more characters
+         */
+        bool refill();
+
+        bool next_slow(string_view& record);
+
+        bool emit(const char* stop, const char* resume, string_view& record) noexcept {
+            cslt::size_t len = static_cast<cslt::size_t>(stop - cursor);
+            if (strip_cr && len != 0 && cursor[len - 1] == '\r')
+                --len;
+            record = string_view(cursor, len);
+            cursor = scanned = resume;
+            ++count;
+            return true;
+        }
+// ================================================================================
+
+    public:
+        static constexpr cslt::size_t default_block_size = 1 << 20;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Reads records from in, block_size characters at a time
+         *
+         * Blocks are read from the stream buffer directly, so a cslt::ifstream
+         * passes them on without its formatted input machinery.
+         */
+        explicit line_reader(std::istream& in, cslt::size_t block_size = default_block_size,
+                             char delimiter = '\n');
+
+        /**
+         * @brief Reads records straight from a mapped file, which must outlive the reader
+         */
+        explicit line_reader(const mapped_file& file, char delimiter = '\n') noexcept
+            : line_reader(file.view(), delimiter) {}
+
+        /**
+         * @brief Reads records from text, which must outlive the reader
+         */
+        explicit line_reader(string_view text, char delimiter = '\n') noexcept;
+// --------------------------------------------------------------------------------
+
+        line_reader(const line_reader&) = delete;
+        line_reader& operator=(const line_reader&) = delete;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Stores the next record, without its delimiter, in record
+         *
+         * @returns false, leaving record unchanged, when the input is exhausted
+         */
+        bool next(string_view& record) {
+            if (scanned != limit) {
+                const cslt::size_t pos = text::find_char(scanned, static_cast<cslt::size_t>(limit - scanned), delim);
+                if (pos != text::not_found)
+                    return emit(scanned + pos, scanned + pos + 1, record);
+            }
+            return next_slow(record);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Calls func with each remaining record and returns how many there were
+         */
+        template <typename Func>
+        cslt::size_t for_each(Func func) {
+            const cslt::size_t first = count;
+            string_view record;
+            while (next(record))
+                func(record);
+            return count - first;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief The number of records returned so far
+         */
+        cslt::size_t records() const noexcept {return count;}
+        char delimiter() const noexcept {return delim;}
+
+        /**
+         * @brief Whether a carriage return before each delimiter is removed
+         */
+        bool strip_carriage_return() const noexcept {return strip_cr;}
+        void strip_carriage_return(bool strip) noexcept {strip_cr = strip;}
+    };
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief Walks the fields of one record, separated by a single character
+     *
+     * Fields are string_views into the record.  Empty fields are kept, so a
+     * record of n delimiters has n + 1 fields; there is no quoting.
+     */
+    class field_splitter {
+    private:
+        string_view rest;
+        char delim;
+        bool done = false;
+// --------------------------------------------------------------------------------
+
+    public:
+        explicit field_splitter(string_view record, char delimiter = ',') noexcept
+            : rest(record), delim(delimiter) {}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Stores the next field in field, returning false when there are no more
+         */
+        bool next(string_view& field) noexcept {
+            if (done)
+                return false;
+            const cslt::size_t pos = rest.find(delim);
+            if (pos == string_view::npos) {
+                field = rest;
+                done = true;
+            } else {
+                field = string_view(rest.data(), pos);
+                rest = string_view(rest.data() + pos + 1, rest.size() - pos - 1);
+            }
+            return true;
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Stores up to max_fields fields of record in fields
+     *
+     * @returns The number of fields in the record, which may be more than
+     *          max_fields; only the first max_fields are stored
+     */
+    cslt::size_t split_fields(string_view record, char delimiter,
+                              string_view* fields, cslt::size_t max_fields) noexcept;
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_line_reader_HPP */
+// ================================================================================
+// ================================================================================
+// eof
@@ -15,15 +15,330 @@
 #ifndef cslt_memory_HPP
 #define cslt_memory_HPP 
 
+#include "config.hpp"
 #include "util.hpp"
 #include "dtype.hpp"
 #include "except.hpp"
+#include "instrument.hpp"
+#include "probe.hpp"
+#include "memory_resource.hpp"
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <limits>
+#include <thread>
+
+#if defined(_WIN32)
+    #include <malloc.h>
+#endif
+
+// Define to 1 to keep every non-null pointer of an atomic_shared_ptr behind
+// its spin lock, for builds whose pointers carry tags in the high bits
+#ifndef CSLT_ATOMIC_SHARED_PTR_LOCKED
+    #define CSLT_ATOMIC_SHARED_PTR_LOCKED 0
+#endif
 // ================================================================================
 // ================================================================================
 
 namespace cslt {
 
+    /**
+     * @brief The default allocator used by the containers in the cslt namespace 
+     *
+     * This class hands out raw, uninitialized storage from the global ``operator new``
+     * and returns it through ``operator delete``.  Objects are never constructed 
+     * by the allocator itself; containers construct and destroy the elements in 
+     * place through ``std::allocator_traits``.
+     *
+     * @tparam T The data type for which memory is allocated
+     */
+    template <typename T>
+    class allocator {
+    public:
+        using value_type = T;
+        using size_type = cslt::size_t;
+        using propagate_on_container_move_assignment = std::true_type;
+        using is_always_equal = std::true_type;
+// --------------------------------------------------------------------------------
+
+        allocator() noexcept = default;
+        template <typename U>
+        allocator(const allocator<U>&) noexcept {}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Allocates uninitialized storage for num objects of type T
+         *
+         * @param num The number of objects of type T
+         * @return A pointer to the first byte of the allocated storage
+         */
+        T* allocate(cslt::size_t num) {
+            if (num > max_size())
+                throw cslt::bad_array_new_length();
+            void* block = ::operator new(num * sizeof(T), std::nothrow);
+            if (!block)
+                cslt::throw_bad_alloc();
+            return static_cast<T*>(block);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns storage previously obtained from allocate
+         *
+         * @param p A pointer returned by allocate
+         * @param num The number of objects passed to allocate
+         */
+        void deallocate(T* p, cslt::size_t num) noexcept {
+            (void)num;
+            ::operator delete(p);
+        }
+// --------------------------------------------------------------------------------
+
+        constexpr cslt::size_t max_size() const noexcept {
+            return std::numeric_limits<cslt::size_t>::max() / sizeof(T);
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    template <typename T, typename U>
+    bool operator==(const allocator<T>&, const allocator<U>&) noexcept {return true;}
+
+    template <typename T, typename U>
+    bool operator!=(const allocator<T>&, const allocator<U>&) noexcept {return false;}
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief Allocates bytes of raw storage aligned to alignment
+     *
+     * Uses posix_memalign, or _aligned_malloc on Windows, so the block must be
+     * returned with aligned_deallocate.  Throws cslt::bad_alloc on failure.
+     *
+     * @param bytes The size of the block, which may be zero
+     * @param alignment A power of two no smaller than sizeof(void*)
+     */
+    inline void* aligned_allocate(cslt::size_t bytes, cslt::size_t alignment) {
+        void* block = nullptr;
+#if defined(_WIN32)
+        block = ::_aligned_malloc(bytes ? bytes : 1, alignment);
+#else
+        if (::posix_memalign(&block, alignment, bytes ? bytes : 1) != 0)
+            block = nullptr;
+#endif
+        if (!block)
+            cslt::throw_bad_alloc();
+        return block;
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Returns a block obtained from aligned_allocate
+     */
+    inline void aligned_deallocate(void* block) noexcept {
+#if defined(_WIN32)
+        ::_aligned_free(block);
+#else
+        std::free(block);
+#endif
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief An allocator whose blocks are aligned and padded for vector loads
+     *
+     * Every block starts on an Align byte boundary and its size is rounded up
+     * to a multiple of Align.  A loop that reads Align bytes at a time from the
+     * start of the block may therefore read a whole vector past the last
+     * element instead of running a scalar tail; the padding is zero filled so
+     * such reads see defined values.  With Align of 64 this covers SSE, AVX
+     * and AVX-512 loads alike.
+     *
+     * @tparam T The data type for which memory is allocated
+     * @tparam Align The alignment and padding granularity in bytes, a power of two
+     */
+    template <typename T, cslt::size_t Align = 64>
+    class aligned_allocator {
+        static_assert(Align != 0 && (Align & (Align - 1)) == 0, "Align must be a power of two");
+        static_assert(Align >= alignof(T), "Align must not be weaker than the alignment of T");
+        static_assert(Align >= sizeof(void*), "Align must be at least the size of a pointer");
+    public:
+        using value_type = T;
+        using size_type = cslt::size_t;
+        using propagate_on_container_move_assignment = std::true_type;
+        using is_always_equal = std::true_type;
+
+        static constexpr cslt::size_t alignment = Align;
+
+        template <typename U>
+        struct rebind {
+            using other = aligned_allocator<U, Align>;
+        };
+// --------------------------------------------------------------------------------
+
+        aligned_allocator() noexcept = default;
+        template <typename U>
+        aligned_allocator(const aligned_allocator<U, Align>&) noexcept {}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief The bytes a block of num objects occupies, padding included
+         */
+        static constexpr cslt::size_t padded_bytes(cslt::size_t num) noexcept {
+            return (num * sizeof(T) + Align - 1) & ~(Align - 1);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Allocates aligned, uninitialized storage for num objects of type T
+         *
+         * @param num The number of objects of type T
+         * @return A pointer aligned to Align; the padding after the objects is zeroed
+         */
+        T* allocate(cslt::size_t num) {
+            if (num > max_size())
+                throw cslt::bad_array_new_length();
+            const cslt::size_t used = num * sizeof(T);
+            const cslt::size_t bytes = padded_bytes(num);
+            char* block = static_cast<char*>(cslt::aligned_allocate(bytes, Align));
+            std::memset(block + used, 0, bytes - used);
+            return reinterpret_cast<T*>(block);
+        }
+// --------------------------------------------------------------------------------
+
+        void deallocate(T* p, cslt::size_t num) noexcept {
+            (void)num;
+            cslt::aligned_deallocate(p);
+        }
+// --------------------------------------------------------------------------------
+
+        constexpr cslt::size_t max_size() const noexcept {
+            return (std::numeric_limits<cslt::size_t>::max() - Align) / sizeof(T);
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    template <typename T, cslt::size_t Align>
+    constexpr cslt::size_t aligned_allocator<T, Align>::alignment;
+// --------------------------------------------------------------------------------
+
+    template <typename T, typename U, cslt::size_t Align>
+    bool operator==(const aligned_allocator<T, Align>&, const aligned_allocator<U, Align>&) noexcept {return true;}
+
+    template <typename T, typename U, cslt::size_t Align>
+    bool operator!=(const aligned_allocator<T, Align>&, const aligned_allocator<U, Align>&) noexcept {return false;}
+// ================================================================================
+// ================================================================================
+// Uninitialized memory helpers used by the containers 
+
+    /**
+     * @brief Destroys num objects in place, leaving the storage allocated 
+     *
+     * Trivially destructible types are skipped entirely.
+     *
+     * @param alloc The allocator that constructed the objects 
+     * @param first A pointer to the first object 
+     * @param num The number of objects to destroy
+     */
+    template <typename Alloc, typename T>
+    void destroy_n(Alloc& alloc, T* first, cslt::size_t num) noexcept {
+        if (std::is_trivially_destructible<T>::value)
+            return;
+        for (cslt::size_t i = 0; i < num; ++i)
+            std::allocator_traits<Alloc>::destroy(alloc, first + i);
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Constructs num objects in uninitialized storage from a source range 
+     *
+     * Each element is moved if its move constructor is ``noexcept`` and copied 
+     * otherwise, so the source range stays intact if a constructor throws.  On 
+     * an exception every object already built in dest is destroyed before 
+     * the exception propagates.  Trivially copyable types are copied with a 
+     * single ``memcpy``.
+     *
+     * @param alloc The allocator used to construct the new objects 
+     * @param first A pointer to the first source object 
+     * @param num The number of objects to transfer 
+     * @param dest A pointer to uninitialized storage for num objects
+     */
+    template <typename Alloc, typename T>
+    void uninitialized_move_if_noexcept_n(Alloc& alloc, T* first, cslt::size_t num, T* dest) {
+        if (std::is_trivially_copyable<T>::value) {
+            if (num > 0)
+                std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), num * sizeof(T));
+            return;
+        }
+        cslt::size_t i = 0;
+        try {
+            for (; i < num; ++i)
+                std::allocator_traits<Alloc>::construct(alloc, dest + i, cslt::move_if_noexcept(first[i]));
+        } catch (...) {
+            cslt::destroy_n(alloc, dest, i);
+            throw;
+        }
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Constructs num copies of a source range in uninitialized storage 
+     *
+     * Provides the same rollback guarantee as uninitialized_move_if_noexcept_n.
+     *
+     * @param alloc The allocator used to construct the new objects 
+     * @param first A pointer to the first source object 
+     * @param num The number of objects to copy 
+     * @param dest A pointer to uninitialized storage for num objects
+     */
+    template <typename Alloc, typename T>
+    void uninitialized_copy_n(Alloc& alloc, const T* first, cslt::size_t num, T* dest) {
+        if (std::is_trivially_copyable<T>::value) {
+            if (num > 0)
+                std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), num * sizeof(T));
+            return;
+        }
+        cslt::size_t i = 0;
+        try {
+            for (; i < num; ++i)
+                std::allocator_traits<Alloc>::construct(alloc, dest + i, first[i]);
+        } catch (...) {
+            cslt::destroy_n(alloc, dest, i);
+            throw;
+        }
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Moves num objects from one block of memory to another 
+     *
+     * A trivially relocatable type is moved with a single ``memcpy`` that 
+     * cannot throw, and the source objects are simply forgotten.  Otherwise 
+     * the objects are constructed in dest with uninitialized_move_if_noexcept_n
+     * and the source objects are destroyed once every transfer succeeded.  
+     * The source storage itself is not released.
+     *
+     * @param alloc The allocator that owns both blocks 
+     * @param first A pointer to the first source object 
+     * @param num The number of objects to relocate 
+     * @param dest A pointer to uninitialized storage for num objects
+     */
+    template <typename Alloc, typename T>
+    void uninitialized_relocate_n(Alloc& alloc, T* first, cslt::size_t num, T* dest) {
+        if (cslt::is_trivially_relocatable<T>::value) {
+            if (num > 0)
+                std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), num * sizeof(T));
+            return;
+        }
+        cslt::uninitialized_move_if_noexcept_n(alloc, first, num, dest);
+        cslt::destroy_n(alloc, first, num);
+    }
+// ================================================================================
+// ================================================================================
+
     /**
      * @brief A class to manage dynamically allocated memory that can only be assigned to one variable at a time 
      *
@@ -37,6 +352,7 @@ namespace cslt {
 // ================================================================================
 
     public:
+        unique_ptr() noexcept = default;
         explicit unique_ptr(T *p) : ptr(p) {}
         unique_ptr(std::nullptr_t) : ptr(nullptr) {}
 // --------------------------------------------------------------------------------
@@ -71,7 +387,7 @@ namespace cslt {
         unique_ptr& operator=(unique_ptr&& move) noexcept {
             if (this != &move) {
                 delete ptr;
-                ptr = nullptr;
+                ptr = move.ptr;
                 move.ptr = nullptr;
             }
             return *this;
@@ -123,6 +439,10 @@ namespace cslt {
         explicit operator bool() const {return ptr != nullptr;}
 
     };
+// --------------------------------------------------------------------------------
+
+    template <typename T>
+    struct is_trivially_relocatable<unique_ptr<T>> : std::true_type {};
 // ================================================================================
 // ================================================================================ 
 
@@ -137,34 +457,311 @@ namespace cslt {
 // ================================================================================ 
 
     /**
-     * @brief Class to manage heap memory allocations that can be shared 
+     * @brief A reference count policy whose counts may be shared between threads
      *
-     * @tparam T The type of data managed in this class 
-     * @param p A pointer of type T
-     * @param counter A counter for hte number of assets sharing this memory
+     * Increments are relaxed, since a new owner can only be made from an
+     * existing one.  Decrements release the writes of the owner that drops
+     * its reference, and the owner that takes a count to zero acquires them
+     * all before the object is destroyed.
+     */
+    struct atomic_count_policy {
+        using count_type = std::atomic<unsigned>;
+
+        static void increment(count_type& count, unsigned num = 1) noexcept {
+            count.fetch_add(num, std::memory_order_relaxed);
+        }
+
+        // Returns true when the count reaches zero
+        static bool decrement(count_type& count) noexcept {
+            return count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+        // Increments a count that has not yet reached zero
+        static bool increment_if_nonzero(count_type& count) noexcept {
+            unsigned current = count.load(std::memory_order_relaxed);
+            while (current != 0) {
+                if (count.compare_exchange_weak(current, current + 1, std::memory_order_acq_rel,
+                                                std::memory_order_relaxed))
+                    return true;
+            }
+            return false;
+        }
+
+        static unsigned load(const count_type& count) noexcept {
+            return count.load(std::memory_order_relaxed);
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief A reference count policy for pointers that never leave one thread
+     *
+     * The counts are plain integers, which avoids the locked instructions of
+     * atomic_count_policy on hot single threaded paths.
+     */
+    struct local_count_policy {
+        using count_type = unsigned;
+
+        static void increment(count_type& count, unsigned num = 1) noexcept {count += num;}
+        static bool decrement(count_type& count) noexcept {return --count == 0;}
+
+        static bool increment_if_nonzero(count_type& count) noexcept {
+            if (count == 0)
+                return false;
+            ++count;
+            return true;
+        }
+
+        static unsigned load(const count_type& count) noexcept {return count;}
+    };
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief The reference counts shared by every shared_ptr that owns an object
+     *
+     * A control block counts the owners of an object and knows how to destroy
+     * the object and how to free itself.  The derived blocks differ only in
+     * where the object lives: shared_pointer_block owns a separately allocated
+     * object, while shared_inplace_block stores the object inside the block.
+     *
+     * The weak count is the number of weak_ptr objects plus one while any
+     * shared_ptr remains, so the block outlives the object until the last
+     * weak_ptr lets go.
+     *
+     * @tparam Policy atomic_count_policy or local_count_policy
+     */
+    template <typename Policy>
+    class shared_control_block {
+    private:
+        typename Policy::count_type _uses{1};
+        typename Policy::count_type _weak{1};
+// --------------------------------------------------------------------------------
+
+        // Destroys the object and drops the weak count the owners held.  It
+        // is kept out of line so that the decrement stays small at each call
+        // site, and so that the compiler does not follow the block past its
+        // release into the next owner's decrement.
+        CSLT_NOINLINE void release_last_use() noexcept {
+            dispose();
+            release_weak();
+        }
+
+        /**
+         * @brief Destroys the managed object
+         */
+        virtual void dispose() noexcept = 0;
+
+        /**
+         * @brief Frees the memory of the control block
+         */
+        virtual void destroy() noexcept = 0;
+
+        /**
+         * @brief Returns the address of the managed object
+         */
+        virtual void* managed() noexcept = 0;
+// ================================================================================
+
+    protected:
+        shared_control_block() noexcept = default;
+        virtual ~shared_control_block() = default;
+// ================================================================================
+
+    public:
+        shared_control_block(const shared_control_block&) = delete;
+        shared_control_block& operator=(const shared_control_block&) = delete;
+
+        void add_ref(unsigned num = 1) noexcept {Policy::increment(_uses, num);}
+
+        // Adds an owner unless the object has already been destroyed
+        bool add_ref_lock() noexcept {return Policy::increment_if_nonzero(_uses);}
+
+        void release() noexcept {
+            if (Policy::decrement(_uses))
+                release_last_use();
+        }
+
+        void add_weak_ref() noexcept {Policy::increment(_weak);}
+
+        void release_weak() noexcept {
+            if (Policy::decrement(_weak))
+                destroy();
+        }
+
+        unsigned use_count() const noexcept {return Policy::load(_uses);}
+
+        void* object() noexcept {return managed();}
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief A control block for an object that was allocated with new
+     */
+    template <typename T, typename Policy>
+    class shared_pointer_block : public shared_control_block<Policy> {
+    private:
+        T* _ptr;
+
+        void dispose() noexcept override {delete _ptr;}
+
+        void destroy() noexcept override {
+            CSLT_RECORD_FREE(shared_ptr, sizeof(shared_pointer_block));
+            delete this;
+        }
+
+        void* managed() noexcept override {return _ptr;}
+
+    public:
+        explicit shared_pointer_block(T* p) noexcept : _ptr(p) {}
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief A control block that stores the managed object next to the counts
+     *
+     * The block and the object share a single allocation from Alloc, so they
+     * are created and freed together and usually sit on the same cache line.
+     * While weak_ptr objects remain the object is destroyed but the block is kept.
      */
+    template <typename T, typename Alloc, typename Policy>
+    class shared_inplace_block : public shared_control_block<Policy> {
+    private:
+        using block_alloc = typename std::allocator_traits<Alloc>::template rebind_alloc<shared_inplace_block>;
+        using block_traits = std::allocator_traits<block_alloc>;
+
+        block_alloc _allocator;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type _storage;
+
+        void dispose() noexcept override {
+            get()->~T();
+        }
+
+        void* managed() noexcept override {return get();}
+
+        void destroy() noexcept override {
+            block_alloc alloc(_allocator);
+            block_traits::destroy(alloc, this);
+            block_traits::deallocate(alloc, this, 1);
+            CSLT_RECORD_FREE(shared_ptr, sizeof(shared_inplace_block));
+        }
+// ================================================================================
+
+    public:
+        template <typename... Args>
+        explicit shared_inplace_block(const Alloc& alloc, Args&&... args) : _allocator(alloc) {
+            ::new (static_cast<void*>(&_storage)) T(cslt::forward<Args>(args)...);
+        }
+
+        T* get() noexcept {return reinterpret_cast<T*>(&_storage);}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Allocates and constructs a block, returning it with a count of one
+         */
+        template <typename... Args>
+        static shared_inplace_block* create(const Alloc& alloc, Args&&... args) {
+            block_alloc balloc(alloc);
+            shared_inplace_block* block = block_traits::allocate(balloc, 1);
+            CSLT_RECORD_ALLOC(shared_ptr, sizeof(shared_inplace_block));
+            try {
+                block_traits::construct(balloc, block, alloc, cslt::forward<Args>(args)...);
+            } catch (...) {
+                block_traits::deallocate(balloc, block, 1);
+                CSLT_RECORD_FREE(shared_ptr, sizeof(shared_inplace_block));
+                throw;
+            }
+            return block;
+        }
+    };
+// ================================================================================
+// ================================================================================
+
+    template <typename T, typename Policy = atomic_count_policy>
+    class shared_ptr;
+
+    template <typename T, typename Policy = atomic_count_policy>
+    class weak_ptr;
+
     template <typename T>
+    class atomic_shared_ptr;
+
+    template <typename T, typename Policy = atomic_count_policy, typename Alloc, typename... Args>
+    shared_ptr<T, Policy> allocate_shared(const Alloc& alloc, Args&&... args);
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Class to manage heap memory allocations that can be shared
+     *
+     * With the default atomic_count_policy copies of a shared_ptr may be made
+     * and destroyed concurrently from any number of threads, although a single
+     * shared_ptr object must not be modified by two threads at once.
+     * local_shared_ptr uses plain counts for pointers that stay on one thread.
+     *
+     * @tparam T The type of data managed in this class
+     * @tparam Policy The reference count policy
+     * @param p A pointer of type T
+     * @param counter The control block holding the number of assets sharing this memory
+     */
+    template <typename T, typename Policy>
     class shared_ptr {
     private:
+        using block_type = shared_control_block<Policy>;
+
         T* ptr = nullptr;
-        unsigned* counter = nullptr; // Pointer to the reference count
+        block_type* counter = nullptr; // Pointer to the reference counts
 // --------------------------------------------------------------------------------
 
         void release() {
-            if (counter && --(*counter) == 0) {
-                delete ptr;
-                delete counter;
-            }
+            if (counter)
+                counter->release();
             ptr = nullptr;
             counter = nullptr;
         }
+// --------------------------------------------------------------------------------
+
+        // Creates a control block for p, deleting p if the block cannot be allocated
+        static block_type* make_block(T* p) {
+            if (!p)
+                return nullptr;
+            try {
+                block_type* block = new shared_pointer_block<T, Policy>(p);
+                CSLT_RECORD_ALLOC(shared_ptr, sizeof(shared_pointer_block<T, Policy>));
+                return block;
+            } catch (...) {
+                delete p;
+                throw;
+            }
+        }
+// --------------------------------------------------------------------------------
+
+        // Adopts a control block that already counts this owner
+        shared_ptr(T* p, block_type* block) noexcept : ptr(p), counter(block) {}
+
+        friend class weak_ptr<T, Policy>;
+
+        template <typename U>
+        friend class atomic_shared_ptr;
+
+        template <typename U, typename P, typename Alloc, typename... Args>
+        friend shared_ptr<U, P> allocate_shared(const Alloc& alloc, Args&&... args);
 // ================================================================================
 
     public:
         // Default constructor
-        explicit shared_ptr(T* p = nullptr) : ptr(p), counter(p ? new unsigned(1) : nullptr) {}
+        explicit shared_ptr(T* p = nullptr) : ptr(p), counter(make_block(p)) {}
         shared_ptr(std::nullptr_t) : ptr(nullptr), counter(nullptr) {}
+// --------------------------------------------------------------------------------
 
+        /**
+         * @brief Takes shared ownership of the object observed by weak
+         *
+         * Throws cslt::bad_weak_ptr if the object has already been destroyed
+         */
+        explicit shared_ptr(const weak_ptr<T, Policy>& weak) : ptr(weak.ptr), counter(weak.counter) {
+            if (!counter || !counter->add_ref_lock())
+                throw cslt::bad_weak_ptr();
+        }
 // --------------------------------------------------------------------------------
 
         // Destructor
@@ -176,7 +773,7 @@ namespace cslt {
         // Copy constructor
         shared_ptr(const shared_ptr& other) : ptr(other.ptr), counter(other.counter) {
             if (counter) {
-                (*counter)++;
+                counter->add_ref();
             }
         }
 // --------------------------------------------------------------------------------
@@ -184,12 +781,11 @@ namespace cslt {
         // Copy assignment operator
         shared_ptr& operator=(const shared_ptr& other) {
             if (this != &other) {
+                if (other.counter)
+                    other.counter->add_ref();
                 release(); // Release current resources
                 ptr = other.ptr;
                 counter = other.counter;
-                if (counter) {
-                    (*counter)++;
-                }
             }
             return *this;
         }
@@ -198,9 +794,10 @@ namespace cslt {
         // Assignment operator from raw pointer, to manage resource assignment
         shared_ptr& operator=(T* p) {
             if (ptr != p) {
+                block_type* block = make_block(p);
                 release(); // Clean up current managed object, if any
                 ptr = p;
-                counter = p ? new unsigned(1) : nullptr; // Allocate counter if p is not nullptr
+                counter = block;
             }
             return *this;
         }
@@ -229,9 +826,10 @@ namespace cslt {
         // Reset method
         void reset(T* p = nullptr) {
             if (ptr != p) {
+                block_type* block = make_block(p);
                 release(); // Clean up current state
                 ptr = p;
-                counter = p ? new unsigned(1) : nullptr;
+                counter = block;
             }
         }
 // --------------------------------------------------------------------------------
@@ -251,34 +849,820 @@ namespace cslt {
         explicit operator bool() const { return ptr != nullptr; }
 
         const T* get() const {return ptr;}
+
+        // Number of shared_ptr objects that own the managed object
+        unsigned use_count() const noexcept {return counter ? counter->use_count() : 0;}
     };
-    
 // ================================================================================
 // ================================================================================
 
     /**
-     * @brief Function to return a shared_ptr object with variadac arugments
+     * @brief A non-owning reference to an object managed by shared_ptr
+     *
+     * A weak_ptr keeps the control block alive but not the object.  lock()
+     * returns a shared_ptr that owns the object if it still exists, which lets
+     * caches and observers break reference cycles.
+     *
+     * @tparam T The type of data managed by the shared_ptr
+     * @tparam Policy The reference count policy of the shared_ptr
      */
-    template <typename T, typename... Args>
-    shared_ptr<T> make_shared(Args&&... args) {
-        return shared_ptr<T>(new T(cslt::forward<Args>(args)...));
-    }
-// ================================================================================
+    template <typename T, typename Policy>
+    class weak_ptr {
+    private:
+        using block_type = shared_control_block<Policy>;
+
+        T* ptr = nullptr;
+        block_type* counter = nullptr;
+
+        friend class shared_ptr<T, Policy>;
 // ================================================================================
 
-    /**
-     * @brief This class helps manage contiguous memory allocations
-     *
+    public:
+        weak_ptr() noexcept = default;
+
+        weak_ptr(const shared_ptr<T, Policy>& shared) noexcept : ptr(shared.ptr), counter(shared.counter) {
+            if (counter)
+                counter->add_weak_ref();
+        }
+// --------------------------------------------------------------------------------
+
+        weak_ptr(const weak_ptr& other) noexcept : ptr(other.ptr), counter(other.counter) {
+            if (counter)
+                counter->add_weak_ref();
+        }
+
+        weak_ptr(weak_ptr&& other) noexcept : ptr(other.ptr), counter(other.counter) {
+            other.ptr = nullptr;
+            other.counter = nullptr;
+        }
+// --------------------------------------------------------------------------------
+
+        ~weak_ptr() {
+            if (counter)
+                counter->release_weak();
+        }
+// --------------------------------------------------------------------------------
+
+        weak_ptr& operator=(const weak_ptr& other) noexcept {
+            weak_ptr(other).swap(*this);
+            return *this;
+        }
+
+        weak_ptr& operator=(weak_ptr&& other) noexcept {
+            weak_ptr(cslt::move(other)).swap(*this);
+            return *this;
+        }
+
+        weak_ptr& operator=(const shared_ptr<T, Policy>& shared) noexcept {
+            weak_ptr(shared).swap(*this);
+            return *this;
+        }
+// --------------------------------------------------------------------------------
+
+        void reset() noexcept {
+            weak_ptr().swap(*this);
+        }
+
+        void swap(weak_ptr& other) noexcept {
+            cslt::swap(ptr, other.ptr);
+            cslt::swap(counter, other.counter);
+        }
+// --------------------------------------------------------------------------------
+
+        // Number of shared_ptr objects that own the observed object
+        unsigned use_count() const noexcept {return counter ? counter->use_count() : 0;}
+
+        // True once the observed object has been destroyed
+        bool expired() const noexcept {return use_count() == 0;}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns a shared_ptr that owns the object, or an empty one if it has expired
+         *
+         * Checking and taking ownership happen in one atomic step, so the
+         * object cannot be destroyed between the two.
+         */
+        shared_ptr<T, Policy> lock() const noexcept {
+            if (counter && counter->add_ref_lock())
+                return shared_ptr<T, Policy>(ptr, counter);
+            return shared_ptr<T, Policy>(nullptr);
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    // Both hold a pointer to the object and one to the control block, so moving
+    // the bytes leaves every count unchanged
+    template <typename T, typename Policy>
+    struct is_trivially_relocatable<shared_ptr<T, Policy>> : std::true_type {};
+
+    template <typename T, typename Policy>
+    struct is_trivially_relocatable<weak_ptr<T, Policy>> : std::true_type {};
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief shared_ptr and weak_ptr with plain counts for single threaded use
+     */
+    template <typename T>
+    using local_shared_ptr = shared_ptr<T, local_count_policy>;
+
+    template <typename T>
+    using local_weak_ptr = weak_ptr<T, local_count_policy>;
+// ================================================================================
+// ================================================================================
+    /**
+     * @brief A shared_ptr that may be loaded and replaced by many threads at once
+     *
+     * This is meant for publishing read-mostly snapshots such as configuration
+     * or routing tables.  Every operation is lock free and a reader never waits
+     * for a writer, as long as each control block address fits in 48 bits.
+     *
+     * The control block pointer and a 16 bit local count share one 64 bit
+     * atomic word.  The stored pointer owns one reference in the control
+     * block.  load() increments the local count along with reading the
+     * pointer, so the block cannot be freed under it.  It then takes a normal
+     * reference and takes back its local count.  A writer that swaps the word
+     * out adds the local count it removed to the block before releasing the
+     * stored reference, and each reader that finds its local count gone gives
+     * back the extra reference.
+     *
+     * User space pointers fit in 48 bits on current x86-64 and AArch64
+     * systems, but not with 5 level paging and a high mmap hint, nor with
+     * tagged pointers such as AArch64 TBI and MTE.  Every pointer is checked
+     * when it is packed.  The first one that does not round trip switches
+     * the object for good to a shared_ptr guarded by a spin lock, and
+     * is_lock_free() then returns false.  Define CSLT_ATOMIC_SHARED_PTR_LOCKED
+     * to 1 to take the locked path for every non-null pointer.
+     *
+     * @tparam T The type of data managed by the shared_ptr
+     */
+    template <typename T>
+    class atomic_shared_ptr {
+    private:
+        using block_type = shared_control_block<atomic_count_policy>;
+
+        static constexpr unsigned pointer_bits = 48;
+        static constexpr std::uint64_t local_one = std::uint64_t(1) << pointer_bits;
+        static constexpr std::uint64_t pointer_mask = local_one - 1;
+
+        // The pointer bits of a word that has switched to the locked path.  No
+        // control block can sit at address 1.
+        static constexpr std::uint64_t locked_word = 1;
+
+        mutable std::atomic<std::uint64_t> word{0};
+        mutable std::atomic<bool> busy{false};
+        shared_ptr<T> locked;  // Guarded by busy once word holds locked_word
+// --------------------------------------------------------------------------------
+
+        class spin_guard {
+            std::atomic<bool>& _busy;
+
+        public:
+            explicit spin_guard(std::atomic<bool>& b) noexcept : _busy(b) {
+                while (_busy.exchange(true, std::memory_order_acquire))
+                    std::this_thread::yield();
+            }
+            ~spin_guard() {_busy.store(false, std::memory_order_release);}
+            spin_guard(const spin_guard&) = delete;
+            spin_guard& operator=(const spin_guard&) = delete;
+        };
+// --------------------------------------------------------------------------------
+
+        static block_type* block_of(std::uint64_t value) noexcept {
+            return reinterpret_cast<block_type*>(static_cast<std::uintptr_t>(value & pointer_mask));
+        }
+
+        static unsigned local_of(std::uint64_t value) noexcept {
+            return static_cast<unsigned>(value >> pointer_bits);
+        }
+
+        // The local count of a locked word may wrap, which never reaches the pointer bits
+        static bool is_locked(std::uint64_t value) noexcept {
+            return (value & pointer_mask) == locked_word;
+        }
+
+        // True when block survives being packed into the pointer bits
+        static bool fits(const block_type* block) noexcept {
+#if CSLT_ATOMIC_SHARED_PTR_LOCKED
+            return block == nullptr;
+#else
+            return (static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(block)) & ~pointer_mask) == 0;
+#endif
+        }
+
+        // Takes the reference held by desired and packs its block with a zero
+        // local count.  The block must fit.
+        static std::uint64_t take(shared_ptr<T>& desired) noexcept {
+            std::uint64_t value = reinterpret_cast<std::uintptr_t>(desired.counter);
+            desired.ptr = nullptr;
+            desired.counter = nullptr;
+            return value;
+        }
+
+        // Turns a word that was swapped out into the shared_ptr that owns its reference
+        static shared_ptr<T> adopt(std::uint64_t value) noexcept {
+            block_type* block = block_of(value);
+            if (!block)
+                return shared_ptr<T>(nullptr);
+            const unsigned local = local_of(value);
+            if (local != 0)
+                block->add_ref(local);
+            return shared_ptr<T>(static_cast<T*>(block->object()), block);
+        }
+// --------------------------------------------------------------------------------
+// The locked path.  Each call holds busy, and switches the word to locked_word
+// first if it still holds a packed pointer.  Objects released by a call are
+// destroyed after busy is let go.
+
+        void lock_word() noexcept {
+            std::uint64_t current = word.load(std::memory_order_relaxed);
+            while (!is_locked(current)) {
+                if (word.compare_exchange_weak(current, locked_word, std::memory_order_acq_rel,
+                                               std::memory_order_relaxed)) {
+                    locked = adopt(current);
+                    return;
+                }
+            }
+        }
+
+        shared_ptr<T> load_locked() const noexcept {
+            spin_guard guard(busy);
+            return locked;
+        }
+
+        shared_ptr<T> exchange_locked(shared_ptr<T> desired) noexcept {
+            spin_guard guard(busy);
+            lock_word();
+            locked.swap(desired);
+            return desired;
+        }
+
+        bool compare_exchange_locked(shared_ptr<T>& expected, shared_ptr<T>& desired) noexcept {
+            shared_ptr<T> current;
+            {
+                spin_guard guard(busy);
+                lock_word();
+                if (locked.counter == expected.counter) {
+                    locked.swap(desired);
+                    return true;
+                }
+                current = locked;
+            }
+            expected = cslt::move(current);
+            return false;
+        }
+// ================================================================================
+
+    public:
+        atomic_shared_ptr() noexcept = default;
+
+        explicit atomic_shared_ptr(shared_ptr<T> desired) noexcept {
+            if (fits(desired.counter)) {
+                word.store(take(desired), std::memory_order_relaxed);
+            } else {
+                word.store(locked_word, std::memory_order_relaxed);
+                locked = cslt::move(desired);
+            }
+        }
+
+        atomic_shared_ptr(const atomic_shared_ptr&) = delete;
+        atomic_shared_ptr& operator=(const atomic_shared_ptr&) = delete;
+// --------------------------------------------------------------------------------
+
+        ~atomic_shared_ptr() {
+            const std::uint64_t value = word.load(std::memory_order_acquire);
+            if (!is_locked(value))
+                adopt(value);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns a shared_ptr that owns the currently stored object
+         */
+        shared_ptr<T> load() const noexcept {
+            const std::uint64_t old = word.fetch_add(local_one, std::memory_order_acquire);
+            if (is_locked(old))
+                return load_locked();
+            block_type* block = block_of(old);
+            if (block)
+                block->add_ref();
+
+            std::uint64_t current = word.load(std::memory_order_relaxed);
+            for (;;) {
+                if (block_of(current) != block || local_of(current) == 0) {
+                    // A writer swapped the word out and paid for the local count
+                    if (block)
+                        block->release();
+                    break;
+                }
+                if (word.compare_exchange_weak(current, current - local_one, std::memory_order_relaxed))
+                    break;
+            }
+            if (!block)
+                return shared_ptr<T>(nullptr);
+            return shared_ptr<T>(static_cast<T*>(block->object()), block);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Replaces the stored object and returns the previous one
+         */
+        shared_ptr<T> exchange(shared_ptr<T> desired) noexcept {
+            if (fits(desired.counter)) {
+                const std::uint64_t replacement = reinterpret_cast<std::uintptr_t>(desired.counter);
+                std::uint64_t current = word.load(std::memory_order_relaxed);
+                while (!is_locked(current)) {
+                    if (word.compare_exchange_weak(current, replacement, std::memory_order_acq_rel,
+                                                   std::memory_order_relaxed)) {
+                        take(desired);
+                        return adopt(current);
+                    }
+                }
+            }
+            return exchange_locked(cslt::move(desired));
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Replaces the stored object, releasing the previous one
+         */
+        void store(shared_ptr<T> desired) noexcept {
+            exchange(cslt::move(desired));
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Stores desired if the stored object is the one owned by expected
+         *
+         * @return true on success.  On failure expected is replaced by the
+         *         currently stored object and false is returned.
+         */
+        bool compare_exchange_strong(shared_ptr<T>& expected, shared_ptr<T> desired) noexcept {
+            std::uint64_t current = word.load(std::memory_order_relaxed);
+            if (fits(desired.counter)) {
+                const std::uint64_t replacement = reinterpret_cast<std::uintptr_t>(desired.counter);
+                while (!is_locked(current) && block_of(current) == expected.counter) {
+                    if (word.compare_exchange_weak(current, replacement, std::memory_order_acq_rel,
+                                                   std::memory_order_relaxed)) {
+                        take(desired);
+                        adopt(current);
+                        return true;
+                    }
+                }
+                if (!is_locked(current)) {
+                    expected = load();
+                    return false;
+                }
+            }
+            return compare_exchange_locked(expected, desired);
+        }
+
+        bool compare_exchange_weak(shared_ptr<T>& expected, shared_ptr<T> desired) noexcept {
+            return compare_exchange_strong(expected, cslt::move(desired));
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns false once the object has switched to the locked path
+         */
+        bool is_lock_free() const noexcept {
+            return word.is_lock_free() && !is_locked(word.load(std::memory_order_relaxed));
+        }
+    };
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief Function to return a shared_ptr whose object and count share one allocation
+     *
+     * The control block and the object are constructed together in a single
+     * block obtained from alloc, and freed together when the last owner releases it.
+     *
+     * @tparam Policy The reference count policy, atomic_count_policy by default
+     * @param alloc An allocator, such as cslt::allocator or cslt::polymorphic_allocator
+     * @param args The arguments forwarded to the constructor of T
+     */
+    template <typename T, typename Policy, typename Alloc, typename... Args>
+    shared_ptr<T, Policy> allocate_shared(const Alloc& alloc, Args&&... args) {
+        using block = shared_inplace_block<T, Alloc, Policy>;
+        block* b = block::create(alloc, cslt::forward<Args>(args)...);
+        return shared_ptr<T, Policy>(b->get(), b);
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Function to return a shared_ptr object with variadac arugments
+     *
+     * The object and its reference count are created with a single allocation.
+     */
+    template <typename T, typename... Args>
+    shared_ptr<T> make_shared(Args&&... args) {
+        return cslt::allocate_shared<T>(cslt::allocator<T>(), cslt::forward<Args>(args)...);
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Function to return a local_shared_ptr with a single allocation
+     */
+    template <typename T, typename... Args>
+    local_shared_ptr<T> make_local_shared(Args&&... args) {
+        return cslt::allocate_shared<T, local_count_policy>(cslt::allocator<T>(),
+                                                            cslt::forward<Args>(args)...);
+    }
+// ================================================================================
+
+    /**
+     * @brief A base class that embeds a reference count in the objects it manages 
+     *
+     * Deriving from intrusive_ref_counter lets intrusive_ptr share an object 
+     * without a separate control block; the count lives inside the object 
+     * itself.  The count is not copied when the object is copied.
+     *
+     * @tparam Derived The class that derives from intrusive_ref_counter
+     * @tparam Policy atomic_count_policy or local_count_policy
+     */
+    template <typename Derived, typename Policy = atomic_count_policy>
+    class intrusive_ref_counter {
+    private:
+        mutable typename Policy::count_type _refs{0};
+// --------------------------------------------------------------------------------
+
+        friend void intrusive_ptr_add_ref(const intrusive_ref_counter* p) noexcept {
+            Policy::increment(p->_refs);
+        }
+
+        friend void intrusive_ptr_release(const intrusive_ref_counter* p) noexcept {
+            if (Policy::decrement(p->_refs))
+                delete static_cast<const Derived*>(p);
+        }
+// ================================================================================
+
+    protected:
+        intrusive_ref_counter() noexcept = default;
+        intrusive_ref_counter(const intrusive_ref_counter&) noexcept : _refs{0} {}
+        intrusive_ref_counter& operator=(const intrusive_ref_counter&) noexcept {return *this;}
+        ~intrusive_ref_counter() = default;
+// ================================================================================
+
+    public:
+        unsigned use_count() const noexcept {return Policy::load(_refs);}
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief A shared pointer that keeps its reference count inside the object 
+     *
+     * The managed type provides intrusive_ptr_add_ref and intrusive_ptr_release, 
+     * usually by deriving from intrusive_ref_counter.  An intrusive_ptr is a 
+     * single pointer wide and never allocates.
+     *
+     * @tparam T The type of data managed in this class
+     */
+    template <typename T>
+    class intrusive_ptr {
+    private:
+        T* ptr = nullptr;
+// ================================================================================
+
+    public:
+        intrusive_ptr() noexcept = default;
+        intrusive_ptr(std::nullptr_t) noexcept {}
+
+        /**
+         * @brief Takes shared ownership of p 
+         *
+         * @param p A pointer to the object
+         * @param add_ref false if the caller is handing over a count it already holds
+         */
+        intrusive_ptr(T* p, bool add_ref = true) : ptr(p) {
+            if (ptr && add_ref)
+                intrusive_ptr_add_ref(ptr);
+        }
+// --------------------------------------------------------------------------------
+
+        ~intrusive_ptr() {
+            if (ptr)
+                intrusive_ptr_release(ptr);
+        }
+// --------------------------------------------------------------------------------
+
+        intrusive_ptr(const intrusive_ptr& other) : ptr(other.ptr) {
+            if (ptr)
+                intrusive_ptr_add_ref(ptr);
+        }
+
+        intrusive_ptr(intrusive_ptr&& other) noexcept : ptr(other.ptr) {
+            other.ptr = nullptr;
+        }
+// --------------------------------------------------------------------------------
+
+        intrusive_ptr& operator=(const intrusive_ptr& other) {
+            intrusive_ptr(other).swap(*this);
+            return *this;
+        }
+
+        intrusive_ptr& operator=(intrusive_ptr&& other) noexcept {
+            intrusive_ptr(cslt::move(other)).swap(*this);
+            return *this;
+        }
+// --------------------------------------------------------------------------------
+
+        void reset(T* p = nullptr) {
+            intrusive_ptr(p).swap(*this);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Gives up ownership without decrementing the count
+         */
+        T* detach() noexcept {
+            T* temp = ptr;
+            ptr = nullptr;
+            return temp;
+        }
+// --------------------------------------------------------------------------------
+
+        void swap(intrusive_ptr& other) noexcept {
+            cslt::swap(ptr, other.ptr);
+        }
+// --------------------------------------------------------------------------------
+
+        T& operator*() const {return *ptr;}
+        T* operator->() const {return ptr;}
+        T* get() const noexcept {return ptr;}
+        explicit operator bool() const {return ptr != nullptr;}
+    };
+// --------------------------------------------------------------------------------
+
+    template <typename T>
+    struct is_trivially_relocatable<intrusive_ptr<T>> : std::true_type {};
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Function to return an intrusive_ptr to a new object
+     */
+    template <typename T, typename... Args>
+    intrusive_ptr<T> make_intrusive(Args&&... args) {
+        return intrusive_ptr<T>(new T(cslt::forward<Args>(args)...));
+    }
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief Storage policy for array_ptr that draws memory from an allocator
+     *
+     * Blocks are obtained from the allocator and every element is value
+     * initialized in place.  Pointers handed to array_ptr::reset must come from
+     * an allocator that compares equal to the one held here.
+     *
+     * @tparam T The data type of the array
+     * @tparam Alloc The allocator that provides the storage
+     */
+    template <typename T, typename Alloc>
+    class array_storage {
+    private:
+        using alloc_traits = std::allocator_traits<Alloc>;
+        Alloc _allocator;
+// --------------------------------------------------------------------------------
+
+        T* allocate(cslt::size_t num) {
+            if (num == 0)
+                return nullptr;
+            T* p = alloc_traits::allocate(_allocator, num);
+            CSLT_RECORD_ALLOC(array_ptr, num * sizeof(T));
+            return p;
+        }
+
+        void deallocate(T* p, cslt::size_t num) noexcept {
+            if (p) {
+                alloc_traits::deallocate(_allocator, p, num);
+                CSLT_RECORD_FREE(array_ptr, num * sizeof(T));
+            }
+        }
+
+        void construct_n(T* p, cslt::size_t num) {
+            cslt::size_t i = 0;
+            try {
+                for (; i < num; ++i)
+                    alloc_traits::construct(_allocator, p + i);
+            } catch (...) {
+                cslt::destroy_n(_allocator, p, i);
+                throw;
+            }
+        }
+
+        void assign_allocator(const array_storage& other, std::true_type) {_allocator = other._allocator;}
+        void assign_allocator(const array_storage&, std::false_type) noexcept {}
+// ================================================================================
+
+    public:
+        static constexpr bool always_steals = alloc_traits::propagate_on_container_move_assignment::value ||
+                                              alloc_traits::is_always_equal::value;
+// --------------------------------------------------------------------------------
+
+        explicit array_storage(const Alloc& alloc = Alloc()) : _allocator(alloc) {}
+
+        array_storage(const array_storage& other)
+            : _allocator(alloc_traits::select_on_container_copy_construction(other._allocator)) {}
+
+        array_storage(array_storage&& other) noexcept : _allocator(cslt::move(other._allocator)) {}
+// --------------------------------------------------------------------------------
+
+        Alloc get_allocator() const {return _allocator;}
+// --------------------------------------------------------------------------------
+
+        T* create(cslt::size_t num) {
+            T* p = allocate(num);
+            try {
+                construct_n(p, num);
+            } catch (...) {
+                deallocate(p, num);
+                throw;
+            }
+            return p;
+        }
+// --------------------------------------------------------------------------------
+
+        T* copy(const T* src, cslt::size_t num) {
+            T* p = allocate(num);
+            try {
+                cslt::uninitialized_copy_n(_allocator, src, num, p);
+            } catch (...) {
+                deallocate(p, num);
+                throw;
+            }
+            return p;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Moves the first min(len, num) elements of p into a new block of num elements
+         *
+         * Elements beyond the old length are value initialized.  The old block is
+         * released once the new one is complete.
+         */
+        T* resize(T* p, cslt::size_t len, cslt::size_t num) {
+            T* block = allocate(num);
+            if (p)
+                CSLT_RECORD_REALLOC(array_ptr);
+            const cslt::size_t keep = std::min(len, num);
+            if (cslt::is_trivially_relocatable<T>::value) {
+                // The new tail is built first, so the bitwise move is the last step and cannot fail
+                try {
+                    construct_n(block + keep, num - keep);
+                } catch (...) {
+                    deallocate(block, num);
+                    throw;
+                }
+                cslt::uninitialized_relocate_n(_allocator, p, keep, block);
+                cslt::destroy_n(_allocator, p + keep, len - keep);
+                deallocate(p, len);
+                return block;
+            }
+            try {
+                cslt::uninitialized_move_if_noexcept_n(_allocator, p, keep, block);
+                try {
+                    construct_n(block + keep, num - keep);
+                } catch (...) {
+                    cslt::destroy_n(_allocator, block, keep);
+                    throw;
+                }
+            } catch (...) {
+                deallocate(block, num);
+                throw;
+            }
+            destroy(p, len);
+            return block;
+        }
+// --------------------------------------------------------------------------------
+
+        void destroy(T* p, cslt::size_t num) noexcept {
+            cslt::destroy_n(_allocator, p, num);
+            deallocate(p, num);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Prepares to take ownership of a block held by other
+         *
+         * @return true if the block can be adopted as is, false if its elements
+         *         must be moved into memory from this allocator instead
+         */
+        bool adopt(const array_storage& other) {
+            assign_allocator(other, typename alloc_traits::propagate_on_container_move_assignment());
+            return _allocator == other._allocator;
+        }
+// --------------------------------------------------------------------------------
+
+        T* move_from(T* src, cslt::size_t num) {
+            T* p = allocate(num);
+            try {
+                cslt::uninitialized_move_if_noexcept_n(_allocator, src, num, p);
+            } catch (...) {
+                deallocate(p, num);
+                throw;
+            }
+            return p;
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Storage policy for array_ptr built on new[] and delete[]
+     *
+     * This is the default policy, so pointers released by an array_ptr may be
+     * freed with delete[] and pointers from new[] may be passed to reset.
+     */
+    template <typename T>
+    class array_storage<T, void> {
+    private:
+        static void swap_bytes(T* a, T* b) noexcept {
+            unsigned char temp[sizeof(T)];
+            std::memcpy(temp, static_cast<const void*>(a), sizeof(T));
+            std::memcpy(static_cast<void*>(a), static_cast<const void*>(b), sizeof(T));
+            std::memcpy(static_cast<void*>(b), temp, sizeof(T));
+        }
+// ================================================================================
+
+    public:
+        static constexpr bool always_steals = true;
+// --------------------------------------------------------------------------------
+
+        T* create(cslt::size_t num) {
+            if (num == 0)
+                return nullptr;
+            T* p = new T[num];
+            CSLT_RECORD_ALLOC(array_ptr, num * sizeof(T));
+            return p;
+        }
+// --------------------------------------------------------------------------------
+
+        T* copy(const T* src, cslt::size_t num) {
+            T* p = create(num);
+            std::copy(src, src + num, p);
+            return p;
+        }
+// --------------------------------------------------------------------------------
+
+        T* resize(T* p, cslt::size_t len, cslt::size_t num) {
+            T* block = create(num);
+            if (p)
+                CSLT_RECORD_REALLOC(array_ptr);
+            cslt::size_t numElementsToCopy = std::min(num, len);
+            if (std::is_trivially_copyable<T>::value) {
+                if (numElementsToCopy > 0)
+                    std::memcpy(static_cast<void*>(block), static_cast<const void*>(p), numElementsToCopy * sizeof(T));
+            }
+            else if (cslt::is_trivially_relocatable<T>::value) {
+                // delete[] will destroy every old slot, so each kept element trades
+                // places with the default constructed one in the new block
+                for (cslt::size_t i = 0; i < numElementsToCopy; ++i)
+                    swap_bytes(block + i, p + i);
+            }
+            else {
+                for (cslt::size_t i = 0; i < numElementsToCopy; ++i) {
+                    block[i] = cslt::move_if_noexcept(p[i]);
+                }
+            }
+            destroy(p, len);
+            return block;
+        }
+// --------------------------------------------------------------------------------
+
+        void destroy(T* p, cslt::size_t num) noexcept {
+            if (p)
+                CSLT_RECORD_FREE(array_ptr, num * sizeof(T));
+            delete[] p;
+        }
+// --------------------------------------------------------------------------------
+
+        bool adopt(const array_storage&) noexcept {return true;}
+
+        T* move_from(T* src, cslt::size_t) noexcept {return src;}
+    };
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief This class helps manage contiguous memory allocations
+     *
      * This class allows a user to manage contiguous memory allocations similar to
      * the unique_ptr class; however, this class also provides methods for reallocation
      * of memory similar to a c-style realloc command.
+     *
+     * By default the array is created with new[] and destroyed with delete[].  When
+     * an allocator type is supplied, such as cslt::polymorphic_allocator<T>, the
+     * memory is drawn from that allocator instead and the elements are value
+     * initialized.
      * 
      * @tparam T the data type of the array pointer.
+     * @tparam Alloc The allocator that provides the storage, or void for new[]
      * @param buff The buffer size as the number of allocated indices of type T
      */
-    template <typename T>
+    template <typename T, typename Alloc = void>
     class array_ptr {
     private:
+        array_storage<T, Alloc> _store;
         T* ptr = nullptr;
         cslt::size_t _len = 0;
 // ================================================================================
@@ -288,49 +1672,62 @@ namespace cslt {
         /**
          * @brief the Constructor
          */
-        explicit array_ptr(std::size_t buff = 0) : ptr(buff > 0 ? new T[buff] : nullptr), _len(buff) {}
+        explicit array_ptr(std::size_t buff = 0) : ptr(_store.create(buff)), _len(buff) {}
         array_ptr(std::nullptr_t) : ptr(nullptr), _len(0) {}
 
+        /**
+         * @brief Constructor that draws memory from an allocator instance
+         */
+        template <typename A = Alloc, typename = typename std::enable_if<!std::is_void<A>::value>::type>
+        array_ptr(std::size_t buff, const A& alloc) : _store(alloc), ptr(_store.create(buff)), _len(buff) {}
 // --------------------------------------------------------------------------------
 
         /**
          * @brief The destructor
          */
         ~array_ptr() {
-            delete[] ptr;
+            _store.destroy(ptr, _len);
         }
 // --------------------------------------------------------------------------------
 
         // Copy constructor
-        array_ptr(const array_ptr& other) : ptr(other._len > 0 ? new T[other._len] : nullptr), _len(other._len) {
-            std::copy(other.ptr, other.ptr + other._len, ptr);
-        }
+        array_ptr(const array_ptr& other) : _store(other._store), ptr(_store.copy(other.ptr, other._len)),
+                                            _len(other._len) {}
 // --------------------------------------------------------------------------------
 
         // Copy assignment operator
         array_ptr& operator=(const array_ptr& other) {
             if (this != &other) { // Guard against self-assignment
-                delete[] ptr; // Free existing resource
+                T* block = _store.copy(other.ptr, other._len);
+                _store.destroy(ptr, _len); // Free existing resource
+                ptr = block;
                 _len = other._len;
-                ptr = other._len > 0 ? new T[other._len] : nullptr;
-                std::copy(other.ptr, other.ptr + other._len, ptr);
             }
             return *this;
         }
 // --------------------------------------------------------------------------------
 
         // Move constructor
-        array_ptr(array_ptr&& other) noexcept : ptr(other.ptr), _len(other._len) {
+        array_ptr(array_ptr&& other) noexcept : _store(cslt::move(other._store)), ptr(other.ptr), _len(other._len) {
             other.ptr = nullptr;
             other._len = 0;
         }
 // --------------------------------------------------------------------------------
 
         // Move assignment operator
-        array_ptr& operator=(array_ptr&& other) noexcept {
+        array_ptr& operator=(array_ptr&& other) noexcept(array_storage<T, Alloc>::always_steals) {
             if (this != &other) {
-                delete[] ptr; // Free existing array
-                ptr = other.ptr;
+                _store.destroy(ptr, _len); // Free existing array
+                ptr = nullptr;
+                _len = 0;
+                if (_store.adopt(other._store)) {
+                    ptr = other.ptr;
+                }
+                else {
+                    // The allocators differ, so the elements are moved into our memory
+                    ptr = _store.move_from(other.ptr, other._len);
+                    other._store.destroy(other.ptr, other._len);
+                }
                 _len = other._len;
                 other.ptr = nullptr;
                 other._len = 0;
@@ -345,32 +1742,45 @@ namespace cslt {
                 return;
             }
 
-            T* newPtr = buff > 0 ? new T[buff] : nullptr;
-
-            cslt::size_t numElementsToCopy = std::min(buff, _len);
-            for (cslt::size_t i = 0; i < numElementsToCopy; ++i) {
-                newPtr[i] = cslt::move_if_noexcept(ptr[i]);
-            }
-
-            delete[] ptr;
-
-            ptr = newPtr;
+            CSLT_PROFILE_SCOPE("array_ptr.realloc");
+            ptr = _store.resize(ptr, _len, buff);
             _len = buff;
         }
 // --------------------------------------------------------------------------------
 
         T& operator*() const {return *ptr;}
         T* operator->() const {return ptr;}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Element access, checked according to CSLT_BOUNDS_CHECK
+         *
+         * Bounds are checked in the default and hardened builds, and not at
+         * all when NDEBUG is defined, so release loops over the array can be
+         * vectorized.  See config.hpp.
+         */
         T& operator[](cslt::size_t index) const {
-            if (index >= _len)
-                throw cslt::out_of_range("Index out of range");
+            CSLT_CHECK_INDEX(index, _len);
             return ptr[index];
         }
-        T& operator[](cslt::size_t index) {
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Element access that always throws cslt::out_of_range past the end
+         */
+        T& at(cslt::size_t index) const {
             if (index >= _len)
-                throw cslt::out_of_range("Index out of range");
+                throw cslt::out_of_range(CSLT_LITERAL("Index out of range"));
             return ptr[index];
         }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Raw pointer access and iteration over the elements
+         */
+        T* data() const noexcept {return ptr;}
+        T* begin() const noexcept {return ptr;}
+        T* end() const noexcept {return ptr + _len;}
 
         explicit operator bool() const {return ptr != nullptr;}
 // --------------------------------------------------------------------------------
@@ -385,7 +1795,7 @@ namespace cslt {
 
         void reset(T* p = nullptr, std::size_t newLen = 0) {
             if (ptr != p) {
-                delete[] ptr;
+                _store.destroy(ptr, _len);
                 ptr = p;
                 _len = newLen; // Consider if you want to keep this pattern
             }
@@ -398,7 +1808,40 @@ namespace cslt {
 // --------------------------------------------------------------------------------
 
         const T* get() const {return ptr;}
+// --------------------------------------------------------------------------------
+
+        template <typename A = Alloc, typename = typename std::enable_if<!std::is_void<A>::value>::type>
+        A get_allocator() const {return _store.get_allocator();}
     };
+// --------------------------------------------------------------------------------
+
+    // The block and the allocator are held by value and never point back into the array_ptr
+    template <typename T, typename Alloc>
+    struct is_trivially_relocatable<array_ptr<T, Alloc>>
+        : std::integral_constant<bool, std::is_void<Alloc>::value || is_trivially_relocatable<Alloc>::value> {};
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief An array_ptr whose block is aligned and padded to Align bytes
+     *
+     * Copies, moves and realloc keep the alignment, since each new block comes
+     * from the same aligned_allocator.  A pointer taken with release() must be
+     * returned through aligned_allocator<T, Align>::deallocate, or adopted by
+     * reset() on another aligned_array_ptr of the same alignment.
+     */
+    template <typename T, cslt::size_t Align = 64>
+    using aligned_array_ptr = array_ptr<T, aligned_allocator<T, Align>>;
+// ================================================================================
+// ================================================================================
+
+    namespace pmr {
+        /**
+         * @brief An array_ptr whose memory comes from a memory_resource
+         */
+        template <typename T>
+        using array_ptr = cslt::array_ptr<T, cslt::polymorphic_allocator<T>>;
+    }
 // ================================================================================
 // ================================================================================
 
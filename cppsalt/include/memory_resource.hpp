@@ -0,0 +1,359 @@
+// ================================================================================
+// ================================================================================
+// - File:    memory_resource.hpp
+// - Purpose: Polymorphic memory resources, arenas and pools
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef memory_resource_HPP
+#define memory_resource_HPP
+
+#include "dtype.hpp"
+#include "except.hpp"
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    /**
+     * @brief An abstract interface for a source of raw memory
+     *
+     * Containers and allocators talk to a memory_resource through the public
+     * allocate, deallocate and is_equal methods.  Concrete resources override
+     * the private do_ methods.
+     */
+    class memory_resource {
+    public:
+        static constexpr cslt::size_t max_align = alignof(std::max_align_t);
+// --------------------------------------------------------------------------------
+
+        virtual ~memory_resource();
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Allocates at least bytes of storage aligned to alignment
+         *
+         * @param bytes The size of the block in bytes
+         * @param alignment A power of two alignment for the block
+         * @return A pointer to the block.  Throws cslt::bad_alloc on failure
+         */
+        void* allocate(cslt::size_t bytes, cslt::size_t alignment = max_align) {
+            return do_allocate(bytes, alignment);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns a block obtained from allocate with the same bytes and alignment
+         */
+        void deallocate(void* p, cslt::size_t bytes, cslt::size_t alignment = max_align) {
+            do_deallocate(p, bytes, alignment);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns true if memory allocated by this resource can be freed by other
+         */
+        bool is_equal(const memory_resource& other) const noexcept {
+            return this == &other || do_is_equal(other);
+        }
+// ================================================================================
+
+    private:
+        virtual void* do_allocate(cslt::size_t bytes, cslt::size_t alignment) = 0;
+        virtual void do_deallocate(void* p, cslt::size_t bytes, cslt::size_t alignment) = 0;
+        virtual bool do_is_equal(const memory_resource& other) const noexcept = 0;
+    };
+// --------------------------------------------------------------------------------
+
+    inline bool operator==(const memory_resource& a, const memory_resource& b) noexcept {
+        return a.is_equal(b);
+    }
+    inline bool operator!=(const memory_resource& a, const memory_resource& b) noexcept {
+        return !a.is_equal(b);
+    }
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief Returns a resource that forwards to the global operator new and delete
+     */
+    memory_resource* new_delete_resource() noexcept;
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Returns a resource that throws cslt::bad_alloc on every allocation
+     *
+     * Useful as the upstream of an arena that must never reach the heap.
+     */
+    memory_resource* null_memory_resource() noexcept;
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Returns the resource used by default constructed polymorphic allocators
+     */
+    memory_resource* get_default_resource() noexcept;
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Replaces the default resource
+     *
+     * @param res The new default, or nullptr to restore new_delete_resource()
+     * @return The previous default resource
+     */
+    memory_resource* set_default_resource(memory_resource* res) noexcept;
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief A bump pointer resource that releases all of its memory at once
+     *
+     * Each allocation is carved from the current chunk by advancing a pointer.
+     * When a chunk is exhausted a new one, twice the size of the last, is taken
+     * from the upstream resource.  deallocate does nothing; the memory is handed
+     * back when release() is called or the arena is destroyed, which costs one
+     * upstream call per chunk regardless of how many objects were allocated.
+     * Objects placed in an arena are not destroyed by it, so only types whose
+     * destructors may be skipped should rely on the arena to reclaim them.
+     */
+    class monotonic_arena : public memory_resource {
+    private:
+        struct chunk {
+            chunk* next;
+            cslt::size_t size;
+        };
+
+        memory_resource* upstream;
+        chunk* chunks = nullptr;
+        char* current = nullptr;
+        char* end = nullptr;
+        char* initial_buffer = nullptr;
+        cslt::size_t initial_size = 0;
+        cslt::size_t next_size;
+        cslt::size_t used = 0;
+// --------------------------------------------------------------------------------
+
+        void new_chunk(cslt::size_t bytes, cslt::size_t alignment);
+// ================================================================================
+
+    public:
+        static constexpr cslt::size_t default_chunk_size = 4096;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Creates an arena whose first chunk holds initial_size bytes
+         *
+         * No memory is requested until the first allocation.
+         */
+        explicit monotonic_arena(memory_resource* upstream = get_default_resource());
+        explicit monotonic_arena(cslt::size_t initial_size,
+                                 memory_resource* upstream = get_default_resource());
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Creates an arena that serves allocations from buffer before using upstream
+         *
+         * The buffer is owned by the caller and must outlive the arena.
+         */
+        monotonic_arena(void* buffer, cslt::size_t size,
+                        memory_resource* upstream = get_default_resource());
+// --------------------------------------------------------------------------------
+
+        monotonic_arena(const monotonic_arena&) = delete;
+        monotonic_arena& operator=(const monotonic_arena&) = delete;
+// --------------------------------------------------------------------------------
+
+        ~monotonic_arena() override;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns every chunk to the upstream resource
+         *
+         * Any memory previously handed out by the arena becomes invalid.  The
+         * arena may be used again afterwards.
+         */
+        void release() noexcept;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns the number of bytes handed out since construction or the last release
+         */
+        cslt::size_t bytes_allocated() const noexcept {return used;}
+
+        memory_resource* upstream_resource() const noexcept {return upstream;}
+// ================================================================================
+
+    private:
+        void* do_allocate(cslt::size_t bytes, cslt::size_t alignment) override;
+        void do_deallocate(void* p, cslt::size_t bytes, cslt::size_t alignment) override;
+        bool do_is_equal(const memory_resource& other) const noexcept override;
+    };
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief A resource that serves small blocks from fixed-size free lists
+     *
+     * Requests are rounded up to a power of two size class between 8 bytes and
+     * max_block_size.  Each size class keeps a singly linked free list threaded
+     * through its unused blocks and refills it by carving slabs obtained from
+     * the upstream resource, so allocate and deallocate are O(1) pointer pushes
+     * and pops.  Larger requests go directly to the upstream resource.  The
+     * pool is not thread safe.
+     */
+    class pool_resource : public memory_resource {
+    private:
+        struct slab {
+            slab* next;
+            cslt::size_t size;
+        };
+        struct free_block {
+            free_block* next;
+        };
+        struct large_block {
+            large_block* prev;
+            large_block* next;
+            cslt::size_t size;
+            cslt::size_t alignment;
+        };
+        struct pool {
+            free_block* free_list = nullptr;
+            cslt::size_t blocks_per_slab = 0;
+        };
+
+        static constexpr cslt::size_t min_block = 8;
+        static constexpr cslt::size_t max_pools = 16;
+
+        memory_resource* upstream;
+        cslt::size_t max_block;
+        cslt::size_t max_blocks_per_slab;
+        cslt::size_t num_pools;
+        pool pools[max_pools];
+        slab* slabs = nullptr;
+        large_block* large = nullptr;
+// --------------------------------------------------------------------------------
+
+        cslt::size_t pool_index(cslt::size_t bytes) const noexcept;
+        void refill(cslt::size_t index);
+        static cslt::size_t large_header(cslt::size_t alignment) noexcept;
+// ================================================================================
+
+    public:
+        /**
+         * @brief Creates a pool resource
+         *
+         * @param max_block_size The largest request served from a free list,
+         *                       rounded up to a power of two and capped at 256KiB
+         * @param max_blocks_per_slab The limit on how many blocks a slab may hold.
+         *                            Slabs of each size class start small and double.
+         * @param upstream The resource that supplies slabs and large blocks
+         */
+        explicit pool_resource(cslt::size_t max_block_size = 512,
+                               cslt::size_t max_blocks_per_slab = 1024,
+                               memory_resource* upstream = get_default_resource());
+        explicit pool_resource(memory_resource* upstream);
+// --------------------------------------------------------------------------------
+
+        pool_resource(const pool_resource&) = delete;
+        pool_resource& operator=(const pool_resource&) = delete;
+// --------------------------------------------------------------------------------
+
+        ~pool_resource() override;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns every slab and large block to the upstream resource
+         */
+        void release() noexcept;
+// --------------------------------------------------------------------------------
+
+        cslt::size_t max_block_size() const noexcept {return max_block;}
+        memory_resource* upstream_resource() const noexcept {return upstream;}
+// ================================================================================
+
+    private:
+        void* do_allocate(cslt::size_t bytes, cslt::size_t alignment) override;
+        void do_deallocate(void* p, cslt::size_t bytes, cslt::size_t alignment) override;
+        bool do_is_equal(const memory_resource& other) const noexcept override;
+    };
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief An allocator that draws its memory from a memory_resource
+     *
+     * This is the bridge that lets the containers in the cslt namespace use an
+     * arena or a pool.  The resource is not propagated on copy or move
+     * assignment, and a copy constructed container falls back to the default
+     * resource, which matches the behavior of std::pmr::polymorphic_allocator.
+     *
+     * @tparam T The data type for which memory is allocated
+     */
+    template <typename T>
+    class polymorphic_allocator {
+    private:
+        memory_resource* res;
+// ================================================================================
+
+    public:
+        using value_type = T;
+        using size_type = cslt::size_t;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::false_type;
+        using propagate_on_container_swap = std::false_type;
+// --------------------------------------------------------------------------------
+
+        polymorphic_allocator() noexcept : res(get_default_resource()) {}
+        polymorphic_allocator(memory_resource* r) noexcept : res(r ? r : get_default_resource()) {}
+        polymorphic_allocator(const polymorphic_allocator& other) noexcept = default;
+        template <typename U>
+        polymorphic_allocator(const polymorphic_allocator<U>& other) noexcept : res(other.resource()) {}
+        polymorphic_allocator& operator=(const polymorphic_allocator&) = delete;
+// --------------------------------------------------------------------------------
+
+        T* allocate(cslt::size_t num) {
+            if (num > std::numeric_limits<cslt::size_t>::max() / sizeof(T))
+                throw cslt::bad_array_new_length();
+            return static_cast<T*>(res->allocate(num * sizeof(T), alignof(T)));
+        }
+// --------------------------------------------------------------------------------
+
+        void deallocate(T* p, cslt::size_t num) {
+            res->deallocate(p, num * sizeof(T), alignof(T));
+        }
+// --------------------------------------------------------------------------------
+
+        polymorphic_allocator select_on_container_copy_construction() const {
+            return polymorphic_allocator();
+        }
+// --------------------------------------------------------------------------------
+
+        memory_resource* resource() const noexcept {return res;}
+    };
+// --------------------------------------------------------------------------------
+
+    template <typename T, typename U>
+    bool operator==(const polymorphic_allocator<T>& a, const polymorphic_allocator<U>& b) noexcept {
+        return *a.resource() == *b.resource();
+    }
+    template <typename T, typename U>
+    bool operator!=(const polymorphic_allocator<T>& a, const polymorphic_allocator<U>& b) noexcept {
+        return !(a == b);
+    }
+
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* memory_resource_HPP */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,450 @@
+// ================================================================================
+// ================================================================================
+// - File:    parallel_algorithm.hpp
+// - Purpose: Parallel for_each, transform, reduce, inclusive_scan and sorts
+//            that run on a thread_pool
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_parallel_algorithm_HPP
+#define cslt_parallel_algorithm_HPP
+
+#include "dtype.hpp"
+#include "except.hpp"
+#include "memory.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <type_traits>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+namespace par {
+
+    /**
+     * @brief Where and how a parallel algorithm runs
+     *
+     * The algorithms accept any contiguous range with data() and size(), such
+     * as cslt::vector, cslt::array_ptr and cslt::span.
+     */
+    struct policy {
+        /// The pool to run on, or nullptr for default_thread_pool()
+        thread_pool* pool = nullptr;
+        /// Whether reduce must return the same result for any number of threads
+        bool deterministic = false;
+        /// The elements each task handles at least, or 0 to let the algorithm choose
+        cslt::size_t grain = 0;
+    };
+// --------------------------------------------------------------------------------
+
+    namespace detail {
+        template <typename Range>
+        using element_t = std::remove_pointer_t<decltype(std::declval<Range&>().data())>;
+
+        // The block size of the algorithms whose result must not depend on the threads
+        constexpr cslt::size_t fixed_block = 1u << 14;
+
+        // Below this many elements the sorts run on the calling thread
+        constexpr cslt::size_t serial_sort_limit = 1u << 13;
+
+        inline thread_pool& pool_of(const policy& p) {
+            return p.pool ? *p.pool : default_thread_pool();
+        }
+
+        inline cslt::size_t block_of(const policy& p) noexcept {
+            return p.grain > 0 ? p.grain : fixed_block;
+        }
+
+        inline cslt::size_t block_count(cslt::size_t num, cslt::size_t block) noexcept {
+            return (num + block - 1) / block;
+        }
+
+        /**
+         * Runs func(index) for every block index, one task per block
+         */
+        template <typename F>
+        void for_blocks(thread_pool& pool, cslt::size_t blocks, F func) {
+            pool.parallel_for(0, blocks, [&func](cslt::size_t begin, cslt::size_t end) {
+                for (cslt::size_t b = begin; b < end; ++b)
+                    func(b);
+            }, 1);
+        }
+    } /* end of detail namespace */
+// ================================================================================
+// ================================================================================
+// ELEMENT-WISE ALGORITHMS
+
+    /**
+     * @brief Calls func(element) for every element of range
+     */
+    template <typename Range, typename F>
+    void for_each(Range&& range, F func, const policy& p = policy()) {
+        auto* data = range.data();
+        detail::pool_of(p).parallel_for(0, range.size(), [data, &func](cslt::size_t begin, cslt::size_t end) {
+            for (cslt::size_t i = begin; i < end; ++i)
+                func(data[i]);
+        }, p.grain);
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Stores func(in[i]) in out[i] for every element of in
+     *
+     * out may be in itself.  Throws cslt::invalid_argument if out is shorter
+     * than in.
+     */
+    template <typename In, typename Out, typename F>
+    void transform(In&& in, Out&& out, F func, const policy& p = policy()) {
+        if (out.size() < in.size())
+            throw cslt::invalid_argument(CSLT_LITERAL("par::transform output is shorter than its input"));
+        auto* source = in.data();
+        auto* dest = out.data();
+        detail::pool_of(p).parallel_for(0, in.size(), [source, dest, &func](cslt::size_t begin, cslt::size_t end) {
+            for (cslt::size_t i = begin; i < end; ++i)
+                dest[i] = func(source[i]);
+        }, p.grain);
+    }
+// ================================================================================
+// ================================================================================
+// REDUCE AND SCAN
+
+    /**
+     * @brief Combines init and every element of range with op
+     *
+     * op must be associative and commutative, as for std::reduce.  By default
+     * each chunk of parallel_for is folded on its own and the chunk results
+     * are combined in the order they finish, so a floating point sum may differ
+     * in its last bits from run to run.  With policy::deterministic the range
+     * is cut into blocks of a fixed size instead, and the block results are
+     * combined in order, which gives the same answer for any number of
+     * threads; T must then be default constructible.
+     */
+    template <typename Range, typename T, typename Op = std::plus<>>
+    T reduce(Range&& range, T init, Op op = Op(), const policy& p = policy()) {
+        const cslt::size_t num = range.size();
+        if (num == 0)
+            return init;
+        auto* data = range.data();
+        thread_pool& pool = detail::pool_of(p);
+        if (p.deterministic) {
+            const cslt::size_t block = detail::block_of(p);
+            const cslt::size_t blocks = detail::block_count(num, block);
+            array_ptr<T> partial(blocks);
+            detail::for_blocks(pool, blocks, [&](cslt::size_t b) {
+                const cslt::size_t begin = b * block;
+                const cslt::size_t end = std::min(num, begin + block);
+                T sum = data[begin];
+                for (cslt::size_t i = begin + 1; i < end; ++i)
+                    sum = op(sum, data[i]);
+                partial[b] = cslt::move(sum);
+            });
+            for (cslt::size_t b = 0; b < blocks; ++b)
+                init = op(init, partial[b]);
+            return init;
+        }
+        std::mutex lock;
+        pool.parallel_for(0, num, [&](cslt::size_t begin, cslt::size_t end) {
+            T sum = data[begin];
+            for (cslt::size_t i = begin + 1; i < end; ++i)
+                sum = op(sum, data[i]);
+            std::lock_guard<std::mutex> guard(lock);
+            init = op(init, sum);
+        }, p.grain);
+        return init;
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Stores in out[i] the combination with op of in[0] through in[i]
+     *
+     * Each block of a fixed size is totalled in parallel, the totals are
+     * scanned in order, and each block is then scanned again from its
+     * carry, so the result does not depend on the threads.  out may be in
+     * itself.  T must be default constructible.  Throws cslt::invalid_argument
+     * if out is shorter than in.
+     */
+    template <typename In, typename Out, typename Op = std::plus<>>
+    void inclusive_scan(In&& in, Out&& out, Op op = Op(), const policy& p = policy()) {
+        using T = std::remove_cv_t<detail::element_t<Out>>;
+        const cslt::size_t num = in.size();
+        if (out.size() < num)
+            throw cslt::invalid_argument(
+                CSLT_LITERAL("par::inclusive_scan output is shorter than its input"));
+        if (num == 0)
+            return;
+        auto* source = in.data();
+        auto* dest = out.data();
+        thread_pool& pool = detail::pool_of(p);
+        const cslt::size_t block = detail::block_of(p);
+        const cslt::size_t blocks = detail::block_count(num, block);
+        array_ptr<T> carry(blocks);
+        detail::for_blocks(pool, blocks, [&](cslt::size_t b) {
+            const cslt::size_t begin = b * block;
+            const cslt::size_t end = std::min(num, begin + block);
+            T sum = source[begin];
+            for (cslt::size_t i = begin + 1; i < end; ++i)
+                sum = op(sum, source[i]);
+            carry[b] = cslt::move(sum);
+        });
+        for (cslt::size_t b = 1; b < blocks; ++b)
+            carry[b] = op(carry[b - 1], carry[b]);
+        detail::for_blocks(pool, blocks, [&](cslt::size_t b) {
+            const cslt::size_t begin = b * block;
+            const cslt::size_t end = std::min(num, begin + block);
+            T running = b == 0 ? T(source[begin]) : op(carry[b - 1], source[begin]);
+            for (cslt::size_t i = begin + 1; i < end; ++i) {
+                T next = op(running, source[i]);
+                dest[i - 1] = cslt::move(running);
+                running = cslt::move(next);
+            }
+            dest[end - 1] = cslt::move(running);
+        });
+    }
+// ================================================================================
+// ================================================================================
+// MERGE SORT
+
+    namespace detail {
+        /**
+         * The number of elements of a that come before output position k in
+         * the stable merge of a and b
+         */
+        template <typename T, typename Compare>
+        cslt::size_t co_rank(cslt::size_t k, const T* a, cslt::size_t na, const T* b, cslt::size_t nb,
+                             Compare& comp) {
+            cslt::size_t low = k > nb ? k - nb : 0;
+            cslt::size_t high = std::min(k, na);
+            while (low < high) {
+                const cslt::size_t i = low + (high - low) / 2;
+                const cslt::size_t j = k - i;
+                // Ties go to a, so a[i] belongs before b[j - 1] unless b[j - 1] is smaller
+                if (j > 0 && !comp(b[j - 1], a[i]))
+                    low = i + 1;
+                else
+                    high = i;
+            }
+            return low;
+        }
+// --------------------------------------------------------------------------------
+
+        template <typename T>
+        void move_blocks(thread_pool& pool, T* from, T* to, cslt::size_t num) {
+            const cslt::size_t blocks = block_count(num, fixed_block);
+            for_blocks(pool, blocks, [=](cslt::size_t b) {
+                const cslt::size_t begin = b * fixed_block;
+                std::move(from + begin, from + std::min(num, begin + fixed_block), to + begin);
+            });
+        }
+    } /* end of detail namespace */
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Sorts range by comp with a parallel merge sort
+     *
+     * The range is cut into a power of two runs, at least two per worker,
+     * which are sorted with std::sort in parallel.  Pairs of runs are then
+     * merged into a buffer of the same size, and every merge is itself split
+     * into pieces of equal output by a binary search, so each round keeps all
+     * the workers busy down to the last one.  The merges are stable, but the
+     * runs are not, so equal elements may be reordered as by std::sort.  T
+     * must be default constructible and move assignable.
+     */
+    template <typename Range, typename Compare = std::less<>>
+    void sort(Range&& range, Compare comp = Compare(), const policy& p = policy()) {
+        using T = detail::element_t<Range>;
+        const cslt::size_t num = range.size();
+        T* data = range.data();
+        thread_pool& pool = detail::pool_of(p);
+        const cslt::size_t min_run = p.grain > 0 ? p.grain : detail::serial_sort_limit;
+        if (num <= min_run || pool.size() == 1) {
+            std::sort(data, data + num, comp);
+            return;
+        }
+        cslt::size_t runs = 2;
+        while (runs < 2 * pool.size() && num / (runs * 2) >= min_run)
+            runs *= 2;
+        const cslt::size_t width = (num + runs - 1) / runs;
+        detail::for_blocks(pool, runs, [&](cslt::size_t r) {
+            const cslt::size_t begin = std::min(num, r * width);
+            std::sort(data + begin, data + std::min(num, begin + width), comp);
+        });
+
+        array_ptr<T> buffer(num);
+        T* from = data;
+        T* to = buffer.data();
+        const cslt::size_t pieces_total = 4 * pool.size();
+        array_ptr<cslt::size_t> splits;
+        for (cslt::size_t run = width; run < num; run *= 2) {
+            const cslt::size_t pairs = (num + 2 * run - 1) / (2 * run);
+            const cslt::size_t pieces = pieces_total > pairs ? pieces_total / pairs : 1;
+            const cslt::size_t bounds = pieces + 1;
+            splits.realloc(pairs * bounds);
+            // Every split is found before any element moves, since a search
+            // must not compare elements another piece has already moved from
+            detail::for_blocks(pool, pairs * bounds, [&](cslt::size_t index) {
+                const cslt::size_t lo = (index / bounds) * 2 * run;
+                const cslt::size_t mid = std::min(num, lo + run);
+                const cslt::size_t hi = std::min(num, lo + 2 * run);
+                const cslt::size_t k = (hi - lo) * (index % bounds) / pieces;
+                splits[index] = detail::co_rank(k, from + lo, mid - lo, from + mid, hi - mid, comp);
+            });
+            detail::for_blocks(pool, pairs * pieces, [&](cslt::size_t index) {
+                const cslt::size_t pair = index / pieces;
+                const cslt::size_t piece = index % pieces;
+                const cslt::size_t lo = pair * 2 * run;
+                const cslt::size_t mid = std::min(num, lo + run);
+                const cslt::size_t hi = std::min(num, lo + 2 * run);
+                const cslt::size_t k0 = (hi - lo) * piece / pieces;
+                const cslt::size_t k1 = (hi - lo) * (piece + 1) / pieces;
+                const cslt::size_t i0 = splits[pair * bounds + piece];
+                const cslt::size_t i1 = splits[pair * bounds + piece + 1];
+                std::merge(std::make_move_iterator(from + lo + i0), std::make_move_iterator(from + lo + i1),
+                           std::make_move_iterator(from + mid + (k0 - i0)),
+                           std::make_move_iterator(from + mid + (k1 - i1)), to + lo + k0, comp);
+            });
+            std::swap(from, to);
+        }
+        if (from != data)
+            detail::move_blocks(pool, from, data, num);
+    }
+// ================================================================================
+// ================================================================================
+// LSD RADIX SORT
+
+    namespace detail {
+        template <typename K>
+        using radix_bits_t = std::conditional_t<(sizeof(K) > 4), std::uint64_t, std::uint32_t>;
+
+        // Maps a key to unsigned bits that sort in the same order
+        template <typename K, typename Signed>
+        radix_bits_t<K> radix_bits(K key, std::true_type /* floating */, Signed) noexcept {
+            using U = radix_bits_t<K>;
+            static_assert(sizeof(K) == sizeof(U), "radix_sort supports float and double keys");
+            U bits;
+            std::memcpy(&bits, &key, sizeof(bits));
+            const U sign = U(1) << (sizeof(U) * 8 - 1);
+            return (bits & sign) ? ~bits : (bits | sign);
+        }
+
+        template <typename K>
+        radix_bits_t<K> radix_bits(K key, std::false_type, std::true_type /* signed */) noexcept {
+            using U = radix_bits_t<K>;
+            const U sign = U(1) << (sizeof(K) * 8 - 1);
+            return (static_cast<U>(key) & (sign | (sign - 1))) ^ sign;
+        }
+
+        template <typename K>
+        radix_bits_t<K> radix_bits(K key, std::false_type, std::false_type) noexcept {
+            return static_cast<radix_bits_t<K>>(key);
+        }
+
+        template <typename K>
+        radix_bits_t<K> radix_key(K key) noexcept {
+            return radix_bits(key, std::is_floating_point<K>(), std::is_signed<K>());
+        }
+// --------------------------------------------------------------------------------
+
+        struct identity_key {
+            template <typename T>
+            T operator()(const T& value) const noexcept {return value;}
+        };
+    } /* end of detail namespace */
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Sorts range stably by key(element), an integer or floating point value
+     *
+     * Each pass orders the elements by eight bits of the key, from the lowest
+     * to the highest.  A pass counts the digits of every block in parallel,
+     * turns the counts into an output position for each digit of each block,
+     * and then moves the blocks in parallel; a pass whose digit is the same
+     * for every element is skipped.  Floating point keys order negative zero
+     * before zero and NaNs by their bits.  T must be default constructible
+     * and move assignable.
+     */
+    template <typename Range, typename Key>
+    void radix_sort_by_key(Range&& range, Key key, const policy& p = policy()) {
+        using T = detail::element_t<Range>;
+        using K = std::decay_t<decltype(key(*range.data()))>;
+        static_assert(std::is_arithmetic<K>::value, "radix_sort keys are integers or floating point values");
+        const cslt::size_t num = range.size();
+        if (num < 2)
+            return;
+        T* data = range.data();
+        thread_pool& pool = detail::pool_of(p);
+        const cslt::size_t min_block = p.grain > 0 ? p.grain : detail::fixed_block;
+        cslt::size_t blocks = std::min(4 * pool.size(), detail::block_count(num, min_block));
+        if (blocks == 0)
+            blocks = 1;
+        const cslt::size_t width = (num + blocks - 1) / blocks;
+        blocks = detail::block_count(num, width);
+
+        array_ptr<T> buffer(num);
+        array_ptr<cslt::size_t> counts(blocks * 256);
+        T* from = data;
+        T* to = buffer.data();
+        for (unsigned shift = 0; shift < sizeof(K) * 8; shift += 8) {
+            detail::for_blocks(pool, blocks, [&](cslt::size_t b) {
+                cslt::size_t* count = counts.data() + b * 256;
+                std::fill(count, count + 256, 0);
+                const cslt::size_t end = std::min(num, (b + 1) * width);
+                for (cslt::size_t i = b * width; i < end; ++i)
+                    ++count[(detail::radix_key(key(from[i])) >> shift) & 0xff];
+            });
+            // Turn the counts into starting positions, digit by digit and block by block
+            cslt::size_t position = 0;
+            bool uniform = false;
+            for (unsigned digit = 0; digit < 256; ++digit) {
+                cslt::size_t total = 0;
+                for (cslt::size_t b = 0; b < blocks; ++b) {
+                    cslt::size_t& count = counts.data()[b * 256 + digit];
+                    const cslt::size_t here = count;
+                    count = position;
+                    position += here;
+                    total += here;
+                }
+                if (total == num)
+                    uniform = true;
+            }
+            if (uniform)
+                continue;
+            detail::for_blocks(pool, blocks, [&](cslt::size_t b) {
+                cslt::size_t* next = counts.data() + b * 256;
+                const cslt::size_t end = std::min(num, (b + 1) * width);
+                for (cslt::size_t i = b * width; i < end; ++i)
+                    to[next[(detail::radix_key(key(from[i])) >> shift) & 0xff]++] = cslt::move(from[i]);
+            });
+            std::swap(from, to);
+        }
+        if (from != data)
+            detail::move_blocks(pool, from, data, num);
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Sorts a range of integers or floating point values with radix_sort_by_key
+     */
+    template <typename Range>
+    void radix_sort(Range&& range, const policy& p = policy()) {
+        radix_sort_by_key(range, detail::identity_key(), p);
+    }
+} /* end of par namespace */
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_parallel_algorithm_HPP */
+// ================================================================================
+// ================================================================================
+// eof
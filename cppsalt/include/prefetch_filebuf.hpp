@@ -0,0 +1,138 @@
+// ================================================================================
+// ================================================================================
+// - File:    prefetch_filebuf.hpp
+// - Purpose: A file stream buffer that reads ahead on a background thread
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_prefetch_filebuf_HPP
+#define cslt_prefetch_filebuf_HPP
+
+#include "dtype.hpp"
+#include "memory.hpp"
+#include "span.hpp"
+#include <condition_variable>
+#include <mutex>
+#include <streambuf>
+#include <thread>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    /**
+     * @brief A read-only file stream buffer that keeps the next blocks loading
+     *
+     * A std::filebuf reads the next block only when the reader has used up
+     * the last one, so a parser stops for every disk read.  A
+     * prefetch_filebuf starts a thread that reads the file into a ring of
+     * depth blocks while the caller works on the block it holds; the caller
+     * only waits when it gets ahead of the disk.
+     *
+     * The blocks can be taken directly with next_block(), which copies
+     * nothing, or read through the std::streambuf interface by an
+     * std::istream or a line_reader.  Seeking is not supported.
+     *
+     * A failure to open the file throws cslt::system_error.  A read error
+     * on the background thread is raised, also as cslt::system_error, when
+     * the caller reaches the block it would have filled.
+     */
+    class prefetch_filebuf : public std::streambuf {
+    private:
+        struct block {
+            array_ptr<char> data;
+            cslt::size_t size = 0;
+        };
+
+        array_ptr<block> ring;
+        cslt::size_t block_bytes = 0;
+        int fd = -1;
+
+        std::thread worker;
+        std::mutex lock;
+        std::condition_variable filled;  // Signalled when a block is ready or the worker ends
+        std::condition_variable freed;   // Signalled when the caller gives a block back
+        cslt::size_t head = 0;           // The block the caller holds or takes next
+        cslt::size_t ready = 0;          // Blocks read and not yet taken
+        bool held = false;               // Whether the caller holds ring[head]
+        bool finished = false;           // The worker reached the end of the file or an error
+        bool stopping = false;           // close() asked the worker to stop
+        int failure = 0;                 // The errno that ended the worker, if any
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief The loop of the background thread
+         */
+        void read_ahead() noexcept;
+// ================================================================================
+
+    public:
+        static constexpr cslt::size_t default_block_size = 1 << 20;
+        static constexpr cslt::size_t default_depth = 4;
+// --------------------------------------------------------------------------------
+
+        prefetch_filebuf() noexcept = default;
+
+        /**
+         * @brief Opens path and starts reading it ahead
+         *
+         * @param path       The file to read
+         * @param block_size The size of each read
+         * @param depth      The number of blocks, including the one the caller
+         *                   holds; at least 2 so one is always loading
+         */
+        explicit prefetch_filebuf(const char* path, cslt::size_t block_size = default_block_size,
+                                  cslt::size_t depth = default_depth);
+// --------------------------------------------------------------------------------
+
+        prefetch_filebuf(const prefetch_filebuf&) = delete;
+        prefetch_filebuf& operator=(const prefetch_filebuf&) = delete;
+// --------------------------------------------------------------------------------
+
+        ~prefetch_filebuf() override;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Opens path, closing any file already open
+         */
+        void open(const char* path, cslt::size_t block_size = default_block_size,
+                  cslt::size_t depth = default_depth);
+
+        /**
+         * @brief Stops the background thread and closes the file
+         */
+        void close() noexcept;
+
+        bool is_open() const noexcept {return fd >= 0;}
+        cslt::size_t block_size() const noexcept {return block_bytes;}
+        cslt::size_t depth() const noexcept {return ring.size();}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns the next block of the file, or an empty span at its end
+         *
+         * The block stays valid until the next call to next_block() or
+         * underflow(), which gives it back to the reader.  Characters the
+         * stream interface has not consumed yet are returned first.
+         */
+        span<const char> next_block();
+// --------------------------------------------------------------------------------
+
+    protected:
+        int_type underflow() override;
+        std::streamsize showmanyc() override;
+    };
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_prefetch_filebuf_HPP */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,180 @@
+// ================================================================================
+// ================================================================================
+// - File:    probe.hpp
+// - Purpose: Named probe points and scoped timers for the profiling in profile.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_probe_HPP
+#define cslt_probe_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+// ================================================================================
+// ================================================================================
+// COMPILE TIME SWITCHES
+//
+// Define CSLT_PROFILE to 1, or configure with -DCSLT_PROFILE=ON, to time the
+// probes placed in the library and in code that uses CSLT_PROFILE_SCOPE.  When
+// it is 0 the macro expands to nothing, scoped_timer does nothing and every
+// snapshot is empty.  Every translation unit in a program must use the same
+// setting.
+//
+// On x86 with GCC or Clang the timers read the time stamp counter through a
+// builtin, so no intrinsics header is included, and a read costs a few
+// nanoseconds; define CSLT_PROFILE_TSC to 0 to use steady_clock instead.
+
+#ifndef CSLT_PROFILE
+    #define CSLT_PROFILE 0
+#endif
+
+#ifndef CSLT_PROFILE_TSC
+    #if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+        #define CSLT_PROFILE_TSC 1
+    #else
+        #define CSLT_PROFILE_TSC 0
+    #endif
+#endif
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+namespace profile {
+
+    constexpr bool enabled = CSLT_PROFILE != 0;
+
+    /**
+     * @brief The index of a named probe point
+     */
+    using probe_id = std::uint32_t;
+
+    /**
+     * @brief The most probes a program can name; later names are ignored
+     */
+    constexpr std::size_t max_probes = 64;
+
+    /**
+     * @brief The id of a probe that could not be registered; recording it does nothing
+     */
+    constexpr probe_id no_probe = static_cast<probe_id>(max_probes);
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Returns the id of the probe called name, registering it if it is new
+     *
+     * Every call with an equal name returns the same id, so a probe placed in
+     * a template is shared by all its instantiations.  The name is kept by
+     * pointer and must outlive the program, as a string literal does.
+     *
+     * @returns no_probe once max_probes names are registered
+     */
+    probe_id register_probe(const char* name) noexcept;
+
+    /**
+     * @brief Returns the name of a probe, or "unknown" if id is not registered
+     */
+    const char* probe_name(probe_id id) noexcept;
+
+    /**
+     * @brief Returns the number of registered probes
+     */
+    std::size_t probe_count() noexcept;
+
+    /**
+     * @brief A probe registered on construction, meant to be a function local static
+     */
+    struct probe_point {
+        const probe_id id;
+
+        explicit probe_point(const char* name) noexcept : id(register_probe(name)) {}
+    };
+// ================================================================================
+// ================================================================================
+// TIMING
+
+    /**
+     * @brief Returns the current time in ticks of the profiling clock
+     *
+     * A tick is a cycle of the time stamp counter when CSLT_PROFILE_TSC is 1
+     * and a steady_clock period otherwise; ns_per_tick converts.
+     */
+    inline std::uint64_t ticks() noexcept {
+#if CSLT_PROFILE_TSC
+        return static_cast<std::uint64_t>(__builtin_ia32_rdtsc());
+#else
+        return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    /**
+     * @brief Returns the length of a tick in nanoseconds
+     *
+     * The time stamp counter is measured against steady_clock from the first
+     * registered probe to this call.  A call made within a millisecond of
+     * that waits for the millisecond to pass.
+     */
+    double ns_per_tick() noexcept;
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Adds a duration in ticks to the calling thread's histogram for id
+     *
+     * Each thread writes only its own histograms, so recording never takes a
+     * lock or a locked instruction.  The first sample of a probe on a thread
+     * allocates that thread's histogram; if the allocation fails the sample
+     * is dropped.
+     */
+    void record(probe_id id, std::uint64_t duration) noexcept;
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Records the time from construction to destruction under one probe
+     */
+    class scoped_timer {
+#if CSLT_PROFILE
+        probe_id _id;
+        std::uint64_t _start;
+
+    public:
+        explicit scoped_timer(probe_id id) noexcept : _id(id), _start(ticks()) {}
+        ~scoped_timer() {record(_id, ticks() - _start);}
+#else
+    public:
+        explicit scoped_timer(probe_id) noexcept {}
+#endif
+        scoped_timer(const scoped_timer&) = delete;
+        scoped_timer& operator=(const scoped_timer&) = delete;
+    };
+
+} /* end of profile namespace */
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+
+#if CSLT_PROFILE
+    #define CSLT_PROFILE_JOIN_(a, b) a##b
+    #define CSLT_PROFILE_JOIN(a, b) CSLT_PROFILE_JOIN_(a, b)
+
+    // Times the rest of the enclosing scope under the probe called name.  The
+    // probe is registered once, by a function local static.
+    #define CSLT_PROFILE_SCOPE(name) \
+        static const ::cslt::profile::probe_point CSLT_PROFILE_JOIN(cslt_probe_, __LINE__)(name); \
+        const ::cslt::profile::scoped_timer CSLT_PROFILE_JOIN(cslt_timer_, __LINE__)( \
+            CSLT_PROFILE_JOIN(cslt_probe_, __LINE__).id)
+#else
+    #define CSLT_PROFILE_SCOPE(name) ((void)0)
+#endif
+// ================================================================================
+// ================================================================================
+#endif /* cslt_probe_HPP */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,156 @@
+// ================================================================================
+// ================================================================================
+// - File:    profile.hpp
+// - Purpose: Optional latency histograms, scoped timers and named probe points
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_profile_HPP
+#define cslt_profile_HPP
+
+#include "probe.hpp"
+#include "memory.hpp"
+#include <cstddef>
+#include <cstdint>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    class fast_ostream;
+
+namespace profile {
+// ================================================================================
+// ================================================================================
+// HISTOGRAMS
+
+    namespace detail {
+        struct histogram_access;
+    }
+
+    /**
+     * @brief Counts of durations in log-linear buckets
+     *
+     * Values below 32 have a bucket each.  Above that every power of two is
+     * split into 16 buckets, so the value a bucket reports is at most 1/16
+     * above any value counted in it, and never below.  The buckets cover
+     * the whole uint64_t range in about 8 KiB.
+     */
+    class histogram {
+    public:
+        static constexpr std::size_t bucket_count = 976;
+
+        /**
+         * @brief Returns the bucket that counts value
+         */
+        static std::size_t bucket_of(std::uint64_t value) noexcept;
+
+        /**
+         * @brief Returns the largest value counted in a bucket
+         */
+        static std::uint64_t bucket_limit(std::size_t index) noexcept;
+// --------------------------------------------------------------------------------
+
+        void record(std::uint64_t value, std::uint64_t num = 1) noexcept;
+        histogram& operator+=(const histogram& other) noexcept;
+
+        std::uint64_t count() const noexcept {return _count;}
+        std::uint64_t sum() const noexcept {return _sum;}
+        std::uint64_t min() const noexcept {return _count ? _min : 0;}
+        std::uint64_t max() const noexcept {return _max;}
+        double mean() const noexcept {return _count ? static_cast<double>(_sum) / static_cast<double>(_count) : 0.0;}
+        std::uint64_t bucket(std::size_t index) const noexcept {return _counts[index];}
+
+        /**
+         * @brief Returns the value at or below which pct percent of the counts lie
+         *
+         * The result is the limit of the bucket holding that rank, capped at
+         * max(), so p50 of a single value is the value itself when it is
+         * below 32 and within 1/16 of it above.  An empty histogram gives 0.
+         */
+        std::uint64_t percentile(double pct) const noexcept;
+
+    private:
+        friend struct detail::histogram_access;
+
+        std::uint64_t _counts[bucket_count] = {};
+        std::uint64_t _count = 0;
+        std::uint64_t _sum = 0;
+        std::uint64_t _min = UINT64_MAX;
+        std::uint64_t _max = 0;
+    };
+// ================================================================================
+// ================================================================================
+// SNAPSHOTS AND REPORTS
+
+    /**
+     * @brief The histograms of every registered probe at one moment, in ticks
+     */
+    class snapshot {
+    public:
+        snapshot() noexcept = default;
+        snapshot(std::size_t num, double ns_per_tick);
+
+        /**
+         * @brief The number of probes, which is probe_count() when the snapshot was taken
+         */
+        std::size_t size() const noexcept {return _size;}
+        const histogram& operator[](probe_id id) const noexcept {return _probes.data()[id];}
+        histogram& operator[](probe_id id) noexcept {return _probes.data()[id];}
+        const char* name(probe_id id) const noexcept {return probe_name(id);}
+
+        /**
+         * @brief The tick length used to print this snapshot in nanoseconds
+         */
+        double ns_per_tick() const noexcept {return _ns_per_tick;}
+
+    private:
+        cslt::array_ptr<histogram> _probes;
+        std::size_t _size = 0;
+        double _ns_per_tick = 1.0;
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Returns the histograms recorded by the calling thread
+     */
+    snapshot thread_snapshot();
+
+    /**
+     * @brief Returns the histograms of every thread, including threads that have exited
+     *
+     * The histograms of running threads are read while they may still be
+     * changing, so a sample recorded during the call may be counted in its
+     * bucket but not yet in the total.
+     */
+    snapshot global_snapshot();
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Writes one line per probe with samples: count, mean, p50, p99, p999 and max in ns
+     */
+    void write_text(fast_ostream& out, const snapshot& snap);
+
+    /**
+     * @brief Writes the same figures as one JSON object followed by a newline
+     *
+     * The object is {"unit":"ns","probes":[...]} with one entry per probe that
+     * has samples, holding name, count, min, mean, p50, p90, p99, p999 and max.
+     */
+    void write_json(fast_ostream& out, const snapshot& snap);
+
+} /* end of profile namespace */
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_profile_HPP */
+// ================================================================================
+// ================================================================================
+// eof
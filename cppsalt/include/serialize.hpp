@@ -0,0 +1,716 @@
+// ================================================================================
+// ================================================================================
+// - File:    serialize.hpp
+// - Purpose: A little-endian binary layout for library containers, with
+//            readers that copy the data out or view it in place
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_serialize_HPP
+#define cslt_serialize_HPP
+
+#include "config.hpp"
+#include "dtype.hpp"
+#include "except.hpp"
+#include "memory.hpp"
+#include "span.hpp"
+#include "string.hpp"
+#include "string_view.hpp"
+#include "util.hpp"
+#include "vec.hpp"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+// ================================================================================
+// ================================================================================
+// LAYOUT
+//
+// A buffer starts with a 16 byte header: the characters "CSLT", the layout
+// version, the schema version chosen by the writer, and four reserved zero
+// bytes, each field a little-endian uint32.  The value follows the header.
+//
+// - A scalar is stored little-endian at an offset that is a multiple of its
+//   size, up to 8.  A bool is one byte holding 0 or 1.
+// - A String is a uint64 length followed by its characters.
+// - A vector or array_ptr of bitwise serializable elements is a uint64 count,
+//   padding to the element alignment, and the elements as one block.
+// - Any other vector or array_ptr is a uint64 count, a table of count + 1
+//   uint64 offsets from the start of the buffer, one to the start of each
+//   element and the last to the end of the array, and then the elements.
+// - A pair is its first member followed by its second.
+//
+// Offsets and padding are measured from the start of the buffer, so a buffer
+// aligned to 8 bytes, as mapped_file and serialize always provide, can be
+// viewed in place without copying any array.
+
+namespace cslt {
+
+    /**
+     * @brief The version of the layout above, stored in every header
+     */
+    constexpr std::uint32_t serial_layout_version = 1;
+
+    /**
+     * @brief The size of the header in front of every serialized value
+     */
+    constexpr cslt::size_t serial_header_size = 16;
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief True for types written as their bytes, and viewed as a span when in an array
+     *
+     * Arithmetic types other than bool and enumerations qualify, and are
+     * byte swapped on big-endian hosts.  A trivially copyable struct may opt
+     * in by specializing this trait.  It is then written exactly as it lies
+     * in memory, padding included, so its members should have fixed widths
+     * and the data is only portable between hosts with the same byte order.
+     *
+     * @tparam T The type to query
+     */
+    template <typename T>
+    struct is_bitwise_serializable
+        : std::integral_constant<bool, (std::is_arithmetic<T>::value || std::is_enum<T>::value) &&
+                                       !std::is_same<std::remove_cv_t<T>, bool>::value> {};
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Writes, reads and views a T in the layout above
+     *
+     * Each specialization provides a view_type and three static functions:
+     * write(serial_writer&, const T&), read(serial_reader&) returning a T,
+     * and view(serial_reader&) returning a view_type that refers to the
+     * buffer.  read and view leave the reader just past the value.  A user
+     * type is made serializable by specializing this template in the cslt
+     * namespace, usually by writing and reading its members in turn.
+     *
+     * @tparam T The type to serialize
+     */
+    template <typename T, typename Enable = void>
+    struct serial_traits;
+
+    /**
+     * @brief The type deserialize_view returns for a T
+     */
+    template <typename T>
+    using serial_view_t = typename serial_traits<T>::view_type;
+// ================================================================================
+// ================================================================================
+
+    namespace detail {
+        // Scalars are aligned to their size so the layout is the same on every
+        // ABI, while user structs keep their own alignment
+        template <typename T>
+        constexpr cslt::size_t serial_alignment() noexcept {
+            return (std::is_arithmetic<T>::value || std::is_enum<T>::value)
+                ? (sizeof(T) < 8 ? sizeof(T) : 8) : alignof(T);
+        }
+
+        template <typename T>
+        using serial_swaps = std::integral_constant<bool, !CSLT_LITTLE_ENDIAN && (sizeof(T) > 1) &&
+                                                          (std::is_arithmetic<T>::value ||
+                                                           std::is_enum<T>::value)>;
+
+        // Converts num values between the host byte order and little-endian
+        template <typename T>
+        void serial_fix_order(T* values, cslt::size_t num) noexcept {
+            if (!serial_swaps<T>::value)
+                return;
+            unsigned char* bytes = reinterpret_cast<unsigned char*>(values);
+            for (cslt::size_t i = 0; i < num; ++i, bytes += sizeof(T)) {
+                for (cslt::size_t lo = 0, hi = sizeof(T) - 1; lo < hi; ++lo, --hi) {
+                    const unsigned char tmp = bytes[lo];
+                    bytes[lo] = bytes[hi];
+                    bytes[hi] = tmp;
+                }
+            }
+        }
+
+        template <typename T>
+        T serial_load(const char* src) noexcept {
+            T value;
+            std::memcpy(&value, src, sizeof(T));
+            serial_fix_order(&value, 1);
+            return value;
+        }
+    }
+// ================================================================================
+// ================================================================================
+// SERIAL_WRITER
+
+    /**
+     * @brief Builds a serialized buffer, starting with the header
+     *
+     * The bytes collect in a cslt::vector<char>, so arrays of bitwise
+     * serializable elements are appended with one memcpy.  The buffer can be
+     * written to a file as it is, or taken with release().
+     */
+    class serial_writer {
+    private:
+        cslt::vector<char> _buf;
+// ================================================================================
+
+    public:
+        /**
+         * @brief Writes the header, recording schema_version for the reader to check
+         */
+        explicit serial_writer(std::uint32_t schema_version = 0);
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Writes value through serial_traits<T>
+         */
+        template <typename T>
+        void write(const T& value) {
+            serial_traits<T>::write(*this, value);
+        }
+
+        /**
+         * @brief Writes num bitwise serializable values as one aligned block
+         */
+        template <typename T>
+        void write_array(const T* values, cslt::size_t num) {
+            static_assert(std::is_trivially_copyable<T>::value, "only trivially copyable values are written as bytes");
+            align(detail::serial_alignment<T>());
+            const cslt::size_t pos = _buf.size();
+            write_bytes(values, num * sizeof(T));
+            if (detail::serial_swaps<T>::value)
+                detail::serial_fix_order(reinterpret_cast<T*>(_buf.data() + pos), num);
+        }
+
+        template <typename T>
+        void write_scalar(T value) {
+            write_array(&value, 1);
+        }
+// --------------------------------------------------------------------------------
+
+        void write_bytes(const void* src, cslt::size_t num) {
+            _buf.append(static_cast<const char*>(src), num);
+        }
+
+        void write_zeros(cslt::size_t num);
+
+        /**
+         * @brief Pads with zero bytes to a multiple of alignment, a power of two up to 64
+         */
+        void align(cslt::size_t alignment);
+
+        /**
+         * @brief Overwrites the uint64 written earlier at offset
+         */
+        void patch_u64(cslt::size_t offset, std::uint64_t value) noexcept {
+            detail::serial_fix_order(&value, 1);
+            std::memcpy(_buf.data() + offset, &value, sizeof(value));
+        }
+// --------------------------------------------------------------------------------
+
+        const char* data() const noexcept {return _buf.data();}
+        cslt::size_t size() const noexcept {return _buf.size();}
+
+        /**
+         * @brief Hands over the buffer, leaving the writer empty and without a header
+         */
+        cslt::vector<char> release() noexcept {return cslt::move(_buf);}
+    };
+// ================================================================================
+// ================================================================================
+// SERIAL_READER
+
+    /**
+     * @brief Reads a serialized buffer in place
+     *
+     * The constructor checks the header, and every read is checked against
+     * the end of the buffer, so truncated or corrupted input throws
+     * cslt::format_error rather than reading out of bounds.  The buffer must
+     * be aligned to 8 bytes and outlive the reader and every view taken from
+     * it.  A reader is a cursor over the buffer and is cheap to copy.
+     */
+    class serial_reader {
+    private:
+        const char* _data = nullptr;
+        cslt::size_t _size = 0;
+        cslt::size_t _pos = 0;
+        std::uint32_t _schema = 0;
+// --------------------------------------------------------------------------------
+
+        [[noreturn]] static void truncated();
+// ================================================================================
+
+    public:
+        serial_reader() noexcept = default;
+
+        /**
+         * @brief Checks the header of bytes and positions the reader after it
+         *
+         * Throws cslt::format_error if bytes is misaligned, shorter than a
+         * header, lacks the "CSLT" tag or uses another layout version.
+         */
+        explicit serial_reader(span<const char> bytes);
+// --------------------------------------------------------------------------------
+
+        std::uint32_t schema_version() const noexcept {return _schema;}
+
+        /**
+         * @brief Throws cslt::format_error unless the writer used schema_version
+         */
+        void expect_schema(std::uint32_t schema_version) const;
+
+        /**
+         * @brief Throws cslt::format_error unless every byte has been read
+         */
+        void expect_end() const;
+// --------------------------------------------------------------------------------
+
+        const char* data() const noexcept {return _data;}
+        cslt::size_t size() const noexcept {return _size;}
+        cslt::size_t position() const noexcept {return _pos;}
+        cslt::size_t remaining() const noexcept {return _size - _pos;}
+
+        /**
+         * @brief Moves to offset from the start of the buffer, which may be its end
+         */
+        void seek(cslt::size_t offset);
+
+        /**
+         * @brief Returns a copy of this reader positioned at offset
+         */
+        serial_reader at(cslt::size_t offset) const {
+            serial_reader other(*this);
+            other.seek(offset);
+            return other;
+        }
+
+        /**
+         * @brief Skips the padding to a multiple of alignment
+         */
+        void align(cslt::size_t alignment);
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns a pointer to the next num bytes and moves past them
+         */
+        const char* take(cslt::size_t num) {
+            if (num > _size - _pos)
+                truncated();
+            const char* bytes = _data + _pos;
+            _pos += num;
+            return bytes;
+        }
+
+        /**
+         * @brief Returns the next aligned block of num values, still in little-endian order
+         */
+        template <typename T>
+        const T* take_array(cslt::size_t num) {
+            align(detail::serial_alignment<T>());
+            if (num > remaining() / sizeof(T))
+                truncated();
+            const char* bytes = take(num * sizeof(T));
+            if (reinterpret_cast<std::uintptr_t>(bytes) % alignof(T) != 0)
+                throw cslt::format_error(CSLT_LITERAL("serialized array is misaligned"));
+            return reinterpret_cast<const T*>(bytes);
+        }
+
+        template <typename T>
+        T read_scalar() {
+            align(detail::serial_alignment<T>());
+            return detail::serial_load<T>(take(sizeof(T)));
+        }
+
+        /**
+         * @brief Reads a uint64 count of elements that each take at least min_bytes
+         *
+         * Throws cslt::format_error if that many elements cannot fit in the
+         * rest of the buffer, which bounds any allocation made for them.
+         */
+        cslt::size_t read_count(cslt::size_t min_bytes) {
+            const std::uint64_t num = read_scalar<std::uint64_t>();
+            if (num > remaining() / min_bytes)
+                truncated();
+            return static_cast<cslt::size_t>(num);
+        }
+// --------------------------------------------------------------------------------
+
+        template <typename T>
+        T read() {
+            return serial_traits<T>::read(*this);
+        }
+
+        template <typename T>
+        serial_view_t<T> view() {
+            return serial_traits<T>::view(*this);
+        }
+    };
+// ================================================================================
+// ================================================================================
+// SERIAL_ARRAY_VIEW
+
+    /**
+     * @brief A read-only view of a serialized array whose elements are not bitwise
+     *
+     * Element i is found through the offset table in constant time and
+     * returned as a serial_view_t<T>, so a vector<String> is viewed as a
+     * sequence of string_views without parsing the elements it skips.
+     *
+     * @tparam T The serialized element type
+     */
+    template <typename T>
+    class serial_array_view {
+    private:
+        serial_reader _in;
+        const char* _table = nullptr;
+        cslt::size_t _len = 0;
+// --------------------------------------------------------------------------------
+
+        serial_view_t<T> element(cslt::size_t index) const {
+            serial_reader in = _in.at(static_cast<cslt::size_t>(detail::serial_load<std::uint64_t>(_table + 8 * index)));
+            return serial_traits<T>::view(in);
+        }
+// ================================================================================
+
+    public:
+        using value_type = serial_view_t<T>;
+        using size_type = cslt::size_t;
+
+        class iterator {
+        private:
+            const serial_array_view* _view = nullptr;
+            cslt::size_t _index = 0;
+
+        public:
+            iterator() noexcept = default;
+            iterator(const serial_array_view* view, cslt::size_t index) noexcept : _view(view), _index(index) {}
+
+            value_type operator*() const {return _view->element(_index);}
+            iterator& operator++() noexcept {++_index; return *this;}
+            iterator operator++(int) noexcept {iterator old(*this); ++_index; return old;}
+            bool operator==(const iterator& other) const noexcept {return _index == other._index;}
+            bool operator!=(const iterator& other) const noexcept {return _index != other._index;}
+        };
+// --------------------------------------------------------------------------------
+
+        serial_array_view() noexcept = default;
+
+        /**
+         * @brief Views num elements listed in table, an offset table inside the buffer of in
+         */
+        serial_array_view(const serial_reader& in, const char* table, cslt::size_t num) noexcept
+            : _in(in), _table(table), _len(num) {}
+// --------------------------------------------------------------------------------
+
+        cslt::size_t size() const noexcept {return _len;}
+        bool empty() const noexcept {return _len == 0;}
+
+        value_type operator[](cslt::size_t index) const {
+            CSLT_CHECK_INDEX(index, _len);
+            return element(index);
+        }
+
+        value_type at(cslt::size_t index) const {
+            if (index >= _len)
+                throw cslt::out_of_range(CSLT_LITERAL("serial_array_view index out of range"));
+            return element(index);
+        }
+
+        iterator begin() const noexcept {return iterator(this, 0);}
+        iterator end() const noexcept {return iterator(this, _len);}
+    };
+// ================================================================================
+// ================================================================================
+// TRAITS FOR SCALARS AND STRINGS
+
+    template <typename T>
+    struct serial_traits<T, std::enable_if_t<is_bitwise_serializable<T>::value>> {
+        using view_type = T;
+
+        static void write(serial_writer& out, const T& value) {
+            out.write_array(&value, 1);
+        }
+
+        static T read(serial_reader& in) {
+            return in.read_scalar<T>();
+        }
+
+        static T view(serial_reader& in) {
+            return in.read_scalar<T>();
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    template <>
+    struct serial_traits<bool> {
+        using view_type = bool;
+
+        static void write(serial_writer& out, bool value) {
+            out.write_scalar<std::uint8_t>(value ? 1 : 0);
+        }
+
+        static bool read(serial_reader& in) {
+            const std::uint8_t value = in.read_scalar<std::uint8_t>();
+            if (value > 1)
+                throw cslt::format_error(CSLT_LITERAL("serialized bool is neither 0 nor 1"));
+            return value == 1;
+        }
+
+        static bool view(serial_reader& in) {
+            return read(in);
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    template <>
+    struct serial_traits<String> {
+        using view_type = string_view;
+
+        static void write(serial_writer& out, const String& value) {
+            out.write_scalar<std::uint64_t>(value.size());
+            out.write_bytes(value.c_string(), value.size());
+        }
+
+        static String read(serial_reader& in) {
+            const string_view text = view(in);
+            return String(text.data(), text.size());
+        }
+
+        static string_view view(serial_reader& in) {
+            const cslt::size_t len = in.read_count(1);
+            return string_view(in.take(len), len);
+        }
+    };
+// ================================================================================
+// ================================================================================
+// TRAITS FOR ARRAYS
+
+    namespace detail {
+        // The shared layout of vector and array_ptr, one block or an offset table
+        template <typename T, bool = is_bitwise_serializable<T>::value>
+        struct serial_array;
+
+        template <typename T>
+        struct serial_array<T, true> {
+            using view_type = span<const T>;
+
+            static void write(serial_writer& out, const T* values, cslt::size_t num) {
+                out.write_scalar<std::uint64_t>(num);
+                out.write_array(values, num);
+            }
+
+            template <typename Alloc>
+            static void read(serial_reader& in, vector<T, Alloc>& out) {
+                const view_type block = raw(in);
+                out.append(block.data(), block.size());
+                serial_fix_order(out.data(), out.size());
+            }
+
+            template <typename Alloc>
+            static void read(serial_reader& in, array_ptr<T, Alloc>& out) {
+                const view_type block = raw(in);
+                out = array_ptr<T, Alloc>(block.size());
+                if (!block.empty())
+                    std::memcpy(static_cast<void*>(out.data()), block.data(), block.size_bytes());
+                serial_fix_order(out.data(), out.size());
+            }
+
+            static view_type view(serial_reader& in) {
+                static_assert(!serial_swaps<T>::value, "arrays of multi-byte scalars are only viewed in place on little-endian hosts");
+                return raw(in);
+            }
+
+            static view_type raw(serial_reader& in) {
+                const cslt::size_t num = in.read_count(sizeof(T));
+                return view_type(in.take_array<T>(num), num);
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <typename T>
+        struct serial_array<T, false> {
+            using view_type = serial_array_view<T>;
+
+            static void write(serial_writer& out, const T* values, cslt::size_t num) {
+                out.write_scalar<std::uint64_t>(num);
+                out.align(8);
+                const cslt::size_t table = out.size();
+                out.write_zeros((num + 1) * 8);
+                for (cslt::size_t i = 0; i < num; ++i) {
+                    out.patch_u64(table + 8 * i, out.size());
+                    serial_traits<T>::write(out, values[i]);
+                }
+                out.patch_u64(table + 8 * num, out.size());
+            }
+
+            template <typename Alloc>
+            static void read(serial_reader& in, vector<T, Alloc>& out) {
+                cslt::size_t num = 0;
+                const char* table = offsets(in, num);
+                out.reserve(num);
+                for (cslt::size_t i = 0; i < num; ++i) {
+                    check_offset(in, table, i);
+                    out.push_back(serial_traits<T>::read(in));
+                }
+                check_offset(in, table, num);
+            }
+
+            template <typename Alloc>
+            static void read(serial_reader& in, array_ptr<T, Alloc>& out) {
+                cslt::size_t num = 0;
+                const char* table = offsets(in, num);
+                out = array_ptr<T, Alloc>(num);
+                for (cslt::size_t i = 0; i < num; ++i) {
+                    check_offset(in, table, i);
+                    out[i] = serial_traits<T>::read(in);
+                }
+                check_offset(in, table, num);
+            }
+
+            static view_type view(serial_reader& in) {
+                cslt::size_t num = 0;
+                const char* table = offsets(in, num);
+                const view_type result(in, table, num);
+                in.seek(static_cast<cslt::size_t>(serial_load<std::uint64_t>(table + 8 * num)));
+                return result;
+            }
+
+            static const char* offsets(serial_reader& in, cslt::size_t& num) {
+                num = in.read_count(8);
+                in.align(8);
+                return in.take((num + 1) * 8);
+            }
+
+            // A copying read walks the elements in order, so each must begin where the table says
+            static void check_offset(const serial_reader& in, const char* table, cslt::size_t index) {
+                if (serial_load<std::uint64_t>(table + 8 * index) != in.position())
+                    throw cslt::format_error(
+                        CSLT_LITERAL("serialized offset table does not match its elements"));
+            }
+        };
+    }
+// --------------------------------------------------------------------------------
+
+    template <typename T, typename Alloc>
+    struct serial_traits<vector<T, Alloc>> {
+        using view_type = typename detail::serial_array<T>::view_type;
+
+        static void write(serial_writer& out, const vector<T, Alloc>& value) {
+            detail::serial_array<T>::write(out, value.data(), value.size());
+        }
+
+        static vector<T, Alloc> read(serial_reader& in) {
+            vector<T, Alloc> value;
+            detail::serial_array<T>::read(in, value);
+            return value;
+        }
+
+        static view_type view(serial_reader& in) {
+            return detail::serial_array<T>::view(in);
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    // Shares the vector layout, so either container reads what the other wrote
+    template <typename T, typename Alloc>
+    struct serial_traits<array_ptr<T, Alloc>> {
+        using view_type = typename detail::serial_array<T>::view_type;
+
+        static void write(serial_writer& out, const array_ptr<T, Alloc>& value) {
+            detail::serial_array<T>::write(out, value.data(), value.size());
+        }
+
+        static array_ptr<T, Alloc> read(serial_reader& in) {
+            array_ptr<T, Alloc> value;
+            detail::serial_array<T>::read(in, value);
+            return value;
+        }
+
+        static view_type view(serial_reader& in) {
+            return detail::serial_array<T>::view(in);
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    template <typename A, typename B>
+    struct serial_traits<pair<A, B>> {
+        using view_type = pair<serial_view_t<A>, serial_view_t<B>>;
+
+        static void write(serial_writer& out, const pair<A, B>& value) {
+            serial_traits<A>::write(out, value.first);
+            serial_traits<B>::write(out, value.second);
+        }
+
+        static pair<A, B> read(serial_reader& in) {
+            A first = serial_traits<A>::read(in);
+            B second = serial_traits<B>::read(in);
+            return pair<A, B>(cslt::move(first), cslt::move(second));
+        }
+
+        static view_type view(serial_reader& in) {
+            serial_view_t<A> first = serial_traits<A>::view(in);
+            serial_view_t<B> second = serial_traits<B>::view(in);
+            return view_type(cslt::move(first), cslt::move(second));
+        }
+    };
+// ================================================================================
+// ================================================================================
+// FREE FUNCTIONS
+
+    /**
+     * @brief Returns value in the serialized layout, header included
+     *
+     * @param value The value to write
+     * @param schema_version A version of the caller's own format, checked on reading
+     */
+    template <typename T>
+    cslt::vector<char> serialize(const T& value, std::uint32_t schema_version = 0) {
+        serial_writer out(schema_version);
+        out.write(value);
+        return out.release();
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Copies a T out of bytes, which may be a vector<char> or a mapped_file
+     *
+     * Throws cslt::format_error if the header is invalid, the schema version
+     * differs from schema_version, the data is truncated or inconsistent, or
+     * bytes are left over after the value.
+     */
+    template <typename T>
+    T deserialize(span<const char> bytes, std::uint32_t schema_version = 0) {
+        serial_reader in(bytes);
+        in.expect_schema(schema_version);
+        T value = in.read<T>();
+        in.expect_end();
+        return value;
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Views a serialized T in place, without copying or allocating
+     *
+     * Scalars are returned by value, a String as a string_view, an array of
+     * bitwise serializable elements as a span and any other array as a
+     * serial_array_view.  The views point into bytes, which must outlive
+     * them.  The same checks as deserialize are made on the header and on
+     * every part of the value that is reached.
+     */
+    template <typename T>
+    serial_view_t<T> deserialize_view(span<const char> bytes, std::uint32_t schema_version = 0) {
+        serial_reader in(bytes);
+        in.expect_schema(schema_version);
+        serial_view_t<T> value = in.view<T>();
+        in.expect_end();
+        return value;
+    }
+}
+// ================================================================================
+// ================================================================================
+#endif /* cslt_serialize_HPP */
+// ================================================================================
+// ================================================================================
+// eof
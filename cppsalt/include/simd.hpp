@@ -0,0 +1,197 @@
+// ================================================================================
+// ================================================================================
+// - File:    simd.hpp
+// - Purpose: Vectorized reductions and elementwise kernels over numeric buffers
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_simd_HPP
+#define cslt_simd_HPP
+
+#include "dtype.hpp"
+#include "span.hpp"
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+namespace simd {
+
+    /**
+     * @brief The instruction sets a kernel table can be built for
+     *
+     * On x86 the best table the processor supports is chosen at the first
+     * call, so a binary built for plain x86-64 still uses AVX2 or AVX-512
+     * where it is present.  The AVX2 table also needs FMA.  NEON is chosen at
+     * compile time on 64 bit ARM.  The scalar table is always available, and
+     * is the only one when CSLT_NO_SIMD is defined.
+     */
+    enum class kernel : unsigned {
+        scalar,
+        sse2,
+        avx2,
+        avx512,
+        neon
+    };
+
+    /**
+     * @brief Returns the name of a kernel, such as "avx2"
+     */
+    const char* kernel_name(kernel k) noexcept;
+
+    /**
+     * @brief Returns true if this build and processor can run kernel k
+     */
+    bool kernel_supported(kernel k) noexcept;
+
+    /**
+     * @brief Returns the kernel the functions below currently use
+     */
+    kernel active_kernel() noexcept;
+
+    /**
+     * @brief Makes every later call use kernel k
+     *
+     * This exists so tests and benchmarks can compare the kernels; a program
+     * has no reason to call it.
+     *
+     * @returns false, leaving the active kernel unchanged, if k is not supported
+     */
+    bool select_kernel(kernel k) noexcept;
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief The comparison count_if applies between each element and a value
+     *
+     * The floating point comparisons follow the operators, so a NaN element
+     * counts only for not_equal.
+     */
+    enum class compare : unsigned {
+        equal,
+        not_equal,
+        less,
+        less_equal,
+        greater,
+        greater_equal
+    };
+// ================================================================================
+// ================================================================================
+// REDUCTIONS
+//
+// Every function takes spans, so an array_ptr, aligned_array_ptr, vector or
+// plain array of float, double or int converts at the call.  The reductions
+// keep several partial results per vector lane, so a floating point sum or
+// dot product may differ in rounding from a loop that adds the elements in
+// order, and from one kernel to another.  Sums and products of int wrap
+// around as unsigned arithmetic does rather than overflowing.
+
+    /**
+     * @brief Returns the sum of the elements, or zero for an empty span
+     */
+    float sum(span<const float> x) noexcept;
+    double sum(span<const double> x) noexcept;
+    int sum(span<const int> x) noexcept;
+
+    /**
+     * @brief Returns the sum of the products of the elements of x and y
+     *
+     * @throws invalid_argument if x and y differ in size
+     */
+    float dot(span<const float> x, span<const float> y);
+    double dot(span<const double> x, span<const double> y);
+    int dot(span<const int> x, span<const int> y);
+
+    /**
+     * @brief Returns the smallest element
+     *
+     * The result is unspecified if a floating point span holds a NaN.
+     *
+     * @throws invalid_argument if x is empty
+     */
+    float min(span<const float> x);
+    double min(span<const double> x);
+    int min(span<const int> x);
+
+    /**
+     * @brief Returns the largest element
+     *
+     * The result is unspecified if a floating point span holds a NaN.
+     *
+     * @throws invalid_argument if x is empty
+     */
+    float max(span<const float> x);
+    double max(span<const double> x);
+    int max(span<const int> x);
+
+    /**
+     * @brief Returns the number of elements e for which e op value holds
+     */
+    cslt::size_t count_if(span<const float> x, compare op, float value) noexcept;
+    cslt::size_t count_if(span<const double> x, compare op, double value) noexcept;
+    cslt::size_t count_if(span<const int> x, compare op, int value) noexcept;
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE KERNELS
+//
+// The output of add, sub and mul may be one of the inputs, but must not
+// otherwise overlap them.
+
+    /**
+     * @brief Sets y[i] to a * x[i] + y[i]
+     *
+     * The AVX2, AVX-512 and NEON kernels use a fused multiply-add, which
+     * rounds once instead of twice.
+     *
+     * @throws invalid_argument if x and y differ in size
+     */
+    void axpy(float a, span<const float> x, span<float> y);
+    void axpy(double a, span<const double> x, span<double> y);
+    void axpy(int a, span<const int> x, span<int> y);
+
+    /**
+     * @brief Sets every element of y to value
+     */
+    void fill(span<float> y, float value) noexcept;
+    void fill(span<double> y, double value) noexcept;
+    void fill(span<int> y, int value) noexcept;
+
+    /**
+     * @brief Sets out[i] to x[i] + y[i]
+     *
+     * @throws invalid_argument if x, y and out differ in size
+     */
+    void add(span<const float> x, span<const float> y, span<float> out);
+    void add(span<const double> x, span<const double> y, span<double> out);
+    void add(span<const int> x, span<const int> y, span<int> out);
+
+    /**
+     * @brief Sets out[i] to x[i] - y[i]
+     *
+     * @throws invalid_argument if x, y and out differ in size
+     */
+    void sub(span<const float> x, span<const float> y, span<float> out);
+    void sub(span<const double> x, span<const double> y, span<double> out);
+    void sub(span<const int> x, span<const int> y, span<int> out);
+
+    /**
+     * @brief Sets out[i] to x[i] * y[i]
+     *
+     * @throws invalid_argument if x, y and out differ in size
+     */
+    void mul(span<const float> x, span<const float> y, span<float> out);
+    void mul(span<const double> x, span<const double> y, span<double> out);
+    void mul(span<const int> x, span<const int> y, span<int> out);
+} /* end of simd namespace */
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_simd_HPP */
+// ================================================================================
+// ================================================================================
+// eof
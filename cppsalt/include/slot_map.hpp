@@ -0,0 +1,543 @@
+// ================================================================================
+// ================================================================================
+// - File:    slot_map.hpp
+// - Purpose: Densely packed object storage addressed by generational handles
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_slot_map_HPP
+#define cslt_slot_map_HPP
+
+#include "dtype.hpp"
+#include "except.hpp"
+#include "hash.hpp"
+#include "instrument.hpp"
+#include "memory.hpp"
+#include "memory_resource.hpp"
+#include "util.hpp"
+#include "vec.hpp"
+#include <cstdint>
+#include <iterator>
+#include <limits>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    /**
+     * @brief A handle to an element of a slot_map
+     *
+     * A handle names a slot and the generation the slot had when the element
+     * was inserted.  Erasing the element bumps the generation, so an old
+     * handle is detected as stale even after the slot is reused.  A default
+     * constructed handle is never valid.
+     */
+    struct slot_handle {
+        std::uint32_t index = std::numeric_limits<std::uint32_t>::max();
+        std::uint32_t generation = 0;
+
+        friend bool operator==(slot_handle lhs, slot_handle rhs) noexcept {
+            return lhs.index == rhs.index && lhs.generation == rhs.generation;
+        }
+
+        friend bool operator!=(slot_handle lhs, slot_handle rhs) noexcept {
+            return !(lhs == rhs);
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    template <>
+    struct hash<slot_handle> {
+        cslt::size_t operator()(slot_handle h) const noexcept {
+            return hash_bytes(&h, sizeof(h));
+        }
+    };
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief A pool of objects held densely and reached through generational handles
+     *
+     * The elements are packed at the front of a list of fixed size chunks, so
+     * iteration walks contiguous memory with no holes.  Each handle goes
+     * through a table of slots that records where its element sits and the
+     * generation of the slot.  Lookup is two array reads, and a handle to an
+     * erased element fails the generation check instead of reaching a
+     * different object.
+     *
+     * Insertion constructs at the end of the dense storage and erase moves
+     * the last element into the hole, so both are O(1).  Growth adds a chunk
+     * and never moves an element.  A pointer to an element stays valid until
+     * that element is erased, or until it is the last in the dense order and
+     * any element is erased.  Iteration order is the dense order and changes
+     * on erase.
+     *
+     * Slots are reused through a free list.  A slot whose generation would
+     * wrap is retired instead, so a stale handle can never become valid again.
+     *
+     * @tparam T The data type stored in the map
+     * @tparam Alloc The allocator for the chunks and the index tables
+     * @tparam ChunkSize The number of elements in a chunk, a power of two
+     */
+    template <typename T, typename Alloc = cslt::allocator<T>, cslt::size_t ChunkSize = 256>
+    class slot_map {
+        static_assert(ChunkSize != 0 && (ChunkSize & (ChunkSize - 1)) == 0,
+                      "ChunkSize must be a power of two");
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using size_type = cslt::size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using handle = slot_handle;
+
+        static constexpr cslt::size_t chunk_size = ChunkSize;
+// ================================================================================
+// PRIVATE VARIABLE DEFINITIONS
+    private:
+        using alloc_traits = std::allocator_traits<Alloc>;
+
+        // For a live slot index is the dense position.  For a free slot it is
+        // the next free slot; the generation is odd exactly when the slot is live.
+        struct slot {
+            std::uint32_t index;
+            std::uint32_t generation;
+        };
+
+        template <typename U>
+        using rebind = typename alloc_traits::template rebind_alloc<U>;
+
+        static constexpr std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+        cslt::vector<T*, rebind<T*>> _chunks;
+        cslt::vector<slot, rebind<slot>> _slots;
+        cslt::vector<std::uint32_t, rebind<std::uint32_t>> _dense_slot;
+        cslt::size_t _len = 0;
+        std::uint32_t _free = npos;
+        Alloc _allocator;
+// ================================================================================
+// PRIVATE FUNCTION DEFINITIONS
+
+        T* _element(cslt::size_t pos) noexcept {
+            return _chunks[pos / ChunkSize] + pos % ChunkSize;
+        }
+
+        const T* _element(cslt::size_t pos) const noexcept {
+            return _chunks[pos / ChunkSize] + pos % ChunkSize;
+        }
+
+        bool _live(handle h) const noexcept {
+            return h.index < _slots.size() && (h.generation & 1u) != 0 &&
+                   _slots[h.index].generation == h.generation;
+        }
+// --------------------------------------------------------------------------------
+// Add chunks until count elements fit.  Existing chunks never move.
+
+        void _grow_chunks(cslt::size_t count) {
+            while (_chunks.size() * ChunkSize < count) {
+                T* chunk = alloc_traits::allocate(_allocator, ChunkSize);
+                try {
+                    _chunks.push_back(chunk);
+                } catch (...) {
+                    alloc_traits::deallocate(_allocator, chunk, ChunkSize);
+                    throw;
+                }
+                CSLT_RECORD_ALLOC(slot_map, ChunkSize * sizeof(T));
+            }
+        }
+
+        void _release_chunks() noexcept {
+            for (cslt::size_t i = 0; i < _chunks.size(); ++i) {
+                alloc_traits::deallocate(_allocator, _chunks[i], ChunkSize);
+                CSLT_RECORD_FREE(slot_map, ChunkSize * sizeof(T));
+            }
+            _chunks.clear();
+        }
+// --------------------------------------------------------------------------------
+// Destroy every element, leaving the slot tables untouched
+
+        void _destroy_elements() noexcept {
+            for (cslt::size_t i = 0; i < _len; ++i)
+                alloc_traits::destroy(_allocator, _element(i));
+            _len = 0;
+        }
+// --------------------------------------------------------------------------------
+// Mark a live slot free.  A slot whose generation wraps to zero is retired.
+
+        void _free_slot(std::uint32_t index) noexcept {
+            slot& s = _slots[index];
+            ++s.generation;
+            if (s.generation == 0)
+                return;
+            s.index = _free;
+            _free = index;
+        }
+// --------------------------------------------------------------------------------
+// Copy or move the elements of other, and its slot tables, into this map so
+// every handle of other is valid here.  The map must be empty.
+
+        template <typename Source, typename Elements>
+        void _adopt_elements(Source& other, Elements&& construct) {
+            _grow_chunks(other._len);
+            _slots.clear();
+            _slots.append(other._slots.data(), other._slots.size());
+            _dense_slot.clear();
+            _dense_slot.append(other._dense_slot.data(), other._dense_slot.size());
+            _free = other._free;
+            try {
+                for (; _len < other._len; ++_len)
+                    construct(_element(_len), other._element(_len));
+            } catch (...) {
+                _destroy_elements();
+                _slots.clear();
+                _dense_slot.clear();
+                _free = npos;
+                throw;
+            }
+        }
+
+        void _copy_from(const slot_map& other) {
+            _adopt_elements(other, [this](T* dest, const T* src) {
+                alloc_traits::construct(_allocator, dest, *src);
+            });
+        }
+
+        void _move_from(slot_map& other) {
+            _adopt_elements(other, [this](T* dest, T* src) {
+                alloc_traits::construct(_allocator, dest, cslt::move(*src));
+            });
+            other.clear();
+        }
+// --------------------------------------------------------------------------------
+
+        void _steal(slot_map& other) noexcept {
+            _chunks = cslt::move(other._chunks);
+            _slots = cslt::move(other._slots);
+            _dense_slot = cslt::move(other._dense_slot);
+            _len = other._len;
+            _free = other._free;
+            other._len = 0;
+            other._free = npos;
+        }
+
+        void _move_assign(slot_map& other, std::true_type) noexcept {
+            _free_all();
+            _allocator = cslt::move(other._allocator);
+            _steal(other);
+        }
+
+        void _move_assign(slot_map& other, std::false_type) {
+            if (_allocator == other._allocator) {
+                _free_all();
+                _steal(other);
+                return;
+            }
+            _destroy_elements();
+            _move_from(other);
+        }
+
+        void _free_all() noexcept {
+            _destroy_elements();
+            _release_chunks();
+            _slots.clear();
+            _dense_slot.clear();
+            _free = npos;
+        }
+// ================================================================================
+// ITERATORS
+    public:
+        template <bool Const>
+        class basic_iterator {
+        private:
+            using map_type = typename std::conditional<Const, const slot_map, slot_map>::type;
+
+            map_type* _map = nullptr;
+            cslt::size_t _pos = 0;
+
+            friend class slot_map;
+            basic_iterator(map_type* map, cslt::size_t pos) noexcept : _map(map), _pos(pos) {}
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = typename std::conditional<Const, const T*, T*>::type;
+            using reference = typename std::conditional<Const, const T&, T&>::type;
+
+            basic_iterator() noexcept = default;
+            template <bool C = Const, typename = typename std::enable_if<C>::type>
+            basic_iterator(const basic_iterator<false>& other) noexcept
+                : _map(other._map), _pos(other._pos) {}
+
+            reference operator*() const noexcept {return *_map->_element(_pos);}
+            pointer operator->() const noexcept {return _map->_element(_pos);}
+
+            /**
+             * @brief The handle of the element the iterator points at
+             */
+            handle get_handle() const noexcept {return _map->handle_at(_pos);}
+
+            basic_iterator& operator++() noexcept {++_pos; return *this;}
+            basic_iterator operator++(int) noexcept {basic_iterator tmp = *this; ++_pos; return tmp;}
+
+            friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+                return lhs._pos == rhs._pos;
+            }
+
+            friend bool operator!=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+                return lhs._pos != rhs._pos;
+            }
+
+            friend class basic_iterator<!Const>;
+        };
+
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+// ================================================================================
+// PUBLIC FUNCTION DEFINITIONS
+
+        slot_map() noexcept(noexcept(Alloc())) : _allocator() {}
+
+        explicit slot_map(const Alloc& alloc)
+            : _chunks(rebind<T*>(alloc)), _slots(rebind<slot>(alloc)),
+              _dense_slot(rebind<std::uint32_t>(alloc)), _allocator(alloc) {}
+// --------------------------------------------------------------------------------
+// Copies keep the slot tables, so every handle of other is valid in the copy
+
+        slot_map(const slot_map& other)
+            : slot_map(alloc_traits::select_on_container_copy_construction(other._allocator)) {
+            _copy_from(other);
+        }
+
+        slot_map(slot_map&& other) noexcept
+            : _chunks(cslt::move(other._chunks)), _slots(cslt::move(other._slots)),
+              _dense_slot(cslt::move(other._dense_slot)), _len(other._len),
+              _free(other._free), _allocator(cslt::move(other._allocator)) {
+            other._len = 0;
+            other._free = npos;
+        }
+
+        slot_map& operator=(const slot_map& other) {
+            if (this != &other) {
+                _destroy_elements();
+                _copy_from(other);
+            }
+            return *this;
+        }
+
+        slot_map& operator=(slot_map&& other)
+            noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                     alloc_traits::is_always_equal::value) {
+            if (this != &other)
+                _move_assign(other, typename alloc_traits::propagate_on_container_move_assignment());
+            return *this;
+        }
+
+        ~slot_map() {
+            _destroy_elements();
+            _release_chunks();
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Constructs an element from args and returns its handle
+         *
+         * No existing element moves.  A new chunk is allocated when the
+         * current ones are full.
+         *
+         * @throws length_error if the map already holds the most slots a handle can name
+         */
+        template <typename... Args>
+        handle emplace(Args&&... args) {
+            if (_free == npos) {
+                if (_slots.size() >= npos)
+                    throw cslt::length_error(CSLT_LITERAL("slot_map exceeds the handle index range"));
+                _slots.push_back(slot{npos, 0});
+                _free = static_cast<std::uint32_t>(_slots.size() - 1);
+            }
+            _grow_chunks(_len + 1);
+            alloc_traits::construct(_allocator, _element(_len), cslt::forward<Args>(args)...);
+            try {
+                _dense_slot.push_back(_free);
+            } catch (...) {
+                alloc_traits::destroy(_allocator, _element(_len));
+                throw;
+            }
+
+            // Nothing below throws, so the slot leaves the free list only once
+            // its element exists
+            const std::uint32_t index = _free;
+            slot& s = _slots[index];
+            _free = s.index;
+            s.index = static_cast<std::uint32_t>(_len);
+            ++s.generation;
+            ++_len;
+            return handle{index, s.generation};
+        }
+
+        handle insert(const T& value) {return emplace(value);}
+        handle insert(T&& value) {return emplace(cslt::move(value));}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Erases the element of h, returning false if h is stale
+         *
+         * The last element in dense order is moved into the hole, so its
+         * address changes and any pointer to it is invalidated.  Its handle
+         * stays valid.
+         */
+        bool erase(handle h) {
+            if (!_live(h))
+                return false;
+            const cslt::size_t pos = _slots[h.index].index;
+            const cslt::size_t last = _len - 1;
+            if (pos != last) {
+                *_element(pos) = cslt::move(*_element(last));
+                const std::uint32_t moved = _dense_slot[last];
+                _dense_slot[pos] = moved;
+                _slots[moved].index = static_cast<std::uint32_t>(pos);
+            }
+            alloc_traits::destroy(_allocator, _element(last));
+            _dense_slot.pop_back();
+            --_len;
+            _free_slot(h.index);
+            return true;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Destroys every element and invalidates every handle
+         *
+         * The chunks are kept for reuse.
+         */
+        void clear() noexcept {
+            _destroy_elements();
+            for (cslt::size_t i = 0; i < _dense_slot.size(); ++i)
+                _free_slot(_dense_slot[i]);
+            _dense_slot.clear();
+        }
+
+        /**
+         * @brief Allocates chunks and table space so count elements fit without allocating
+         */
+        void reserve(cslt::size_t count) {
+            _grow_chunks(count);
+            _slots.reserve(count);
+            _dense_slot.reserve(count);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns the element of h, or nullptr if h is stale or was never valid
+         */
+        T* get(handle h) noexcept {
+            return _live(h) ? _element(_slots[h.index].index) : nullptr;
+        }
+
+        const T* get(handle h) const noexcept {
+            return _live(h) ? _element(_slots[h.index].index) : nullptr;
+        }
+
+        /**
+         * @brief Returns the element of h
+         *
+         * @throws out_of_range if h is stale or was never valid
+         */
+        T& at(handle h) {
+            if (!_live(h))
+                throw cslt::out_of_range(CSLT_LITERAL("Stale or invalid slot_map handle"));
+            return *_element(_slots[h.index].index);
+        }
+
+        const T& at(handle h) const {
+            if (!_live(h))
+                throw cslt::out_of_range(CSLT_LITERAL("Stale or invalid slot_map handle"));
+            return *_element(_slots[h.index].index);
+        }
+
+        bool contains(handle h) const noexcept {return _live(h);}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief The handle of the element at dense position pos, which must be below size()
+         */
+        handle handle_at(cslt::size_t pos) const noexcept {
+            const std::uint32_t index = _dense_slot[pos];
+            return handle{index, _slots[index].generation};
+        }
+
+        /**
+         * @brief Calls func on every element, one chunk at a time
+         *
+         * This is the fastest way to visit the elements, since the inner
+         * loop runs over a plain array.
+         */
+        template <typename Func>
+        void for_each(Func func) {
+            cslt::size_t left = _len;
+            for (cslt::size_t c = 0; left != 0; ++c) {
+                T* chunk = _chunks[c];
+                const cslt::size_t num = left < ChunkSize ? left : ChunkSize;
+                for (cslt::size_t i = 0; i < num; ++i)
+                    func(chunk[i]);
+                left -= num;
+            }
+        }
+
+        template <typename Func>
+        void for_each(Func func) const {
+            cslt::size_t left = _len;
+            for (cslt::size_t c = 0; left != 0; ++c) {
+                const T* chunk = _chunks[c];
+                const cslt::size_t num = left < ChunkSize ? left : ChunkSize;
+                for (cslt::size_t i = 0; i < num; ++i)
+                    func(chunk[i]);
+                left -= num;
+            }
+        }
+// --------------------------------------------------------------------------------
+
+        iterator begin() noexcept {return iterator(this, 0);}
+        iterator end() noexcept {return iterator(this, _len);}
+        const_iterator begin() const noexcept {return const_iterator(this, 0);}
+        const_iterator end() const noexcept {return const_iterator(this, _len);}
+        const_iterator cbegin() const noexcept {return begin();}
+        const_iterator cend() const noexcept {return end();}
+// --------------------------------------------------------------------------------
+
+        cslt::size_t size() const noexcept {return _len;}
+        bool empty() const noexcept {return _len == 0;}
+
+        /**
+         * @brief The number of elements the allocated chunks hold
+         */
+        cslt::size_t capacity() const noexcept {return _chunks.size() * ChunkSize;}
+
+        Alloc get_allocator() const {return _allocator;}
+    };
+// ================================================================================
+// ================================================================================
+
+    namespace pmr {
+        /**
+         * @brief A slot_map whose chunks and tables come from a memory_resource
+         *
+         * With a pool_resource upstream the fixed size chunks are recycled
+         * through the pool instead of the global heap.
+         */
+        template <typename T, cslt::size_t ChunkSize = 256>
+        using slot_map = cslt::slot_map<T, cslt::polymorphic_allocator<T>, ChunkSize>;
+    }
+}
+// ================================================================================
+// ================================================================================
+#endif /* cslt_slot_map_HPP */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,695 @@
+// ================================================================================
+// ================================================================================
+// - File:    small_vector.hpp
+// - Purpose: Vectors that keep their first elements inside the object itself
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_small_vector_HPP
+#define cslt_small_vector_HPP
+
+#include "config.hpp"
+#include "dtype.hpp"
+#include "except.hpp"
+#include "instrument.hpp"
+#include "memory.hpp"
+#include "memory_resource.hpp"
+#include "util.hpp"
+#include "vec.hpp"
+#include <initializer_list>
+#include <type_traits>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    /**
+     * @brief A vector that holds up to N elements inline before it spills to the heap
+     *
+     * The first N elements live in a buffer inside the object, so a
+     * small_vector that never outgrows N never allocates.  Past N it grows
+     * like vector, doubling a heap block from the allocator and relocating
+     * the elements into it through the same helpers.  shrink_to_fit moves
+     * the elements back inline once they fit again.
+     *
+     * @tparam T The data type stored in the vector
+     * @tparam N The number of elements stored inline
+     * @tparam Alloc The allocator that provides the heap storage
+     */
+    template <typename T, cslt::size_t N, typename Alloc = cslt::allocator<T>>
+    class small_vector {
+        static_assert(N > 0, "small_vector needs room for at least one inline element");
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using size_type = cslt::size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+// ================================================================================
+// PRIVATE VARIABLE DEFINITIONS
+    private:
+        using alloc_traits = std::allocator_traits<Alloc>;
+
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type _inline[N];
+        T *_data = _inline_data();
+        cslt::size_t _len = 0;
+        cslt::size_t _alloc = N;
+        Alloc _allocator;
+// ================================================================================
+// PRIVATE FUNCTION DEFINITIONS
+
+        T* _inline_data() noexcept {return reinterpret_cast<T*>(_inline);}
+        const T* _inline_data() const noexcept {return reinterpret_cast<const T*>(_inline);}
+// --------------------------------------------------------------------------------
+// Obtain and return heap storage through the allocator, counting each block
+// when instrumentation is enabled
+
+        T* _allocate(cslt::size_t buff) {
+            T* block = alloc_traits::allocate(_allocator, buff);
+            CSLT_RECORD_ALLOC(small_vector, buff * sizeof(T));
+            return block;
+        }
+
+        void _deallocate(T* block, cslt::size_t buff) noexcept {
+            alloc_traits::deallocate(_allocator, block, buff);
+            CSLT_RECORD_FREE(small_vector, buff * sizeof(T));
+        }
+// --------------------------------------------------------------------------------
+// Free the heap block, if any, and point back at the empty inline buffer
+
+        void _release() noexcept {
+            if (!is_inline())
+                _deallocate(_data, _alloc);
+            _data = _inline_data();
+            _alloc = N;
+        }
+// --------------------------------------------------------------------------------
+// Make new_data of buff indices the buffer once the elements are in it
+
+        void _adopt(T* new_data, cslt::size_t buff) noexcept {
+            const bool was_heap = !is_inline();
+            _release();
+            if (was_heap)
+                CSLT_RECORD_REALLOC(small_vector);
+            _data = new_data;
+            _alloc = buff;
+        }
+// --------------------------------------------------------------------------------
+// Move the live elements into a block of buff indices, which is the inline
+// buffer when buff fits in it
+
+        void _reallocate(cslt::size_t buff) {
+            if (buff <= N) {
+                if (is_inline())
+                    return;
+                cslt::uninitialized_relocate_n(_allocator, _data, _len, _inline_data());
+                _deallocate(_data, _alloc);
+                _data = _inline_data();
+                _alloc = N;
+                return;
+            }
+            T* new_data = _allocate(buff);
+            try {
+                cslt::uninitialized_relocate_n(_allocator, _data, _len, new_data);
+            } catch (...) {
+                _deallocate(new_data, buff);
+                throw;
+            }
+            _adopt(new_data, buff);
+        }
+// --------------------------------------------------------------------------------
+// Grow onto the heap and construct a new element at index in a single pass
+
+        template <typename... Args>
+        void _realloc_insert(cslt::size_t index, Args&&... args) {
+            const cslt::size_t buff = grow_capacity(_alloc, _len + 1, alloc_traits::max_size(_allocator));
+            T* new_data = _allocate(buff);
+            try {
+                cslt::uninitialized_relocate_insert_n(_allocator, _data, _len, index, new_data,
+                                                      cslt::forward<Args>(args)...);
+            } catch (...) {
+                _deallocate(new_data, buff);
+                throw;
+            }
+            _adopt(new_data, buff);
+            _len++;
+        }
+// --------------------------------------------------------------------------------
+// Take the elements of other, stealing its heap block when it has one.  Other
+// is left empty and inline.
+
+        void _take(small_vector& other) {
+            if (other.is_inline()) {
+                cslt::uninitialized_relocate_n(_allocator, other._data, other._len, _data);
+            }
+            else {
+                _data = other._data;
+                _alloc = other._alloc;
+                other._data = other._inline_data();
+                other._alloc = N;
+            }
+            _len = other._len;
+            other._len = 0;
+        }
+
+// --------------------------------------------------------------------------------
+// Copy and move assignment, dispatched on whether the allocator propagates
+
+        // The allocator propagates, so storage from an unequal allocator is
+        // released through the old one before the new one is taken
+        void _copy_assign(const small_vector& other, std::true_type) {
+            if (!(_allocator == other._allocator))
+                _free();
+            _allocator = other._allocator;
+            _copy_assign(other, std::false_type());
+        }
+
+        // Reuses the existing buffer when it is large enough
+        void _copy_assign(const small_vector& other, std::false_type) {
+            if (other._len > _alloc) {
+                T* new_data = _allocate(other._len);
+                try {
+                    cslt::uninitialized_copy_n(_allocator, other._data, other._len, new_data);
+                } catch (...) {
+                    _deallocate(new_data, other._len);
+                    throw;
+                }
+                clear();
+                _adopt(new_data, other._len);
+            }
+            else {
+                clear();
+                cslt::uninitialized_copy_n(_allocator, other._data, other._len, _data);
+            }
+            _len = other._len;
+        }
+
+        void _move_assign(small_vector& other, std::true_type) {
+            _free();
+            _allocator = cslt::move(other._allocator);
+            _take(other);
+        }
+
+        // The allocator does not propagate, so the heap block can only be
+        // stolen when both allocators can free each other's memory
+        void _move_assign(small_vector& other, std::false_type) {
+            if (_allocator == other._allocator) {
+                _free();
+                _take(other);
+                return;
+            }
+            clear();
+            reserve(other._len);
+            cslt::uninitialized_move_if_noexcept_n(_allocator, other._data, other._len, _data);
+            _len = other._len;
+            other.clear();
+        }
+// --------------------------------------------------------------------------------
+// Release every element and the heap block
+
+        void _free() noexcept {
+            cslt::destroy_n(_allocator, _data, _len);
+            _len = 0;
+            _release();
+        }
+// ================================================================================
+// PUBLIC FUNCTION DEFINITIONS
+    public:
+// --------------------------------------------------------------------------------
+// Instantiate an empty vector that uses only the inline buffer
+
+        small_vector() noexcept(noexcept(Alloc())) : _allocator() {}
+
+        explicit small_vector(const Alloc& alloc) noexcept : _allocator(alloc) {}
+// --------------------------------------------------------------------------------
+// Instantiate with room for buff elements, on the heap only when buff exceeds N
+
+        explicit small_vector(cslt::size_t buff, const Alloc& alloc = Alloc()) : _allocator(alloc) {
+            reserve(buff);
+        }
+// --------------------------------------------------------------------------------
+// Constructor for initializer list
+
+        small_vector(std::initializer_list<T> ilist, const Alloc& alloc = Alloc()) : _allocator(alloc) {
+            reserve(ilist.size());
+            try {
+                cslt::uninitialized_copy_n(_allocator, ilist.begin(), ilist.size(), _data);
+            } catch (...) {
+                _release();
+                throw;
+            }
+            _len = ilist.size();
+        }
+// --------------------------------------------------------------------------------
+// Copy constructor, a copy that does not fit inline is allocated to the exact size
+
+        small_vector(const small_vector& other)
+            : _allocator(alloc_traits::select_on_container_copy_construction(other._allocator)) {
+            reserve(other._len);
+            try {
+                cslt::uninitialized_copy_n(_allocator, other._data, other._len, _data);
+            } catch (...) {
+                _release();
+                throw;
+            }
+            _len = other._len;
+        }
+// --------------------------------------------------------------------------------
+// Move constructor, steals a heap block and relocates inline elements
+
+        small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+            : _allocator(cslt::move(other._allocator)) {
+            _take(other);
+        }
+// --------------------------------------------------------------------------------
+// Copy assignment operator, reuses the existing buffer when it is large enough
+
+        small_vector& operator=(const small_vector& other) {
+            if (this != &other)
+                _copy_assign(other, typename alloc_traits::propagate_on_container_copy_assignment());
+            return *this;
+        }
+// --------------------------------------------------------------------------------
+// Move assignment operator
+
+        small_vector& operator=(small_vector&& other)
+            noexcept(std::is_nothrow_move_constructible<T>::value &&
+                     (alloc_traits::propagate_on_container_move_assignment::value ||
+                      alloc_traits::is_always_equal::value)) {
+            if (this != &other)
+                _move_assign(other, typename alloc_traits::propagate_on_container_move_assignment());
+            return *this;
+        }
+// --------------------------------------------------------------------------------
+// Construct a new element in place at the end of the vector
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args) {
+            if (_len >= _alloc)
+                _realloc_insert(_len, cslt::forward<Args>(args)...);
+            else {
+                alloc_traits::construct(_allocator, _data + _len, cslt::forward<Args>(args)...);
+                _len++;
+            }
+            return _data[_len - 1];
+        }
+// --------------------------------------------------------------------------------
+// push data to the end of the vector
+
+        void push_back(const T& value) {
+            emplace_back(value);
+        }
+
+        void push_back(T&& value) {
+            emplace_back(cslt::move(value));
+        }
+// --------------------------------------------------------------------------------
+// push_back for data pushed to a specifc index
+
+        void push_back(const T& value, cslt::size_t index) {
+            if (index > _len)
+                throw cslt::out_of_range(CSLT_LITERAL("Index is out of bounds"));
+            if (_len >= _alloc) {
+                _realloc_insert(index, value);
+                return;
+            }
+            // Copy first, value may refer to an element that is about to shift
+            T temp(value);
+            cslt::shift_insert(_allocator, _data, _len, index, cslt::move(temp));
+            _len++;
+        }
+
+        void push_back(T&& value, cslt::size_t index) {
+            if (index > _len)
+                throw cslt::out_of_range(CSLT_LITERAL("Index is out of bounds"));
+            if (_len >= _alloc) {
+                _realloc_insert(index, cslt::move(value));
+                return;
+            }
+            cslt::shift_insert(_allocator, _data, _len, index, cslt::move(value));
+            _len++;
+        }
+// --------------------------------------------------------------------------------
+// Remove the last element
+
+        void pop_back() {
+            if (_len == 0)
+                throw cslt::out_of_range(CSLT_LITERAL("pop_back called on an empty small_vector"));
+            _len--;
+            alloc_traits::destroy(_allocator, _data + _len);
+        }
+// --------------------------------------------------------------------------------
+// Destroy every element but keep the buffer
+
+        void clear() noexcept {
+            cslt::destroy_n(_allocator, _data, _len);
+            _len = 0;
+        }
+// --------------------------------------------------------------------------------
+// Reserve memory
+
+        void reserve(cslt::size_t buff) {
+            if (buff <= _alloc)
+                return;
+            if (buff > alloc_traits::max_size(_allocator))
+                throw cslt::length_error(CSLT_LITERAL("Vector size exceeds maximum allocation"));
+            _reallocate(buff);
+        }
+// --------------------------------------------------------------------------------
+// Reduce the heap block to the number of live elements, or return to the
+// inline buffer when they fit in it
+
+        void shrink_to_fit() {
+            if (_alloc > _len)
+                _reallocate(_len);
+        }
+// --------------------------------------------------------------------------------
+// Element access, checked like vector
+
+        T& operator[](cslt::size_t index) {
+            CSLT_CHECK_INDEX(index, _len);
+            return _data[index];
+        }
+        const T& operator[](cslt::size_t index) const {
+            CSLT_CHECK_INDEX(index, _len);
+            return _data[index];
+        }
+
+        T& at(cslt::size_t index) {
+            if (index >= _len)
+                throw cslt::out_of_range(CSLT_LITERAL("Index out of range"));
+            return _data[index];
+        }
+        const T& at(cslt::size_t index) const {
+            if (index >= _len)
+                throw cslt::out_of_range(CSLT_LITERAL("Index out of range"));
+            return _data[index];
+        }
+
+        T* data() noexcept {return _data;}
+        const T* data() const noexcept {return _data;}
+// --------------------------------------------------------------------------------
+// Raw pointer iterators
+
+        T* begin() noexcept {return _data;}
+        const T* begin() const noexcept {return _data;}
+        T* end() noexcept {return _data + _len;}
+        const T* end() const noexcept {return _data + _len;}
+// --------------------------------------------------------------------------------
+
+        cslt::size_t size() const noexcept {return _len;}
+        cslt::size_t alloc() const noexcept {return _alloc;}
+        bool empty() const noexcept {return _len == 0;}
+        Alloc get_allocator() const {return _allocator;}
+// --------------------------------------------------------------------------------
+// True while the elements live in the inline buffer
+
+        bool is_inline() const noexcept {return _data == _inline_data();}
+// --------------------------------------------------------------------------------
+// Destructor
+
+        ~small_vector() {
+            _free();
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    namespace pmr {
+        /**
+         * @brief A small_vector that spills into a memory_resource
+         */
+        template <typename T, cslt::size_t N>
+        using small_vector = cslt::small_vector<T, N, cslt::polymorphic_allocator<T>>;
+    }
+// ================================================================================
+// ================================================================================
+
+    namespace detail {
+
+        /**
+         * @brief The elements and length of a static_vector
+         *
+         * Trivial element types are kept in a plain array, so that the whole
+         * static_vector is a literal type and can be built and changed in a
+         * constant expression.  Other types get raw storage and construct
+         * their elements in place.
+         */
+        template <typename T, cslt::size_t N, bool = std::is_trivial<T>::value>
+        struct static_vector_storage {
+            T _items[N] {};
+            cslt::size_t _len = 0;
+
+            constexpr T* _ptr() noexcept {return _items;}
+            constexpr const T* _ptr() const noexcept {return _items;}
+
+            template <typename... Args>
+            constexpr void _construct(cslt::size_t index, Args&&... args) {
+                _items[index] = T(cslt::forward<Args>(args)...);
+            }
+
+            constexpr void _destroy(cslt::size_t, cslt::size_t) noexcept {}
+
+            // The shift is a plain loop, which the compiler turns into a memmove
+            constexpr void _shift_insert(cslt::size_t index, T&& value) {
+                for (cslt::size_t i = _len; i > index; --i)
+                    _items[i] = _items[i - 1];
+                _items[index] = value;
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <typename T, cslt::size_t N>
+        struct static_vector_storage<T, N, false> {
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type _bytes[N];
+            cslt::size_t _len = 0;
+
+            T* _ptr() noexcept {return reinterpret_cast<T*>(_bytes);}
+            const T* _ptr() const noexcept {return reinterpret_cast<const T*>(_bytes);}
+
+            template <typename... Args>
+            void _construct(cslt::size_t index, Args&&... args) {
+                ::new (static_cast<void*>(_ptr() + index)) T(cslt::forward<Args>(args)...);
+            }
+
+            void _destroy(cslt::size_t first, cslt::size_t num) noexcept {
+                cslt::allocator<T> alloc;
+                cslt::destroy_n(alloc, _ptr() + first, num);
+            }
+
+            void _shift_insert(cslt::size_t index, T&& value) {
+                cslt::allocator<T> alloc;
+                cslt::shift_insert(alloc, _ptr(), _len, index, cslt::move(value));
+            }
+// --------------------------------------------------------------------------------
+
+            static_vector_storage() noexcept {}
+
+            static_vector_storage(const static_vector_storage& other) {
+                cslt::allocator<T> alloc;
+                cslt::uninitialized_copy_n(alloc, other._ptr(), other._len, _ptr());
+                _len = other._len;
+            }
+
+            // The source is left empty
+            static_vector_storage(static_vector_storage&& other)
+                noexcept(std::is_nothrow_move_constructible<T>::value) {
+                cslt::allocator<T> alloc;
+                cslt::uninitialized_relocate_n(alloc, other._ptr(), other._len, _ptr());
+                _len = other._len;
+                other._len = 0;
+            }
+
+            static_vector_storage& operator=(const static_vector_storage& other) {
+                if (this != &other) {
+                    _destroy(0, _len);
+                    _len = 0;
+                    cslt::allocator<T> alloc;
+                    cslt::uninitialized_copy_n(alloc, other._ptr(), other._len, _ptr());
+                    _len = other._len;
+                }
+                return *this;
+            }
+
+            static_vector_storage& operator=(static_vector_storage&& other)
+                noexcept(std::is_nothrow_move_constructible<T>::value) {
+                if (this != &other) {
+                    _destroy(0, _len);
+                    _len = 0;
+                    cslt::allocator<T> alloc;
+                    cslt::uninitialized_relocate_n(alloc, other._ptr(), other._len, _ptr());
+                    _len = other._len;
+                    other._len = 0;
+                }
+                return *this;
+            }
+
+            ~static_vector_storage() {
+                _destroy(0, _len);
+            }
+        };
+    } /* end of detail namespace */
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief A vector with a fixed capacity of N elements and no heap storage
+     *
+     * The elements live inside the object.  Growing past N throws
+     * cslt::length_error instead of allocating.  When T is trivial every
+     * operation is constexpr, so a static_vector can be filled at compile
+     * time.
+     *
+     * @tparam T The data type stored in the vector
+     * @tparam N The capacity
+     */
+    template <typename T, cslt::size_t N>
+    class static_vector : private detail::static_vector_storage<T, N> {
+        static_assert(N > 0, "static_vector needs room for at least one element");
+    public:
+        using value_type = T;
+        using size_type = cslt::size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+// ================================================================================
+// PRIVATE FUNCTION DEFINITIONS
+    private:
+        using storage = detail::static_vector_storage<T, N>;
+        using storage::_len;
+        using storage::_ptr;
+
+        constexpr void _check_room(cslt::size_t required) const {
+            if (required > N)
+                throw cslt::length_error(CSLT_LITERAL("static_vector capacity exceeded"));
+        }
+// ================================================================================
+// PUBLIC FUNCTION DEFINITIONS
+    public:
+        static_vector() = default;
+// --------------------------------------------------------------------------------
+// Constructor for initializer list
+
+        constexpr static_vector(std::initializer_list<T> ilist) {
+            _check_room(ilist.size());
+            for (const T* it = ilist.begin(); it != ilist.end(); ++it)
+                emplace_back(*it);
+        }
+// --------------------------------------------------------------------------------
+// Construct a new element in place at the end of the vector
+
+        template <typename... Args>
+        constexpr T& emplace_back(Args&&... args) {
+            _check_room(_len + 1);
+            this->_construct(_len, cslt::forward<Args>(args)...);
+            _len++;
+            return _ptr()[_len - 1];
+        }
+// --------------------------------------------------------------------------------
+// push data to the end of the vector
+
+        constexpr void push_back(const T& value) {
+            emplace_back(value);
+        }
+
+        constexpr void push_back(T&& value) {
+            emplace_back(cslt::move(value));
+        }
+// --------------------------------------------------------------------------------
+// push_back for data pushed to a specifc index
+
+        constexpr void push_back(const T& value, cslt::size_t index) {
+            // Copy first, value may refer to an element that is about to shift
+            T temp(value);
+            push_back(cslt::move(temp), index);
+        }
+
+        constexpr void push_back(T&& value, cslt::size_t index) {
+            if (index > _len)
+                throw cslt::out_of_range(CSLT_LITERAL("Index is out of bounds"));
+            _check_room(_len + 1);
+            this->_shift_insert(index, cslt::move(value));
+            _len++;
+        }
+// --------------------------------------------------------------------------------
+// Remove the last element
+
+        constexpr void pop_back() {
+            if (_len == 0)
+                throw cslt::out_of_range(CSLT_LITERAL("pop_back called on an empty static_vector"));
+            _len--;
+            this->_destroy(_len, 1);
+        }
+// --------------------------------------------------------------------------------
+
+        constexpr void clear() noexcept {
+            this->_destroy(0, _len);
+            _len = 0;
+        }
+// --------------------------------------------------------------------------------
+// There is nothing to allocate; a request past N throws cslt::length_error
+
+        constexpr void reserve(cslt::size_t buff) const {
+            _check_room(buff);
+        }
+// --------------------------------------------------------------------------------
+// Element access, checked like vector
+
+        constexpr T& operator[](cslt::size_t index) {
+            CSLT_CHECK_INDEX(index, _len);
+            return _ptr()[index];
+        }
+        constexpr const T& operator[](cslt::size_t index) const {
+            CSLT_CHECK_INDEX(index, _len);
+            return _ptr()[index];
+        }
+
+        constexpr T& at(cslt::size_t index) {
+            if (index >= _len)
+                throw cslt::out_of_range(CSLT_LITERAL("Index out of range"));
+            return _ptr()[index];
+        }
+        constexpr const T& at(cslt::size_t index) const {
+            if (index >= _len)
+                throw cslt::out_of_range(CSLT_LITERAL("Index out of range"));
+            return _ptr()[index];
+        }
+
+        constexpr T* data() noexcept {return _ptr();}
+        constexpr const T* data() const noexcept {return _ptr();}
+// --------------------------------------------------------------------------------
+// Raw pointer iterators
+
+        constexpr T* begin() noexcept {return _ptr();}
+        constexpr const T* begin() const noexcept {return _ptr();}
+        constexpr T* end() noexcept {return _ptr() + _len;}
+        constexpr const T* end() const noexcept {return _ptr() + _len;}
+// --------------------------------------------------------------------------------
+
+        constexpr cslt::size_t size() const noexcept {return _len;}
+        constexpr cslt::size_t alloc() const noexcept {return N;}
+        constexpr bool empty() const noexcept {return _len == 0;}
+        constexpr bool full() const noexcept {return _len == N;}
+    };
+// --------------------------------------------------------------------------------
+
+    // small_vector points into itself while inline and is never relocatable;
+    // static_vector is relocatable whenever its elements are
+    template <typename T, cslt::size_t N>
+    struct is_trivially_relocatable<static_vector<T, N>> : is_trivially_relocatable<T> {};
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_small_vector_HPP */
+// ================================================================================
+// ================================================================================
+// eof
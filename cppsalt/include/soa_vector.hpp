@@ -0,0 +1,589 @@
+// ================================================================================
+// ================================================================================
+// - File:    soa_vector.hpp
+// - Purpose: A vector of records stored as one contiguous column per field
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_soa_vector_HPP
+#define cslt_soa_vector_HPP
+
+#include "config.hpp"
+#include "dtype.hpp"
+#include "except.hpp"
+#include "instrument.hpp"
+#include "memory.hpp"
+#include "memory_resource.hpp"
+#include "span.hpp"
+#include "util.hpp"
+#include "vec.hpp"
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    /**
+     * @brief A proxy for one element of a soa_vector, holding a reference to each field
+     *
+     * Fields are reached with get<I>().  Assigning a std::tuple of values
+     * writes every field, and the proxy converts to a std::tuple copy of the
+     * element.
+     *
+     * @tparam Refs The field types, const qualified for a read-only proxy
+     */
+    template <typename... Refs>
+    class soa_reference {
+    private:
+        std::tuple<Refs&...> refs;
+
+        template <typename Tuple, cslt::size_t... I>
+        void assign(const Tuple& values, std::index_sequence<I...>) const {
+            using expand = int[];
+            (void)expand{0, ((void)(std::get<I>(refs) = std::get<I>(values)), 0)...};
+        }
+// --------------------------------------------------------------------------------
+
+    public:
+        explicit soa_reference(Refs&... fields) noexcept : refs(fields...) {}
+        soa_reference(const soa_reference&) noexcept = default;
+// --------------------------------------------------------------------------------
+
+        template <cslt::size_t I>
+        auto get() const noexcept -> std::tuple_element_t<I, std::tuple<Refs&...>> {
+            return std::get<I>(refs);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Writes each field of values to the element
+         */
+        template <typename... Values,
+                  typename = std::enable_if_t<sizeof...(Values) == sizeof...(Refs)>>
+        const soa_reference& operator=(const std::tuple<Values...>& values) const {
+            assign(values, std::index_sequence_for<Refs...>());
+            return *this;
+        }
+
+        /**
+         * @brief Writes the fields of another element, as assigning a T& would
+         */
+        const soa_reference& operator=(const soa_reference& other) const {
+            assign(other.refs, std::index_sequence_for<Refs...>());
+            return *this;
+        }
+// --------------------------------------------------------------------------------
+
+        operator std::tuple<std::remove_const_t<Refs>...>() const {
+            return std::tuple<std::remove_const_t<Refs>...>(refs);
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    template <cslt::size_t I, typename... Refs>
+    auto get(const soa_reference<Refs...>& element) noexcept -> decltype(element.template get<I>()) {
+        return element.template get<I>();
+    }
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief A sequence of records with each field held in its own array
+     *
+     * A vector of structs brings every field of a record into the cache
+     * whenever one is read, so a loop over two fields of a twelve field
+     * record wastes most of the bandwidth it uses.  A soa_vector<float,
+     * float, int> keeps all the first fields in one array, all the second
+     * fields in another and so on, so a loop over column<0>() and
+     * column<1>() reads only those fields, with unit stride the compiler can
+     * vectorize.
+     *
+     * Each column is aligned to column_alignment bytes and drawn from a
+     * memory_resource.  The columns grow together, by the same rule as
+     * vector, and are relocated with move_if_noexcept or one memcpy for a
+     * trivially copyable field.  Growth gives the strong exception
+     * guarantee.  Element access returns a soa_reference proxy.
+     *
+     * A copy draws from the default resource and copy assignment keeps the
+     * target's resource, as a pmr container would; a move and swap carry
+     * the resource along with the columns.
+     *
+     * @tparam Fields The type of each column, in order
+     */
+    template <typename... Fields>
+    class soa_vector {
+        static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+
+    public:
+        static constexpr cslt::size_t columns = sizeof...(Fields);
+        static constexpr cslt::size_t column_alignment = 64;
+
+        template <cslt::size_t I>
+        using column_type = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+        using value_type = std::tuple<Fields...>;
+        using size_type = cslt::size_t;
+        using reference = soa_reference<Fields...>;
+        using const_reference = soa_reference<const Fields...>;
+// ================================================================================
+// PRIVATE VARIABLE DEFINITIONS
+    private:
+        using indices = std::index_sequence_for<Fields...>;
+        template <cslt::size_t I>
+        using index = std::integral_constant<cslt::size_t, I>;
+
+        std::tuple<Fields*...> _cols;
+        cslt::size_t _len = 0;
+        cslt::size_t _alloc = 0;
+        memory_resource* _res;
+// ================================================================================
+// PRIVATE FUNCTION DEFINITIONS
+// --------------------------------------------------------------------------------
+// Storage for one column of buff elements and its release
+
+        template <typename T>
+        static constexpr cslt::size_t _alignment() {
+            return alignof(T) > column_alignment ? alignof(T) : column_alignment;
+        }
+
+        template <typename T>
+        T* _allocate(cslt::size_t buff) {
+            if (buff == 0)
+                return nullptr;
+            T* block = static_cast<T*>(_res->allocate(buff * sizeof(T), _alignment<T>()));
+            CSLT_RECORD_ALLOC(soa_vector, buff * sizeof(T));
+            return block;
+        }
+
+        template <typename T>
+        void _deallocate(T* block, cslt::size_t buff) noexcept {
+            if (block) {
+                _res->deallocate(block, buff * sizeof(T), _alignment<T>());
+                CSLT_RECORD_FREE(soa_vector, buff * sizeof(T));
+            }
+        }
+// --------------------------------------------------------------------------------
+// Allocates every column of a new block, freeing the ones already made if one fails
+
+        void _allocate_all(std::tuple<Fields*...>& block, cslt::size_t buff, index<columns>) {
+            (void)block;
+            (void)buff;
+        }
+
+        template <cslt::size_t I>
+        void _allocate_all(std::tuple<Fields*...>& block, cslt::size_t buff, index<I>) {
+            std::get<I>(block) = _allocate<column_type<I>>(buff);
+            try {
+                _allocate_all(block, buff, index<I + 1>());
+            } catch (...) {
+                _deallocate(std::get<I>(block), buff);
+                throw;
+            }
+        }
+
+        template <cslt::size_t... I>
+        void _deallocate_all(std::tuple<Fields*...>& block, cslt::size_t buff, std::index_sequence<I...>) noexcept {
+            using expand = int[];
+            (void)expand{0, (_deallocate(std::get<I>(block), buff), 0)...};
+        }
+// --------------------------------------------------------------------------------
+// Moves the first num elements of each column into block.  The sources are
+// left in place, so a throw leaves this vector untouched.
+
+        void _move_all(std::tuple<Fields*...>& block, cslt::size_t num, index<columns>) {
+            (void)block;
+            (void)num;
+        }
+
+        template <cslt::size_t I>
+        void _move_all(std::tuple<Fields*...>& block, cslt::size_t num, index<I>) {
+            cslt::allocator<column_type<I>> alloc;
+            cslt::uninitialized_move_if_noexcept_n(alloc, std::get<I>(_cols), num, std::get<I>(block));
+            try {
+                _move_all(block, num, index<I + 1>());
+            } catch (...) {
+                cslt::destroy_n(alloc, std::get<I>(block), num);
+                throw;
+            }
+        }
+
+        void _copy_all(const soa_vector& other, index<columns>) {
+            (void)other;
+        }
+
+        template <cslt::size_t I>
+        void _copy_all(const soa_vector& other, index<I>) {
+            cslt::allocator<column_type<I>> alloc;
+            cslt::uninitialized_copy_n(alloc, std::get<I>(other._cols), other._len, std::get<I>(_cols));
+            try {
+                _copy_all(other, index<I + 1>());
+            } catch (...) {
+                cslt::destroy_n(alloc, std::get<I>(_cols), other._len);
+                throw;
+            }
+        }
+// --------------------------------------------------------------------------------
+// Destroys the elements from first to last of every column
+
+        template <cslt::size_t... I>
+        void _destroy_range(cslt::size_t first, cslt::size_t last, std::index_sequence<I...>) noexcept {
+            using expand = int[];
+            (void)expand{0, (_destroy_column<I>(first, last), 0)...};
+        }
+
+        template <cslt::size_t I>
+        void _destroy_column(cslt::size_t first, cslt::size_t last) noexcept {
+            cslt::allocator<column_type<I>> alloc;
+            cslt::destroy_n(alloc, std::get<I>(_cols) + first, last - first);
+        }
+// --------------------------------------------------------------------------------
+// Constructs field I and those after it at slot of cols from the matching
+// arguments, destroying the fields already built if a later one throws
+
+        template <typename Tuple>
+        static void _construct_at(std::tuple<Fields*...>& cols, cslt::size_t slot, Tuple& args, index<columns>) {
+            (void)cols;
+            (void)slot;
+            (void)args;
+        }
+
+        template <cslt::size_t I, typename Tuple>
+        static void _construct_at(std::tuple<Fields*...>& cols, cslt::size_t slot, Tuple& args, index<I>) {
+            using T = column_type<I>;
+            ::new (static_cast<void*>(std::get<I>(cols) + slot))
+                T(cslt::forward<std::tuple_element_t<I, Tuple>>(std::get<I>(args)));
+            try {
+                _construct_at(cols, slot, args, index<I + 1>());
+            } catch (...) {
+                std::get<I>(cols)[slot].~T();
+                throw;
+            }
+        }
+
+        void _default_at(cslt::size_t slot, index<columns>) {
+            (void)slot;
+        }
+
+        template <cslt::size_t I>
+        void _default_at(cslt::size_t slot, index<I>) {
+            using T = column_type<I>;
+            ::new (static_cast<void*>(std::get<I>(_cols) + slot)) T();
+            try {
+                _default_at(slot, index<I + 1>());
+            } catch (...) {
+                std::get<I>(_cols)[slot].~T();
+                throw;
+            }
+        }
+// --------------------------------------------------------------------------------
+// Moves every column into a new block of buff elements
+
+        void _reallocate(cslt::size_t buff) {
+            std::tuple<Fields*...> block;
+            _allocate_all(block, buff, index<0>());
+            try {
+                _move_all(block, _len, index<0>());
+            } catch (...) {
+                _deallocate_all(block, buff, indices());
+                throw;
+            }
+            _destroy_range(0, _len, indices());
+            if (_alloc != 0) {
+                _deallocate_all(_cols, _alloc, indices());
+                CSLT_RECORD_REALLOC(soa_vector);
+            }
+            _cols = block;
+            _alloc = buff;
+        }
+
+        cslt::size_t _grow_to(cslt::size_t required) const {
+            return grow_capacity(_alloc, required, std::numeric_limits<cslt::size_t>::max() / _largest_field());
+        }
+// --------------------------------------------------------------------------------
+// Grows the columns and appends an element in one pass.  The new element is
+// built before the old ones are moved, so args may refer to an element of
+// this vector.
+
+        template <typename Tuple>
+        void _realloc_push(Tuple& args) {
+            const cslt::size_t buff = _grow_to(_len + 1);
+            std::tuple<Fields*...> block;
+            _allocate_all(block, buff, index<0>());
+            try {
+                _construct_at(block, _len, args, index<0>());
+                try {
+                    _move_all(block, _len, index<0>());
+                } catch (...) {
+                    _destroy_slot(block, _len, indices());
+                    throw;
+                }
+            } catch (...) {
+                _deallocate_all(block, buff, indices());
+                throw;
+            }
+            _destroy_range(0, _len, indices());
+            if (_alloc != 0) {
+                _deallocate_all(_cols, _alloc, indices());
+                CSLT_RECORD_REALLOC(soa_vector);
+            }
+            _cols = block;
+            _alloc = buff;
+        }
+
+        template <cslt::size_t... I>
+        static void _destroy_slot(std::tuple<Fields*...>& cols, cslt::size_t slot, std::index_sequence<I...>) noexcept {
+            using expand = int[];
+            (void)expand{0, (_destroy_one(std::get<I>(cols) + slot), 0)...};
+        }
+
+        template <typename T>
+        static void _destroy_one(T* p) noexcept {
+            p->~T();
+        }
+
+        static constexpr cslt::size_t _largest_field() {
+            cslt::size_t largest = 1;
+            const cslt::size_t sizes[] = {sizeof(Fields)...};
+            for (cslt::size_t size : sizes)
+                largest = size > largest ? size : largest;
+            return largest;
+        }
+
+        template <cslt::size_t... I>
+        reference _at(cslt::size_t index, std::index_sequence<I...>) const noexcept {
+            return reference(std::get<I>(_cols)[index]...);
+        }
+
+        template <cslt::size_t... I>
+        const_reference _const_at(cslt::size_t index, std::index_sequence<I...>) const noexcept {
+            return const_reference(std::get<I>(_cols)[index]...);
+        }
+// ================================================================================
+// PUBLIC FUNCTIONS
+
+    public:
+        /**
+         * @brief Creates an empty soa_vector, which allocates nothing until it grows
+         */
+        explicit soa_vector(memory_resource* res = get_default_resource()) noexcept
+            : _cols(static_cast<Fields*>(nullptr)...), _res(res) {}
+
+        /**
+         * @brief Copies other into columns drawn from the default resource
+         *
+         * A resource is not handed on by a copy, as with
+         * polymorphic_allocator's select_on_container_copy_construction; the
+         * two argument form copies into a chosen one.
+         */
+        soa_vector(const soa_vector& other) : soa_vector(other, get_default_resource()) {}
+
+        soa_vector(const soa_vector& other, memory_resource* res) : soa_vector(res) {
+            if (other._len == 0)
+                return;
+            std::tuple<Fields*...> block;
+            _allocate_all(block, other._len, index<0>());
+            _cols = block;
+            _alloc = other._len;
+            try {
+                _copy_all(other, index<0>());
+            } catch (...) {
+                _deallocate_all(_cols, _alloc, indices());
+                throw;
+            }
+            _len = other._len;
+        }
+
+        soa_vector(soa_vector&& other) noexcept
+            : _cols(other._cols), _len(other._len), _alloc(other._alloc), _res(other._res) {
+            other._cols = std::tuple<Fields*...>(static_cast<Fields*>(nullptr)...);
+            other._len = other._alloc = 0;
+        }
+
+        /**
+         * @brief Replaces the elements with copies of other's, keeping this vector's resource
+         */
+        soa_vector& operator=(const soa_vector& other) {
+            if (this != &other) {
+                soa_vector copy(other, _res);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        soa_vector& operator=(soa_vector&& other) noexcept {
+            if (this != &other) {
+                soa_vector moved(cslt::move(other));
+                swap(moved);
+            }
+            return *this;
+        }
+
+        ~soa_vector() {
+            _destroy_range(0, _len, indices());
+            if (_alloc != 0)
+                _deallocate_all(_cols, _alloc, indices());
+        }
+
+        void swap(soa_vector& other) noexcept {
+            std::swap(_cols, other._cols);
+            std::swap(_len, other._len);
+            std::swap(_alloc, other._alloc);
+            std::swap(_res, other._res);
+        }
+// --------------------------------------------------------------------------------
+
+        cslt::size_t size() const noexcept {return _len;}
+        cslt::size_t capacity() const noexcept {return _alloc;}
+        bool empty() const noexcept {return _len == 0;}
+        memory_resource* resource() const noexcept {return _res;}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Makes room for buff elements in every column
+         */
+        void reserve(cslt::size_t buff) {
+            if (buff > _alloc)
+                _reallocate(buff);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Appends an element built field by field from values
+         *
+         * Each argument constructs the field in the matching column, so there
+         * must be one per field.  If a field's constructor throws, the fields
+         * already built are destroyed and the vector is unchanged.  A lone
+         * value_type goes to the tuple overload instead, so a one column
+         * vector still takes its element type.
+         */
+        template <typename... Values,
+                  typename = std::enable_if_t<sizeof...(Values) == columns &&
+                                              !std::is_same<std::tuple<std::decay_t<Values>...>,
+                                                            std::tuple<value_type>>::value>>
+        void push_back(Values&&... values) {
+            std::tuple<Values&&...> args(cslt::forward<Values>(values)...);
+            if (_len == _alloc)
+                _realloc_push(args);
+            else
+                _construct_at(_cols, _len, args, index<0>());
+            ++_len;
+        }
+
+        /**
+         * @brief Appends the fields of a tuple, as the element type of this vector
+         */
+        void push_back(const value_type& element) {
+            push_tuple(element, indices());
+        }
+// --------------------------------------------------------------------------------
+
+        void pop_back() noexcept {
+            if (_len != 0) {
+                _destroy_range(_len - 1, _len, indices());
+                --_len;
+            }
+        }
+
+        void clear() noexcept {
+            _destroy_range(0, _len, indices());
+            _len = 0;
+        }
+
+        /**
+         * @brief Shrinks to num elements, or grows with value-initialized fields
+         */
+        void resize(cslt::size_t num) {
+            if (num <= _len) {
+                _destroy_range(num, _len, indices());
+                _len = num;
+                return;
+            }
+            reserve(num);
+            for (; _len < num; ++_len)
+                _default_at(_len, index<0>());
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Element access, checked according to CSLT_BOUNDS_CHECK
+         */
+        reference operator[](cslt::size_t index) {
+            CSLT_CHECK_INDEX(index, _len);
+            return _at(index, indices());
+        }
+
+        const_reference operator[](cslt::size_t index) const {
+            CSLT_CHECK_INDEX(index, _len);
+            return _const_at(index, indices());
+        }
+
+        /**
+         * @brief Element access that always throws cslt::out_of_range past the end
+         */
+        reference at(cslt::size_t index) {
+            if (index >= _len)
+                throw cslt::out_of_range(CSLT_LITERAL("soa_vector index out of range"));
+            return _at(index, indices());
+        }
+
+        const_reference at(cslt::size_t index) const {
+            if (index >= _len)
+                throw cslt::out_of_range(CSLT_LITERAL("soa_vector index out of range"));
+            return _const_at(index, indices());
+        }
+
+        reference front() {return (*this)[0];}
+        const_reference front() const {return (*this)[0];}
+        reference back() {return (*this)[_len - 1];}
+        const_reference back() const {return (*this)[_len - 1];}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief The array of field I, one entry per element, for loops over one field
+         */
+        template <cslt::size_t I>
+        span<column_type<I>> column() noexcept {
+            return span<column_type<I>>(std::get<I>(_cols), _len);
+        }
+
+        template <cslt::size_t I>
+        span<const column_type<I>> column() const noexcept {
+            return span<const column_type<I>>(std::get<I>(_cols), _len);
+        }
+
+        template <cslt::size_t I>
+        column_type<I>* data() noexcept {return std::get<I>(_cols);}
+
+        template <cslt::size_t I>
+        const column_type<I>* data() const noexcept {return std::get<I>(_cols);}
+
+    private:
+        template <cslt::size_t... I>
+        void push_tuple(const value_type& element, std::index_sequence<I...>) {
+            push_back(std::get<I>(element)...);
+        }
+    };
+
+    template <typename... Fields>
+    constexpr cslt::size_t soa_vector<Fields...>::columns;
+
+    template <typename... Fields>
+    constexpr cslt::size_t soa_vector<Fields...>::column_alignment;
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_soa_vector_HPP */
+// ================================================================================
+// ================================================================================
+// eof
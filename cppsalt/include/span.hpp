@@ -0,0 +1,130 @@
+// ================================================================================
+// ================================================================================
+// - File:    span.hpp
+// - Purpose: A non-owning view of a contiguous sequence of objects
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_span_HPP
+#define cslt_span_HPP
+
+#include "dtype.hpp"
+#include "config.hpp"
+#include "except.hpp"
+#include <type_traits>
+#include <utility>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    /**
+     * @brief A pointer and a count describing objects owned by someone else
+     *
+     * A span is built implicitly from a C array or from any container with
+     * data() and size() members whose elements convert to T by pointer, which
+     * includes cslt::vector, cslt::array_ptr and the std:: containers.  A
+     * function taking span<const T> therefore accepts all of them without a
+     * copy or a template.  The viewed objects must outlive the span.
+     *
+     * @tparam T The element type; use const T for a read-only view
+     */
+    template <typename T>
+    class span {
+    private:
+        T* _data = nullptr;
+        cslt::size_t _len = 0;
+// --------------------------------------------------------------------------------
+
+        // Pointers to U may be used as pointers to T without a conversion of
+        // the pointed-to objects, such as T* to const T*
+        template <typename U>
+        using enable_compatible = std::enable_if_t<std::is_convertible<U(*)[], T(*)[]>::value>;
+
+        template <typename C>
+        using element_of = std::remove_pointer_t<decltype(std::declval<C&>().data())>;
+
+        template <typename C>
+        using enable_container = std::enable_if_t<
+            !std::is_array<C>::value &&
+            std::is_convertible<decltype(std::declval<C&>().size()), cslt::size_t>::value &&
+            std::is_convertible<element_of<C>(*)[], T(*)[]>::value>;
+// ================================================================================
+
+    public:
+        using element_type = T;
+        using value_type = std::remove_cv_t<T>;
+        using size_type = cslt::size_t;
+        using pointer = T*;
+        using reference = T&;
+        using iterator = T*;
+// --------------------------------------------------------------------------------
+// Constructors
+
+        constexpr span() noexcept = default;
+        constexpr span(T* data, cslt::size_t num) noexcept : _data(data), _len(num) {}
+        constexpr span(T* first, T* last) noexcept : _data(first), _len(static_cast<cslt::size_t>(last - first)) {}
+
+        template <cslt::size_t N>
+        constexpr span(T (&array)[N]) noexcept : _data(array), _len(N) {}
+
+        template <typename C, typename = enable_container<C>>
+        constexpr span(C& container) noexcept(noexcept(container.data()))
+            : _data(container.data()), _len(container.size()) {}
+
+        template <typename C, typename = enable_container<const C>>
+        constexpr span(const C& container) noexcept(noexcept(container.data()))
+            : _data(container.data()), _len(container.size()) {}
+
+        // A span<T> converts to a span<const T>
+        template <typename U, typename = enable_compatible<U>>
+        constexpr span(const span<U>& other) noexcept : _data(other.data()), _len(other.size()) {}
+// --------------------------------------------------------------------------------
+// Element access
+
+        constexpr T* data() const noexcept {return _data;}
+        constexpr cslt::size_t size() const noexcept {return _len;}
+        constexpr cslt::size_t size_bytes() const noexcept {return _len * sizeof(T);}
+        constexpr bool empty() const noexcept {return _len == 0;}
+        constexpr T* begin() const noexcept {return _data;}
+        constexpr T* end() const noexcept {return _data + _len;}
+        constexpr T& front() const noexcept {return _data[0];}
+        constexpr T& back() const noexcept {return _data[_len - 1];}
+
+        T& operator[](cslt::size_t index) const {
+            CSLT_CHECK_INDEX(index, _len);
+            return _data[index];
+        }
+
+        T& at(cslt::size_t index) const {
+            if (index >= _len)
+                throw cslt::out_of_range(CSLT_LITERAL("span index out of range"));
+            return _data[index];
+        }
+// --------------------------------------------------------------------------------
+// Subviews, which must lie inside the span
+
+        constexpr span first(cslt::size_t num) const noexcept {return span(_data, num);}
+        constexpr span last(cslt::size_t num) const noexcept {return span(_data + _len - num, num);}
+
+        /**
+         * @brief Returns the num objects starting at offset, or all of them to the end
+         */
+        constexpr span subspan(cslt::size_t offset, cslt::size_t num = static_cast<cslt::size_t>(-1)) const noexcept {
+            return span(_data + offset, num == static_cast<cslt::size_t>(-1) ? _len - offset : num);
+        }
+    };
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_span_HPP */
+// ================================================================================
+// ================================================================================
+// eof
@@ -16,7 +16,10 @@
 #define string_HPP
 
 #include "dtype.hpp"
+#include "hash.hpp"
 #include "memory.hpp"
+#include "memory_resource.hpp"
+#include "string_view.hpp"
 #include <cstring>
 // ================================================================================
 // ================================================================================
@@ -24,28 +27,105 @@
 namespace cslt {
 
     /**
-     * @brief This class manages a string implementation as a char array 
+     * @brief This class manages a string implementation as a char array
+     *
+     * Strings of up to sso_capacity characters are stored in a buffer inside
+     * the object and never touch the heap.  Longer strings are stored in a heap
+     * block that grows geometrically as characters are appended.  The length
+     * is cached, so size() never rescans the characters.  Heap blocks are drawn
+     * from a memory_resource, which defaults to get_default_resource().
      *
      * @param str A null terminated string literal
      */
-    class String {  
-        array_ptr<char> ptr = nullptr;
+    class String {
+    public:
+        /**
+         * @brief The number of characters that fit in the object without a heap allocation
+         */
+        static constexpr cslt::size_t sso_capacity = 23;
+// ================================================================================
+
+    private:
         cslt::size_t len = 0;
-        cslt::size_t alloc = 0;
+        cslt::size_t alloc = 0;  // Heap capacity not counting the null terminator, 0 when inline
+        memory_resource* res;
+        union {
+            char* heap;
+            char sso[sso_capacity + 1];
+        };
+// --------------------------------------------------------------------------------
+
+        bool is_inline() const noexcept {return alloc == 0;}
+        char* buffer() noexcept {return is_inline() ? sso : heap;}
+        const char* buffer() const noexcept {return is_inline() ? sso : heap;}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Copies num characters of str into an empty String
+         */
+        void assign_empty(const char* str, cslt::size_t num);
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Moves the characters into a heap block with room for buff characters
+         */
+        void grow(cslt::size_t buff);
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Frees any heap block and returns the String to the empty inline state
+         */
+        void release() noexcept;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Takes the characters of other, which must use an equal resource
+         */
+        void steal(String& other) noexcept;
 // ================================================================================
 
+    public:
+        /**
+         * @brief Default constructor, creates an empty String without allocating
+         */
+        String() noexcept;
+        explicit String(const polymorphic_allocator<char>& alloc) noexcept;
+// --------------------------------------------------------------------------------
+
         /**
          * @brief Constructor for class that takes a string literal as an input
          */
         String(const char* str);
+        String(const char* str, const polymorphic_allocator<char>& alloc);
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Constructor from the first num characters of str
+         *
+         * @param str A pointer to at least num characters
+         * @param num The number of characters to copy
+         */
+        String(const char* str, cslt::size_t num);
+        String(const char* str, cslt::size_t num, const polymorphic_allocator<char>& alloc);
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Constructor that copies the characters of a view
+         */
+        explicit String(string_view view) : String(view.data(), view.size()) {}
+        String(string_view view, const polymorphic_allocator<char>& alloc)
+            : String(view.data(), view.size(), alloc) {}
 // --------------------------------------------------------------------------------
 
         /**
-         * @brief Copy constructor for String class. 
+         * @brief Copy constructor for String class.
+         *
+         * A copy allocates from the default resource unless another allocator is given.
          *
          * @param other An object of String
          */
         String(const String& other);
+        String(const String& other, const polymorphic_allocator<char>& alloc);
 // --------------------------------------------------------------------------------
 
         /**
@@ -60,18 +140,31 @@ namespace cslt {
         /**
          * @brief This method is an rvalue copy constructor to enable move semantics
          *
+         * The heap block of other is transferred without an allocation, and an
+         * inline string is copied byte for byte.  other is left empty.
+         *
          * @param other An object of type String
          */
         String(String&& other) noexcept;
 // --------------------------------------------------------------------------------
 
         /**
-         * @brief This method is an rvalue assignment operator to enable move semantics 
+         * @brief This method is an rvalue assignment operator to enable move semantics
          *
-         * @param other An object of type String 
+         * The characters of other are taken without an allocation when both Strings
+         * use equal memory resources.  Otherwise they are copied into memory from
+         * the resource of this String, which keeps its resource in either case.
+         *
+         * @param other An object of type String
          * @returns A String object
          */
-        String& operator=(String&& other) noexcept;
+        String& operator=(String&& other);
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Destructor, frees the heap block if one is in use
+         */
+        ~String();
 // --------------------------------------------------------------------------------
 
         /**
@@ -83,19 +176,188 @@ namespace cslt {
 // --------------------------------------------------------------------------------
 
         /**
-         * @brief This function returns the size of allocated memory to include the null temrinator in indices 
+         * @brief This function returns the number of characters the String can hold without reallocating
+         *
+         * @returns The capacity, not including the null terminator
+         */
+        cslt::size_t capacity() const;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief This function returns the size of heap memory owned by the String in indices
          *
-         * @returns allocated memory, including the null temrinator
+         * @returns allocated heap memory, including the null temrinator, or 0 when the
+         *          string is stored inline
          */
         cslt::size_t memory() const;
 // --------------------------------------------------------------------------------
 
         /**
-         * @brief This function returns the string as a c-style string literal 
-         * 
+         * @brief This function returns true if the String contains no characters
+         */
+        bool empty() const;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief This function returns the string as a c-style string literal
+         *
          * @returns A c-style string literal
          */
         const char* c_string() const;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns a view of the characters, valid until the String is modified
+         *
+         * The conversion is implicit, so a String may be passed to any
+         * function taking a string_view.
+         */
+        string_view view() const noexcept {return string_view(buffer(), len);}
+        operator string_view() const noexcept {return view();}
+// --------------------------------------------------------------------------------
+
+        static constexpr cslt::size_t npos = string_view::npos;
+
+        /**
+         * @brief Searches the String, returning npos when nothing is found
+         *
+         * These match the members of string_view and use the same vectorized
+         * kernels.
+         */
+        cslt::size_t find(char chr, cslt::size_t pos = 0) const noexcept {return view().find(chr, pos);}
+        cslt::size_t find(string_view needle, cslt::size_t pos = 0) const noexcept {return view().find(needle, pos);}
+        cslt::size_t rfind(char chr, cslt::size_t pos = npos) const noexcept {return view().rfind(chr, pos);}
+        cslt::size_t rfind(string_view needle, cslt::size_t pos = npos) const noexcept {return view().rfind(needle, pos);}
+        cslt::size_t find_first_of(string_view chars, cslt::size_t pos = 0) const noexcept {
+            return view().find_first_of(chars, pos);
+        }
+        cslt::size_t find_first_not_of(string_view chars, cslt::size_t pos = 0) const noexcept {
+            return view().find_first_not_of(chars, pos);
+        }
+        bool contains(char chr) const noexcept {return view().contains(chr);}
+        bool contains(string_view needle) const noexcept {return view().contains(needle);}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Compares lexicographically, returning a negative, zero or positive value
+         */
+        int compare(string_view other) const noexcept {return view().compare(other);}
+
+        /**
+         * @brief Compares with ASCII letters folded to lower case
+         */
+        int compare_icase(string_view other) const noexcept {return view().compare_icase(other);}
+        bool equals_icase(string_view other) const noexcept {return view().equals_icase(other);}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Ensures the String can hold buff characters without reallocating
+         *
+         * @param buff The requested capacity, not including the null terminator
+         */
+        void reserve(cslt::size_t buff);
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Appends num characters of str to the end of the String
+         *
+         * When the capacity is exceeded the heap block is at least doubled, so a
+         * series of appends costs amortized constant time per character.
+         *
+         * @param str A pointer to at least num characters
+         * @param num The number of characters to append
+         * @returns A reference to this String
+         */
+        String& append(const char* str, cslt::size_t num);
+        String& append(const char* str);
+        String& append(const String& other);
+        String& append(string_view view) {return append(view.data(), view.size());}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Appends text to the end of the String
+         */
+        String& operator+=(const char* str);
+        String& operator+=(const String& other);
+        String& operator+=(char chr);
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Removes every character without releasing the capacity
+         */
+        void clear() noexcept;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns an allocator bound to the memory resource of this String
+         */
+        polymorphic_allocator<char> get_allocator() const noexcept;
+    };
+// --------------------------------------------------------------------------------
+
+    // An inline String keeps its characters in the union and finds them through
+    // alloc, never through a pointer to itself, so its bytes may be moved freely
+    template <>
+    struct is_trivially_relocatable<String> : std::true_type {};
+// ================================================================================
+// ================================================================================
+
+    String operator+(const String& lhs, const String& rhs);
+    String operator+(const String& lhs, const char* rhs);
+    String operator+(String&& lhs, const String& rhs);
+    String operator+(String&& lhs, const char* rhs);
+// --------------------------------------------------------------------------------
+
+    bool operator==(const String& lhs, const String& rhs);
+    bool operator==(const String& lhs, const char* rhs);
+    bool operator!=(const String& lhs, const String& rhs);
+    bool operator!=(const String& lhs, const char* rhs);
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief Hashes the characters of a String
+     *
+     * A null terminated string or a string_view hashes to the same value as a
+     * String holding the same characters, so a hashed container keyed by
+     * String can be searched with either without constructing a String.
+     */
+    template <>
+    struct hash<String> {
+        using is_transparent = void;
+
+        cslt::size_t operator()(const String& str) const noexcept {
+            return hash_bytes(str.c_string(), str.size());
+        }
+
+        cslt::size_t operator()(const char* str) const noexcept {
+            return hash_bytes(str, std::strlen(str));
+        }
+
+        cslt::size_t operator()(string_view view) const noexcept {
+            return hash_bytes(view.data(), view.size());
+        }
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Compares a String with a String, a null terminated string or a view
+     */
+    template <>
+    struct equal_to<String> {
+        using is_transparent = void;
+
+        bool operator()(const String& lhs, const String& rhs) const {
+            return lhs == rhs;
+        }
+
+        bool operator()(const String& lhs, const char* rhs) const {
+            return lhs == rhs;
+        }
+
+        bool operator()(const String& lhs, string_view rhs) const noexcept {
+            return lhs.view() == rhs;
+        }
     };
 
 } /* end of cslt namespace */
@@ -0,0 +1,213 @@
+// ================================================================================
+// ================================================================================
+// - File:    string_builder.hpp
+// - Purpose: Builds long text in a chain of chunks without moving what was written
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_string_builder_HPP
+#define cslt_string_builder_HPP
+
+#include "dtype.hpp"
+#include "memory_resource.hpp"
+#include "string.hpp"
+#include "string_view.hpp"
+#include <cstring>
+#include <ostream>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    /**
+     * @brief Accumulates appended text in fixed size chunks
+     *
+     * A String that outgrows its capacity copies every character written so
+     * far into a larger block.  A string_builder instead links a new chunk to
+     * the chain, so each appended character is copied exactly once no matter
+     * how long the text becomes.  The chunks can be written to a stream or a
+     * file descriptor as they are, and str() copies them into one String
+     * only when contiguous text is needed.
+     *
+     * Chunks come from a memory_resource.  Passing a monotonic_arena makes
+     * each chunk a pointer bump and frees them all with the arena.
+     */
+    class string_builder {
+    private:
+        struct chunk {
+            chunk* next;
+            cslt::size_t capacity;
+            cslt::size_t used;  // Only kept up to date once the chunk is full
+
+            char* data() noexcept {return reinterpret_cast<char*>(this + 1);}
+            const char* data() const noexcept {return reinterpret_cast<const char*>(this + 1);}
+        };
+
+        memory_resource* res;
+        cslt::size_t chunk_bytes;
+        chunk* head = nullptr;
+        chunk* tail = nullptr;
+        char* cursor = nullptr;
+        char* limit = nullptr;
+        cslt::size_t len = 0;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Links a chunk with room for at least num characters after the tail
+         */
+        void add_chunk(cslt::size_t num);
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Copies what fits in the tail and puts the rest in a new chunk
+         */
+        void append_slow(const char* str, cslt::size_t num);
+// --------------------------------------------------------------------------------
+
+        cslt::size_t used(const chunk* c) const noexcept {
+            return c == tail ? static_cast<cslt::size_t>(cursor - c->data()) : c->used;
+        }
+// --------------------------------------------------------------------------------
+
+        void free_chunks(chunk* first) noexcept;
+// ================================================================================
+
+    public:
+        static constexpr cslt::size_t default_chunk_size = 16384;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Creates an empty builder, which allocates nothing until the first append
+         *
+         * @param chunk_size The number of characters each chunk holds.  A
+         *                   single append larger than this gets a chunk of its own size.
+         * @param res        The resource the chunks are allocated from
+         */
+        explicit string_builder(cslt::size_t chunk_size = default_chunk_size,
+                                memory_resource* res = get_default_resource()) noexcept;
+        explicit string_builder(memory_resource* res) noexcept
+            : string_builder(default_chunk_size, res) {}
+// --------------------------------------------------------------------------------
+
+        string_builder(const string_builder&) = delete;
+        string_builder& operator=(const string_builder&) = delete;
+
+        /**
+         * @brief Takes the chunks of other, which is left empty
+         */
+        string_builder(string_builder&& other) noexcept;
+        string_builder& operator=(string_builder&& other) noexcept;
+// --------------------------------------------------------------------------------
+
+        ~string_builder();
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Appends num characters of str
+         *
+         * An append that fits in the current chunk is a bounds test and a
+         * memcpy.
+         */
+        string_builder& append(const char* str, cslt::size_t num) {
+            if (num <= static_cast<cslt::size_t>(limit - cursor)) {
+                if (num != 0)
+                    std::memcpy(cursor, str, num);
+                cursor += num;
+                len += num;
+            } else {
+                append_slow(str, num);
+            }
+            return *this;
+        }
+
+        string_builder& append(string_view view) {return append(view.data(), view.size());}
+
+        string_builder& append(char chr) {
+            if (cursor == limit)
+                add_chunk(1);
+            *cursor++ = chr;
+            ++len;
+            return *this;
+        }
+
+        string_builder& operator<<(string_view view) {return append(view);}
+        string_builder& operator<<(const char* str) {return append(string_view(str));}
+        string_builder& operator<<(char chr) {return append(chr);}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Removes the text, keeping the first chunk for reuse and freeing the others
+         */
+        void clear() noexcept;
+// --------------------------------------------------------------------------------
+
+        cslt::size_t size() const noexcept {return len;}
+        bool empty() const noexcept {return len == 0;}
+        cslt::size_t chunk_size() const noexcept {return chunk_bytes;}
+        cslt::size_t chunk_count() const noexcept;
+        memory_resource* resource() const noexcept {return res;}
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Calls func with a string_view of each non-empty chunk in order
+         */
+        template <typename Func>
+        void for_each_chunk(Func func) const {
+            for (const chunk* c = head; c != nullptr; c = c->next) {
+                const cslt::size_t num = used(c);
+                if (num != 0)
+                    func(string_view(c->data(), num));
+            }
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Copies the text into dest, which must hold size() characters
+         */
+        void copy_to(char* dest) const noexcept;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns the text as one String, which costs a single copy
+         */
+        String str() const;
+        String str(const polymorphic_allocator<char>& alloc) const;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Writes every chunk to os without joining them first
+         */
+        std::ostream& write_to(std::ostream& os) const;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Writes the text to an open file descriptor with gathered writes
+         *
+         * On POSIX systems the chunks are passed to writev, many at a time,
+         * and partial writes are resumed until everything is written.  Throws
+         * cslt::system_error if a write fails.
+         *
+         * @returns The number of characters written, which is size()
+         */
+        cslt::size_t writev(int fd) const;
+    };
+// ================================================================================
+// ================================================================================
+
+    inline std::ostream& operator<<(std::ostream& os, const string_builder& builder) {
+        return builder.write_to(os);
+    }
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_string_builder_HPP */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,150 @@
+// ================================================================================
+// ================================================================================
+// - File:    string_search.hpp
+// - Purpose: Vectorized kernels that search and compare runs of characters
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_string_search_HPP
+#define cslt_string_search_HPP
+
+#include "dtype.hpp"
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+namespace text {
+
+    /**
+     * @brief Returned by the search kernels when nothing is found
+     */
+    constexpr cslt::size_t not_found = static_cast<cslt::size_t>(-1);
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief The instruction sets a kernel table can be built for
+     *
+     * On x86 the best table the processor supports is chosen at the first
+     * call, so a binary built for plain x86-64 still uses AVX2 where it is
+     * present.  NEON is chosen at compile time on ARM.  The scalar table is
+     * always available, and is the only one when CSLT_NO_SIMD is defined.
+     */
+    enum class kernel : unsigned {
+        scalar,
+        sse2,
+        sse42,
+        avx2,
+        neon
+    };
+
+    /**
+     * @brief Returns the name of a kernel, such as "avx2"
+     */
+    const char* kernel_name(kernel k) noexcept;
+
+    /**
+     * @brief Returns true if this build and processor can run kernel k
+     */
+    bool kernel_supported(kernel k) noexcept;
+
+    /**
+     * @brief Returns the kernel the search functions currently use
+     */
+    kernel active_kernel() noexcept;
+
+    /**
+     * @brief Makes every later search use kernel k
+     *
+     * This exists so tests and benchmarks can compare the kernels; a program
+     * has no need to call it.  It must not race with a running search.
+     *
+     * @returns false, leaving the active kernel unchanged, if k is not supported
+     */
+    bool select_kernel(kernel k) noexcept;
+// ================================================================================
+// ================================================================================
+// Searches, each over the num characters at str and returning an index into
+// them or not_found
+
+    /**
+     * @brief Finds the first occurrence of chr, in the manner of memchr
+     */
+    cslt::size_t find_char(const char* str, cslt::size_t num, char chr) noexcept;
+
+    /**
+     * @brief Finds the last occurrence of chr
+     */
+    cslt::size_t rfind_char(const char* str, cslt::size_t num, char chr) noexcept;
+
+    /**
+     * @brief Finds the first occurrence of the needle_len characters at needle
+     *
+     * The vector kernels compare the first and the last character of the
+     * needle against a whole register of candidate positions at once and
+     * only compare the rest of the needle where both match, which skips most
+     * of the haystack for any needle that is not made of one repeated
+     * character.  An empty needle is found at index 0.
+     */
+    cslt::size_t find(const char* str, cslt::size_t num,
+                      const char* needle, cslt::size_t needle_len) noexcept;
+
+    /**
+     * @brief Finds the last occurrence of the needle_len characters at needle
+     *
+     * An empty needle is found at index num.
+     */
+    cslt::size_t rfind(const char* str, cslt::size_t num,
+                       const char* needle, cslt::size_t needle_len) noexcept;
+
+    /**
+     * @brief Finds the first character that is one of the set_len characters at set
+     *
+     * The SSE4.2 kernel tests sixteen characters against a set of up to
+     * sixteen in one instruction; larger sets use a lookup table.
+     */
+    cslt::size_t find_first_of(const char* str, cslt::size_t num,
+                               const char* set, cslt::size_t set_len) noexcept;
+
+    /**
+     * @brief Finds the first character that is not one of the set_len characters at set
+     */
+    cslt::size_t find_first_not_of(const char* str, cslt::size_t num,
+                                   const char* set, cslt::size_t set_len) noexcept;
+// ================================================================================
+// ================================================================================
+// Comparisons
+
+    /**
+     * @brief Compares num characters as unsigned bytes, in the manner of memcmp
+     */
+    int compare(const char* lhs, const char* rhs, cslt::size_t num) noexcept;
+
+    /**
+     * @brief Returns true if the num characters at lhs and rhs are the same
+     */
+    bool equal(const char* lhs, const char* rhs, cslt::size_t num) noexcept;
+
+    /**
+     * @brief Compares num characters with ASCII letters folded to lower case
+     *
+     * Bytes outside 'A' to 'Z' compare by value, so the result does not
+     * depend on the locale.
+     *
+     * @returns A negative, zero or positive value
+     */
+    int compare_icase(const char* lhs, const char* rhs, cslt::size_t num) noexcept;
+} /* end of text namespace */
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_string_search_HPP */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,305 @@
+// ================================================================================
+// ================================================================================
+// - File:    string_view.hpp
+// - Purpose: A non-owning, read-only view of a sequence of characters
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_string_view_HPP
+#define cslt_string_view_HPP
+
+#include "dtype.hpp"
+#include "config.hpp"
+#include "except.hpp"
+#include "hash.hpp"
+#include "string_search.hpp"
+#include <ostream>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    /**
+     * @brief A pointer and a length describing characters owned by someone else
+     *
+     * A string_view never allocates and never copies the characters, so a
+     * parser can split and compare text held in a String, a mapped_file or a
+     * literal without building intermediate strings.  The characters need
+     * not be null terminated, and data() of a view is not null terminated in
+     * general.  The viewed memory must outlive the view.
+     *
+     * Every member except the stream operator is constexpr, so views of
+     * literals can be searched and split at compile time.  A call to at() or
+     * substr() that would throw is not a constant expression.  At run time the
+     * searches and comparisons call the vectorized kernels of
+     * string_search.hpp, where the compiler can tell the two apart.
+     */
+    class string_view {
+    private:
+        const char* _data = nullptr;
+        cslt::size_t _len = 0;
+// --------------------------------------------------------------------------------
+
+        static constexpr cslt::size_t _length(const char* str) noexcept {
+            cslt::size_t num = 0;
+            while (str[num] != '\0')
+                ++num;
+            return num;
+        }
+
+        static constexpr int _compare(const char* lhs, const char* rhs, cslt::size_t num) noexcept {
+            if (!CSLT_CONSTANT_EVALUATED())
+                return text::compare(lhs, rhs, num);
+            for (cslt::size_t i = 0; i < num; ++i) {
+                const unsigned char a = static_cast<unsigned char>(lhs[i]);
+                const unsigned char b = static_cast<unsigned char>(rhs[i]);
+                if (a != b)
+                    return a < b ? -1 : 1;
+            }
+            return 0;
+        }
+
+        static constexpr int _compare_icase(const char* lhs, const char* rhs, cslt::size_t num) noexcept {
+            if (!CSLT_CONSTANT_EVALUATED())
+                return text::compare_icase(lhs, rhs, num);
+            for (cslt::size_t i = 0; i < num; ++i) {
+                const unsigned char a = _fold(lhs[i]);
+                const unsigned char b = _fold(rhs[i]);
+                if (a != b)
+                    return a < b ? -1 : 1;
+            }
+            return 0;
+        }
+
+        static constexpr unsigned char _fold(char chr) noexcept {
+            const unsigned char value = static_cast<unsigned char>(chr);
+            return value >= 'A' && value <= 'Z' ? static_cast<unsigned char>(value + 0x20) : value;
+        }
+
+        constexpr bool _contains(char chr) const noexcept {
+            for (cslt::size_t i = 0; i < _len; ++i)
+                if (_data[i] == chr)
+                    return true;
+            return false;
+        }
+
+        // Shifts an index found in the view starting at pos back to this view
+        static constexpr cslt::size_t _offset(cslt::size_t index, cslt::size_t pos) noexcept {
+            return index == text::not_found ? npos : index + pos;
+        }
+// ================================================================================
+
+    public:
+        using value_type = char;
+        using size_type = cslt::size_t;
+        using const_iterator = const char*;
+        using iterator = const char*;
+
+        static constexpr cslt::size_t npos = static_cast<cslt::size_t>(-1);
+// --------------------------------------------------------------------------------
+// Constructors
+
+        constexpr string_view() noexcept = default;
+        constexpr string_view(const char* str) : _data(str), _len(str ? _length(str) : 0) {}
+        constexpr string_view(const char* str, cslt::size_t num) noexcept : _data(str), _len(num) {}
+// --------------------------------------------------------------------------------
+// Element access
+
+        constexpr const char* data() const noexcept {return _data;}
+        constexpr cslt::size_t size() const noexcept {return _len;}
+        constexpr cslt::size_t length() const noexcept {return _len;}
+        constexpr bool empty() const noexcept {return _len == 0;}
+        constexpr const char* begin() const noexcept {return _data;}
+        constexpr const char* end() const noexcept {return _data + _len;}
+        constexpr char operator[](cslt::size_t index) const noexcept {return _data[index];}
+        constexpr char front() const noexcept {return _data[0];}
+        constexpr char back() const noexcept {return _data[_len - 1];}
+
+        constexpr char at(cslt::size_t index) const {
+            if (index >= _len)
+                throw cslt::out_of_range(CSLT_LITERAL("string_view index out of range"));
+            return _data[index];
+        }
+// --------------------------------------------------------------------------------
+// Modifiers, which only move the ends of the view
+
+        // Both remove at most size() characters, so a count of npos empties the view
+        constexpr void remove_prefix(cslt::size_t num) noexcept {
+            num = num < _len ? num : _len;
+            _data += num;
+            _len -= num;
+        }
+
+        constexpr void remove_suffix(cslt::size_t num) noexcept {
+            _len -= num < _len ? num : _len;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Returns the view of up to num characters starting at pos
+         *
+         * Throws cslt::out_of_range if pos is past the end.
+         */
+        constexpr string_view substr(cslt::size_t pos, cslt::size_t num = npos) const {
+            if (pos > _len)
+                throw cslt::out_of_range(CSLT_LITERAL("string_view::substr position out of range"));
+            const cslt::size_t left = _len - pos;
+            return string_view(_data + pos, num < left ? num : left);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Compares lexicographically, returning a negative, zero or positive value
+         */
+        constexpr int compare(string_view other) const noexcept {
+            const cslt::size_t num = _len < other._len ? _len : other._len;
+            const int result = _compare(_data, other._data, num);
+            if (result != 0)
+                return result;
+            return _len == other._len ? 0 : (_len < other._len ? -1 : 1);
+        }
+
+        /**
+         * @brief Compares with the ASCII letters of both views folded to lower case
+         */
+        constexpr int compare_icase(string_view other) const noexcept {
+            const cslt::size_t num = _len < other._len ? _len : other._len;
+            const int result = _compare_icase(_data, other._data, num);
+            if (result != 0)
+                return result;
+            return _len == other._len ? 0 : (_len < other._len ? -1 : 1);
+        }
+
+        constexpr bool equals_icase(string_view other) const noexcept {
+            return _len == other._len && _compare_icase(_data, other._data, _len) == 0;
+        }
+
+        constexpr bool starts_with(string_view prefix) const noexcept {
+            return _len >= prefix._len && _compare(_data, prefix._data, prefix._len) == 0;
+        }
+
+        constexpr bool ends_with(string_view suffix) const noexcept {
+            return _len >= suffix._len && _compare(_data + _len - suffix._len, suffix._data, suffix._len) == 0;
+        }
+// --------------------------------------------------------------------------------
+// Searching, each returns npos when nothing is found
+
+        constexpr cslt::size_t find(char chr, cslt::size_t pos = 0) const noexcept {
+            if (pos >= _len)
+                return npos;
+            if (!CSLT_CONSTANT_EVALUATED())
+                return _offset(text::find_char(_data + pos, _len - pos, chr), pos);
+            for (cslt::size_t i = pos; i < _len; ++i)
+                if (_data[i] == chr)
+                    return i;
+            return npos;
+        }
+
+        constexpr cslt::size_t find(string_view needle, cslt::size_t pos = 0) const noexcept {
+            if (needle._len == 0)
+                return pos <= _len ? pos : npos;
+            if (needle._len > _len)
+                return npos;
+            const cslt::size_t last = _len - needle._len;
+            if (pos > last)
+                return npos;
+            if (!CSLT_CONSTANT_EVALUATED())
+                return _offset(text::find(_data + pos, _len - pos, needle._data, needle._len), pos);
+            for (cslt::size_t i = pos; i <= last; ++i)
+                if (_data[i] == needle._data[0] && _compare(_data + i + 1, needle._data + 1, needle._len - 1) == 0)
+                    return i;
+            return npos;
+        }
+
+        constexpr cslt::size_t rfind(char chr, cslt::size_t pos = npos) const noexcept {
+            if (_len == 0)
+                return npos;
+            const cslt::size_t num = pos < _len ? pos + 1 : _len;
+            if (!CSLT_CONSTANT_EVALUATED())
+                return text::rfind_char(_data, num, chr);
+            for (cslt::size_t i = num; i-- > 0;)
+                if (_data[i] == chr)
+                    return i;
+            return npos;
+        }
+
+        constexpr cslt::size_t rfind(string_view needle, cslt::size_t pos = npos) const noexcept {
+            if (needle._len > _len)
+                return npos;
+            const cslt::size_t last = _len - needle._len;
+            const cslt::size_t first = pos < last ? pos : last;
+            if (!CSLT_CONSTANT_EVALUATED())
+                return text::rfind(_data, first + needle._len, needle._data, needle._len);
+            for (cslt::size_t i = first + 1; i-- > 0;)
+                if (_compare(_data + i, needle._data, needle._len) == 0)
+                    return i;
+            return npos;
+        }
+
+        constexpr cslt::size_t find_first_of(string_view chars, cslt::size_t pos = 0) const noexcept {
+            if (pos >= _len)
+                return npos;
+            if (!CSLT_CONSTANT_EVALUATED())
+                return _offset(text::find_first_of(_data + pos, _len - pos, chars._data, chars._len), pos);
+            for (cslt::size_t i = pos; i < _len; ++i)
+                if (chars._contains(_data[i]))
+                    return i;
+            return npos;
+        }
+
+        constexpr cslt::size_t find_first_not_of(string_view chars, cslt::size_t pos = 0) const noexcept {
+            if (pos >= _len)
+                return npos;
+            if (!CSLT_CONSTANT_EVALUATED())
+                return _offset(text::find_first_not_of(_data + pos, _len - pos, chars._data, chars._len), pos);
+            for (cslt::size_t i = pos; i < _len; ++i)
+                if (!chars._contains(_data[i]))
+                    return i;
+            return npos;
+        }
+
+        constexpr bool contains(char chr) const noexcept {return find(chr) != npos;}
+        constexpr bool contains(string_view needle) const noexcept {return find(needle) != npos;}
+    };
+// ================================================================================
+// ================================================================================
+
+    constexpr bool operator==(string_view lhs, string_view rhs) noexcept {
+        return lhs.size() == rhs.size() && lhs.compare(rhs) == 0;
+    }
+
+    constexpr bool operator!=(string_view lhs, string_view rhs) noexcept {return !(lhs == rhs);}
+    constexpr bool operator<(string_view lhs, string_view rhs) noexcept {return lhs.compare(rhs) < 0;}
+    constexpr bool operator>(string_view lhs, string_view rhs) noexcept {return lhs.compare(rhs) > 0;}
+    constexpr bool operator<=(string_view lhs, string_view rhs) noexcept {return lhs.compare(rhs) <= 0;}
+    constexpr bool operator>=(string_view lhs, string_view rhs) noexcept {return lhs.compare(rhs) >= 0;}
+// --------------------------------------------------------------------------------
+
+    inline std::ostream& operator<<(std::ostream& os, string_view view) {
+        return os.write(view.data(), static_cast<std::streamsize>(view.size()));
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Hashes the viewed characters, matching hash<String> for the same text
+     */
+    template <>
+    struct hash<string_view> {
+        cslt::size_t operator()(string_view view) const noexcept {
+            return hash_bytes(view.data(), view.size());
+        }
+    };
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_string_view_HPP */
+// ================================================================================
+// ================================================================================
+// eof
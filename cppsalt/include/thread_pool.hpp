@@ -0,0 +1,702 @@
+// ================================================================================
+// ================================================================================
+// - File:    thread_pool.hpp
+// - Purpose: A work-stealing thread pool, its task futures and parallel_for
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#ifndef cslt_thread_pool_HPP
+#define cslt_thread_pool_HPP
+
+#include "dtype.hpp"
+#include "except.hpp"
+#include "memory.hpp"
+#include "type_traits.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+
+    /**
+     * @brief A Chase-Lev deque: one owner pushes and takes at the bottom, any
+     *        thread steals from the top
+     *
+     * The owner works on its newest items while thieves take the oldest, so
+     * the two ends meet only when a single item is left and neither end needs
+     * a lock.  The ring doubles when it fills.  The rings it outgrows are kept
+     * until the deque is destroyed, since a thief may still be reading one.
+     *
+     * @tparam T A trivially copyable type, normally a pointer
+     */
+    template <typename T>
+    class work_stealing_deque {
+        static_assert(std::is_trivially_copyable<T>::value, "work_stealing_deque holds trivially copyable items");
+    private:
+        struct ring {
+            array_ptr<std::atomic<T>> slots;
+            std::int64_t mask;
+            ring* older;
+
+            ring(std::int64_t capacity, ring* previous)
+                : slots(static_cast<cslt::size_t>(capacity)), mask(capacity - 1), older(previous) {}
+
+            T get(std::int64_t index) const noexcept {
+                return slots.data()[index & mask].load(std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t index, T value) noexcept {
+                slots.data()[index & mask].store(value, std::memory_order_relaxed);
+            }
+        };
+
+        alignas(64) std::atomic<std::int64_t> _top{0};
+        alignas(64) std::atomic<std::int64_t> _bottom{0};
+        std::atomic<ring*> _ring;
+// --------------------------------------------------------------------------------
+
+        ring* _grow(ring* old, std::int64_t top, std::int64_t bottom) {
+            ring* bigger = new ring((old->mask + 1) * 2, old);
+            for (std::int64_t i = top; i < bottom; ++i)
+                bigger->put(i, old->get(i));
+            _ring.store(bigger, std::memory_order_release);
+            return bigger;
+        }
+// ================================================================================
+
+    public:
+        /**
+         * @brief Creates a deque with room for capacity items, rounded up to a power of two
+         */
+        explicit work_stealing_deque(cslt::size_t capacity = 256) {
+            std::int64_t size = 2;
+            while (static_cast<cslt::size_t>(size) < capacity)
+                size *= 2;
+            _ring.store(new ring(size, nullptr), std::memory_order_relaxed);
+        }
+
+        work_stealing_deque(const work_stealing_deque&) = delete;
+        work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+
+        ~work_stealing_deque() {
+            ring* r = _ring.load(std::memory_order_relaxed);
+            while (r) {
+                ring* older = r->older;
+                delete r;
+                r = older;
+            }
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Adds an item at the bottom; called only by the owner
+         */
+        void push(T value) {
+            const std::int64_t bottom = _bottom.load(std::memory_order_relaxed);
+            const std::int64_t top = _top.load(std::memory_order_acquire);
+            ring* r = _ring.load(std::memory_order_relaxed);
+            if (bottom - top > r->mask)
+                r = _grow(r, top, bottom);
+            r->put(bottom, value);
+            _bottom.store(bottom + 1, std::memory_order_release);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Removes the newest item; called only by the owner
+         *
+         * @return false if the deque was empty or a thief took the last item
+         */
+        bool take(T& value) noexcept {
+            const std::int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+            ring* r = _ring.load(std::memory_order_relaxed);
+            _bottom.store(bottom, std::memory_order_seq_cst);
+            std::int64_t top = _top.load(std::memory_order_seq_cst);
+            if (top > bottom) {
+                _bottom.store(bottom + 1, std::memory_order_relaxed);
+                return false;
+            }
+            value = r->get(bottom);
+            if (top < bottom)
+                return true;
+            // The last item; the owner and the thieves race for it on top
+            const bool won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                          std::memory_order_relaxed);
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Removes the oldest item; safe from any thread
+         *
+         * @return false if the deque was empty or another thread won the item
+         */
+        bool steal(T& value) noexcept {
+            std::int64_t top = _top.load(std::memory_order_seq_cst);
+            const std::int64_t bottom = _bottom.load(std::memory_order_seq_cst);
+            if (top >= bottom)
+                return false;
+            ring* r = _ring.load(std::memory_order_acquire);
+            value = r->get(top);
+            return _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                std::memory_order_relaxed);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief An estimate of the number of items, exact when no thread is working on the deque
+         */
+        cslt::size_t size() const noexcept {
+            const std::int64_t bottom = _bottom.load(std::memory_order_seq_cst);
+            const std::int64_t top = _top.load(std::memory_order_seq_cst);
+            return bottom > top ? static_cast<cslt::size_t>(bottom - top) : 0;
+        }
+
+        bool empty() const noexcept {return size() == 0;}
+    };
+// ================================================================================
+// ================================================================================
+
+    class thread_pool;
+
+    namespace detail {
+
+        /**
+         * @brief Something a thread can wait on: a task result or a parallel_for
+         *
+         * The state moves from pending to done once.  A waiter that is about
+         * to block marks it waited, which tells the finishing thread to wake
+         * the pool's sleepers; otherwise finishing costs a single exchange.
+         */
+        class completion {
+        private:
+            enum : int {pending = 0, done = 1, waited = 2};
+            std::atomic<int> _state{pending};
+// ================================================================================
+
+        public:
+            bool ready() const noexcept {
+                return _state.load(std::memory_order_acquire) == done;
+            }
+
+            /**
+             * @brief Records that a thread will block on this
+             *
+             * @return false if it has already finished
+             */
+            bool mark_waiting() noexcept {
+                int expected = pending;
+                return _state.compare_exchange_strong(expected, waited, std::memory_order_acq_rel) ||
+                       expected == waited;
+            }
+
+            /**
+             * @brief Marks this done and wakes its waiter, if it has one
+             *
+             * Nothing in this object is touched after the exchange, since the
+             * waiter may return and destroy it at once.
+             */
+            void finish(thread_pool& pool) noexcept;
+        };
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief The base of everything a thread_pool runs
+         *
+         * The deque that holds a task owns one reference to it, and a future
+         * may own another.
+         */
+        class pool_task : public intrusive_ref_counter<pool_task> {
+        public:
+            virtual ~pool_task() = default;
+            virtual void run(thread_pool& pool) noexcept = 0;
+        };
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief The result of a submitted task, shared with its task_future
+         */
+        template <typename R>
+        class task_state : public pool_task, public completion {
+        private:
+            typename std::aligned_storage<sizeof(R), alignof(R)>::type _value;
+            bool _has_value = false;
+            std::exception_ptr _error;
+// ================================================================================
+
+        protected:
+            template <typename F>
+            void invoke(F& func) noexcept {
+                try {
+                    ::new (static_cast<void*>(&_value)) R(func());
+                    _has_value = true;
+                } catch (...) {
+                    _error = std::current_exception();
+                }
+            }
+// ================================================================================
+
+        public:
+            ~task_state() override {
+                if (_has_value)
+                    reinterpret_cast<R*>(&_value)->~R();
+            }
+
+            R take() {
+                if (_error)
+                    std::rethrow_exception(_error);
+                return cslt::move(*reinterpret_cast<R*>(&_value));
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <>
+        class task_state<void> : public pool_task, public completion {
+        private:
+            std::exception_ptr _error;
+// ================================================================================
+
+        protected:
+            template <typename F>
+            void invoke(F& func) noexcept {
+                try {
+                    func();
+                } catch (...) {
+                    _error = std::current_exception();
+                }
+            }
+// ================================================================================
+
+        public:
+            void take() {
+                if (_error)
+                    std::rethrow_exception(_error);
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <typename F, typename R>
+        class packaged_task final : public task_state<R> {
+        private:
+            F _func;
+// ================================================================================
+
+        public:
+            template <typename G>
+            explicit packaged_task(G&& func) : _func(cslt::forward<G>(func)) {}
+
+            void run(thread_pool& pool) noexcept override {
+                this->invoke(_func);
+                this->finish(pool);
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief The chunks of one parallel_for still to finish, and its first error
+         */
+        class for_group : public completion {
+        private:
+            std::atomic<cslt::size_t> _pending{1};
+            std::atomic<bool> _failed{false};
+            std::exception_ptr _error;
+// ================================================================================
+
+        public:
+            void add() noexcept {_pending.fetch_add(1, std::memory_order_relaxed);}
+
+            void finish_one(thread_pool& pool) noexcept {
+                if (_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    finish(pool);
+            }
+
+            bool failed() const noexcept {return _failed.load(std::memory_order_relaxed);}
+
+            void fail(std::exception_ptr error) noexcept {
+                if (!_failed.exchange(true, std::memory_order_acq_rel))
+                    _error = cslt::move(error);
+            }
+
+            void rethrow() {
+                if (_error)
+                    std::rethrow_exception(_error);
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <typename F>
+        class range_task;
+    } /* end of detail namespace */
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief The result of a task submitted to a thread_pool
+     *
+     * Unlike std::future, a task_future shares no mutex or condition
+     * variable with its task; the result lives in the task object itself.  A
+     * thread that waits runs other tasks of the pool until the result is
+     * ready, and only blocks once there are none left it could run.
+     *
+     * An exception thrown by the task is rethrown from get().  Using a future
+     * that holds no task, because it was default constructed, moved from or
+     * already read, throws cslt::future_error.
+     *
+     * @tparam R The type the task returns, which may be void
+     */
+    template <typename R>
+    class task_future {
+    private:
+        intrusive_ptr<detail::task_state<R>> _state;
+        thread_pool* _pool = nullptr;
+
+        void _check() const {
+            if (!_state)
+                throw cslt::future_error(CSLT_LITERAL("task_future has no task"));
+        }
+// ================================================================================
+
+    public:
+        task_future() noexcept = default;
+        task_future(intrusive_ptr<detail::task_state<R>> state, thread_pool& pool) noexcept
+            : _state(cslt::move(state)), _pool(&pool) {}
+// --------------------------------------------------------------------------------
+
+        task_future(task_future&& other) noexcept : _state(cslt::move(other._state)), _pool(other._pool) {}
+
+        task_future& operator=(task_future&& other) noexcept {
+            _state = cslt::move(other._state);
+            _pool = other._pool;
+            return *this;
+        }
+
+        task_future(const task_future&) = delete;
+        task_future& operator=(const task_future&) = delete;
+// --------------------------------------------------------------------------------
+
+        bool valid() const noexcept {return static_cast<bool>(_state);}
+
+        /**
+         * @brief Whether the task has finished, without waiting
+         */
+        bool ready() const {
+            _check();
+            return _state->ready();
+        }
+
+        /**
+         * @brief Waits for the task, running other tasks of the pool meanwhile
+         */
+        void wait() const;
+
+        /**
+         * @brief Waits for the task and returns its result or rethrows its exception
+         *
+         * The future holds no task afterwards.
+         */
+        R get() {
+            wait();
+            intrusive_ptr<detail::task_state<R>> state(cslt::move(_state));
+            return state->take();
+        }
+    };
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief Options for a thread_pool
+     */
+    struct thread_pool_options {
+        /// The number of workers, or 0 for one per hardware thread
+        cslt::size_t threads = 0;
+        /// Pin each worker to one CPU, filling one NUMA node before the next
+        bool pin_threads = false;
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief A fixed set of worker threads that balance their load by stealing
+     *
+     * Each worker owns a work_stealing_deque.  A task submitted from a worker
+     * goes to the bottom of its own deque, where no other thread contends for
+     * it; an idle worker steals from the top of another's deque, preferring
+     * workers on its own NUMA node.  Tasks submitted from outside the pool go
+     * through a shared injection queue, which is the only lock on the path.
+     * Idle workers spin briefly and then sleep until new work arrives.
+     *
+     * The destructor runs every task already submitted before it joins the
+     * workers.  Submitting a task while the pool is being destroyed is
+     * undefined.
+     */
+    class thread_pool {
+    private:
+        struct alignas(64) worker {
+            work_stealing_deque<detail::pool_task*> tasks;
+            std::thread thread;
+            std::uint64_t seed = 0;   // xorshift state for picking victims
+            int cpu = -1;             // The CPU the worker is pinned to, or -1
+            int node = 0;             // The NUMA node of that CPU
+        };
+
+        aligned_array_ptr<worker, 64> _workers;
+
+        std::mutex _inject_lock;
+        std::deque<detail::pool_task*> _injected;
+        std::atomic<cslt::size_t> _inject_count{0};
+
+        std::mutex _lock;                    // Guards _epoch and sleeping
+        std::condition_variable _sleep;      // Idle workers and blocked waiters
+        cslt::size_t _epoch = 0;             // Bumped to wake a sleeper for new work
+        std::atomic<cslt::size_t> _sleepers{0};
+        std::atomic<bool> _stopping{false};
+// --------------------------------------------------------------------------------
+
+        friend class detail::completion;
+        template <typename F>
+        friend class detail::range_task;
+// --------------------------------------------------------------------------------
+
+        static cslt::size_t _worker_count(cslt::size_t threads) noexcept;
+        void _start(const thread_pool_options& options);
+        void _worker_loop(cslt::size_t index) noexcept;
+        worker* _local_worker() noexcept;
+
+        /**
+         * @brief Queues a task that already holds the reference the queue owns
+         */
+        void _schedule(detail::pool_task* task);
+
+        detail::pool_task* _find_task(worker* self) noexcept;
+        bool _has_work() const noexcept;
+        void _execute(detail::pool_task* task) noexcept;
+
+        /**
+         * @brief Sleeps until new work arrives, the pool stops or c finishes
+         */
+        void _park(const detail::completion* c);
+        void _wake_waiters() noexcept;
+        void _wait(detail::completion& c);
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Whether a range should be split: the caller is a worker of this
+         *        pool whose deque thieves have emptied
+         */
+        bool _wants_split() noexcept {
+            worker* self = _local_worker();
+            return self != nullptr && self->tasks.empty();
+        }
+
+        template <typename F>
+        void _run_range(F& body, detail::for_group& group, cslt::size_t first, cslt::size_t last,
+                        cslt::size_t grain) noexcept;
+
+        template <typename F>
+        bool _spawn_range(F& body, detail::for_group& group, cslt::size_t first, cslt::size_t last,
+                          cslt::size_t grain) noexcept;
+// ================================================================================
+
+    public:
+        /**
+         * @brief Starts threads workers, or one per hardware thread when threads is 0
+         */
+        explicit thread_pool(cslt::size_t threads = 0);
+        explicit thread_pool(const thread_pool_options& options);
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        ~thread_pool();
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief The number of worker threads
+         */
+        cslt::size_t size() const noexcept {return _workers.size();}
+
+        /**
+         * @brief The CPU worker index is pinned to, or -1 when it is not pinned
+         */
+        int worker_cpu(cslt::size_t index) const {return _workers.at(index).cpu;}
+
+        /**
+         * @brief The index of the calling thread among the workers of this pool, or -1
+         */
+        long current_worker() const noexcept;
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Runs func() on the pool and returns a future for its result
+         */
+        template <typename F>
+        task_future<std::decay_t<invoke_result_t<std::decay_t<F>&>>>
+        submit(F&& func) {
+            using R = std::decay_t<invoke_result_t<std::decay_t<F>&>>;
+            intrusive_ptr<detail::task_state<R>> state(
+                new detail::packaged_task<typename std::decay<F>::type, R>(cslt::forward<F>(func)));
+            intrusive_ptr_add_ref(state.get());
+            try {
+                _schedule(state.get());
+            } catch (...) {
+                intrusive_ptr_release(state.get());
+                throw;
+            }
+            return task_future<R>(cslt::move(state), *this);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Calls body(begin, end) over chunks that together cover [first, last)
+         *
+         * The range is split in half only while the splitting worker's deque
+         * is empty, which means other workers have stolen everything it
+         * offered, so the chunks grow as the load evens out and shrink where
+         * a thread falls behind.  No chunk is smaller than grain, which
+         * defaults to the range over sixteen times the number of workers.
+         * The calling thread helps and returns once every chunk has run.  If
+         * a chunk throws, the chunks not yet started are skipped and the
+         * first exception is rethrown.
+         */
+        template <typename F>
+        void parallel_for(cslt::size_t first, cslt::size_t last, F&& body, cslt::size_t grain = 0);
+// --------------------------------------------------------------------------------
+
+        /**
+         * @brief Runs one queued task on the calling thread, if there is one
+         *
+         * @return true if a task ran
+         */
+        bool run_pending_task();
+
+        template <typename R>
+        friend class task_future;
+    };
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief A pool with one worker per hardware thread, created on first use
+     */
+    thread_pool& default_thread_pool();
+// ================================================================================
+// ================================================================================
+// TEMPLATE DEFINITIONS
+
+    template <typename R>
+    void task_future<R>::wait() const {
+        _check();
+        if (!_state->ready())
+            _pool->_wait(*_state);
+    }
+// --------------------------------------------------------------------------------
+
+    namespace detail {
+        template <typename F>
+        class range_task final : public pool_task {
+        private:
+            F* _body;
+            for_group* _group;
+            cslt::size_t _first;
+            cslt::size_t _last;
+            cslt::size_t _grain;
+// ================================================================================
+
+        public:
+            range_task(F& body, for_group& group, cslt::size_t first, cslt::size_t last,
+                       cslt::size_t grain) noexcept
+                : _body(&body), _group(&group), _first(first), _last(last), _grain(grain) {}
+
+            void run(thread_pool& pool) noexcept override {
+                pool._run_range(*_body, *_group, _first, _last, _grain);
+            }
+        };
+    } /* end of detail namespace */
+// --------------------------------------------------------------------------------
+
+    template <typename F>
+    bool thread_pool::_spawn_range(F& body, detail::for_group& group, cslt::size_t first,
+                                   cslt::size_t last, cslt::size_t grain) noexcept {
+        detail::range_task<F>* task = new (std::nothrow) detail::range_task<F>(body, group, first, last, grain);
+        if (!task)
+            return false;
+        intrusive_ptr_add_ref(task);
+        group.add();
+        try {
+            _schedule(task);
+        } catch (...) {
+            group.finish_one(*this);
+            intrusive_ptr_release(task);
+            return false;
+        }
+        return true;
+    }
+// --------------------------------------------------------------------------------
+
+    template <typename F>
+    void thread_pool::_run_range(F& body, detail::for_group& group, cslt::size_t first,
+                                 cslt::size_t last, cslt::size_t grain) noexcept {
+        while (last - first > grain && _wants_split()) {
+            const cslt::size_t middle = first + (last - first) / 2;
+            if (!_spawn_range(body, group, middle, last, grain))
+                break;
+            last = middle;
+        }
+        if (!group.failed()) {
+            try {
+                body(first, last);
+            } catch (...) {
+                group.fail(std::current_exception());
+            }
+        }
+        group.finish_one(*this);
+    }
+// --------------------------------------------------------------------------------
+
+    template <typename F>
+    void thread_pool::parallel_for(cslt::size_t first, cslt::size_t last, F&& body, cslt::size_t grain) {
+        if (first >= last)
+            return;
+        const cslt::size_t count = last - first;
+        if (grain == 0)
+            grain = count / (16 * size()) > 0 ? count / (16 * size()) : 1;
+        detail::for_group group;
+        if (_local_worker()) {
+            _run_range(body, group, first, last, grain);
+        }
+        else {
+            // Outside the pool nothing steals from the caller, so the range is
+            // dealt out in up to two pieces per worker, which split further
+            const cslt::size_t pieces = 2 * size() < count / grain ? 2 * size() : (count / grain > 0 ? count / grain : 1);
+            const cslt::size_t step = count / pieces;
+            cslt::size_t begin = first;
+            for (cslt::size_t i = 1; i < pieces; ++i, begin += step) {
+                if (!_spawn_range(body, group, begin, begin + step, grain))
+                    break;
+            }
+            _run_range(body, group, begin, last, grain);
+        }
+        _wait(group);
+        group.rethrow();
+    }
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+#endif /* cslt_thread_pool_HPP */
+// ================================================================================
+// ================================================================================
+// eof
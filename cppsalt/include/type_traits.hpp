@@ -35,6 +35,51 @@ namespace cslt {
     template<typename T>
     using is_copy_constructible = std::is_copy_constructible<T>;
 // ================================================================================
+// ================================================================================ 
+
+    /**
+     * @brief True when moving a T to new storage and destroying the original
+     *        is the same as copying its bytes
+     *
+     * The containers relocate such elements with memcpy and never run their
+     * move constructors or destructors while growing.  Every trivially
+     * copyable type qualifies.  A class that owns memory through plain
+     * pointers and never points into itself may opt in by specializing this
+     * trait, as unique_ptr, shared_ptr, String and vector do.  A class that
+     * keeps a pointer to its own members, such as small_vector, must not.
+     *
+     * @tparam T The type to query
+     */
+    template <typename T>
+    struct is_trivially_relocatable : std::integral_constant<bool, std::is_trivially_copyable<T>::value> {};
+// ================================================================================
+// ================================================================================ 
+
+    namespace detail {
+        template <typename Void, typename F, typename... Args>
+        struct invoke_result {};
+
+        template <typename F, typename... Args>
+        struct invoke_result<decltype(void(std::declval<F>()(std::declval<Args>()...))), F, Args...> {
+            using type = decltype(std::declval<F>()(std::declval<Args>()...));
+        };
+    }
+
+    /**
+     * @brief The type returned by calling an F with arguments of types Args
+     *
+     * Stands in for C++17's std::invoke_result, which replaces the
+     * deprecated std::result_of, for function objects and function
+     * pointers; pointers to members are not handled.  When the call is
+     * ill-formed there is no type member, so the trait may be used to
+     * constrain a template.
+     */
+    template <typename F, typename... Args>
+    struct invoke_result : detail::invoke_result<void, F, Args...> {};
+
+    template <typename F, typename... Args>
+    using invoke_result_t = typename invoke_result<F, Args...>::type;
+// ================================================================================
 // ================================================================================ 
  
 }
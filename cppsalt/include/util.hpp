@@ -29,21 +29,58 @@
 
 namespace cslt {
 
+    /**
+     * @brief Casts arg to an rvalue reference; nothing is moved until the result is consumed
+     */
+    template <typename T>
+    constexpr typename remove_reference<T>::type&& move(T&& arg) noexcept {
+        return static_cast<typename remove_reference<T>::type&&>(arg);
+    }
+// ================================================================================
+// ================================================================================
+
+    template<typename T>
+    constexpr T&& forward(typename std::remove_reference<T>::type& arg) noexcept {
+        return static_cast<T&&>(arg);
+    }
+// --------------------------------------------------------------------------------
+
+    template<typename T>
+    constexpr T&& forward(typename std::remove_reference<T>::type&& arg) noexcept {
+        static_assert(!std::is_lvalue_reference<T>::value, "Can't forward an rvalue as an lvalue.");
+        return static_cast<T&&>(arg);
+    }
+// ================================================================================
+// ================================================================================
+
     /**
      * @brief This function swaps to variables of the same type in memory.
      *
+     * The values are moved through a temporary, so swapping types that own
+     * heap memory exchanges their buffers instead of copying them.
+     *
      * @param a The first variable to be swapped 
      * @param b The second variable to be swapped
      */
     template<typename T>
-    void swap(T &a, T &b) {
-        T temp = a;
-        a = b;
-        b = temp;
+    void swap(T &a, T &b) noexcept(std::is_nothrow_move_constructible<T>::value &&
+                                   std::is_nothrow_move_assignable<T>::value) {
+        T temp = cslt::move(a);
+        a = cslt::move(b);
+        b = cslt::move(temp);
     }
 // ================================================================================
 // ================================================================================ 
 
+    /**
+     * @brief Tag that selects the pair constructor building second from a list of arguments
+     */
+    struct emplace_second_t {
+        explicit emplace_second_t() = default;
+    };
+    constexpr emplace_second_t emplace_second{};
+// --------------------------------------------------------------------------------
+
     /**
      * @ Struct pair 
      *
@@ -60,20 +97,29 @@ namespace cslt {
 // Constructor
         pair() : first(), second() {}
         pair(const A& first_val, const B& second_val) : first(first_val), second(second_val) {}
+
+        template <typename U1, typename U2,
+                  typename = std::enable_if_t<std::is_constructible<A, U1&&>::value &&
+                                              std::is_constructible<B, U2&&>::value>>
+        pair(U1&& first_val, U2&& second_val)
+            : first(std::forward<U1>(first_val)), second(std::forward<U2>(second_val)) {}
+// --------------------------------------------------------------------------------
+// Construct second in place from args, so that it need not be movable
+
+        template <typename U, typename... Args>
+        pair(emplace_second_t, U&& first_val, Args&&... args)
+            : first(std::forward<U>(first_val)), second(std::forward<Args>(args)...) {}
 // --------------------------------------------------------------------------------
-// Copy constructor
+// Copy and move constructors, defaulted so that a pair of trivially copyable
+// types is itself trivially copyable
 
-        pair(const pair& other) : first(other.first), second(other.second) {}
+        pair(const pair& other) = default;
+        pair(pair&& other) = default;
 // --------------------------------------------------------------------------------
 // Overload equl operator 
 
-        pair& operator=(const pair& other) {
-            if (this != &other) {
-                first = other.first;
-                second = other.second;
-            }
-            return *this;
-        }
+        pair& operator=(const pair& other) = default;
+        pair& operator=(pair&& other) = default;
 // --------------------------------------------------------------------------------
 // Swap data
     void swap (pair& pr) noexcept ( noexcept(cslt::swap(first,pr.first)) &&
@@ -82,29 +128,33 @@ namespace cslt {
         cslt::swap(second,pr.second);
     }
 };
+// --------------------------------------------------------------------------------
+
+    template<typename A, typename B>
+    void swap(pair<A, B>& a, pair<A, B>& b) noexcept(noexcept(a.swap(b))) {
+        a.swap(b);
+    }
+// --------------------------------------------------------------------------------
+
+    template<typename A, typename B>
+    struct is_trivially_relocatable<pair<A, B>>
+        : std::integral_constant<bool, is_trivially_relocatable<A>::value &&
+                                       is_trivially_relocatable<B>::value> {};
 // ================================================================================
 // ================================================================================
 
     /**
-     * @brief This function creates and returns a copy of the pair struct 
+     * @brief This function creates and returns a pair struct 
+     *
+     * Each value is copied when it is an lvalue and moved when it is an rvalue.
      *
      * @param first_val: A value of type defined by the user 
      * @param second_val: A value of type defined by the user 
      * @return A struct of type pair
      */
     template<typename A, typename B>
-    pair<A, B> make_pair(const A& first_val, const B& second_val) {
-        return pair<A, B>(first_val, second_val);
-    }
-// ================================================================================
-// ================================================================================
-
-    /**
-     * @brief Removes reference to return r value 
-     */
-    template <typename T>
-    typename remove_reference<T>::type move(T&& arg) {
-        return static_cast<typename remove_reference<T>::type&&>(arg);
+    pair<std::decay_t<A>, std::decay_t<B>> make_pair(A&& first_val, B&& second_val) {
+        return pair<std::decay_t<A>, std::decay_t<B>>(cslt::forward<A>(first_val), cslt::forward<B>(second_val));
     }
 // ================================================================================
 // ================================================================================
@@ -120,20 +170,6 @@ namespace cslt {
     std::add_rvalue_reference_t<T> declval() noexcept;  // Note: function is not defined
 
 // ================================================================================
-// ================================================================================
-
-    template<typename T>
-    T&& forward(typename std::remove_reference<T>::type& arg) noexcept {
-        return static_cast<T&&>(arg);
-    }
-// --------------------------------------------------------------------------------
-
-    template<typename T>
-    T&& forward(typename std::remove_reference<T>::type&& arg) noexcept {
-        static_assert(!std::is_lvalue_reference<T>::value, "Can't forward an rvalue as an lvalue.");
-        return static_cast<T&&>(arg);
-    }
-// ================================================================================
 // ================================================================================
 } /* end of cslt namespace */
 // ================================================================================
@@ -15,124 +15,573 @@
 #ifndef vec_HPP
 #define vec_HPP
 #include "dtype.hpp"
+#include "config.hpp"
 #include "except.hpp"
+#include "instrument.hpp"
+#include "probe.hpp"
+#include "util.hpp"
+#include "memory.hpp"
 #include <initializer_list>
 #include <algorithm>
+#include <cstring>
 
 namespace cslt {
 
-    template<typename T>
+    /**
+     * @brief The capacity a vector grows to when it needs room for required elements
+     *
+     * The capacity doubles, or jumps straight to required when that is
+     * larger, and stops at max.  soa_vector grows by the same rule.
+     */
+    inline cslt::size_t grow_capacity(cslt::size_t current, cslt::size_t required, cslt::size_t max) {
+        if (required > max)
+            throw cslt::length_error(CSLT_LITERAL("Vector size exceeds maximum allocation"));
+        if (current > max / 2)
+            return max;
+        return std::max(current > 0 ? current * 2 : 1, required);
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Builds a new element at dest + index from args and relocates num
+     *        elements from first around it
+     *
+     * The new element is built before the old ones move, so args may refer
+     * to one of them.  The source elements are destroyed only once every
+     * transfer succeeded; on an exception dest is left empty and the source
+     * untouched.  Trivially relocatable elements are moved with memcpy once
+     * the new element exists.  vector and small_vector grow through this call.
+     */
+    template <typename Alloc, typename T, typename... Args>
+    void uninitialized_relocate_insert_n(Alloc& alloc, T* first, cslt::size_t num, cslt::size_t index,
+                                         T* dest, Args&&... args) {
+        using alloc_traits = std::allocator_traits<Alloc>;
+        alloc_traits::construct(alloc, dest + index, cslt::forward<Args>(args)...);
+        if (cslt::is_trivially_relocatable<T>::value) {
+            cslt::uninitialized_relocate_n(alloc, first, index, dest);
+            cslt::uninitialized_relocate_n(alloc, first + index, num - index, dest + index + 1);
+            return;
+        }
+        try {
+            cslt::uninitialized_move_if_noexcept_n(alloc, first, index, dest);
+            try {
+                cslt::uninitialized_move_if_noexcept_n(alloc, first + index, num - index, dest + index + 1);
+            } catch (...) {
+                cslt::destroy_n(alloc, dest, index);
+                throw;
+            }
+        } catch (...) {
+            alloc_traits::destroy(alloc, dest + index);
+            throw;
+        }
+        cslt::destroy_n(alloc, first, num);
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * @brief Inserts value at index of a buffer holding num live elements and
+     *        room for one more
+     *
+     * Trivially relocatable elements are shifted with one memmove; others are
+     * moved one slot to the right, starting from the end.
+     */
+    template <typename Alloc, typename T>
+    void shift_insert(Alloc& alloc, T* data, cslt::size_t num, cslt::size_t index, T&& value) {
+        using alloc_traits = std::allocator_traits<Alloc>;
+        if (index == num) {
+            alloc_traits::construct(alloc, data + num, cslt::move(value));
+        }
+        else if (cslt::is_trivially_relocatable<T>::value) {
+            // The slot at index is left holding stale bytes, so it is constructed, not
+            // assigned, and the shift is undone if that throws
+            std::memmove(static_cast<void*>(data + index + 1), static_cast<const void*>(data + index),
+                         (num - index) * sizeof(T));
+            try {
+                alloc_traits::construct(alloc, data + index, cslt::move(value));
+            } catch (...) {
+                std::memmove(static_cast<void*>(data + index), static_cast<const void*>(data + index + 1),
+                             (num - index) * sizeof(T));
+                throw;
+            }
+        }
+        else {
+            // Shift elements to the right to make space
+            alloc_traits::construct(alloc, data + num, cslt::move(data[num - 1]));
+            std::move_backward(data + index, data + num - 1, data + num);
+            data[index] = cslt::move(value);
+        }
+    }
+// ================================================================================
+// ================================================================================
+
+    /**
+     * @brief A dynamically sized array with raw, uninitialized reserve capacity
+     *
+     * Only the first size() slots of the buffer hold live objects; the remaining
+     * capacity is raw storage from the allocator.  Elements are constructed in
+     * place, and on growth they are relocated into the new block with
+     * move_if_noexcept, or with a single memcpy when is_trivially_relocatable
+     * holds for T.
+     *
+     * @tparam T The data type stored in the vector
+     * @tparam Alloc The allocator that provides the storage
+     */
+    template<typename T, typename Alloc = cslt::allocator<T>>
     class vector {
-// ================================================================================ 
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using size_type = cslt::size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+// ================================================================================
 // PRIVATE VARIABLE DEFINITIONS
     private:
-        T *_data;
+        using alloc_traits = std::allocator_traits<Alloc>;
+
+        T *_data = nullptr;
         cslt::size_t _len = 0;
-        cslt::size_t _alloc;
-// ================================================================================ 
+        cslt::size_t _alloc = 0;
+        Alloc _allocator;
+// ================================================================================
+// PRIVATE FUNCTION DEFINITIONS
+// --------------------------------------------------------------------------------
+// Obtain and return raw storage through the allocator, counting each block
+// when instrumentation is enabled
+
+        T* _allocate(cslt::size_t buff) {
+            if (buff == 0)
+                return nullptr;
+            T* block = alloc_traits::allocate(_allocator, buff);
+            CSLT_RECORD_ALLOC(vector, buff * sizeof(T));
+            return block;
+        }
+
+        void _deallocate(T* block, cslt::size_t buff) noexcept {
+            alloc_traits::deallocate(_allocator, block, buff);
+            CSLT_RECORD_FREE(vector, buff * sizeof(T));
+        }
+// --------------------------------------------------------------------------------
+// Determine the next capacity, doubling the allocation size
+
+        cslt::size_t _grow_to(cslt::size_t required) const {
+            return grow_capacity(_alloc, required, alloc_traits::max_size(_allocator));
+        }
+// --------------------------------------------------------------------------------
+// Move the live elements into a new block of buff indices
+
+        void _reallocate(cslt::size_t buff) {
+            CSLT_PROFILE_SCOPE("vector.realloc");
+            T* new_data = _allocate(buff);
+            try {
+                cslt::uninitialized_relocate_n(_allocator, _data, _len, new_data);
+            } catch (...) {
+                if (new_data)
+                    _deallocate(new_data, buff);
+                throw;
+            }
+            if (_data) {
+                _deallocate(_data, _alloc);
+                CSLT_RECORD_REALLOC(vector);
+            }
+            _data = new_data;
+            _alloc = buff;
+        }
+// --------------------------------------------------------------------------------
+// Grow the buffer and construct a new element at index in a single pass.  The
+// new element is built before the old ones are relocated, so args may safely
+// refer to an element of this vector.
+
+        template <typename... Args>
+        void _realloc_insert(cslt::size_t index, Args&&... args) {
+            CSLT_PROFILE_SCOPE("vector.realloc");
+            const cslt::size_t buff = _grow_to(_len + 1);
+            T* new_data = _allocate(buff);
+            try {
+                cslt::uninitialized_relocate_insert_n(_allocator, _data, _len, index, new_data,
+                                                      cslt::forward<Args>(args)...);
+            } catch (...) {
+                _deallocate(new_data, buff);
+                throw;
+            }
+            if (_data) {
+                _deallocate(_data, _alloc);
+                CSLT_RECORD_REALLOC(vector);
+            }
+            _data = new_data;
+            _alloc = buff;
+            _len++;
+        }
+// --------------------------------------------------------------------------------
+// Insert an element at index when the capacity is already available
+
+        void _shift_insert(cslt::size_t index, T&& value) {
+            cslt::shift_insert(_allocator, _data, _len, index, cslt::move(value));
+            _len++;
+        }
+// --------------------------------------------------------------------------------
+// Take ownership of the buffer in other, the allocator travels with it
+
+        void _steal(vector& other) noexcept {
+            _data = other._data;
+            _len = other._len;
+            _alloc = other._alloc;
+            other._data = nullptr;
+            other._len = 0;
+            other._alloc = 0;
+        }
+
+// --------------------------------------------------------------------------------
+// Copy and move assignment, dispatched on whether the allocator propagates
+
+        // The allocator propagates, so storage from an unequal allocator is
+        // released through the old one before the new one is taken
+        void _copy_assign(const vector& other, std::true_type) {
+            if (!(_allocator == other._allocator))
+                _free();
+            _allocator = other._allocator;
+            _copy_assign(other, std::false_type());
+        }
+
+        // Reuses the existing buffer when it is large enough
+        void _copy_assign(const vector& other, std::false_type) {
+            if (other._len > _alloc) {
+                T* new_data = _allocate(other._len);
+                try {
+                    cslt::uninitialized_copy_n(_allocator, other._data, other._len, new_data);
+                } catch (...) {
+                    _deallocate(new_data, other._len);
+                    throw;
+                }
+                _free();
+                _data = new_data;
+                _alloc = other._len;
+            }
+            else {
+                clear();
+                cslt::uninitialized_copy_n(_allocator, other._data, other._len, _data);
+            }
+            _len = other._len;
+        }
+
+        void _move_assign(vector& other, std::true_type) noexcept {
+            _free();
+            _allocator = cslt::move(other._allocator);
+            _steal(other);
+        }
+
+        // The allocator does not propagate, so the buffer can only be stolen
+        // when both allocators can free each other's memory
+        void _move_assign(vector& other, std::false_type) {
+            if (_allocator == other._allocator) {
+                _free();
+                _steal(other);
+                return;
+            }
+            clear();
+            reserve(other._len);
+            cslt::uninitialized_move_if_noexcept_n(_allocator, other._data, other._len, _data);
+            _len = other._len;
+            other.clear();
+        }
+// --------------------------------------------------------------------------------
+// Release every element and the buffer
+
+        void _free() noexcept {
+            cslt::destroy_n(_allocator, _data, _len);
+            if (_data)
+                _deallocate(_data, _alloc);
+            _data = nullptr;
+            _len = 0;
+            _alloc = 0;
+        }
+// ================================================================================
 // PUBLIC FUNCTION DEFINITIONS
     public:
-// -------------------------------------------------------------------------------- 
-// Instantiate with 1 element
+// --------------------------------------------------------------------------------
+// Instantiate an empty vector, the first insertion allocates
+
+        vector() noexcept(noexcept(Alloc())) : _allocator() {}
+// --------------------------------------------------------------------------------
+// Instantiate with an allocator instance
 
-        vector() : _data(new T[1]), _alloc(1) {};
+        explicit vector(const Alloc& alloc) noexcept : _allocator(alloc) {}
 // --------------------------------------------------------------------------------
-// Instnatiate with user defined number of elements 
+// Instnatiate with user defined number of elements
 
-        vector(cslt::size_t buff) : _data(new T[buff]), _alloc(buff) {};
+        vector(cslt::size_t buff, const Alloc& alloc = Alloc()) : _allocator(alloc) {
+            _data = _allocate(buff);
+            _alloc = buff;
+        };
 // --------------------------------------------------------------------------------
 // Constructor for initializer list
 
-        vector(std::initializer_list<T> ilist) : _data(new T[ilist.size()]), _len(ilist.size()), _alloc(ilist.size()) {
-            std::copy(ilist.begin(), ilist.end(), _data);
+        vector(std::initializer_list<T> ilist, const Alloc& alloc = Alloc()) : _allocator(alloc) {
+            _data = _allocate(ilist.size());
+            _alloc = ilist.size();
+            try {
+                cslt::uninitialized_copy_n(_allocator, ilist.begin(), ilist.size(), _data);
+            } catch (...) {
+                if (_data)
+                    _deallocate(_data, _alloc);
+                throw;
+            }
+            _len = ilist.size();
         }
 // --------------------------------------------------------------------------------
-// push data to the function.
+// Copy constructor, the copy is allocated to the exact size of the source
 
-        void push_back(const T& value) {
-            if (_len >= _alloc) {
-                // Doubling the allocation size
-                _alloc = (_alloc > 0) ? _alloc * 2 : 1;
-                T* newData = new T[_alloc];
-                
-                std::copy(_data, _data + _len, newData);
+        vector(const vector& other)
+            : _allocator(alloc_traits::select_on_container_copy_construction(other._allocator)) {
+            _data = _allocate(other._len);
+            _alloc = other._len;
+            try {
+                cslt::uninitialized_copy_n(_allocator, other._data, other._len, _data);
+            } catch (...) {
+                if (_data)
+                    _deallocate(_data, _alloc);
+                throw;
+            }
+            _len = other._len;
+        }
+// --------------------------------------------------------------------------------
+// Move constructor, steals the buffer of other
+
+        vector(vector&& other) noexcept
+            : _data(other._data), _len(other._len), _alloc(other._alloc),
+              _allocator(cslt::move(other._allocator)) {
+            other._data = nullptr;
+            other._len = 0;
+            other._alloc = 0;
+        }
+// --------------------------------------------------------------------------------
+// Copy assignment operator, reuses the existing buffer when it is large enough
+
+        vector& operator=(const vector& other) {
+            if (this != &other)
+                _copy_assign(other, typename alloc_traits::propagate_on_container_copy_assignment());
+            return *this;
+        }
+// --------------------------------------------------------------------------------
+// Move assignment operator
 
-                // Deallocating old block
-                delete[] _data;
+        vector& operator=(vector&& other)
+            noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                     alloc_traits::is_always_equal::value) {
+            if (this != &other)
+                _move_assign(other, typename alloc_traits::propagate_on_container_move_assignment());
+            return *this;
+        }
+// --------------------------------------------------------------------------------
+// Construct a new element in place at the end of the vector
 
-                // Assigning new block to _data
-                _data = newData;
+        template <typename... Args>
+        T& emplace_back(Args&&... args) {
+            if (_len >= _alloc)
+                _realloc_insert(_len, cslt::forward<Args>(args)...);
+            else {
+                alloc_traits::construct(_allocator, _data + _len, cslt::forward<Args>(args)...);
+                _len++;
             }
+            return _data[_len - 1];
+        }
+// --------------------------------------------------------------------------------
+// push data to the function.
+
+        void push_back(const T& value) {
+            emplace_back(value);
+        }
+// --------------------------------------------------------------------------------
+// push an rvalue to the end of the vector without copying it
 
-            // Adding new element
-            _data[_len++] = value;
-        } 
+        void push_back(T&& value) {
+            emplace_back(cslt::move(value));
+        }
 // --------------------------------------------------------------------------------
-// push_back for data pushed to a specifc index 
+// push_back for data pushed to a specifc index
 
         void push_back(const T& value, cslt::size_t index) {
             if (index > _len) { // Check bounds
-                throw cslt::out_of_range("Index is out of bounds");
+                throw cslt::out_of_range(CSLT_LITERAL("Index is out of bounds"));
             }
+            if (_len >= _alloc) {
+                _realloc_insert(index, value);
+                return;
+            }
+            // Copy first, value may refer to an element that is about to shift
+            T temp(value);
+            _shift_insert(index, cslt::move(temp));
+        }
+// --------------------------------------------------------------------------------
+// push_back of an rvalue to a specific index
 
-            // Ensure there's enough space, reallocating if necessary
-            if (_len + 1 > _alloc) {
-                _alloc = (_alloc > 0) ? _alloc * 2 : 1;
-                T* newData = new T[_alloc];
-                std::copy(_data, _data + _len, newData);
-                delete[] _data;
-                _data = newData;
+        void push_back(T&& value, cslt::size_t index) {
+            if (index > _len) { // Check bounds
+                throw cslt::out_of_range(CSLT_LITERAL("Index is out of bounds"));
+            }
+            if (_len >= _alloc) {
+                _realloc_insert(index, cslt::move(value));
+                return;
             }
+            _shift_insert(index, cslt::move(value));
+        }
+// --------------------------------------------------------------------------------
+// Copy num elements from first onto the end, with one memcpy for trivially
+// copyable types.  The range is copied before the old elements are relocated,
+// so it may lie inside this vector.
 
-            // Shift elements to the right to make space
-            for (cslt::size_t i = _len; i > index; --i) {
-                _data[i] = _data[i - 1];
+        void append(const T* first, cslt::size_t num) {
+            if (num == 0)
+                return;
+            if (num <= _alloc - _len) {
+                cslt::uninitialized_copy_n(_allocator, first, num, _data + _len);
+                _len += num;
+                return;
+            }
+            if (num > alloc_traits::max_size(_allocator) - _len)
+                throw cslt::length_error(CSLT_LITERAL("Vector size exceeds maximum allocation"));
+            CSLT_PROFILE_SCOPE("vector.realloc");
+            const cslt::size_t buff = _grow_to(_len + num);
+            T* new_data = _allocate(buff);
+            try {
+                cslt::uninitialized_copy_n(_allocator, first, num, new_data + _len);
+            } catch (...) {
+                _deallocate(new_data, buff);
+                throw;
+            }
+            try {
+                cslt::uninitialized_relocate_n(_allocator, _data, _len, new_data);
+            } catch (...) {
+                cslt::destroy_n(_allocator, new_data + _len, num);
+                _deallocate(new_data, buff);
+                throw;
+            }
+            if (_data) {
+                _deallocate(_data, _alloc);
+                CSLT_RECORD_REALLOC(vector);
             }
+            _data = new_data;
+            _alloc = buff;
+            _len += num;
+        }
+// --------------------------------------------------------------------------------
+// Remove the last element
 
-            // Insert the new element
-            _data[index] = value;
+        void pop_back() {
+            if (_len == 0)
+                throw cslt::out_of_range(CSLT_LITERAL("pop_back called on an empty vector"));
+            _len--;
+            alloc_traits::destroy(_allocator, _data + _len);
+        }
+// --------------------------------------------------------------------------------
+// Destroy every element but keep the allocation
 
-            // Increment the length
-            _len++;
+        void clear() noexcept {
+            cslt::destroy_n(_allocator, _data, _len);
+            _len = 0;
         }
 // --------------------------------------------------------------------------------
-// Reserve memory 
+// Reserve memory
 
         void reserve(cslt::size_t buff) {
             if (buff <= _alloc)
                 return;
+            if (buff > alloc_traits::max_size(_allocator))
+                throw cslt::length_error(CSLT_LITERAL("Vector size exceeds maximum allocation"));
+            _reallocate(buff);
+        }
+// --------------------------------------------------------------------------------
+// Reduce the allocation to the number of live elements
 
-            T* new_data = new T[buff];
-            // Use std::move_if_noexcept to take advantage of move semantics if possible and safe
-            std::move(_data, _data + _len, new_data);
+        void shrink_to_fit() {
+            if (_alloc > _len)
+                _reallocate(_len);
+        }
+// --------------------------------------------------------------------------------
+// Element access
 
-            delete[] _data;
-            _data = new_data;
-            _alloc = buff; // Update the allocated size
-} 
+// operator[] is checked according to CSLT_BOUNDS_CHECK in config.hpp, while
+// at() always throws cslt::out_of_range past the end
+
+        T& operator[](cslt::size_t index) {
+            CSLT_CHECK_INDEX(index, _len);
+            return _data[index];
+        }
+        const T& operator[](cslt::size_t index) const {
+            CSLT_CHECK_INDEX(index, _len);
+            return _data[index];
+        }
+
+        T& at(cslt::size_t index) {
+            if (index >= _len)
+                throw cslt::out_of_range(CSLT_LITERAL("Index out of range"));
+            return _data[index];
+        }
+        const T& at(cslt::size_t index) const {
+            if (index >= _len)
+                throw cslt::out_of_range(CSLT_LITERAL("Index out of range"));
+            return _data[index];
+        }
+
+        T* data() noexcept {return _data;}
+        const T* data() const noexcept {return _data;}
+// --------------------------------------------------------------------------------
+// Raw pointer iterators
+
+        T* begin() noexcept {return _data;}
+        const T* begin() const noexcept {return _data;}
+        T* end() noexcept {return _data + _len;}
+        const T* end() const noexcept {return _data + _len;}
 // --------------------------------------------------------------------------------
-// Return size of array 
+// Return size of array
 
-        const cslt::size_t size() {
+        cslt::size_t size() const noexcept {
             return _len;
         }
 // --------------------------------------------------------------------------------
 // Return allocated length of array
 
-        const cslt::size_t alloc() {
+        cslt::size_t alloc() const noexcept {
             return _alloc;
         }
-// -------------------------------------------------------------------------------- 
+// --------------------------------------------------------------------------------
+
+        bool empty() const noexcept {
+            return _len == 0;
+        }
+// --------------------------------------------------------------------------------
+
+        Alloc get_allocator() const {
+            return _allocator;
+        }
+// --------------------------------------------------------------------------------
 // Destructor
 
         ~vector() {
-            delete[] _data;
-            _len = 0;
+            _free();
         }
     };
+// ================================================================================
+// ================================================================================
+
+    // The buffer is always on the heap, so only the allocator can pin a vector in place
+    template <typename T, typename Alloc>
+    struct is_trivially_relocatable<vector<T, Alloc>> : is_trivially_relocatable<Alloc> {};
+// ================================================================================
+// ================================================================================
+
+    namespace pmr {
+        /**
+         * @brief A vector whose memory comes from a memory_resource
+         */
+        template <typename T>
+        using vector = cslt::vector<T, cslt::polymorphic_allocator<T>>;
+    }
 }
 // ================================================================================
-// ================================================================================ 
+// ================================================================================
 
 #endif /* file_name_HPP */
 // ================================================================================
@@ -0,0 +1,183 @@
+// ================================================================================
+// ================================================================================
+// - File:    instrument.cpp
+// - Purpose: Thread local allocation counters and the registry that sums them
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "include/instrument.hpp"
+#include <atomic>
+#include <mutex>
+
+namespace cslt {
+namespace instrument {
+
+    namespace {
+        enum field : std::size_t {
+            allocs, frees, reallocs, bytes_in, bytes_out, field_count
+        };
+// --------------------------------------------------------------------------------
+
+        // Counters owned by one thread.  Only the owner writes them, so a
+        // relaxed load and store replaces a read-modify-write, and other
+        // threads may read them at any time for a global snapshot.
+        struct thread_counters {
+            std::atomic<std::uint64_t> values[site_count][field_count];
+            thread_counters* prev = nullptr;
+            thread_counters* next = nullptr;
+
+            thread_counters() noexcept;
+            ~thread_counters();
+
+            void add(site s, field f, std::uint64_t num) noexcept {
+                std::atomic<std::uint64_t>& value = values[static_cast<std::size_t>(s)][f];
+                value.store(value.load(std::memory_order_relaxed) + num, std::memory_order_relaxed);
+            }
+
+            void read(snapshot& out) const noexcept {
+                for (std::size_t i = 0; i < site_count; ++i) {
+                    counters& c = out.sites[i];
+                    c.allocations += values[i][allocs].load(std::memory_order_relaxed);
+                    c.deallocations += values[i][frees].load(std::memory_order_relaxed);
+                    c.reallocations += values[i][reallocs].load(std::memory_order_relaxed);
+                    c.bytes_allocated += values[i][bytes_in].load(std::memory_order_relaxed);
+                    c.bytes_freed += values[i][bytes_out].load(std::memory_order_relaxed);
+                }
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        // The live threads and the totals of threads that have exited
+        struct registry {
+            std::mutex lock;
+            thread_counters* head = nullptr;
+            snapshot retired;
+        };
+
+        registry& get_registry() noexcept {
+            static registry instance;
+            return instance;
+        }
+// --------------------------------------------------------------------------------
+
+        thread_counters::thread_counters() noexcept {
+            for (auto& row : values)
+                for (auto& value : row)
+                    value.store(0, std::memory_order_relaxed);
+            registry& reg = get_registry();
+            std::lock_guard<std::mutex> guard(reg.lock);
+            next = reg.head;
+            if (next)
+                next->prev = this;
+            reg.head = this;
+        }
+
+        thread_counters::~thread_counters() {
+            registry& reg = get_registry();
+            std::lock_guard<std::mutex> guard(reg.lock);
+            read(reg.retired);
+            if (prev)
+                prev->next = next;
+            else
+                reg.head = next;
+            if (next)
+                next->prev = prev;
+        }
+// --------------------------------------------------------------------------------
+
+        thread_counters& local() noexcept {
+            thread_local thread_counters instance;
+            return instance;
+        }
+    }
+// ================================================================================
+// ================================================================================
+
+    counters& counters::operator+=(const counters& other) noexcept {
+        allocations += other.allocations;
+        deallocations += other.deallocations;
+        reallocations += other.reallocations;
+        bytes_allocated += other.bytes_allocated;
+        bytes_freed += other.bytes_freed;
+        return *this;
+    }
+// --------------------------------------------------------------------------------
+
+    counters snapshot::total() const noexcept {
+        counters sum;
+        for (const counters& c : sites)
+            sum += c;
+        return sum;
+    }
+// ================================================================================
+// ================================================================================
+
+    void record_allocation(site s, std::size_t bytes) noexcept {
+        thread_counters& tc = local();
+        tc.add(s, allocs, 1);
+        tc.add(s, bytes_in, bytes);
+    }
+// --------------------------------------------------------------------------------
+
+    void record_deallocation(site s, std::size_t bytes) noexcept {
+        thread_counters& tc = local();
+        tc.add(s, frees, 1);
+        tc.add(s, bytes_out, bytes);
+    }
+// --------------------------------------------------------------------------------
+
+    void record_reallocation(site s) noexcept {
+        local().add(s, reallocs, 1);
+    }
+// --------------------------------------------------------------------------------
+
+    snapshot thread_snapshot() noexcept {
+        snapshot result;
+        if (enabled)
+            local().read(result);
+        return result;
+    }
+// --------------------------------------------------------------------------------
+
+    snapshot global_snapshot() {
+        snapshot result;
+        if (!enabled)
+            return result;
+        registry& reg = get_registry();
+        std::lock_guard<std::mutex> guard(reg.lock);
+        for (std::size_t i = 0; i < site_count; ++i)
+            result.sites[i] += reg.retired.sites[i];
+        for (const thread_counters* tc = reg.head; tc; tc = tc->next)
+            tc->read(result);
+        return result;
+    }
+// --------------------------------------------------------------------------------
+
+    const char* site_name(site s) noexcept {
+        switch (s) {
+            case site::array_ptr: return "array_ptr";
+            case site::vector: return "vector";
+            case site::string: return "string";
+            case site::shared_ptr: return "shared_ptr";
+            case site::exception: return "exception";
+            case site::hash_map: return "hash_map";
+            case site::string_builder: return "string_builder";
+            case site::soa_vector: return "soa_vector";
+            case site::small_vector: return "small_vector";
+            case site::slot_map: return "slot_map";
+            default: return "unknown";
+        }
+    }
+
+} /* end of instrument namespace */
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+// eof
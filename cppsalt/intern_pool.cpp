@@ -0,0 +1,131 @@
+// ================================================================================
+// ================================================================================
+// - File:    intern_pool.cpp
+// - Purpose: Insertion and table growth of intern_pool
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "include/intern_pool.hpp"
+#include <new>
+
+namespace cslt {
+
+    namespace {
+        constexpr cslt::size_t min_capacity = 16;
+
+        // The smallest power of two that keeps count entries at most half full
+        cslt::size_t capacity_for(cslt::size_t count) noexcept {
+            cslt::size_t capacity = min_capacity;
+            while (capacity / 2 < count)
+                capacity *= 2;
+            return capacity;
+        }
+    }
+// ================================================================================
+// ================================================================================
+
+    intern_pool::intern_pool(cslt::size_t expected, memory_resource* upstream)
+        : _arena(upstream), _table(nullptr), _count(0) {
+        _table.store(make_table(capacity_for(expected)), std::memory_order_release);
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * Slots are zeroed before the table is returned, and the caller publishes
+     * it with a release store, so a reader never sees an unset slot.
+     */
+    const intern_pool::table* intern_pool::make_table(cslt::size_t capacity) {
+        using slot = std::atomic<const detail::intern_entry*>;
+        table* tab = static_cast<table*>(_arena.allocate(sizeof(table), alignof(table)));
+        slot* slots = static_cast<slot*>(_arena.allocate(capacity * sizeof(slot), alignof(slot)));
+        for (cslt::size_t i = 0; i < capacity; ++i)
+            new (slots + i) slot(nullptr);
+        tab->mask = capacity - 1;
+        tab->slots = slots;
+        return tab;
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * Entries are copied into a larger table that is published whole.  The old
+     * table stays in the arena for readers that still hold it.
+     */
+    const intern_pool::table* intern_pool::grow_for(cslt::size_t count) {
+        const table* old = _table.load(std::memory_order_relaxed);
+        const cslt::size_t capacity = capacity_for(count);
+        if (capacity <= old->mask + 1)
+            return old;
+        const table* tab = make_table(capacity);
+        for (cslt::size_t i = 0; i <= old->mask; ++i) {
+            const detail::intern_entry* entry = old->slots[i].load(std::memory_order_relaxed);
+            if (entry == nullptr)
+                continue;
+            cslt::size_t index = entry->hash & tab->mask;
+            while (tab->slots[index].load(std::memory_order_relaxed) != nullptr)
+                index = (index + 1) & tab->mask;
+            tab->slots[index].store(entry, std::memory_order_relaxed);
+        }
+        _table.store(tab, std::memory_order_release);
+        return tab;
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * The text is written before the release store of its slot, so a reader
+     * that loads the pointer with acquire sees the whole entry.
+     */
+    const detail::intern_entry* intern_pool::insert(string_view text, cslt::size_t hash) {
+        const table* tab = grow_for(_count.load(std::memory_order_relaxed) + 1);
+        void* block = _arena.allocate(sizeof(detail::intern_entry) + text.size() + 1,
+                                      alignof(detail::intern_entry));
+        detail::intern_entry* entry = new (block) detail::intern_entry{hash, text.size()};
+        char* chars = reinterpret_cast<char*>(entry + 1);
+        if (!text.empty())
+            std::memcpy(chars, text.data(), text.size());
+        chars[text.size()] = '\0';
+
+        cslt::size_t index = hash & tab->mask;
+        while (tab->slots[index].load(std::memory_order_relaxed) != nullptr)
+            index = (index + 1) & tab->mask;
+        tab->slots[index].store(entry, std::memory_order_release);
+        _count.fetch_add(1, std::memory_order_release);
+        return entry;
+    }
+// ================================================================================
+// ================================================================================
+
+    interned_string intern_pool::intern(string_view text) {
+        const cslt::size_t hash = hash_bytes(text.data(), text.size());
+        const detail::intern_entry* entry = lookup(_table.load(std::memory_order_acquire), text, hash);
+        if (entry != nullptr)
+            return interned_string(entry);
+        std::lock_guard<std::mutex> lock(_mutex);
+        // Another thread may have added the string since the lock-free lookup
+        entry = lookup(_table.load(std::memory_order_relaxed), text, hash);
+        if (entry == nullptr)
+            entry = insert(text, hash);
+        return interned_string(entry);
+    }
+// --------------------------------------------------------------------------------
+
+    void intern_pool::reserve(cslt::size_t count) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        grow_for(count);
+    }
+// --------------------------------------------------------------------------------
+
+    cslt::size_t intern_pool::memory() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _arena.bytes_allocated();
+    }
+}
+// ================================================================================
+// ================================================================================
+// eof
@@ -13,6 +13,23 @@
 // Include modules here
 
 #include "include/io.hpp"
+#include "include/except.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
 
 // ================================================================================
 // ================================================================================
@@ -28,6 +45,260 @@ namespace cslt {
     std::wistream& wcin = std::wcin;   // Initialize with standard wcin
     std::wostream& wcerr = std::wcerr; // Initialize with standard wcerr
     std::wostream& wclog = std::wclog; // Initialize with standard wclog
+// ================================================================================
+// ================================================================================
+// MEMORY MAPPED FILES
+
+    namespace {
+
+        // Throws a system_error naming the failed action, the path and the
+        // operating system's description of the error
+        [[noreturn]] void throw_file_error(const char* action, const char* path, const char* reason) {
+            char text[512];
+            std::snprintf(text, sizeof(text), "%s %s: %s", action, path, reason);
+            throw cslt::system_error(text);
+        }
+
+    #if defined(_WIN32)
+        [[noreturn]] void throw_last_error(const char* action, const char* path) {
+            char reason[256];
+            const DWORD code = GetLastError();
+            if (!FormatMessageA(FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, nullptr,
+                                code, 0, reason, sizeof(reason), nullptr))
+                std::snprintf(reason, sizeof(reason), "error %lu", static_cast<unsigned long>(code));
+            throw_file_error(action, path, reason);
+        }
+    #else
+        [[noreturn]] void throw_last_error(const char* action, const char* path) {
+            throw_file_error(action, path, std::strerror(errno));
+        }
+
+        int madvise_flag(access_hint hint) noexcept {
+            switch (hint) {
+                case access_hint::sequential: return MADV_SEQUENTIAL;
+                case access_hint::random: return MADV_RANDOM;
+                case access_hint::willneed: return MADV_WILLNEED;
+                default: return MADV_NORMAL;
+            }
+        }
+    #endif
+    }
+// --------------------------------------------------------------------------------
+
+    mapped_file::mapped_file(const char* path, access_hint hint) {
+        open(path, hint);
+    }
+// --------------------------------------------------------------------------------
+
+    mapped_file::mapped_file(mapped_file&& other) noexcept
+        : _data(other._data), _size(other._size), _open(other._open) {
+        other._data = nullptr;
+        other._size = 0;
+        other._open = false;
+    }
+// --------------------------------------------------------------------------------
+
+    mapped_file& mapped_file::operator=(mapped_file&& other) noexcept {
+        if (this != &other) {
+            close();
+            _data = other._data;
+            _size = other._size;
+            _open = other._open;
+            other._data = nullptr;
+            other._size = 0;
+            other._open = false;
+        }
+        return *this;
+    }
+// --------------------------------------------------------------------------------
+
+    mapped_file::~mapped_file() {
+        close();
+    }
+// --------------------------------------------------------------------------------
+
+#if defined(_WIN32)
+    void mapped_file::open(const char* path, access_hint hint) {
+        close();
+        const DWORD flags = hint == access_hint::sequential ? FILE_FLAG_SEQUENTIAL_SCAN :
+                            hint == access_hint::random ? FILE_FLAG_RANDOM_ACCESS : FILE_ATTRIBUTE_NORMAL;
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            throw_last_error("Unable to open", path);
+
+        LARGE_INTEGER length;
+        if (!GetFileSizeEx(file, &length)) {
+            CloseHandle(file);
+            throw_last_error("Unable to read the size of", path);
+        }
+        if (static_cast<unsigned long long>(length.QuadPart) > std::numeric_limits<cslt::size_t>::max()) {
+            CloseHandle(file);
+            throw_file_error("Unable to map", path, "file is larger than the address space");
+        }
+        if (length.QuadPart == 0) {
+            CloseHandle(file);
+            _open = true;
+            return;
+        }
+
+        // The view keeps the file mapped after both handles are closed
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping)
+            throw_last_error("Unable to map", path);
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (!view)
+            throw_last_error("Unable to map", path);
+
+        _data = static_cast<const char*>(view);
+        _size = static_cast<cslt::size_t>(length.QuadPart);
+        _open = true;
+        if (hint == access_hint::willneed)
+            advise(hint);
+    }
+// --------------------------------------------------------------------------------
+
+    void mapped_file::close() noexcept {
+        if (_data)
+            UnmapViewOfFile(_data);
+        _data = nullptr;
+        _size = 0;
+        _open = false;
+    }
+// --------------------------------------------------------------------------------
+
+    void mapped_file::advise(access_hint hint) const noexcept {
+        if (hint == access_hint::willneed)
+            will_need(0, _size);
+    }
+// --------------------------------------------------------------------------------
+
+    void mapped_file::will_need(cslt::size_t offset, cslt::size_t num) const noexcept {
+    #if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+        if (offset >= _size)
+            return;
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = const_cast<char*>(_data + offset);
+        range.NumberOfBytes = num < _size - offset ? num : _size - offset;
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    #else
+        (void)offset;
+        (void)num;
+    #endif
+    }
+#else
+    void mapped_file::open(const char* path, access_hint hint) {
+        close();
+        const int fd = ::open(path, O_RDONLY);
+        if (fd < 0)
+            throw_last_error("Unable to open", path);
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            const int code = errno;
+            ::close(fd);
+            errno = code;
+            throw_last_error("Unable to read the size of", path);
+        }
+        if (static_cast<unsigned long long>(info.st_size) > std::numeric_limits<cslt::size_t>::max()) {
+            ::close(fd);
+            throw_file_error("Unable to map", path, "file is larger than the address space");
+        }
+        if (info.st_size == 0) {
+            ::close(fd);
+            _open = true;
+            return;
+        }
+
+        // The mapping keeps its own reference to the file, so the
+        // descriptor is not needed once it exists
+        const cslt::size_t length = static_cast<cslt::size_t>(info.st_size);
+        void* view = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        const int code = errno;
+        ::close(fd);
+        if (view == MAP_FAILED) {
+            errno = code;
+            throw_last_error("Unable to map", path);
+        }
+
+        _data = static_cast<const char*>(view);
+        _size = length;
+        _open = true;
+        if (hint != access_hint::normal)
+            advise(hint);
+    }
+// --------------------------------------------------------------------------------
+
+    void mapped_file::close() noexcept {
+        if (_data)
+            ::munmap(const_cast<char*>(_data), _size);
+        _data = nullptr;
+        _size = 0;
+        _open = false;
+    }
+// --------------------------------------------------------------------------------
+
+    void mapped_file::advise(access_hint hint) const noexcept {
+        if (_data)
+            ::madvise(const_cast<char*>(_data), _size, madvise_flag(hint));
+    }
+// --------------------------------------------------------------------------------
+
+    void mapped_file::will_need(cslt::size_t offset, cslt::size_t num) const noexcept {
+        if (offset >= _size)
+            return;
+        // madvise needs a page aligned start, and a mapping starts on a page
+        const cslt::size_t page = static_cast<cslt::size_t>(::sysconf(_SC_PAGESIZE));
+        const cslt::size_t start = offset - offset % page;
+        const cslt::size_t stop = num < _size - offset ? offset + num : _size;
+        ::madvise(const_cast<char*>(_data + start), stop - start, MADV_WILLNEED);
+    }
+#endif
+// ================================================================================
+// ================================================================================
+// MMAP_STREAMBUF
+
+    mmap_streambuf::mmap_streambuf(const char* data, cslt::size_t size) noexcept {
+        // The get area is only read; putback of a different character fails
+        // in the default pbackfail instead of writing
+        char* first = const_cast<char*>(data);
+        setg(first, first, first + size);
+    }
+// --------------------------------------------------------------------------------
+
+    mmap_streambuf::mmap_streambuf(const mapped_file& file) noexcept
+        : mmap_streambuf(file.data(), file.size()) {}
+// --------------------------------------------------------------------------------
+
+    std::streamsize mmap_streambuf::showmanyc() {
+        const std::streamsize left = egptr() - gptr();
+        return left > 0 ? left : -1;
+    }
+// --------------------------------------------------------------------------------
+
+    mmap_streambuf::pos_type mmap_streambuf::seekoff(off_type off, std::ios_base::seekdir dir,
+                                                     std::ios_base::openmode which) {
+        if (!(which & std::ios_base::in) || (which & std::ios_base::out))
+            return pos_type(off_type(-1));
+        off_type base;
+        if (dir == std::ios_base::beg)
+            base = 0;
+        else if (dir == std::ios_base::cur)
+            base = gptr() - eback();
+        else
+            base = egptr() - eback();
+        const off_type target = base + off;
+        if (target < 0 || target > egptr() - eback())
+            return pos_type(off_type(-1));
+        setg(eback(), eback() + target, egptr());
+        return pos_type(target);
+    }
+// --------------------------------------------------------------------------------
+
+    mmap_streambuf::pos_type mmap_streambuf::seekpos(pos_type pos, std::ios_base::openmode which) {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
 }
 // ================================================================================
 // ================================================================================
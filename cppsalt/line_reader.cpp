@@ -0,0 +1,151 @@
+// ================================================================================
+// ================================================================================
+// - File:    line_reader.cpp
+// - Purpose: Block reads of line_reader and the split_fields function
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "include/line_reader.hpp"
+#include "include/config.hpp"
+#include "include/probe.hpp"
+#include <cstring>
+
+#if CSLT_SIMD_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace cslt {
+
+    constexpr cslt::size_t line_reader::default_block_size;
+
+    namespace {
+        // The index of the lowest set bit of a mask that is not zero
+        inline unsigned lowest_bit(unsigned mask) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_ctz(mask));
+#else
+            unsigned bit = 0;
+            while ((mask & 1u) == 0) {
+                mask >>= 1;
+                ++bit;
+            }
+            return bit;
+#endif
+        }
+    }
+// ================================================================================
+// ================================================================================
+// PRIVATE FUNCTIONS
+
+    bool line_reader::refill() {
+        CSLT_PROFILE_SCOPE("line_reader.refill");
+        char* start = buffer.data();
+        const cslt::size_t partial = static_cast<cslt::size_t>(limit - cursor);
+        const cslt::size_t searched = static_cast<cslt::size_t>(scanned - cursor);
+        if (partial != 0 && cursor != start)
+            std::memmove(start, cursor, partial);
+        // A record as long as the whole buffer needs a larger one
+        if (partial == buffer.size()) {
+            buffer.realloc(buffer.size() * 2);
+            start = buffer.data();
+        }
+        cursor = start;
+        scanned = start + searched;
+        limit = start + partial;
+        const std::streamsize got = source->sgetn(start + partial,
+                                                  static_cast<std::streamsize>(buffer.size() - partial));
+        if (got <= 0)
+            return false;
+        limit += got;
+        return true;
+    }
+// --------------------------------------------------------------------------------
+
+    bool line_reader::next_slow(string_view& record) {
+        scanned = limit;
+        while (!exhausted) {
+            if (!refill()) {
+                exhausted = true;
+                break;
+            }
+            const cslt::size_t pos = text::find_char(scanned, static_cast<cslt::size_t>(limit - scanned), delim);
+            if (pos != text::not_found)
+                return emit(scanned + pos, scanned + pos + 1, record);
+            scanned = limit;
+        }
+        if (cursor == limit)
+            return false;
+        // The last record has no delimiter after it
+        return emit(limit, limit, record);
+    }
+// ================================================================================
+// ================================================================================
+// CONSTRUCTORS
+
+    line_reader::line_reader(std::istream& in, cslt::size_t block_size, char delimiter)
+        : source(in.rdbuf()), buffer(block_size != 0 ? block_size : 1),
+          delim(delimiter), strip_cr(delimiter == '\n'), exhausted(source == nullptr) {
+        cursor = limit = scanned = buffer.data();
+    }
+// --------------------------------------------------------------------------------
+
+    line_reader::line_reader(string_view text, char delimiter) noexcept
+        : buffer(nullptr), cursor(text.data()), limit(text.data() + text.size()), scanned(text.data()),
+          delim(delimiter), strip_cr(delimiter == '\n'), exhausted(true) {}
+// ================================================================================
+// ================================================================================
+
+    namespace {
+        // Stores the field ending at stop and moves past its delimiter
+        struct field_sink {
+            const char* data;
+            string_view* fields;
+            cslt::size_t max_fields;
+            cslt::size_t count = 0;
+            cslt::size_t start = 0;
+
+            void add(cslt::size_t stop) noexcept {
+                if (count < max_fields)
+                    fields[count] = string_view(data + start, stop - start);
+                ++count;
+                start = stop + 1;
+            }
+        };
+    }
+
+    cslt::size_t split_fields(string_view record, char delimiter,
+                              string_view* fields, cslt::size_t max_fields) noexcept {
+        // Fields are short, so a search call per field costs more than the
+        // search; one pass reports every delimiter of a 16 byte block instead
+        field_sink sink{record.data(), fields, max_fields};
+        const char* data = record.data();
+        const cslt::size_t num = record.size();
+        cslt::size_t i = 0;
+#if CSLT_SIMD_SSE2
+        const __m128i target = _mm_set1_epi8(delimiter);
+        for (; i + 16 <= num; i += 16) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, target)));
+            while (mask != 0) {
+                sink.add(i + lowest_bit(mask));
+                mask &= mask - 1;
+            }
+        }
+#endif
+        for (; i < num; ++i)
+            if (data[i] == delimiter)
+                sink.add(i);
+        sink.add(num);
+        return sink.count;
+    }
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+// eof
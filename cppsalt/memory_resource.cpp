@@ -0,0 +1,355 @@
+// ================================================================================
+// ================================================================================
+// - File:    memory_resource.cpp
+// - Purpose: This file contains the implementation of the memory resources
+//            available under the cslt namespace.
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "include/memory_resource.hpp"
+#include <atomic>
+#include <cstdint>
+#include <new>
+
+namespace cslt {
+
+    constexpr cslt::size_t memory_resource::max_align;
+    constexpr cslt::size_t monotonic_arena::default_chunk_size;
+    constexpr cslt::size_t pool_resource::min_block;
+    constexpr cslt::size_t pool_resource::max_pools;
+
+    memory_resource::~memory_resource() = default;
+// ================================================================================
+// ================================================================================
+// GLOBAL RESOURCES
+
+    namespace {
+
+        // Rounds value up to the next multiple of a power of two alignment
+        inline cslt::size_t align_up(cslt::size_t value, cslt::size_t alignment) noexcept {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+// --------------------------------------------------------------------------------
+
+        inline char* align_ptr(char* p, cslt::size_t alignment) noexcept {
+            return reinterpret_cast<char*>(align_up(reinterpret_cast<std::uintptr_t>(p), alignment));
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * Forwards to the global operator new.  Over-aligned requests are padded
+         * and the address of the original block is stored just before the
+         * aligned pointer.
+         */
+        class new_delete_resource_t : public memory_resource {
+            void* do_allocate(cslt::size_t bytes, cslt::size_t alignment) override {
+                if (alignment <= memory_resource::max_align) {
+                    void* p = ::operator new(bytes, std::nothrow);
+                    if (!p)
+                        cslt::throw_bad_alloc();
+                    return p;
+                }
+                char* raw = static_cast<char*>(::operator new(bytes + alignment + sizeof(void*), std::nothrow));
+                if (!raw)
+                    cslt::throw_bad_alloc();
+                char* aligned = align_ptr(raw + sizeof(void*), alignment);
+                reinterpret_cast<void**>(aligned)[-1] = raw;
+                return aligned;
+            }
+
+            void do_deallocate(void* p, cslt::size_t, cslt::size_t alignment) override {
+                if (alignment <= memory_resource::max_align)
+                    ::operator delete(p);
+                else
+                    ::operator delete(static_cast<void**>(p)[-1]);
+            }
+
+            bool do_is_equal(const memory_resource& other) const noexcept override {
+                return this == &other;
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        class null_memory_resource_t : public memory_resource {
+            void* do_allocate(cslt::size_t, cslt::size_t) override {
+                throw cslt::bad_alloc(CSLT_LITERAL("null_memory_resource cannot allocate"));
+            }
+
+            void do_deallocate(void*, cslt::size_t, cslt::size_t) override {}
+
+            bool do_is_equal(const memory_resource& other) const noexcept override {
+                return this == &other;
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        new_delete_resource_t& new_delete_instance() noexcept {
+            static new_delete_resource_t instance;
+            return instance;
+        }
+
+        std::atomic<memory_resource*>& default_resource() noexcept {
+            static std::atomic<memory_resource*> instance{&new_delete_instance()};
+            return instance;
+        }
+    }
+// --------------------------------------------------------------------------------
+
+    memory_resource* new_delete_resource() noexcept {
+        return &new_delete_instance();
+    }
+// --------------------------------------------------------------------------------
+
+    memory_resource* null_memory_resource() noexcept {
+        static null_memory_resource_t instance;
+        return &instance;
+    }
+// --------------------------------------------------------------------------------
+
+    memory_resource* get_default_resource() noexcept {
+        return default_resource().load(std::memory_order_acquire);
+    }
+// --------------------------------------------------------------------------------
+
+    memory_resource* set_default_resource(memory_resource* res) noexcept {
+        if (!res)
+            res = new_delete_resource();
+        return default_resource().exchange(res, std::memory_order_acq_rel);
+    }
+// ================================================================================
+// ================================================================================
+// MONOTONIC ARENA
+
+    monotonic_arena::monotonic_arena(memory_resource* upstream)
+        : upstream(upstream ? upstream : get_default_resource()), next_size(default_chunk_size) {}
+// --------------------------------------------------------------------------------
+
+    monotonic_arena::monotonic_arena(cslt::size_t initial_size, memory_resource* upstream)
+        : upstream(upstream ? upstream : get_default_resource()),
+          next_size(initial_size > sizeof(chunk) ? initial_size : default_chunk_size) {}
+// --------------------------------------------------------------------------------
+
+    monotonic_arena::monotonic_arena(void* buffer, cslt::size_t size, memory_resource* upstream)
+        : upstream(upstream ? upstream : get_default_resource()),
+          current(static_cast<char*>(buffer)), end(static_cast<char*>(buffer) + size),
+          initial_buffer(static_cast<char*>(buffer)), initial_size(size),
+          next_size(size > default_chunk_size ? 2 * size : default_chunk_size) {}
+// --------------------------------------------------------------------------------
+
+    monotonic_arena::~monotonic_arena() {
+        release();
+    }
+// --------------------------------------------------------------------------------
+
+    void monotonic_arena::release() noexcept {
+        while (chunks) {
+            chunk* next = chunks->next;
+            upstream->deallocate(chunks, chunks->size, memory_resource::max_align);
+            chunks = next;
+        }
+        current = initial_buffer;
+        end = initial_buffer ? initial_buffer + initial_size : nullptr;
+        used = 0;
+    }
+// --------------------------------------------------------------------------------
+
+    void monotonic_arena::new_chunk(cslt::size_t bytes, cslt::size_t alignment) {
+        const cslt::size_t header = align_up(sizeof(chunk), memory_resource::max_align);
+        cslt::size_t size = next_size;
+        const cslt::size_t needed = header + bytes + alignment;
+        if (size < needed)
+            size = align_up(needed, default_chunk_size);
+        void* block = upstream->allocate(size, memory_resource::max_align);
+        chunk* node = static_cast<chunk*>(block);
+        node->next = chunks;
+        node->size = size;
+        chunks = node;
+        current = static_cast<char*>(block) + header;
+        end = static_cast<char*>(block) + size;
+        if (next_size <= std::numeric_limits<cslt::size_t>::max() / 2)
+            next_size *= 2;
+    }
+// --------------------------------------------------------------------------------
+
+    void* monotonic_arena::do_allocate(cslt::size_t bytes, cslt::size_t alignment) {
+        if (bytes == 0)
+            bytes = 1;
+        char* p = current ? align_ptr(current, alignment) : nullptr;
+        if (!p || p > end || static_cast<cslt::size_t>(end - p) < bytes) {
+            new_chunk(bytes, alignment);
+            p = align_ptr(current, alignment);
+        }
+        current = p + bytes;
+        used += bytes;
+        return p;
+    }
+// --------------------------------------------------------------------------------
+
+    void monotonic_arena::do_deallocate(void*, cslt::size_t, cslt::size_t) {}
+// --------------------------------------------------------------------------------
+
+    bool monotonic_arena::do_is_equal(const memory_resource& other) const noexcept {
+        return this == &other;
+    }
+// ================================================================================
+// ================================================================================
+// POOL RESOURCE
+
+    pool_resource::pool_resource(cslt::size_t max_block_size, cslt::size_t max_blocks_per_slab,
+                                 memory_resource* upstream)
+        : upstream(upstream ? upstream : get_default_resource()),
+          max_blocks_per_slab(max_blocks_per_slab > 0 ? max_blocks_per_slab : 1) {
+        cslt::size_t size = min_block;
+        num_pools = 1;
+        while (size < max_block_size && num_pools < max_pools) {
+            size <<= 1;
+            ++num_pools;
+        }
+        max_block = size;
+    }
+// --------------------------------------------------------------------------------
+
+    pool_resource::pool_resource(memory_resource* upstream) : pool_resource(512, 1024, upstream) {}
+// --------------------------------------------------------------------------------
+
+    pool_resource::~pool_resource() {
+        release();
+    }
+// --------------------------------------------------------------------------------
+
+    void pool_resource::release() noexcept {
+        while (slabs) {
+            slab* next = slabs->next;
+            upstream->deallocate(slabs, slabs->size, memory_resource::max_align);
+            slabs = next;
+        }
+        while (large) {
+            large_block* next = large->next;
+            upstream->deallocate(large, large->size, large->alignment);
+            large = next;
+        }
+        for (cslt::size_t i = 0; i < num_pools; ++i)
+            pools[i] = pool();
+    }
+// --------------------------------------------------------------------------------
+
+    cslt::size_t pool_resource::pool_index(cslt::size_t bytes) const noexcept {
+        cslt::size_t index = 0;
+        cslt::size_t size = min_block;
+        while (size < bytes) {
+            size <<= 1;
+            ++index;
+        }
+        return index;
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * Each size class starts with a slab of a few blocks and doubles the slab
+     * size on every refill up to max_blocks_per_slab.
+     */
+    void pool_resource::refill(cslt::size_t index) {
+        pool& p = pools[index];
+        const cslt::size_t block = min_block << index;
+        p.blocks_per_slab = p.blocks_per_slab == 0 ? 4 : p.blocks_per_slab * 2;
+        if (p.blocks_per_slab > max_blocks_per_slab)
+            p.blocks_per_slab = max_blocks_per_slab;
+        const cslt::size_t header = align_up(sizeof(slab), memory_resource::max_align);
+        const cslt::size_t size = header + block * p.blocks_per_slab;
+        char* raw = static_cast<char*>(upstream->allocate(size, memory_resource::max_align));
+        slab* node = reinterpret_cast<slab*>(raw);
+        node->next = slabs;
+        node->size = size;
+        slabs = node;
+        // Thread the new blocks onto the free list in address order
+        char* first = raw + header;
+        for (cslt::size_t i = p.blocks_per_slab; i > 0; --i) {
+            free_block* fb = reinterpret_cast<free_block*>(first + (i - 1) * block);
+            fb->next = p.free_list;
+            p.free_list = fb;
+        }
+    }
+// --------------------------------------------------------------------------------
+
+    cslt::size_t pool_resource::large_header(cslt::size_t alignment) noexcept {
+        const cslt::size_t header = align_up(sizeof(large_block), memory_resource::max_align);
+        return alignment > header ? alignment : header;
+    }
+// --------------------------------------------------------------------------------
+
+    void* pool_resource::do_allocate(cslt::size_t bytes, cslt::size_t alignment) {
+        if (bytes == 0)
+            bytes = 1;
+        if (bytes <= max_block && alignment <= memory_resource::max_align) {
+            cslt::size_t index = pool_index(bytes);
+            // A block of size 2^k is only guaranteed an alignment of 2^k within a slab
+            while ((min_block << index) < alignment)
+                ++index;
+            if (index < num_pools) {
+                pool& p = pools[index];
+                if (!p.free_list)
+                    refill(index);
+                free_block* fb = p.free_list;
+                p.free_list = fb->next;
+                return fb;
+            }
+        }
+        // The header is a multiple of the alignment, so the block that follows it
+        // keeps the alignment of the upstream allocation
+        const cslt::size_t header = large_header(alignment);
+        const cslt::size_t align = alignment > memory_resource::max_align ? alignment : memory_resource::max_align;
+        char* raw = static_cast<char*>(upstream->allocate(bytes + header, align));
+        large_block* node = reinterpret_cast<large_block*>(raw);
+        node->prev = nullptr;
+        node->next = large;
+        node->size = bytes + header;
+        node->alignment = align;
+        if (large)
+            large->prev = node;
+        large = node;
+        return raw + header;
+    }
+// --------------------------------------------------------------------------------
+
+    void pool_resource::do_deallocate(void* p, cslt::size_t bytes, cslt::size_t alignment) {
+        if (!p)
+            return;
+        if (bytes == 0)
+            bytes = 1;
+        if (bytes <= max_block && alignment <= memory_resource::max_align) {
+            cslt::size_t index = pool_index(bytes);
+            while ((min_block << index) < alignment)
+                ++index;
+            if (index < num_pools) {
+                free_block* fb = static_cast<free_block*>(p);
+                fb->next = pools[index].free_list;
+                pools[index].free_list = fb;
+                return;
+            }
+        }
+        large_block* node = reinterpret_cast<large_block*>(static_cast<char*>(p) - large_header(alignment));
+        if (node->prev)
+            node->prev->next = node->next;
+        else
+            large = node->next;
+        if (node->next)
+            node->next->prev = node->prev;
+        upstream->deallocate(node, node->size, node->alignment);
+    }
+// --------------------------------------------------------------------------------
+
+    bool pool_resource::do_is_equal(const memory_resource& other) const noexcept {
+        return this == &other;
+    }
+
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+// eof
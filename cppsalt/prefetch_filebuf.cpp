@@ -0,0 +1,233 @@
+// ================================================================================
+// ================================================================================
+// - File:    prefetch_filebuf.cpp
+// - Purpose: The read-ahead thread and stream interface of prefetch_filebuf
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "include/prefetch_filebuf.hpp"
+#include "include/except.hpp"
+#include "include/probe.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#if defined(_WIN32)
+    #include <fcntl.h>
+    #include <io.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace cslt {
+
+    constexpr cslt::size_t prefetch_filebuf::default_block_size;
+    constexpr cslt::size_t prefetch_filebuf::default_depth;
+// ================================================================================
+// ================================================================================
+// PRIVATE FUNCTIONS
+
+    namespace {
+        [[noreturn]] void throw_error(const char* action, const char* path, int code) {
+            char text[512];
+            std::snprintf(text, sizeof(text), "%s %s: %s", action, path, std::strerror(code));
+            throw cslt::system_error(text);
+        }
+// --------------------------------------------------------------------------------
+
+        int open_for_reading(const char* path) noexcept {
+#if defined(_WIN32)
+            return ::_open(path, _O_RDONLY | _O_BINARY | _O_SEQUENTIAL);
+#else
+            const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    #if defined(POSIX_FADV_SEQUENTIAL)
+            if (fd >= 0)
+                ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    #endif
+            return fd;
+#endif
+        }
+// --------------------------------------------------------------------------------
+
+        // Reads until dest is full or the file ends, returning the count or -1
+        long long read_fully(int fd, char* dest, cslt::size_t num) noexcept {
+            cslt::size_t got = 0;
+            while (got < num) {
+#if defined(_WIN32)
+                const cslt::size_t left = num - got;
+                const int count = ::_read(fd, dest + got, left > 0x40000000u ? 0x40000000u : static_cast<unsigned>(left));
+#else
+                const ssize_t count = ::read(fd, dest + got, num - got);
+#endif
+                if (count < 0) {
+                    if (errno == EINTR)
+                        continue;
+                    return -1;
+                }
+                if (count == 0)
+                    break;
+                got += static_cast<cslt::size_t>(count);
+            }
+            return static_cast<long long>(got);
+        }
+    }
+// --------------------------------------------------------------------------------
+
+    void prefetch_filebuf::read_ahead() noexcept {
+        const cslt::size_t count = ring.size();
+        cslt::size_t tail = 0;
+        for (;;) {
+            {
+                // The blocks in use run from head, so tail is free once fewer
+                // than count are held or waiting
+                std::unique_lock<std::mutex> guard(lock);
+                freed.wait(guard, [this, count] {return stopping || ready + (held ? 1u : 0u) < count;});
+                if (stopping)
+                    break;
+            }
+            block& slot = ring.data()[tail];
+            const long long got = read_fully(fd, slot.data.data(), block_bytes);
+            const int code = got < 0 ? errno : 0;
+            bool done;
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                slot.size = got > 0 ? static_cast<cslt::size_t>(got) : 0;
+                if (slot.size != 0)
+                    ++ready;
+                failure = code;
+                // Only the end of the file or an error leaves a block short
+                done = static_cast<cslt::size_t>(got) != block_bytes;
+                finished = done;
+            }
+            filled.notify_one();
+            if (done)
+                return;
+            tail = (tail + 1) % count;
+        }
+        std::lock_guard<std::mutex> guard(lock);
+        finished = true;
+    }
+// ================================================================================
+// ================================================================================
+// CONSTRUCTORS
+
+    prefetch_filebuf::prefetch_filebuf(const char* path, cslt::size_t block_size, cslt::size_t depth) {
+        open(path, block_size, depth);
+    }
+// --------------------------------------------------------------------------------
+
+    prefetch_filebuf::~prefetch_filebuf() {
+        close();
+    }
+// ================================================================================
+// ================================================================================
+// PUBLIC FUNCTIONS
+
+    void prefetch_filebuf::open(const char* path, cslt::size_t block_size, cslt::size_t depth) {
+        close();
+        block_bytes = block_size != 0 ? block_size : 1;
+        ring = array_ptr<block>(depth > 2 ? depth : 2);
+        for (block& slot : ring)
+            slot.data = array_ptr<char>(block_bytes);
+        fd = open_for_reading(path);
+        if (fd < 0) {
+            const int code = errno;
+            ring = array_ptr<block>();
+            throw_error("Unable to open", path, code);
+        }
+        try {
+            worker = std::thread(&prefetch_filebuf::read_ahead, this);
+        } catch (...) {
+            close();
+            throw;
+        }
+    }
+// --------------------------------------------------------------------------------
+
+    void prefetch_filebuf::close() noexcept {
+        if (worker.joinable()) {
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                stopping = true;
+            }
+            freed.notify_one();
+            worker.join();
+        }
+        if (fd >= 0) {
+#if defined(_WIN32)
+            ::_close(fd);
+#else
+            ::close(fd);
+#endif
+            fd = -1;
+        }
+        ring = array_ptr<block>();
+        head = ready = 0;
+        held = finished = stopping = false;
+        failure = 0;
+        setg(nullptr, nullptr, nullptr);
+    }
+// --------------------------------------------------------------------------------
+
+    span<const char> prefetch_filebuf::next_block() {
+        if (gptr() != egptr()) {
+            const span<const char> rest(gptr(), static_cast<cslt::size_t>(egptr() - gptr()));
+            setg(eback(), egptr(), egptr());
+            return rest;
+        }
+        if (ring.size() == 0)
+            return span<const char>();
+        std::unique_lock<std::mutex> guard(lock);
+        if (held) {
+            held = false;
+            head = (head + 1) % ring.size();
+            freed.notify_one();
+        }
+        filled.wait(guard, [this] {return ready != 0 || finished;});
+        if (ready == 0) {
+            if (failure != 0)
+                throw_error("Unable to read", "the prefetched file", failure);
+            return span<const char>();
+        }
+        --ready;
+        held = true;
+        const block& slot = ring.data()[head];
+        return span<const char>(slot.data.data(), slot.size);
+    }
+// --------------------------------------------------------------------------------
+
+    prefetch_filebuf::int_type prefetch_filebuf::underflow() {
+        if (gptr() != egptr())
+            return traits_type::to_int_type(*gptr());
+        // Mostly the wait for the reader thread when it falls behind
+        CSLT_PROFILE_SCOPE("prefetch_filebuf.underflow");
+        const span<const char> next = next_block();
+        if (next.empty())
+            return traits_type::eof();
+        // The block is never written; the get area only needs char*
+        char* start = const_cast<char*>(next.data());
+        setg(start, start, start + next.size());
+        return traits_type::to_int_type(*start);
+    }
+// --------------------------------------------------------------------------------
+
+    std::streamsize prefetch_filebuf::showmanyc() {
+        if (gptr() != egptr())
+            return egptr() - gptr();
+        std::lock_guard<std::mutex> guard(lock);
+        if (ready != 0)
+            return static_cast<std::streamsize>(ring.data()[(head + (held ? 1 : 0)) % ring.size()].size);
+        return finished || ring.size() == 0 ? -1 : 0;
+    }
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+// eof
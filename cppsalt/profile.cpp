@@ -0,0 +1,452 @@
+// ================================================================================
+// ================================================================================
+// - File:    profile.cpp
+// - Purpose: Probe registration, thread local latency histograms and the
+//            reports built from them
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "include/profile.hpp"
+#include "include/fast_ostream.hpp"
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+
+namespace cslt {
+namespace profile {
+
+    namespace detail {
+        // Lets the thread histograms below add their raw counts to a histogram
+        struct histogram_access {
+            static void add_bucket(histogram& h, std::size_t index, std::uint64_t num) noexcept {
+                h._counts[index] += num;
+            }
+
+            static void add_totals(histogram& h, std::uint64_t count, std::uint64_t sum,
+                                   std::uint64_t min, std::uint64_t max) noexcept {
+                h._count += count;
+                h._sum += sum;
+                if (min < h._min)
+                    h._min = min;
+                if (max > h._max)
+                    h._max = max;
+            }
+        };
+    }
+// ================================================================================
+// ================================================================================
+
+    namespace {
+        // Probe names never change once set, so a name is read without the
+        // lock.  Both arrays are constant initialized, so probes registered by
+        // the constructors of other static objects find them ready.
+        std::mutex name_lock;
+        std::atomic<const char*> names[max_probes];
+        std::atomic<std::size_t> name_count{0};
+// --------------------------------------------------------------------------------
+
+        inline unsigned highest_bit(std::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#else
+            unsigned bit = 0;
+            while (value >>= 1)
+                ++bit;
+            return bit;
+#endif
+        }
+
+        // Only the owning thread writes, so a relaxed load and store replaces
+        // a read-modify-write
+        inline void bump(std::atomic<std::uint64_t>& value, std::uint64_t num) noexcept {
+            value.store(value.load(std::memory_order_relaxed) + num, std::memory_order_relaxed);
+        }
+// --------------------------------------------------------------------------------
+
+        // One probe's histogram on one thread, readable by other threads at
+        // any time for a global snapshot
+        struct thread_probe {
+            std::atomic<std::uint64_t> counts[histogram::bucket_count];
+            std::atomic<std::uint64_t> count{0};
+            std::atomic<std::uint64_t> sum{0};
+            std::atomic<std::uint64_t> min{UINT64_MAX};
+            std::atomic<std::uint64_t> max{0};
+
+            thread_probe() noexcept {
+                for (auto& value : counts)
+                    value.store(0, std::memory_order_relaxed);
+            }
+
+            void add(std::uint64_t duration) noexcept {
+                bump(counts[histogram::bucket_of(duration)], 1);
+                bump(count, 1);
+                bump(sum, duration);
+                if (duration < min.load(std::memory_order_relaxed))
+                    min.store(duration, std::memory_order_relaxed);
+                if (duration > max.load(std::memory_order_relaxed))
+                    max.store(duration, std::memory_order_relaxed);
+            }
+
+            void read(histogram& out) const noexcept {
+                for (std::size_t i = 0; i < histogram::bucket_count; ++i) {
+                    const std::uint64_t num = counts[i].load(std::memory_order_relaxed);
+                    if (num != 0)
+                        detail::histogram_access::add_bucket(out, i, num);
+                }
+                detail::histogram_access::add_totals(out, count.load(std::memory_order_relaxed),
+                                                     sum.load(std::memory_order_relaxed),
+                                                     min.load(std::memory_order_relaxed),
+                                                     max.load(std::memory_order_relaxed));
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        // The histograms of one thread, each allocated at its probe's first sample
+        struct thread_probes {
+            std::atomic<thread_probe*> probes[max_probes];
+            thread_probes* prev = nullptr;
+            thread_probes* next = nullptr;
+
+            thread_probes() noexcept;
+            ~thread_probes();
+
+            thread_probe* get(probe_id id) noexcept {
+                thread_probe* probe = probes[id].load(std::memory_order_relaxed);
+                if (!probe) {
+                    probe = new (std::nothrow) thread_probe;
+                    probes[id].store(probe, std::memory_order_release);
+                }
+                return probe;
+            }
+
+            void read(snapshot& out) const noexcept {
+                for (std::size_t i = 0; i < out.size(); ++i)
+                    if (const thread_probe* probe = probes[i].load(std::memory_order_acquire))
+                        probe->read(out[static_cast<probe_id>(i)]);
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        // The live threads, the histograms of threads that have exited, and
+        // the clock readings the time stamp counter is calibrated from
+        struct registry {
+            std::mutex lock;
+            thread_probes* head = nullptr;
+            cslt::unique_ptr<histogram> retired[max_probes];
+            const std::uint64_t start_ticks = ticks();
+            const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        };
+
+        registry& get_registry() noexcept {
+            static registry instance;
+            return instance;
+        }
+// --------------------------------------------------------------------------------
+
+        thread_probes::thread_probes() noexcept {
+            for (auto& probe : probes)
+                probe.store(nullptr, std::memory_order_relaxed);
+            registry& reg = get_registry();
+            std::lock_guard<std::mutex> guard(reg.lock);
+            next = reg.head;
+            if (next)
+                next->prev = this;
+            reg.head = this;
+        }
+
+        thread_probes::~thread_probes() {
+            registry& reg = get_registry();
+            std::lock_guard<std::mutex> guard(reg.lock);
+            for (std::size_t i = 0; i < max_probes; ++i) {
+                thread_probe* probe = probes[i].load(std::memory_order_relaxed);
+                if (!probe)
+                    continue;
+                if (!reg.retired[i])
+                    reg.retired[i].reset(new (std::nothrow) histogram);
+                if (reg.retired[i])
+                    probe->read(*reg.retired[i]);
+                delete probe;
+            }
+            if (prev)
+                prev->next = next;
+            else
+                reg.head = next;
+            if (next)
+                next->prev = prev;
+        }
+// --------------------------------------------------------------------------------
+
+        thread_probes& local() noexcept {
+            thread_local thread_probes instance;
+            return instance;
+        }
+// ================================================================================
+// ================================================================================
+// REPORT HELPERS
+
+        void write_ns(fast_ostream& out, double ticks_value, double scale) {
+            out << fixed(ticks_value * scale, 1);
+        }
+
+        void write_json_string(fast_ostream& out, const char* str) {
+            static const char digits[] = "0123456789abcdef";
+            out.put('"');
+            for (; *str; ++str) {
+                const unsigned char chr = static_cast<unsigned char>(*str);
+                if (chr == '"' || chr == '\\') {
+                    out.put('\\').put(static_cast<char>(chr));
+                }
+                else if (chr < 0x20) {
+                    const char escape[] = {'\\', 'u', '0', '0', digits[chr >> 4], digits[chr & 15]};
+                    out.write(escape, sizeof(escape));
+                }
+                else {
+                    out.put(static_cast<char>(chr));
+                }
+            }
+            out.put('"');
+        }
+    } /* end of anonymous namespace */
+// ================================================================================
+// ================================================================================
+// PROBES
+
+    probe_id register_probe(const char* name) noexcept {
+        if (!name)
+            return no_probe;
+        std::lock_guard<std::mutex> guard(name_lock);
+        const std::size_t num = name_count.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < num; ++i)
+            if (std::strcmp(names[i].load(std::memory_order_relaxed), name) == 0)
+                return static_cast<probe_id>(i);
+        if (num == max_probes)
+            return no_probe;
+        // Starts the calibration clock with the first probe
+        get_registry();
+        names[num].store(name, std::memory_order_relaxed);
+        name_count.store(num + 1, std::memory_order_release);
+        return static_cast<probe_id>(num);
+    }
+// --------------------------------------------------------------------------------
+
+    const char* probe_name(probe_id id) noexcept {
+        if (id >= name_count.load(std::memory_order_acquire))
+            return "unknown";
+        return names[id].load(std::memory_order_relaxed);
+    }
+// --------------------------------------------------------------------------------
+
+    std::size_t probe_count() noexcept {
+        return name_count.load(std::memory_order_acquire);
+    }
+// ================================================================================
+// ================================================================================
+// TIMING
+
+    double ns_per_tick() noexcept {
+#if CSLT_PROFILE_TSC
+        using std::chrono::steady_clock;
+        const registry& reg = get_registry();
+        // Below a millisecond the reading of steady_clock is too coarse
+        // against the counter
+        steady_clock::time_point now = steady_clock::now();
+        while (now - reg.start_time < std::chrono::milliseconds(1)) {
+            std::this_thread::yield();
+            now = steady_clock::now();
+        }
+        const std::uint64_t elapsed_ticks = ticks() - reg.start_ticks;
+        const double elapsed_ns = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now - reg.start_time).count());
+        return elapsed_ticks == 0 ? 1.0 : elapsed_ns / static_cast<double>(elapsed_ticks);
+#else
+        using period = std::chrono::steady_clock::period;
+        return 1e9 * static_cast<double>(period::num) / static_cast<double>(period::den);
+#endif
+    }
+// --------------------------------------------------------------------------------
+
+    void record(probe_id id, std::uint64_t duration) noexcept {
+        if (!enabled || id >= max_probes)
+            return;
+        if (thread_probe* probe = local().get(id))
+            probe->add(duration);
+    }
+// ================================================================================
+// ================================================================================
+// HISTOGRAM
+
+    std::size_t histogram::bucket_of(std::uint64_t value) noexcept {
+        if (value < 32)
+            return static_cast<std::size_t>(value);
+        const unsigned bit = highest_bit(value);
+        const std::uint64_t top = value >> (bit - 4);
+        return 32 + (bit - 5) * 16 + static_cast<std::size_t>(top - 16);
+    }
+// --------------------------------------------------------------------------------
+
+    std::uint64_t histogram::bucket_limit(std::size_t index) noexcept {
+        if (index < 32)
+            return index;
+        const std::size_t offset = index - 32;
+        const unsigned shift = static_cast<unsigned>(offset / 16) + 1;
+        const std::uint64_t low = static_cast<std::uint64_t>(16 + offset % 16) << shift;
+        return low + ((std::uint64_t(1) << shift) - 1);
+    }
+// --------------------------------------------------------------------------------
+
+    void histogram::record(std::uint64_t value, std::uint64_t num) noexcept {
+        if (num == 0)
+            return;
+        _counts[bucket_of(value)] += num;
+        _count += num;
+        _sum += value * num;
+        if (value < _min)
+            _min = value;
+        if (value > _max)
+            _max = value;
+    }
+// --------------------------------------------------------------------------------
+
+    histogram& histogram::operator+=(const histogram& other) noexcept {
+        for (std::size_t i = 0; i < bucket_count; ++i)
+            _counts[i] += other._counts[i];
+        _count += other._count;
+        _sum += other._sum;
+        if (other._min < _min)
+            _min = other._min;
+        if (other._max > _max)
+            _max = other._max;
+        return *this;
+    }
+// --------------------------------------------------------------------------------
+
+    std::uint64_t histogram::percentile(double pct) const noexcept {
+        // The bucket totals are used rather than _count, which a snapshot of
+        // a running thread may read at a different moment
+        std::uint64_t total = 0;
+        for (std::uint64_t num : _counts)
+            total += num;
+        if (total == 0)
+            return 0;
+        if (pct < 0.0)
+            pct = 0.0;
+        const double wanted = pct >= 100.0 ? static_cast<double>(total)
+                                           : pct / 100.0 * static_cast<double>(total);
+        std::uint64_t rank = static_cast<std::uint64_t>(wanted);
+        if (static_cast<double>(rank) < wanted || rank == 0)
+            ++rank;
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < bucket_count; ++i) {
+            seen += _counts[i];
+            if (seen >= rank) {
+                const std::uint64_t limit = bucket_limit(i);
+                return limit < _max ? limit : _max;
+            }
+        }
+        return _max;
+    }
+// ================================================================================
+// ================================================================================
+// SNAPSHOTS
+
+    snapshot::snapshot(std::size_t num, double ns_per_tick)
+        : _probes(num), _size(num), _ns_per_tick(ns_per_tick) {}
+// --------------------------------------------------------------------------------
+
+    snapshot thread_snapshot() {
+        if (!enabled)
+            return snapshot();
+        snapshot result(probe_count(), ns_per_tick());
+        local().read(result);
+        return result;
+    }
+// --------------------------------------------------------------------------------
+
+    snapshot global_snapshot() {
+        if (!enabled)
+            return snapshot();
+        snapshot result(probe_count(), ns_per_tick());
+        registry& reg = get_registry();
+        std::lock_guard<std::mutex> guard(reg.lock);
+        for (std::size_t i = 0; i < result.size(); ++i)
+            if (reg.retired[i])
+                result[static_cast<probe_id>(i)] += *reg.retired[i];
+        for (const thread_probes* tp = reg.head; tp; tp = tp->next)
+            tp->read(result);
+        return result;
+    }
+// ================================================================================
+// ================================================================================
+// REPORTS
+
+    void write_text(fast_ostream& out, const snapshot& snap) {
+        const double scale = snap.ns_per_tick();
+        for (std::size_t i = 0; i < snap.size(); ++i) {
+            const probe_id id = static_cast<probe_id>(i);
+            const histogram& h = snap[id];
+            if (h.count() == 0)
+                continue;
+            out << snap.name(id) << ": count=" << h.count() << " mean=";
+            write_ns(out, h.mean(), scale);
+            out << "ns p50=";
+            write_ns(out, static_cast<double>(h.percentile(50.0)), scale);
+            out << "ns p99=";
+            write_ns(out, static_cast<double>(h.percentile(99.0)), scale);
+            out << "ns p999=";
+            write_ns(out, static_cast<double>(h.percentile(99.9)), scale);
+            out << "ns max=";
+            write_ns(out, static_cast<double>(h.max()), scale);
+            out << "ns\n";
+        }
+    }
+// --------------------------------------------------------------------------------
+
+    void write_json(fast_ostream& out, const snapshot& snap) {
+        const double scale = snap.ns_per_tick();
+        struct field {
+            const char* key;
+            double pct;
+        };
+        static const field percentiles[] = {
+            {",\"p50\":", 50.0}, {",\"p90\":", 90.0}, {",\"p99\":", 99.0}, {",\"p999\":", 99.9}
+        };
+
+        out << "{\"unit\":\"ns\",\"probes\":[";
+        bool first = true;
+        for (std::size_t i = 0; i < snap.size(); ++i) {
+            const probe_id id = static_cast<probe_id>(i);
+            const histogram& h = snap[id];
+            if (h.count() == 0)
+                continue;
+            out << (first ? "{\"name\":" : ",{\"name\":");
+            first = false;
+            write_json_string(out, snap.name(id));
+            out << ",\"count\":" << h.count() << ",\"min\":";
+            write_ns(out, static_cast<double>(h.min()), scale);
+            out << ",\"mean\":";
+            write_ns(out, h.mean(), scale);
+            for (const field& f : percentiles) {
+                out << f.key;
+                write_ns(out, static_cast<double>(h.percentile(f.pct)), scale);
+            }
+            out << ",\"max\":";
+            write_ns(out, static_cast<double>(h.max()), scale);
+            out.put('}');
+        }
+        out << "]}\n";
+    }
+
+} /* end of profile namespace */
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,97 @@
+// ================================================================================
+// ================================================================================
+// - File:    serialize.cpp
+// - Purpose: The header handling and bounds checks of serial_writer and serial_reader
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "include/serialize.hpp"
+
+namespace cslt {
+
+    namespace {
+        const char serial_tag[4] = {'C', 'S', 'L', 'T'};
+        const char zero_block[64] = {};
+    }
+// ================================================================================
+// ================================================================================
+// SERIAL_WRITER
+
+    serial_writer::serial_writer(std::uint32_t schema_version) {
+        _buf.reserve(256);
+        write_bytes(serial_tag, sizeof(serial_tag));
+        write_scalar(serial_layout_version);
+        write_scalar(schema_version);
+        write_scalar(std::uint32_t(0));
+    }
+// --------------------------------------------------------------------------------
+
+    void serial_writer::write_zeros(cslt::size_t num) {
+        while (num > sizeof(zero_block)) {
+            write_bytes(zero_block, sizeof(zero_block));
+            num -= sizeof(zero_block);
+        }
+        write_bytes(zero_block, num);
+    }
+// --------------------------------------------------------------------------------
+
+    void serial_writer::align(cslt::size_t alignment) {
+        const cslt::size_t pad = (alignment - _buf.size() % alignment) % alignment;
+        write_bytes(zero_block, pad);
+    }
+// ================================================================================
+// ================================================================================
+// SERIAL_READER
+
+    void serial_reader::truncated() {
+        throw cslt::format_error(CSLT_LITERAL("serialized data is truncated"));
+    }
+// --------------------------------------------------------------------------------
+
+    serial_reader::serial_reader(span<const char> bytes) : _data(bytes.data()), _size(bytes.size()) {
+        if (reinterpret_cast<std::uintptr_t>(_data) % 8 != 0)
+            throw cslt::format_error(CSLT_LITERAL("serialized data must be aligned to 8 bytes"));
+        if (std::memcmp(take(serial_header_size), serial_tag, sizeof(serial_tag)) != 0)
+            throw cslt::format_error(CSLT_LITERAL("data does not start with a cslt serial header"));
+        _pos = sizeof(serial_tag);
+        if (read_scalar<std::uint32_t>() != serial_layout_version)
+            throw cslt::format_error(CSLT_LITERAL("unsupported serial layout version"));
+        _schema = read_scalar<std::uint32_t>();
+        _pos = serial_header_size;
+    }
+// --------------------------------------------------------------------------------
+
+    void serial_reader::expect_schema(std::uint32_t schema_version) const {
+        if (_schema != schema_version)
+            throw cslt::format_error(CSLT_LITERAL("serialized schema version does not match"));
+    }
+// --------------------------------------------------------------------------------
+
+    void serial_reader::expect_end() const {
+        if (_pos != _size)
+            throw cslt::format_error(CSLT_LITERAL("serialized data has trailing bytes"));
+    }
+// --------------------------------------------------------------------------------
+
+    void serial_reader::seek(cslt::size_t offset) {
+        if (offset > _size)
+            truncated();
+        _pos = offset;
+    }
+// --------------------------------------------------------------------------------
+
+    void serial_reader::align(cslt::size_t alignment) {
+        const cslt::size_t pad = (alignment - _pos % alignment) % alignment;
+        take(pad);
+    }
+}
+// ================================================================================
+// ================================================================================
+// eof
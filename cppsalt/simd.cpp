@@ -0,0 +1,1191 @@
+// ================================================================================
+// ================================================================================
+// - File:    simd.cpp
+// - Purpose: Scalar, SSE2, AVX2, AVX-512 and NEON numeric kernels and the table
+//            that selects between them
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "include/simd.hpp"
+#include "include/config.hpp"
+#include "include/except.hpp"
+#include <atomic>
+
+#if CSLT_SIMD_SSE2
+    #include <emmintrin.h>
+    // The AVX2 and AVX-512 kernels are compiled with a target attribute rather
+    // than a global flag and only run once the processor reports support, which
+    // needs the GCC and Clang builtins
+    #if defined(__GNUC__) || defined(__clang__)
+        #include <immintrin.h>
+        #define CSLT_X86_DISPATCH 1
+        #define CSLT_TARGET(isa) __attribute__((target(isa)))
+        #define CSLT_FLATTEN __attribute__((flatten))
+    #endif
+#elif CSLT_SIMD_NEON && defined(__aarch64__)
+    // The reductions across lanes used below exist only on 64 bit ARM
+    #include <arm_neon.h>
+    #define CSLT_NEON64 1
+#endif
+
+#ifndef CSLT_X86_DISPATCH
+    #define CSLT_X86_DISPATCH 0
+#endif
+#ifndef CSLT_NEON64
+    #define CSLT_NEON64 0
+#endif
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+namespace simd {
+
+    namespace {
+        static_assert(sizeof(int) == 4, "the int kernels assume a 32 bit int");
+
+        // Counts the set bits of a comparison mask.  Without the popcnt
+        // instruction the builtin becomes a library call, which costs more
+        // than the comparison, so the bits are added in place instead.
+        inline unsigned popcount(unsigned mask) noexcept {
+#if defined(__POPCNT__)
+            return static_cast<unsigned>(__builtin_popcount(mask));
+#else
+            mask = mask - ((mask >> 1) & 0x55555555u);
+            mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+            mask = (mask + (mask >> 4)) & 0x0F0F0F0Fu;
+            return (mask * 0x01010101u) >> 24;
+#endif
+        }
+
+        template <compare Op, typename T>
+        inline bool holds(T lhs, T rhs) noexcept {
+            switch (Op) {
+                case compare::equal: return lhs == rhs;
+                case compare::not_equal: return lhs != rhs;
+                case compare::less: return lhs < rhs;
+                case compare::less_equal: return lhs <= rhs;
+                case compare::greater: return lhs > rhs;
+                case compare::greater_equal: return lhs >= rhs;
+            }
+            return false;
+        }
+// ================================================================================
+// ================================================================================
+// OPERATION SETS
+//
+// Each instruction set provides, per element type, a register type, its width
+// in elements and the operations below.  Registers are passed by reference so
+// that the generic kernels, which carry no target attribute, never pass a
+// vector by value; an AVX register passed by value to a function compiled
+// without AVX changes the calling convention.  Built with optimization the
+// flattened entry points inline everything and the references disappear.
+
+        // int arithmetic wraps as unsigned arithmetic does
+        template <typename T>
+        struct arith {
+            static T add(T a, T b) noexcept {return a + b;}
+            static T sub(T a, T b) noexcept {return a - b;}
+            static T mul(T a, T b) noexcept {return a * b;}
+        };
+
+        template <>
+        struct arith<int> {
+            static int add(int a, int b) noexcept {
+                return static_cast<int>(static_cast<unsigned>(a) + static_cast<unsigned>(b));
+            }
+            static int sub(int a, int b) noexcept {
+                return static_cast<int>(static_cast<unsigned>(a) - static_cast<unsigned>(b));
+            }
+            static int mul(int a, int b) noexcept {
+                return static_cast<int>(static_cast<unsigned>(a) * static_cast<unsigned>(b));
+            }
+        };
+// --------------------------------------------------------------------------------
+// One element per register, used by the scalar table and for the tails of the
+// vector kernels
+
+        template <typename T>
+        struct scalar_ops {
+            using value_type = T;
+            using reg = T;
+            static constexpr cslt::size_t width = 1;
+
+            static void load(reg& r, const T* p) noexcept {r = *p;}
+            static void store(T* p, const reg& r) noexcept {*p = r;}
+            static void set1(reg& r, T value) noexcept {r = value;}
+            static void add(reg& a, const reg& b) noexcept {a = arith<T>::add(a, b);}
+            static void sub(reg& a, const reg& b) noexcept {a = arith<T>::sub(a, b);}
+            static void mul(reg& a, const reg& b) noexcept {a = arith<T>::mul(a, b);}
+            static void fma(reg& acc, const reg& a, const reg& b) noexcept {
+                acc = arith<T>::add(arith<T>::mul(a, b), acc);
+            }
+            static void min(reg& a, const reg& b) noexcept {if (b < a) a = b;}
+            static void max(reg& a, const reg& b) noexcept {if (a < b) a = b;}
+
+            template <compare Op>
+            static unsigned count(const reg& a, const reg& b) noexcept {return holds<Op>(a, b) ? 1u : 0u;}
+        };
+// --------------------------------------------------------------------------------
+// Folds applied both to registers and, through scalar_ops, to single elements
+
+        template <typename Ops>
+        struct fold_add {
+            static void apply(typename Ops::reg& a, const typename Ops::reg& b) noexcept {Ops::add(a, b);}
+        };
+
+        template <typename Ops>
+        struct fold_sub {
+            static void apply(typename Ops::reg& a, const typename Ops::reg& b) noexcept {Ops::sub(a, b);}
+        };
+
+        template <typename Ops>
+        struct fold_mul {
+            static void apply(typename Ops::reg& a, const typename Ops::reg& b) noexcept {Ops::mul(a, b);}
+        };
+
+        template <typename Ops>
+        struct fold_min {
+            static void apply(typename Ops::reg& a, const typename Ops::reg& b) noexcept {Ops::min(a, b);}
+        };
+
+        template <typename Ops>
+        struct fold_max {
+            static void apply(typename Ops::reg& a, const typename Ops::reg& b) noexcept {Ops::max(a, b);}
+        };
+// ================================================================================
+// ================================================================================
+// GENERIC KERNELS
+//
+// Written once against an operation set V.  The reductions keep four
+// registers of partial results to hide the latency of each add, then fold
+// the lanes in order, then the elements past the last full register.
+
+        template <typename V>
+        struct kernels {
+            using value_type = typename V::value_type;
+            using T = value_type;
+            using reg = typename V::reg;
+            using S = scalar_ops<T>;
+            static constexpr cslt::size_t W = V::width;
+
+            template <template <typename> class Fold>
+            static T reduce(const T* x, cslt::size_t num, T init) noexcept {
+                reg a0, a1, a2, a3, v;
+                V::set1(a0, init);
+                V::set1(a1, init);
+                V::set1(a2, init);
+                V::set1(a3, init);
+                cslt::size_t i = 0;
+                for (; i + 4 * W <= num; i += 4 * W) {
+                    V::load(v, x + i);
+                    Fold<V>::apply(a0, v);
+                    V::load(v, x + i + W);
+                    Fold<V>::apply(a1, v);
+                    V::load(v, x + i + 2 * W);
+                    Fold<V>::apply(a2, v);
+                    V::load(v, x + i + 3 * W);
+                    Fold<V>::apply(a3, v);
+                }
+                for (; i + W <= num; i += W) {
+                    V::load(v, x + i);
+                    Fold<V>::apply(a0, v);
+                }
+                Fold<V>::apply(a0, a1);
+                Fold<V>::apply(a2, a3);
+                Fold<V>::apply(a0, a2);
+
+                T lanes[W];
+                V::store(lanes, a0);
+                T total = lanes[0];
+                for (cslt::size_t k = 1; k < W; ++k)
+                    Fold<S>::apply(total, lanes[k]);
+                for (; i < num; ++i)
+                    Fold<S>::apply(total, x[i]);
+                return total;
+            }
+// --------------------------------------------------------------------------------
+
+            static T sum(const T* x, cslt::size_t num) noexcept {
+                return reduce<fold_add>(x, num, T(0));
+            }
+
+            // num is at least one
+            static T min(const T* x, cslt::size_t num) noexcept {
+                return reduce<fold_min>(x, num, x[0]);
+            }
+
+            static T max(const T* x, cslt::size_t num) noexcept {
+                return reduce<fold_max>(x, num, x[0]);
+            }
+// --------------------------------------------------------------------------------
+
+            static T dot(const T* x, const T* y, cslt::size_t num) noexcept {
+                reg a0, a1, a2, a3, u, v;
+                V::set1(a0, T(0));
+                V::set1(a1, T(0));
+                V::set1(a2, T(0));
+                V::set1(a3, T(0));
+                cslt::size_t i = 0;
+                for (; i + 4 * W <= num; i += 4 * W) {
+                    V::load(u, x + i);
+                    V::load(v, y + i);
+                    V::fma(a0, u, v);
+                    V::load(u, x + i + W);
+                    V::load(v, y + i + W);
+                    V::fma(a1, u, v);
+                    V::load(u, x + i + 2 * W);
+                    V::load(v, y + i + 2 * W);
+                    V::fma(a2, u, v);
+                    V::load(u, x + i + 3 * W);
+                    V::load(v, y + i + 3 * W);
+                    V::fma(a3, u, v);
+                }
+                for (; i + W <= num; i += W) {
+                    V::load(u, x + i);
+                    V::load(v, y + i);
+                    V::fma(a0, u, v);
+                }
+                V::add(a0, a1);
+                V::add(a2, a3);
+                V::add(a0, a2);
+
+                T lanes[W];
+                V::store(lanes, a0);
+                T total = lanes[0];
+                for (cslt::size_t k = 1; k < W; ++k)
+                    S::add(total, lanes[k]);
+                for (; i < num; ++i)
+                    S::fma(total, x[i], y[i]);
+                return total;
+            }
+// --------------------------------------------------------------------------------
+
+            template <compare Op>
+            static cslt::size_t count(const T* x, cslt::size_t num, T value) noexcept {
+                reg target, v;
+                V::set1(target, value);
+                cslt::size_t total = 0;
+                cslt::size_t i = 0;
+                for (; i + W <= num; i += W) {
+                    V::load(v, x + i);
+                    total += V::template count<Op>(v, target);
+                }
+                for (; i < num; ++i)
+                    total += S::template count<Op>(x[i], value);
+                return total;
+            }
+
+            static cslt::size_t count_if(const T* x, cslt::size_t num, compare op, T value) noexcept {
+                switch (op) {
+                    case compare::equal: return count<compare::equal>(x, num, value);
+                    case compare::not_equal: return count<compare::not_equal>(x, num, value);
+                    case compare::less: return count<compare::less>(x, num, value);
+                    case compare::less_equal: return count<compare::less_equal>(x, num, value);
+                    case compare::greater: return count<compare::greater>(x, num, value);
+                    case compare::greater_equal: return count<compare::greater_equal>(x, num, value);
+                }
+                return 0;
+            }
+// --------------------------------------------------------------------------------
+
+            static void axpy(T a, const T* x, T* y, cslt::size_t num) noexcept {
+                reg scale, u, v;
+                V::set1(scale, a);
+                cslt::size_t i = 0;
+                for (; i + W <= num; i += W) {
+                    V::load(u, x + i);
+                    V::load(v, y + i);
+                    V::fma(v, scale, u);
+                    V::store(y + i, v);
+                }
+                for (; i < num; ++i)
+                    S::fma(y[i], a, x[i]);
+            }
+
+            static void fill(T* y, cslt::size_t num, T value) noexcept {
+                reg v;
+                V::set1(v, value);
+                cslt::size_t i = 0;
+                for (; i + W <= num; i += W)
+                    V::store(y + i, v);
+                for (; i < num; ++i)
+                    y[i] = value;
+            }
+// --------------------------------------------------------------------------------
+
+            template <template <typename> class Op>
+            static void elementwise(const T* x, const T* y, T* out, cslt::size_t num) noexcept {
+                reg u, v;
+                cslt::size_t i = 0;
+                for (; i + W <= num; i += W) {
+                    V::load(u, x + i);
+                    V::load(v, y + i);
+                    Op<V>::apply(u, v);
+                    V::store(out + i, u);
+                }
+                for (; i < num; ++i) {
+                    T value = x[i];
+                    Op<S>::apply(value, y[i]);
+                    out[i] = value;
+                }
+            }
+
+            static void add(const T* x, const T* y, T* out, cslt::size_t num) noexcept {
+                elementwise<fold_add>(x, y, out, num);
+            }
+
+            static void sub(const T* x, const T* y, T* out, cslt::size_t num) noexcept {
+                elementwise<fold_sub>(x, y, out, num);
+            }
+
+            static void mul(const T* x, const T* y, T* out, cslt::size_t num) noexcept {
+                elementwise<fold_mul>(x, y, out, num);
+            }
+        };
+// ================================================================================
+// ================================================================================
+// KERNEL TABLES
+
+        template <typename T>
+        struct kernel_table {
+            T (*sum)(const T*, cslt::size_t);
+            T (*dot)(const T*, const T*, cslt::size_t);
+            T (*min)(const T*, cslt::size_t);
+            T (*max)(const T*, cslt::size_t);
+            cslt::size_t (*count_if)(const T*, cslt::size_t, compare, T);
+            void (*axpy)(T, const T*, T*, cslt::size_t);
+            void (*fill)(T*, cslt::size_t, T);
+            void (*add)(const T*, const T*, T*, cslt::size_t);
+            void (*sub)(const T*, const T*, T*, cslt::size_t);
+            void (*mul)(const T*, const T*, T*, cslt::size_t);
+        };
+
+        struct kernel_set {
+            kernel kind;
+            kernel_table<float> f32;
+            kernel_table<double> f64;
+            kernel_table<int> i32;
+        };
+
+        template <typename K>
+        constexpr kernel_table<typename K::value_type> table_of() noexcept {
+            return {K::sum, K::dot, K::min, K::max, K::count_if,
+                    K::axpy, K::fill, K::add, K::sub, K::mul};
+        }
+
+        template <template <typename> class K>
+        constexpr kernel_set set_of(kernel kind) noexcept {
+            return {kind, table_of<K<float>>(), table_of<K<double>>(), table_of<K<int>>()};
+        }
+// --------------------------------------------------------------------------------
+
+        template <typename T>
+        using scalar_kernels = kernels<scalar_ops<T>>;
+
+        constexpr kernel_set scalar_set = set_of<scalar_kernels>(kernel::scalar);
+// ================================================================================
+// ================================================================================
+// SSE2 OPERATIONS, 16 bytes per register
+
+#if CSLT_SIMD_SSE2
+        template <typename T>
+        struct sse2_ops;
+
+        template <>
+        struct sse2_ops<float> {
+            using value_type = float;
+            using reg = __m128;
+            static constexpr cslt::size_t width = 4;
+
+            static void load(reg& r, const float* p) noexcept {r = _mm_loadu_ps(p);}
+            static void store(float* p, const reg& r) noexcept {_mm_storeu_ps(p, r);}
+            static void set1(reg& r, float value) noexcept {r = _mm_set1_ps(value);}
+            static void add(reg& a, const reg& b) noexcept {a = _mm_add_ps(a, b);}
+            static void sub(reg& a, const reg& b) noexcept {a = _mm_sub_ps(a, b);}
+            static void mul(reg& a, const reg& b) noexcept {a = _mm_mul_ps(a, b);}
+            static void fma(reg& acc, const reg& a, const reg& b) noexcept {acc = _mm_add_ps(_mm_mul_ps(a, b), acc);}
+            static void min(reg& a, const reg& b) noexcept {a = _mm_min_ps(a, b);}
+            static void max(reg& a, const reg& b) noexcept {a = _mm_max_ps(a, b);}
+
+            template <compare Op>
+            static __m128 cmp(const reg& a, const reg& b) noexcept {
+                switch (Op) {
+                    case compare::equal: return _mm_cmpeq_ps(a, b);
+                    case compare::not_equal: return _mm_cmpneq_ps(a, b);
+                    case compare::less: return _mm_cmplt_ps(a, b);
+                    case compare::less_equal: return _mm_cmple_ps(a, b);
+                    case compare::greater: return _mm_cmpgt_ps(a, b);
+                    case compare::greater_equal: return _mm_cmpge_ps(a, b);
+                }
+                return _mm_setzero_ps();
+            }
+
+            template <compare Op>
+            static unsigned count(const reg& a, const reg& b) noexcept {
+                return popcount(static_cast<unsigned>(_mm_movemask_ps(cmp<Op>(a, b))));
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <>
+        struct sse2_ops<double> {
+            using value_type = double;
+            using reg = __m128d;
+            static constexpr cslt::size_t width = 2;
+
+            static void load(reg& r, const double* p) noexcept {r = _mm_loadu_pd(p);}
+            static void store(double* p, const reg& r) noexcept {_mm_storeu_pd(p, r);}
+            static void set1(reg& r, double value) noexcept {r = _mm_set1_pd(value);}
+            static void add(reg& a, const reg& b) noexcept {a = _mm_add_pd(a, b);}
+            static void sub(reg& a, const reg& b) noexcept {a = _mm_sub_pd(a, b);}
+            static void mul(reg& a, const reg& b) noexcept {a = _mm_mul_pd(a, b);}
+            static void fma(reg& acc, const reg& a, const reg& b) noexcept {acc = _mm_add_pd(_mm_mul_pd(a, b), acc);}
+            static void min(reg& a, const reg& b) noexcept {a = _mm_min_pd(a, b);}
+            static void max(reg& a, const reg& b) noexcept {a = _mm_max_pd(a, b);}
+
+            template <compare Op>
+            static __m128d cmp(const reg& a, const reg& b) noexcept {
+                switch (Op) {
+                    case compare::equal: return _mm_cmpeq_pd(a, b);
+                    case compare::not_equal: return _mm_cmpneq_pd(a, b);
+                    case compare::less: return _mm_cmplt_pd(a, b);
+                    case compare::less_equal: return _mm_cmple_pd(a, b);
+                    case compare::greater: return _mm_cmpgt_pd(a, b);
+                    case compare::greater_equal: return _mm_cmpge_pd(a, b);
+                }
+                return _mm_setzero_pd();
+            }
+
+            template <compare Op>
+            static unsigned count(const reg& a, const reg& b) noexcept {
+                return popcount(static_cast<unsigned>(_mm_movemask_pd(cmp<Op>(a, b))));
+            }
+        };
+// --------------------------------------------------------------------------------
+// SSE2 has no 32 bit minimum, maximum or low multiply; they are built from
+// comparisons and from the 32 to 64 bit multiply of the even lanes
+
+        template <>
+        struct sse2_ops<int> {
+            using value_type = int;
+            using reg = __m128i;
+            static constexpr cslt::size_t width = 4;
+
+            static __m128i mullo(__m128i a, __m128i b) noexcept {
+                const __m128i even = _mm_mul_epu32(a, b);
+                const __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+                return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                          _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+            }
+
+            static __m128i select(__m128i mask, __m128i yes, __m128i no) noexcept {
+                return _mm_or_si128(_mm_and_si128(mask, yes), _mm_andnot_si128(mask, no));
+            }
+
+            static void load(reg& r, const int* p) noexcept {r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));}
+            static void store(int* p, const reg& r) noexcept {_mm_storeu_si128(reinterpret_cast<__m128i*>(p), r);}
+            static void set1(reg& r, int value) noexcept {r = _mm_set1_epi32(value);}
+            static void add(reg& a, const reg& b) noexcept {a = _mm_add_epi32(a, b);}
+            static void sub(reg& a, const reg& b) noexcept {a = _mm_sub_epi32(a, b);}
+            static void mul(reg& a, const reg& b) noexcept {a = mullo(a, b);}
+            static void fma(reg& acc, const reg& a, const reg& b) noexcept {acc = _mm_add_epi32(mullo(a, b), acc);}
+            static void min(reg& a, const reg& b) noexcept {a = select(_mm_cmpgt_epi32(a, b), b, a);}
+            static void max(reg& a, const reg& b) noexcept {a = select(_mm_cmpgt_epi32(a, b), a, b);}
+
+            static unsigned lanes(__m128i mask) noexcept {
+                return popcount(static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(mask))));
+            }
+
+            template <compare Op>
+            static unsigned count(const reg& a, const reg& b) noexcept {
+                switch (Op) {
+                    case compare::equal: return lanes(_mm_cmpeq_epi32(a, b));
+                    case compare::not_equal: return width - lanes(_mm_cmpeq_epi32(a, b));
+                    case compare::less: return lanes(_mm_cmplt_epi32(a, b));
+                    case compare::less_equal: return width - lanes(_mm_cmpgt_epi32(a, b));
+                    case compare::greater: return lanes(_mm_cmpgt_epi32(a, b));
+                    case compare::greater_equal: return width - lanes(_mm_cmplt_epi32(a, b));
+                }
+                return 0;
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <typename T>
+        using sse2_kernels = kernels<sse2_ops<T>>;
+
+        constexpr kernel_set sse2_set = set_of<sse2_kernels>(kernel::sse2);
+#endif
+// ================================================================================
+// ================================================================================
+// AVX2 OPERATIONS, 32 bytes per register
+//
+// Every function that touches a 256 or 512 bit register carries the target
+// attribute.  The entry points in the tables are also flattened, which
+// inlines the generic kernels and the operations into one function built for
+// the instruction set.
+
+#if CSLT_X86_DISPATCH
+        template <typename T>
+        struct avx2_ops;
+
+        template <>
+        struct avx2_ops<float> {
+            using value_type = float;
+            using reg = __m256;
+            static constexpr cslt::size_t width = 8;
+
+            CSLT_TARGET("avx2,fma") static void load(reg& r, const float* p) noexcept {r = _mm256_loadu_ps(p);}
+            CSLT_TARGET("avx2,fma") static void store(float* p, const reg& r) noexcept {_mm256_storeu_ps(p, r);}
+            CSLT_TARGET("avx2,fma") static void set1(reg& r, float value) noexcept {r = _mm256_set1_ps(value);}
+            CSLT_TARGET("avx2,fma") static void add(reg& a, const reg& b) noexcept {a = _mm256_add_ps(a, b);}
+            CSLT_TARGET("avx2,fma") static void sub(reg& a, const reg& b) noexcept {a = _mm256_sub_ps(a, b);}
+            CSLT_TARGET("avx2,fma") static void mul(reg& a, const reg& b) noexcept {a = _mm256_mul_ps(a, b);}
+            CSLT_TARGET("avx2,fma") static void fma(reg& acc, const reg& a, const reg& b) noexcept {acc = _mm256_fmadd_ps(a, b, acc);}
+            CSLT_TARGET("avx2,fma") static void min(reg& a, const reg& b) noexcept {a = _mm256_min_ps(a, b);}
+            CSLT_TARGET("avx2,fma") static void max(reg& a, const reg& b) noexcept {a = _mm256_max_ps(a, b);}
+
+            template <compare Op>
+            CSLT_TARGET("avx2,fma") static unsigned count(const reg& a, const reg& b) noexcept {
+                __m256 mask = _mm256_setzero_ps();
+                switch (Op) {
+                    case compare::equal: mask = _mm256_cmp_ps(a, b, _CMP_EQ_OQ); break;
+                    case compare::not_equal: mask = _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); break;
+                    case compare::less: mask = _mm256_cmp_ps(a, b, _CMP_LT_OQ); break;
+                    case compare::less_equal: mask = _mm256_cmp_ps(a, b, _CMP_LE_OQ); break;
+                    case compare::greater: mask = _mm256_cmp_ps(a, b, _CMP_GT_OQ); break;
+                    case compare::greater_equal: mask = _mm256_cmp_ps(a, b, _CMP_GE_OQ); break;
+                }
+                return popcount(static_cast<unsigned>(_mm256_movemask_ps(mask)));
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <>
+        struct avx2_ops<double> {
+            using value_type = double;
+            using reg = __m256d;
+            static constexpr cslt::size_t width = 4;
+
+            CSLT_TARGET("avx2,fma") static void load(reg& r, const double* p) noexcept {r = _mm256_loadu_pd(p);}
+            CSLT_TARGET("avx2,fma") static void store(double* p, const reg& r) noexcept {_mm256_storeu_pd(p, r);}
+            CSLT_TARGET("avx2,fma") static void set1(reg& r, double value) noexcept {r = _mm256_set1_pd(value);}
+            CSLT_TARGET("avx2,fma") static void add(reg& a, const reg& b) noexcept {a = _mm256_add_pd(a, b);}
+            CSLT_TARGET("avx2,fma") static void sub(reg& a, const reg& b) noexcept {a = _mm256_sub_pd(a, b);}
+            CSLT_TARGET("avx2,fma") static void mul(reg& a, const reg& b) noexcept {a = _mm256_mul_pd(a, b);}
+            CSLT_TARGET("avx2,fma") static void fma(reg& acc, const reg& a, const reg& b) noexcept {acc = _mm256_fmadd_pd(a, b, acc);}
+            CSLT_TARGET("avx2,fma") static void min(reg& a, const reg& b) noexcept {a = _mm256_min_pd(a, b);}
+            CSLT_TARGET("avx2,fma") static void max(reg& a, const reg& b) noexcept {a = _mm256_max_pd(a, b);}
+
+            template <compare Op>
+            CSLT_TARGET("avx2,fma") static unsigned count(const reg& a, const reg& b) noexcept {
+                __m256d mask = _mm256_setzero_pd();
+                switch (Op) {
+                    case compare::equal: mask = _mm256_cmp_pd(a, b, _CMP_EQ_OQ); break;
+                    case compare::not_equal: mask = _mm256_cmp_pd(a, b, _CMP_NEQ_UQ); break;
+                    case compare::less: mask = _mm256_cmp_pd(a, b, _CMP_LT_OQ); break;
+                    case compare::less_equal: mask = _mm256_cmp_pd(a, b, _CMP_LE_OQ); break;
+                    case compare::greater: mask = _mm256_cmp_pd(a, b, _CMP_GT_OQ); break;
+                    case compare::greater_equal: mask = _mm256_cmp_pd(a, b, _CMP_GE_OQ); break;
+                }
+                return popcount(static_cast<unsigned>(_mm256_movemask_pd(mask)));
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <>
+        struct avx2_ops<int> {
+            using value_type = int;
+            using reg = __m256i;
+            static constexpr cslt::size_t width = 8;
+
+            CSLT_TARGET("avx2,fma") static void load(reg& r, const int* p) noexcept {
+                r = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            }
+            CSLT_TARGET("avx2,fma") static void store(int* p, const reg& r) noexcept {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), r);
+            }
+            CSLT_TARGET("avx2,fma") static void set1(reg& r, int value) noexcept {r = _mm256_set1_epi32(value);}
+            CSLT_TARGET("avx2,fma") static void add(reg& a, const reg& b) noexcept {a = _mm256_add_epi32(a, b);}
+            CSLT_TARGET("avx2,fma") static void sub(reg& a, const reg& b) noexcept {a = _mm256_sub_epi32(a, b);}
+            CSLT_TARGET("avx2,fma") static void mul(reg& a, const reg& b) noexcept {a = _mm256_mullo_epi32(a, b);}
+            CSLT_TARGET("avx2,fma") static void fma(reg& acc, const reg& a, const reg& b) noexcept {
+                acc = _mm256_add_epi32(_mm256_mullo_epi32(a, b), acc);
+            }
+            CSLT_TARGET("avx2,fma") static void min(reg& a, const reg& b) noexcept {a = _mm256_min_epi32(a, b);}
+            CSLT_TARGET("avx2,fma") static void max(reg& a, const reg& b) noexcept {a = _mm256_max_epi32(a, b);}
+
+            CSLT_TARGET("avx2,fma") static unsigned lanes(__m256i mask) noexcept {
+                return popcount(static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(mask))));
+            }
+
+            template <compare Op>
+            CSLT_TARGET("avx2,fma") static unsigned count(const reg& a, const reg& b) noexcept {
+                switch (Op) {
+                    case compare::equal: return lanes(_mm256_cmpeq_epi32(a, b));
+                    case compare::not_equal: return width - lanes(_mm256_cmpeq_epi32(a, b));
+                    case compare::less: return lanes(_mm256_cmpgt_epi32(b, a));
+                    case compare::less_equal: return width - lanes(_mm256_cmpgt_epi32(a, b));
+                    case compare::greater: return lanes(_mm256_cmpgt_epi32(a, b));
+                    case compare::greater_equal: return width - lanes(_mm256_cmpgt_epi32(b, a));
+                }
+                return 0;
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <typename T>
+        struct avx2_kernels {
+            using value_type = T;
+            using K = kernels<avx2_ops<T>>;
+
+            CSLT_TARGET("avx2,fma") CSLT_FLATTEN
+            static T sum(const T* x, cslt::size_t num) noexcept {return K::sum(x, num);}
+            CSLT_TARGET("avx2,fma") CSLT_FLATTEN
+            static T dot(const T* x, const T* y, cslt::size_t num) noexcept {return K::dot(x, y, num);}
+            CSLT_TARGET("avx2,fma") CSLT_FLATTEN
+            static T min(const T* x, cslt::size_t num) noexcept {return K::min(x, num);}
+            CSLT_TARGET("avx2,fma") CSLT_FLATTEN
+            static T max(const T* x, cslt::size_t num) noexcept {return K::max(x, num);}
+            CSLT_TARGET("avx2,fma") CSLT_FLATTEN
+            static cslt::size_t count_if(const T* x, cslt::size_t num, compare op, T value) noexcept {
+                return K::count_if(x, num, op, value);
+            }
+            CSLT_TARGET("avx2,fma") CSLT_FLATTEN
+            static void axpy(T a, const T* x, T* y, cslt::size_t num) noexcept {K::axpy(a, x, y, num);}
+            CSLT_TARGET("avx2,fma") CSLT_FLATTEN
+            static void fill(T* y, cslt::size_t num, T value) noexcept {K::fill(y, num, value);}
+            CSLT_TARGET("avx2,fma") CSLT_FLATTEN
+            static void add(const T* x, const T* y, T* out, cslt::size_t num) noexcept {K::add(x, y, out, num);}
+            CSLT_TARGET("avx2,fma") CSLT_FLATTEN
+            static void sub(const T* x, const T* y, T* out, cslt::size_t num) noexcept {K::sub(x, y, out, num);}
+            CSLT_TARGET("avx2,fma") CSLT_FLATTEN
+            static void mul(const T* x, const T* y, T* out, cslt::size_t num) noexcept {K::mul(x, y, out, num);}
+        };
+
+        constexpr kernel_set avx2_set = set_of<avx2_kernels>(kernel::avx2);
+// ================================================================================
+// ================================================================================
+// AVX-512 OPERATIONS, 64 bytes per register; comparisons give a lane mask
+//
+// The minimum and maximum use the zero masked forms under a full mask, which
+// compile to the same instruction; GCC 12 warns falsely about the undefined
+// register the unmasked forms pass through once they are inlined.
+
+        constexpr __mmask16 full16 = 0xFFFF;
+        constexpr __mmask8 full8 = 0xFF;
+
+        template <typename T>
+        struct avx512_ops;
+
+        template <>
+        struct avx512_ops<float> {
+            using value_type = float;
+            using reg = __m512;
+            static constexpr cslt::size_t width = 16;
+
+            CSLT_TARGET("avx512f") static void load(reg& r, const float* p) noexcept {r = _mm512_loadu_ps(p);}
+            CSLT_TARGET("avx512f") static void store(float* p, const reg& r) noexcept {_mm512_storeu_ps(p, r);}
+            CSLT_TARGET("avx512f") static void set1(reg& r, float value) noexcept {r = _mm512_set1_ps(value);}
+            CSLT_TARGET("avx512f") static void add(reg& a, const reg& b) noexcept {a = _mm512_add_ps(a, b);}
+            CSLT_TARGET("avx512f") static void sub(reg& a, const reg& b) noexcept {a = _mm512_sub_ps(a, b);}
+            CSLT_TARGET("avx512f") static void mul(reg& a, const reg& b) noexcept {a = _mm512_mul_ps(a, b);}
+            CSLT_TARGET("avx512f") static void fma(reg& acc, const reg& a, const reg& b) noexcept {acc = _mm512_fmadd_ps(a, b, acc);}
+            CSLT_TARGET("avx512f") static void min(reg& a, const reg& b) noexcept {a = _mm512_maskz_min_ps(full16, a, b);}
+            CSLT_TARGET("avx512f") static void max(reg& a, const reg& b) noexcept {a = _mm512_maskz_max_ps(full16, a, b);}
+
+            template <compare Op>
+            CSLT_TARGET("avx512f") static unsigned count(const reg& a, const reg& b) noexcept {
+                __mmask16 mask = 0;
+                switch (Op) {
+                    case compare::equal: mask = _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); break;
+                    case compare::not_equal: mask = _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ); break;
+                    case compare::less: mask = _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); break;
+                    case compare::less_equal: mask = _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); break;
+                    case compare::greater: mask = _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); break;
+                    case compare::greater_equal: mask = _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); break;
+                }
+                return popcount(static_cast<unsigned>(mask));
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <>
+        struct avx512_ops<double> {
+            using value_type = double;
+            using reg = __m512d;
+            static constexpr cslt::size_t width = 8;
+
+            CSLT_TARGET("avx512f") static void load(reg& r, const double* p) noexcept {r = _mm512_loadu_pd(p);}
+            CSLT_TARGET("avx512f") static void store(double* p, const reg& r) noexcept {_mm512_storeu_pd(p, r);}
+            CSLT_TARGET("avx512f") static void set1(reg& r, double value) noexcept {r = _mm512_set1_pd(value);}
+            CSLT_TARGET("avx512f") static void add(reg& a, const reg& b) noexcept {a = _mm512_add_pd(a, b);}
+            CSLT_TARGET("avx512f") static void sub(reg& a, const reg& b) noexcept {a = _mm512_sub_pd(a, b);}
+            CSLT_TARGET("avx512f") static void mul(reg& a, const reg& b) noexcept {a = _mm512_mul_pd(a, b);}
+            CSLT_TARGET("avx512f") static void fma(reg& acc, const reg& a, const reg& b) noexcept {acc = _mm512_fmadd_pd(a, b, acc);}
+            CSLT_TARGET("avx512f") static void min(reg& a, const reg& b) noexcept {a = _mm512_maskz_min_pd(full8, a, b);}
+            CSLT_TARGET("avx512f") static void max(reg& a, const reg& b) noexcept {a = _mm512_maskz_max_pd(full8, a, b);}
+
+            template <compare Op>
+            CSLT_TARGET("avx512f") static unsigned count(const reg& a, const reg& b) noexcept {
+                __mmask8 mask = 0;
+                switch (Op) {
+                    case compare::equal: mask = _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); break;
+                    case compare::not_equal: mask = _mm512_cmp_pd_mask(a, b, _CMP_NEQ_UQ); break;
+                    case compare::less: mask = _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); break;
+                    case compare::less_equal: mask = _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); break;
+                    case compare::greater: mask = _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); break;
+                    case compare::greater_equal: mask = _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ); break;
+                }
+                return popcount(static_cast<unsigned>(mask));
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <>
+        struct avx512_ops<int> {
+            using value_type = int;
+            using reg = __m512i;
+            static constexpr cslt::size_t width = 16;
+
+            CSLT_TARGET("avx512f") static void load(reg& r, const int* p) noexcept {r = _mm512_loadu_si512(p);}
+            CSLT_TARGET("avx512f") static void store(int* p, const reg& r) noexcept {_mm512_storeu_si512(p, r);}
+            CSLT_TARGET("avx512f") static void set1(reg& r, int value) noexcept {r = _mm512_set1_epi32(value);}
+            CSLT_TARGET("avx512f") static void add(reg& a, const reg& b) noexcept {a = _mm512_add_epi32(a, b);}
+            CSLT_TARGET("avx512f") static void sub(reg& a, const reg& b) noexcept {a = _mm512_sub_epi32(a, b);}
+            CSLT_TARGET("avx512f") static void mul(reg& a, const reg& b) noexcept {a = _mm512_mullo_epi32(a, b);}
+            CSLT_TARGET("avx512f") static void fma(reg& acc, const reg& a, const reg& b) noexcept {
+                acc = _mm512_add_epi32(_mm512_mullo_epi32(a, b), acc);
+            }
+            CSLT_TARGET("avx512f") static void min(reg& a, const reg& b) noexcept {a = _mm512_maskz_min_epi32(full16, a, b);}
+            CSLT_TARGET("avx512f") static void max(reg& a, const reg& b) noexcept {a = _mm512_maskz_max_epi32(full16, a, b);}
+
+            template <compare Op>
+            CSLT_TARGET("avx512f") static unsigned count(const reg& a, const reg& b) noexcept {
+                __mmask16 mask = 0;
+                switch (Op) {
+                    case compare::equal: mask = _mm512_cmpeq_epi32_mask(a, b); break;
+                    case compare::not_equal: mask = _mm512_cmpneq_epi32_mask(a, b); break;
+                    case compare::less: mask = _mm512_cmplt_epi32_mask(a, b); break;
+                    case compare::less_equal: mask = _mm512_cmple_epi32_mask(a, b); break;
+                    case compare::greater: mask = _mm512_cmpgt_epi32_mask(a, b); break;
+                    case compare::greater_equal: mask = _mm512_cmpge_epi32_mask(a, b); break;
+                }
+                return popcount(static_cast<unsigned>(mask));
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <typename T>
+        struct avx512_kernels {
+            using value_type = T;
+            using K = kernels<avx512_ops<T>>;
+
+            CSLT_TARGET("avx512f") CSLT_FLATTEN
+            static T sum(const T* x, cslt::size_t num) noexcept {return K::sum(x, num);}
+            CSLT_TARGET("avx512f") CSLT_FLATTEN
+            static T dot(const T* x, const T* y, cslt::size_t num) noexcept {return K::dot(x, y, num);}
+            CSLT_TARGET("avx512f") CSLT_FLATTEN
+            static T min(const T* x, cslt::size_t num) noexcept {return K::min(x, num);}
+            CSLT_TARGET("avx512f") CSLT_FLATTEN
+            static T max(const T* x, cslt::size_t num) noexcept {return K::max(x, num);}
+            CSLT_TARGET("avx512f") CSLT_FLATTEN
+            static cslt::size_t count_if(const T* x, cslt::size_t num, compare op, T value) noexcept {
+                return K::count_if(x, num, op, value);
+            }
+            CSLT_TARGET("avx512f") CSLT_FLATTEN
+            static void axpy(T a, const T* x, T* y, cslt::size_t num) noexcept {K::axpy(a, x, y, num);}
+            CSLT_TARGET("avx512f") CSLT_FLATTEN
+            static void fill(T* y, cslt::size_t num, T value) noexcept {K::fill(y, num, value);}
+            CSLT_TARGET("avx512f") CSLT_FLATTEN
+            static void add(const T* x, const T* y, T* out, cslt::size_t num) noexcept {K::add(x, y, out, num);}
+            CSLT_TARGET("avx512f") CSLT_FLATTEN
+            static void sub(const T* x, const T* y, T* out, cslt::size_t num) noexcept {K::sub(x, y, out, num);}
+            CSLT_TARGET("avx512f") CSLT_FLATTEN
+            static void mul(const T* x, const T* y, T* out, cslt::size_t num) noexcept {K::mul(x, y, out, num);}
+        };
+
+        constexpr kernel_set avx512_set = set_of<avx512_kernels>(kernel::avx512);
+// --------------------------------------------------------------------------------
+
+        bool cpu_supports(kernel k) noexcept {
+            __builtin_cpu_init();
+            if (k == kernel::avx512)
+                return __builtin_cpu_supports("avx512f");
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        }
+#endif
+// ================================================================================
+// ================================================================================
+// NEON OPERATIONS, 16 bytes per register
+//
+// A comparison gives all ones in each matching lane, so shifting the sign bit
+// down and adding across the register counts the matches.
+
+#if CSLT_NEON64
+        template <typename T>
+        struct neon_ops;
+
+        template <>
+        struct neon_ops<float> {
+            using value_type = float;
+            using reg = float32x4_t;
+            static constexpr cslt::size_t width = 4;
+
+            static void load(reg& r, const float* p) noexcept {r = vld1q_f32(p);}
+            static void store(float* p, const reg& r) noexcept {vst1q_f32(p, r);}
+            static void set1(reg& r, float value) noexcept {r = vdupq_n_f32(value);}
+            static void add(reg& a, const reg& b) noexcept {a = vaddq_f32(a, b);}
+            static void sub(reg& a, const reg& b) noexcept {a = vsubq_f32(a, b);}
+            static void mul(reg& a, const reg& b) noexcept {a = vmulq_f32(a, b);}
+            static void fma(reg& acc, const reg& a, const reg& b) noexcept {acc = vfmaq_f32(acc, a, b);}
+            static void min(reg& a, const reg& b) noexcept {a = vminq_f32(a, b);}
+            static void max(reg& a, const reg& b) noexcept {a = vmaxq_f32(a, b);}
+
+            template <compare Op>
+            static uint32x4_t cmp(const reg& a, const reg& b) noexcept {
+                switch (Op) {
+                    case compare::equal: return vceqq_f32(a, b);
+                    case compare::not_equal: return vmvnq_u32(vceqq_f32(a, b));
+                    case compare::less: return vcltq_f32(a, b);
+                    case compare::less_equal: return vcleq_f32(a, b);
+                    case compare::greater: return vcgtq_f32(a, b);
+                    case compare::greater_equal: return vcgeq_f32(a, b);
+                }
+                return vdupq_n_u32(0);
+            }
+
+            template <compare Op>
+            static unsigned count(const reg& a, const reg& b) noexcept {
+                return vaddvq_u32(vshrq_n_u32(cmp<Op>(a, b), 31));
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <>
+        struct neon_ops<double> {
+            using value_type = double;
+            using reg = float64x2_t;
+            static constexpr cslt::size_t width = 2;
+
+            static void load(reg& r, const double* p) noexcept {r = vld1q_f64(p);}
+            static void store(double* p, const reg& r) noexcept {vst1q_f64(p, r);}
+            static void set1(reg& r, double value) noexcept {r = vdupq_n_f64(value);}
+            static void add(reg& a, const reg& b) noexcept {a = vaddq_f64(a, b);}
+            static void sub(reg& a, const reg& b) noexcept {a = vsubq_f64(a, b);}
+            static void mul(reg& a, const reg& b) noexcept {a = vmulq_f64(a, b);}
+            static void fma(reg& acc, const reg& a, const reg& b) noexcept {acc = vfmaq_f64(acc, a, b);}
+            static void min(reg& a, const reg& b) noexcept {a = vminq_f64(a, b);}
+            static void max(reg& a, const reg& b) noexcept {a = vmaxq_f64(a, b);}
+
+            template <compare Op>
+            static uint64x2_t cmp(const reg& a, const reg& b) noexcept {
+                switch (Op) {
+                    case compare::equal: return vceqq_f64(a, b);
+                    case compare::not_equal:
+                        return vreinterpretq_u64_u32(vmvnq_u32(vreinterpretq_u32_u64(vceqq_f64(a, b))));
+                    case compare::less: return vcltq_f64(a, b);
+                    case compare::less_equal: return vcleq_f64(a, b);
+                    case compare::greater: return vcgtq_f64(a, b);
+                    case compare::greater_equal: return vcgeq_f64(a, b);
+                }
+                return vdupq_n_u64(0);
+            }
+
+            template <compare Op>
+            static unsigned count(const reg& a, const reg& b) noexcept {
+                return static_cast<unsigned>(vaddvq_u64(vshrq_n_u64(cmp<Op>(a, b), 63)));
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <>
+        struct neon_ops<int> {
+            using value_type = int;
+            using reg = int32x4_t;
+            static constexpr cslt::size_t width = 4;
+
+            static void load(reg& r, const int* p) noexcept {r = vld1q_s32(p);}
+            static void store(int* p, const reg& r) noexcept {vst1q_s32(p, r);}
+            static void set1(reg& r, int value) noexcept {r = vdupq_n_s32(value);}
+            static void add(reg& a, const reg& b) noexcept {a = vaddq_s32(a, b);}
+            static void sub(reg& a, const reg& b) noexcept {a = vsubq_s32(a, b);}
+            static void mul(reg& a, const reg& b) noexcept {a = vmulq_s32(a, b);}
+            static void fma(reg& acc, const reg& a, const reg& b) noexcept {acc = vmlaq_s32(acc, a, b);}
+            static void min(reg& a, const reg& b) noexcept {a = vminq_s32(a, b);}
+            static void max(reg& a, const reg& b) noexcept {a = vmaxq_s32(a, b);}
+
+            template <compare Op>
+            static uint32x4_t cmp(const reg& a, const reg& b) noexcept {
+                switch (Op) {
+                    case compare::equal: return vceqq_s32(a, b);
+                    case compare::not_equal: return vmvnq_u32(vceqq_s32(a, b));
+                    case compare::less: return vcltq_s32(a, b);
+                    case compare::less_equal: return vcleq_s32(a, b);
+                    case compare::greater: return vcgtq_s32(a, b);
+                    case compare::greater_equal: return vcgeq_s32(a, b);
+                }
+                return vdupq_n_u32(0);
+            }
+
+            template <compare Op>
+            static unsigned count(const reg& a, const reg& b) noexcept {
+                return vaddvq_u32(vshrq_n_u32(cmp<Op>(a, b), 31));
+            }
+        };
+// --------------------------------------------------------------------------------
+
+        template <typename T>
+        using neon_kernels = kernels<neon_ops<T>>;
+
+        constexpr kernel_set neon_set = set_of<neon_kernels>(kernel::neon);
+#endif
+// ================================================================================
+// ================================================================================
+// DISPATCH
+
+        const kernel_set* set_for(kernel k) noexcept {
+            switch (k) {
+                case kernel::scalar:
+                    return &scalar_set;
+#if CSLT_SIMD_SSE2
+                case kernel::sse2:
+                    return &sse2_set;
+#endif
+#if CSLT_X86_DISPATCH
+                case kernel::avx2:
+                    return cpu_supports(k) ? &avx2_set : nullptr;
+                case kernel::avx512:
+                    return cpu_supports(k) ? &avx512_set : nullptr;
+#endif
+#if CSLT_NEON64
+                case kernel::neon:
+                    return &neon_set;
+#endif
+                default:
+                    return nullptr;
+            }
+        }
+
+        const kernel_set* best_set() noexcept {
+            const kernel order[] = {kernel::avx512, kernel::avx2, kernel::sse2, kernel::neon};
+            for (kernel k : order)
+                if (const kernel_set* found = set_for(k))
+                    return found;
+            return &scalar_set;
+        }
+// --------------------------------------------------------------------------------
+
+        // Starts null, which is constant initialized, so calls made by the
+        // constructors of other static objects still find a table.  Two threads
+        // racing on the first call store the same pointer.
+        std::atomic<const kernel_set*> current{nullptr};
+
+        const kernel_set& kernel_sets() noexcept {
+            const kernel_set* found = current.load(std::memory_order_acquire);
+            if (found == nullptr) {
+                found = best_set();
+                current.store(found, std::memory_order_release);
+            }
+            return *found;
+        }
+
+        template <typename T>
+        const kernel_table<T>& table() noexcept;
+
+        template <>
+        const kernel_table<float>& table<float>() noexcept {return kernel_sets().f32;}
+        template <>
+        const kernel_table<double>& table<double>() noexcept {return kernel_sets().f64;}
+        template <>
+        const kernel_table<int>& table<int>() noexcept {return kernel_sets().i32;}
+// ================================================================================
+// ================================================================================
+// ARGUMENT CHECKS, shared by the overloads for each element type
+
+        template <typename T>
+        T sum_of(span<const T> x) noexcept {
+            return table<T>().sum(x.data(), x.size());
+        }
+
+        template <typename T>
+        T dot_of(span<const T> x, span<const T> y) {
+            if (x.size() != y.size())
+                throw cslt::invalid_argument(CSLT_LITERAL("simd::dot spans differ in size"));
+            return table<T>().dot(x.data(), y.data(), x.size());
+        }
+
+        template <typename T>
+        T min_of(span<const T> x) {
+            if (x.empty())
+                throw cslt::invalid_argument(CSLT_LITERAL("simd::min of an empty span"));
+            return table<T>().min(x.data(), x.size());
+        }
+
+        template <typename T>
+        T max_of(span<const T> x) {
+            if (x.empty())
+                throw cslt::invalid_argument(CSLT_LITERAL("simd::max of an empty span"));
+            return table<T>().max(x.data(), x.size());
+        }
+
+        template <typename T>
+        cslt::size_t count_if_of(span<const T> x, compare op, T value) noexcept {
+            return table<T>().count_if(x.data(), x.size(), op, value);
+        }
+
+        template <typename T>
+        void axpy_of(T a, span<const T> x, span<T> y) {
+            if (x.size() != y.size())
+                throw cslt::invalid_argument(CSLT_LITERAL("simd::axpy spans differ in size"));
+            table<T>().axpy(a, x.data(), y.data(), x.size());
+        }
+
+        template <typename T>
+        void fill_of(span<T> y, T value) noexcept {
+            table<T>().fill(y.data(), y.size(), value);
+        }
+
+        template <typename T>
+        void check_sizes(span<const T> x, span<const T> y, span<T> out) {
+            if (x.size() != y.size() || x.size() != out.size())
+                throw cslt::invalid_argument(CSLT_LITERAL("simd elementwise spans differ in size"));
+        }
+    } /* end of anonymous namespace */
+// ================================================================================
+// ================================================================================
+
+    const char* kernel_name(kernel k) noexcept {
+        switch (k) {
+            case kernel::scalar: return "scalar";
+            case kernel::sse2: return "sse2";
+            case kernel::avx2: return "avx2";
+            case kernel::avx512: return "avx512";
+            case kernel::neon: return "neon";
+        }
+        return "unknown";
+    }
+// --------------------------------------------------------------------------------
+
+    bool kernel_supported(kernel k) noexcept {
+        return set_for(k) != nullptr;
+    }
+// --------------------------------------------------------------------------------
+
+    kernel active_kernel() noexcept {
+        return kernel_sets().kind;
+    }
+// --------------------------------------------------------------------------------
+
+    bool select_kernel(kernel k) noexcept {
+        const kernel_set* found = set_for(k);
+        if (found == nullptr)
+            return false;
+        current.store(found, std::memory_order_release);
+        return true;
+    }
+// ================================================================================
+// ================================================================================
+
+    float sum(span<const float> x) noexcept {return sum_of(x);}
+    double sum(span<const double> x) noexcept {return sum_of(x);}
+    int sum(span<const int> x) noexcept {return sum_of(x);}
+// --------------------------------------------------------------------------------
+
+    float dot(span<const float> x, span<const float> y) {return dot_of(x, y);}
+    double dot(span<const double> x, span<const double> y) {return dot_of(x, y);}
+    int dot(span<const int> x, span<const int> y) {return dot_of(x, y);}
+// --------------------------------------------------------------------------------
+
+    float min(span<const float> x) {return min_of(x);}
+    double min(span<const double> x) {return min_of(x);}
+    int min(span<const int> x) {return min_of(x);}
+// --------------------------------------------------------------------------------
+
+    float max(span<const float> x) {return max_of(x);}
+    double max(span<const double> x) {return max_of(x);}
+    int max(span<const int> x) {return max_of(x);}
+// --------------------------------------------------------------------------------
+
+    cslt::size_t count_if(span<const float> x, compare op, float value) noexcept {
+        return count_if_of(x, op, value);
+    }
+
+    cslt::size_t count_if(span<const double> x, compare op, double value) noexcept {
+        return count_if_of(x, op, value);
+    }
+
+    cslt::size_t count_if(span<const int> x, compare op, int value) noexcept {
+        return count_if_of(x, op, value);
+    }
+// ================================================================================
+// ================================================================================
+
+    void axpy(float a, span<const float> x, span<float> y) {axpy_of(a, x, y);}
+    void axpy(double a, span<const double> x, span<double> y) {axpy_of(a, x, y);}
+    void axpy(int a, span<const int> x, span<int> y) {axpy_of(a, x, y);}
+// --------------------------------------------------------------------------------
+
+    void fill(span<float> y, float value) noexcept {fill_of(y, value);}
+    void fill(span<double> y, double value) noexcept {fill_of(y, value);}
+    void fill(span<int> y, int value) noexcept {fill_of(y, value);}
+// --------------------------------------------------------------------------------
+
+    void add(span<const float> x, span<const float> y, span<float> out) {
+        check_sizes(x, y, out);
+        table<float>().add(x.data(), y.data(), out.data(), x.size());
+    }
+
+    void add(span<const double> x, span<const double> y, span<double> out) {
+        check_sizes(x, y, out);
+        table<double>().add(x.data(), y.data(), out.data(), x.size());
+    }
+
+    void add(span<const int> x, span<const int> y, span<int> out) {
+        check_sizes(x, y, out);
+        table<int>().add(x.data(), y.data(), out.data(), x.size());
+    }
+// --------------------------------------------------------------------------------
+
+    void sub(span<const float> x, span<const float> y, span<float> out) {
+        check_sizes(x, y, out);
+        table<float>().sub(x.data(), y.data(), out.data(), x.size());
+    }
+
+    void sub(span<const double> x, span<const double> y, span<double> out) {
+        check_sizes(x, y, out);
+        table<double>().sub(x.data(), y.data(), out.data(), x.size());
+    }
+
+    void sub(span<const int> x, span<const int> y, span<int> out) {
+        check_sizes(x, y, out);
+        table<int>().sub(x.data(), y.data(), out.data(), x.size());
+    }
+// --------------------------------------------------------------------------------
+
+    void mul(span<const float> x, span<const float> y, span<float> out) {
+        check_sizes(x, y, out);
+        table<float>().mul(x.data(), y.data(), out.data(), x.size());
+    }
+
+    void mul(span<const double> x, span<const double> y, span<double> out) {
+        check_sizes(x, y, out);
+        table<double>().mul(x.data(), y.data(), out.data(), x.size());
+    }
+
+    void mul(span<const int> x, span<const int> y, span<int> out) {
+        check_sizes(x, y, out);
+        table<int>().mul(x.data(), y.data(), out.data(), x.size());
+    }
+} /* end of simd namespace */
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+// eof
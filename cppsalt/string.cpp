@@ -13,70 +13,315 @@
 // Include modules here
 
 #include "include/string.hpp"
+#include "include/instrument.hpp"
 
 namespace cslt {
 
-    String::String(const char* str)
-        : ptr(std::strlen(str) + 1), len(std::strlen(str)), alloc(std::strlen(str) + 1) {
-            std::strcpy(ptr.get(), str);
-            ptr[std::strlen(str)] = '\0';
+    constexpr cslt::size_t String::sso_capacity;
+    constexpr cslt::size_t string_view::npos;
+    constexpr cslt::size_t String::npos;
+// ================================================================================
+// ================================================================================
+// PRIVATE FUNCTIONS
+
+    void String::assign_empty(const char* str, cslt::size_t num) {
+        if (num > sso_capacity) {
+            heap = static_cast<char*>(res->allocate(num + 1, 1));
+            CSLT_RECORD_ALLOC(string, num + 1);
+            alloc = num;
+        }
+        char* buf = buffer();
+        if (num > 0)
+            std::memcpy(buf, str, num);
+        buf[num] = '\0';
+        len = num;
+    }
+// --------------------------------------------------------------------------------
+
+    void String::grow(cslt::size_t buff) {
+        char* block = static_cast<char*>(res->allocate(buff + 1, 1));
+        CSLT_RECORD_ALLOC(string, buff + 1);
+        std::memcpy(block, buffer(), len + 1);
+        if (!is_inline()) {
+            res->deallocate(heap, alloc + 1, 1);
+            CSLT_RECORD_FREE(string, alloc + 1);
+            CSLT_RECORD_REALLOC(string);
         }
+        heap = block;
+        alloc = buff;
+    }
+// --------------------------------------------------------------------------------
+
+    void String::release() noexcept {
+        if (!is_inline()) {
+            res->deallocate(heap, alloc + 1, 1);
+            CSLT_RECORD_FREE(string, alloc + 1);
+        }
+        alloc = 0;
+        len = 0;
+        sso[0] = '\0';
+    }
+// --------------------------------------------------------------------------------
+
+    void String::steal(String& other) noexcept {
+        len = other.len;
+        alloc = other.alloc;
+        if (other.is_inline())
+            std::memcpy(sso, other.sso, other.len + 1);
+        else
+            heap = other.heap;
+        other.alloc = 0;
+        other.len = 0;
+        other.sso[0] = '\0';
+    }
+// ================================================================================
+// ================================================================================
+// CONSTRUCTORS AND ASSIGNMENT
+
+    String::String() noexcept : res(get_default_resource()) {
+        sso[0] = '\0';
+    }
+// --------------------------------------------------------------------------------
+
+    String::String(const polymorphic_allocator<char>& alloc) noexcept : res(alloc.resource()) {
+        sso[0] = '\0';
+    }
 // --------------------------------------------------------------------------------
 
     /**
-     * This class relies on the array_ptr copy constructor to manage deep copies
+     * The length is measured once and the characters are copied with memcpy
      */
-    String::String(const String& other) : ptr(other.ptr), len(other.len), alloc(other.alloc) {}
+    String::String(const char* str) : res(get_default_resource()) {
+        assign_empty(str, str ? std::strlen(str) : 0);
+    }
+// --------------------------------------------------------------------------------
+
+    String::String(const char* str, const polymorphic_allocator<char>& alloc) : res(alloc.resource()) {
+        assign_empty(str, str ? std::strlen(str) : 0);
+    }
 // --------------------------------------------------------------------------------
 
-    /** 
-     * Assignment operator, which relies on array_ptr implementation to manage a deep 
-     * copy of the String
+    String::String(const char* str, cslt::size_t num) : res(get_default_resource()) {
+        assign_empty(str, num);
+    }
+// --------------------------------------------------------------------------------
+
+    String::String(const char* str, cslt::size_t num, const polymorphic_allocator<char>& alloc)
+        : res(alloc.resource()) {
+        assign_empty(str, num);
+    }
+// --------------------------------------------------------------------------------
+
+    /**
+     * A heap copy is sized to the length of other rather than its capacity
      */
+    String::String(const String& other) : res(get_default_resource()) {
+        assign_empty(other.buffer(), other.len);
+    }
+// --------------------------------------------------------------------------------
+
+    String::String(const String& other, const polymorphic_allocator<char>& alloc) : res(alloc.resource()) {
+        assign_empty(other.buffer(), other.len);
+    }
+// --------------------------------------------------------------------------------
 
+    /**
+     * Assignment operator, which reuses the existing buffer when it is large enough
+     */
     String& String::operator=(const String& other) {
         if (this != &other) {
-            ptr = other.ptr;
-            len = other.len;
-            alloc = other.alloc;
+            if (other.len > capacity()) {
+                String temp(other, get_allocator());
+                release();
+                steal(temp);
+            }
+            else {
+                char* buf = buffer();
+                std::memcpy(buf, other.buffer(), other.len + 1);
+                len = other.len;
+            }
         }
         return *this;
     }
 // --------------------------------------------------------------------------------
 
     /**
-     * This class is an rvalue copy constructor that relies on the shared_ptr copy 
-     * constructor to manage move semantics.
+     * This class is an rvalue copy constructor that steals the heap block of other
      */
-    String::String(String&& other) noexcept : ptr(other.ptr), len(other.len), alloc(other.alloc) {}
+    String::String(String&& other) noexcept : res(other.res) {
+        steal(other);
+    }
 // --------------------------------------------------------------------------------
 
     /**
-     * This class is an rvalue assignment operator that relies on the shared_ptr 
-     * copy assignment operator to manage move semantics
+     * This class is an rvalue assignment operator that steals the heap block of other
+     * when the two resources are interchangeable
      */
-    String& String::operator=(String&& other) noexcept {
+    String& String::operator=(String&& other) {
         if (this != &other) {
-            ptr = cslt::move(other.ptr);
-            len = other.len;
-            alloc = other.alloc;
+            if (*res == *other.res) {
+                release();
+                steal(other);
+            }
+            else {
+                *this = static_cast<const String&>(other);
+                other.clear();
+            }
         }
         return *this;
     }
 // --------------------------------------------------------------------------------
 
+    String::~String() {
+        release();
+    }
+// ================================================================================
+// ================================================================================
+// ACCESSORS
+
     cslt::size_t String::size() const {
         return len;
     }
 // --------------------------------------------------------------------------------
 
+    cslt::size_t String::capacity() const {
+        return is_inline() ? sso_capacity : alloc;
+    }
+// --------------------------------------------------------------------------------
+
     cslt::size_t String::memory() const {
-        return alloc;
+        return is_inline() ? 0 : alloc + 1;
+    }
+// --------------------------------------------------------------------------------
+
+    bool String::empty() const {
+        return len == 0;
     }
 // --------------------------------------------------------------------------------
 
     const char* String::c_string() const {
-        return ptr.get();
+        return buffer();
+    }
+// ================================================================================
+// ================================================================================
+// MODIFIERS
+
+    void String::reserve(cslt::size_t buff) {
+        if (buff > capacity())
+            grow(buff);
+    }
+// --------------------------------------------------------------------------------
+
+    String& String::append(const char* str, cslt::size_t num) {
+        if (num == 0)
+            return *this;
+        const cslt::size_t required = len + num;
+        if (required > capacity()) {
+            // str may point into this String, so it is copied before the old
+            // block is released
+            const char* base = buffer();
+            const bool aliased = str >= base && str < base + len;
+            const cslt::size_t offset = aliased ? static_cast<cslt::size_t>(str - base) : 0;
+            grow(std::max(required, 2 * capacity()));
+            if (aliased)
+                str = buffer() + offset;
+        }
+        char* buf = buffer();
+        std::memmove(buf + len, str, num);
+        len = required;
+        buf[len] = '\0';
+        return *this;
+    }
+// --------------------------------------------------------------------------------
+
+    String& String::append(const char* str) {
+        return append(str, std::strlen(str));
+    }
+// --------------------------------------------------------------------------------
+
+    String& String::append(const String& other) {
+        return append(other.buffer(), other.len);
+    }
+// --------------------------------------------------------------------------------
+
+    String& String::operator+=(const char* str) {
+        return append(str);
+    }
+// --------------------------------------------------------------------------------
+
+    String& String::operator+=(const String& other) {
+        return append(other);
+    }
+// --------------------------------------------------------------------------------
+
+    String& String::operator+=(char chr) {
+        return append(&chr, 1);
+    }
+// --------------------------------------------------------------------------------
+
+    void String::clear() noexcept {
+        len = 0;
+        buffer()[0] = '\0';
+    }
+// --------------------------------------------------------------------------------
+
+    polymorphic_allocator<char> String::get_allocator() const noexcept {
+        return polymorphic_allocator<char>(res);
+    }
+// ================================================================================
+// ================================================================================
+// NON-MEMBER OPERATORS
+
+    String operator+(const String& lhs, const String& rhs) {
+        String result;
+        result.reserve(lhs.size() + rhs.size());
+        result.append(lhs);
+        result.append(rhs);
+        return result;
+    }
+// --------------------------------------------------------------------------------
+
+    String operator+(const String& lhs, const char* rhs) {
+        const cslt::size_t num = std::strlen(rhs);
+        String result;
+        result.reserve(lhs.size() + num);
+        result.append(lhs);
+        result.append(rhs, num);
+        return result;
+    }
+// --------------------------------------------------------------------------------
+
+    String operator+(String&& lhs, const String& rhs) {
+        lhs.append(rhs);
+        return cslt::move(lhs);
+    }
+// --------------------------------------------------------------------------------
+
+    String operator+(String&& lhs, const char* rhs) {
+        lhs.append(rhs);
+        return cslt::move(lhs);
+    }
+// --------------------------------------------------------------------------------
+
+    bool operator==(const String& lhs, const String& rhs) {
+        return lhs.size() == rhs.size() &&
+               std::memcmp(lhs.c_string(), rhs.c_string(), lhs.size()) == 0;
+    }
+// --------------------------------------------------------------------------------
+
+    bool operator==(const String& lhs, const char* rhs) {
+        const cslt::size_t num = std::strlen(rhs);
+        return lhs.size() == num && std::memcmp(lhs.c_string(), rhs, num) == 0;
+    }
+// --------------------------------------------------------------------------------
+
+    bool operator!=(const String& lhs, const String& rhs) {
+        return !(lhs == rhs);
+    }
+// --------------------------------------------------------------------------------
+
+    bool operator!=(const String& lhs, const char* rhs) {
+        return !(lhs == rhs);
     }
 }
 // ================================================================================
@@ -0,0 +1,240 @@
+// ================================================================================
+// ================================================================================
+// - File:    string_builder.cpp
+// - Purpose: Chunk management and output of string_builder
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "include/string_builder.hpp"
+#include "include/except.hpp"
+#include "include/instrument.hpp"
+#include <cerrno>
+#include <cstdio>
+
+#if defined(_WIN32)
+    #include <io.h>
+#else
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
+
+namespace cslt {
+
+    constexpr cslt::size_t string_builder::default_chunk_size;
+// ================================================================================
+// ================================================================================
+// PRIVATE FUNCTIONS
+
+    void string_builder::add_chunk(cslt::size_t num) {
+        const cslt::size_t capacity = num > chunk_bytes ? num : chunk_bytes;
+        const cslt::size_t bytes = sizeof(chunk) + capacity;
+        chunk* block = static_cast<chunk*>(res->allocate(bytes, alignof(chunk)));
+        CSLT_RECORD_ALLOC(string_builder, bytes);
+        block->next = nullptr;
+        block->capacity = capacity;
+        block->used = 0;
+        if (tail != nullptr) {
+            tail->used = static_cast<cslt::size_t>(cursor - tail->data());
+            tail->next = block;
+        } else {
+            head = block;
+        }
+        tail = block;
+        cursor = block->data();
+        limit = cursor + capacity;
+    }
+// --------------------------------------------------------------------------------
+
+    void string_builder::append_slow(const char* str, cslt::size_t num) {
+        const cslt::size_t room = static_cast<cslt::size_t>(limit - cursor);
+        if (room != 0) {
+            std::memcpy(cursor, str, room);
+            cursor += room;
+            len += room;
+            str += room;
+            num -= room;
+        }
+        add_chunk(num);
+        std::memcpy(cursor, str, num);
+        cursor += num;
+        len += num;
+    }
+// --------------------------------------------------------------------------------
+
+    void string_builder::free_chunks(chunk* first) noexcept {
+        while (first != nullptr) {
+            chunk* next = first->next;
+            const cslt::size_t bytes = sizeof(chunk) + first->capacity;
+            res->deallocate(first, bytes, alignof(chunk));
+            CSLT_RECORD_FREE(string_builder, bytes);
+            first = next;
+        }
+    }
+// ================================================================================
+// ================================================================================
+// CONSTRUCTORS
+
+    string_builder::string_builder(cslt::size_t chunk_size, memory_resource* res) noexcept
+        : res(res), chunk_bytes(chunk_size != 0 ? chunk_size : 1) {}
+// --------------------------------------------------------------------------------
+
+    string_builder::string_builder(string_builder&& other) noexcept
+        : res(other.res), chunk_bytes(other.chunk_bytes), head(other.head), tail(other.tail),
+          cursor(other.cursor), limit(other.limit), len(other.len) {
+        other.head = other.tail = nullptr;
+        other.cursor = other.limit = nullptr;
+        other.len = 0;
+    }
+// --------------------------------------------------------------------------------
+
+    string_builder& string_builder::operator=(string_builder&& other) noexcept {
+        if (this != &other) {
+            free_chunks(head);
+            res = other.res;
+            chunk_bytes = other.chunk_bytes;
+            head = other.head;
+            tail = other.tail;
+            cursor = other.cursor;
+            limit = other.limit;
+            len = other.len;
+            other.head = other.tail = nullptr;
+            other.cursor = other.limit = nullptr;
+            other.len = 0;
+        }
+        return *this;
+    }
+// --------------------------------------------------------------------------------
+
+    string_builder::~string_builder() {
+        free_chunks(head);
+    }
+// ================================================================================
+// ================================================================================
+// PUBLIC FUNCTIONS
+
+    void string_builder::clear() noexcept {
+        if (head == nullptr)
+            return;
+        free_chunks(head->next);
+        head->next = nullptr;
+        head->used = 0;
+        tail = head;
+        cursor = head->data();
+        limit = cursor + head->capacity;
+        len = 0;
+    }
+// --------------------------------------------------------------------------------
+
+    cslt::size_t string_builder::chunk_count() const noexcept {
+        cslt::size_t count = 0;
+        for (const chunk* c = head; c != nullptr; c = c->next)
+            ++count;
+        return count;
+    }
+// --------------------------------------------------------------------------------
+
+    void string_builder::copy_to(char* dest) const noexcept {
+        for_each_chunk([&dest](string_view piece) {
+            std::memcpy(dest, piece.data(), piece.size());
+            dest += piece.size();
+        });
+    }
+// --------------------------------------------------------------------------------
+
+    String string_builder::str() const {
+        return str(polymorphic_allocator<char>());
+    }
+
+    String string_builder::str(const polymorphic_allocator<char>& alloc) const {
+        String result(alloc);
+        result.reserve(len);
+        for_each_chunk([&result](string_view piece) {
+            result.append(piece);
+        });
+        return result;
+    }
+// --------------------------------------------------------------------------------
+
+    std::ostream& string_builder::write_to(std::ostream& os) const {
+        for (const chunk* c = head; c != nullptr && os; c = c->next)
+            os.write(c->data(), static_cast<std::streamsize>(used(c)));
+        return os;
+    }
+// --------------------------------------------------------------------------------
+
+    namespace {
+        [[noreturn]] void throw_write_error(int fd) {
+            char text[256];
+            std::snprintf(text, sizeof(text), "string_builder could not write to descriptor %d: %s",
+                          fd, std::strerror(errno));
+            throw cslt::system_error(text);
+        }
+    }
+
+#if defined(_WIN32)
+    cslt::size_t string_builder::writev(int fd) const {
+        // The CRT has no gathered write, so the chunks are written one by one
+        for (const chunk* c = head; c != nullptr; c = c->next) {
+            const char* data = c->data();
+            cslt::size_t left = used(c);
+            while (left != 0) {
+                const unsigned part = left > 0x40000000u ? 0x40000000u : static_cast<unsigned>(left);
+                const int written = ::_write(fd, data, part);
+                if (written < 0)
+                    throw_write_error(fd);
+                data += written;
+                left -= static_cast<cslt::size_t>(written);
+            }
+        }
+        return len;
+    }
+#else
+    cslt::size_t string_builder::writev(int fd) const {
+        // Well below IOV_MAX, which is at least 16 and usually 1024
+        constexpr int batch = 64;
+        const chunk* c = head;
+        cslt::size_t offset = 0;  // Characters of c already written
+        while (c != nullptr) {
+            struct iovec vec[batch];
+            int count = 0;
+            for (const chunk* p = c; p != nullptr && count < batch; p = p->next) {
+                const cslt::size_t skip = p == c ? offset : 0;
+                const cslt::size_t num = used(p) - skip;
+                if (num == 0)
+                    continue;
+                vec[count].iov_base = const_cast<char*>(p->data() + skip);
+                vec[count].iov_len = num;
+                ++count;
+            }
+            if (count == 0)
+                break;
+            const ssize_t result = ::writev(fd, vec, count);
+            if (result < 0) {
+                if (errno == EINTR)
+                    continue;
+                throw_write_error(fd);
+            }
+            // Moves past the chunks the write completed, stopping inside a
+            // chunk the kernel only partly took
+            cslt::size_t written = static_cast<cslt::size_t>(result);
+            while (c != nullptr && written >= used(c) - offset) {
+                written -= used(c) - offset;
+                offset = 0;
+                c = c->next;
+            }
+            offset += written;
+        }
+        return len;
+    }
+#endif
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,753 @@
+// ================================================================================
+// ================================================================================
+// - File:    string_search.cpp
+// - Purpose: Scalar, SSE2, SSE4.2, AVX2 and NEON search kernels and the table
+//            that selects between them
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "include/string_search.hpp"
+#include "include/config.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#if CSLT_SIMD_SSE2
+    #include <emmintrin.h>
+    // The SSE4.2 and AVX2 kernels are compiled with a target attribute rather
+    // than a global flag and only run once the processor reports support, which
+    // needs the GCC and Clang builtins
+    #if defined(__GNUC__) || defined(__clang__)
+        #include <immintrin.h>
+        #define CSLT_X86_DISPATCH 1
+        #define CSLT_TARGET(isa) __attribute__((target(isa)))
+    #endif
+#elif CSLT_SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+#ifndef CSLT_X86_DISPATCH
+    #define CSLT_X86_DISPATCH 0
+#endif
+// ================================================================================
+// ================================================================================
+
+namespace cslt {
+namespace text {
+
+    namespace {
+        struct kernel_table {
+            kernel kind;
+            cslt::size_t (*find_char)(const char*, cslt::size_t, char);
+            cslt::size_t (*rfind_char)(const char*, cslt::size_t, char);
+            // Only called with 2 <= needle_len <= num
+            cslt::size_t (*find)(const char*, cslt::size_t, const char*, cslt::size_t);
+            cslt::size_t (*find_first_of)(const char*, cslt::size_t, const char*, cslt::size_t);
+            cslt::size_t (*find_first_not_of)(const char*, cslt::size_t, const char*, cslt::size_t);
+            int (*compare_icase)(const char*, const char*, cslt::size_t);
+        };
+// --------------------------------------------------------------------------------
+// Bit scans over the match masks, which are never zero
+
+        inline unsigned lowest_bit(std::uint64_t mask) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_ctzll(mask));
+#else
+            unsigned bit = 0;
+            while ((mask & 1u) == 0) {
+                mask >>= 1;
+                ++bit;
+            }
+            return bit;
+#endif
+        }
+
+        inline unsigned highest_bit(std::uint64_t mask) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return 63u - static_cast<unsigned>(__builtin_clzll(mask));
+#else
+            unsigned bit = 0;
+            while (mask >>= 1)
+                ++bit;
+            return bit;
+#endif
+        }
+// --------------------------------------------------------------------------------
+
+        inline unsigned char fold(char chr) noexcept {
+            const unsigned char value = static_cast<unsigned char>(chr);
+            return static_cast<unsigned>(value - 'A') < 26u ? static_cast<unsigned char>(value + 0x20) : value;
+        }
+// ================================================================================
+// ================================================================================
+// SCALAR KERNELS
+
+        cslt::size_t find_char_scalar(const char* str, cslt::size_t num, char chr) noexcept {
+            const void* hit = std::memchr(str, chr, num);
+            return hit ? static_cast<cslt::size_t>(static_cast<const char*>(hit) - str) : not_found;
+        }
+// --------------------------------------------------------------------------------
+
+        cslt::size_t rfind_char_scalar(const char* str, cslt::size_t num, char chr) noexcept {
+            for (cslt::size_t i = num; i-- > 0;)
+                if (str[i] == chr)
+                    return i;
+            return not_found;
+        }
+// --------------------------------------------------------------------------------
+
+        // Checks the candidates from start on, which is also how the vector
+        // kernels finish once fewer than a register of candidates remain
+        cslt::size_t find_from(const char* str, cslt::size_t num, const char* needle,
+                               cslt::size_t needle_len, cslt::size_t start) noexcept {
+            const char* pos = str + start;
+            const char* const last = str + (num - needle_len) + 1;
+            while (pos < last) {
+                pos = static_cast<const char*>(std::memchr(pos, needle[0], static_cast<cslt::size_t>(last - pos)));
+                if (pos == nullptr)
+                    return not_found;
+                if (std::memcmp(pos + 1, needle + 1, needle_len - 1) == 0)
+                    return static_cast<cslt::size_t>(pos - str);
+                ++pos;
+            }
+            return not_found;
+        }
+
+        cslt::size_t find_scalar(const char* str, cslt::size_t num,
+                                 const char* needle, cslt::size_t needle_len) noexcept {
+            return find_from(str, num, needle, needle_len, 0);
+        }
+
+        // While the first character of the needle is rare, memchr skips ahead
+        // faster than the first and last character filter of the vector
+        // kernels can.  Returns true with the result in index once the search
+        // is over, or false with the position the filter should resume from
+        // after too many candidates failed.
+        bool find_by_first(const char* str, cslt::size_t num, const char* needle,
+                           cslt::size_t needle_len, cslt::size_t& index) noexcept {
+            const char* pos = str;
+            const char* const last = str + (num - needle_len) + 1;
+            for (int misses = 0; misses < 16; ++misses) {
+                pos = static_cast<const char*>(std::memchr(pos, needle[0], static_cast<cslt::size_t>(last - pos)));
+                if (pos == nullptr) {
+                    index = not_found;
+                    return true;
+                }
+                if (std::memcmp(pos + 1, needle + 1, needle_len - 1) == 0) {
+                    index = static_cast<cslt::size_t>(pos - str);
+                    return true;
+                }
+                if (++pos == last) {
+                    index = not_found;
+                    return true;
+                }
+            }
+            index = static_cast<cslt::size_t>(pos - str);
+            return false;
+        }
+// --------------------------------------------------------------------------------
+
+        struct byte_set {
+            bool member[256] = {};
+
+            byte_set(const char* set, cslt::size_t set_len) noexcept {
+                for (cslt::size_t i = 0; i < set_len; ++i)
+                    member[static_cast<unsigned char>(set[i])] = true;
+            }
+
+            bool contains(char chr) const noexcept {
+                return member[static_cast<unsigned char>(chr)];
+            }
+        };
+
+        cslt::size_t find_first_of_scalar(const char* str, cslt::size_t num,
+                                          const char* set, cslt::size_t set_len) noexcept {
+            const byte_set members(set, set_len);
+            for (cslt::size_t i = 0; i < num; ++i)
+                if (members.contains(str[i]))
+                    return i;
+            return not_found;
+        }
+
+        cslt::size_t find_first_not_of_scalar(const char* str, cslt::size_t num,
+                                              const char* set, cslt::size_t set_len) noexcept {
+            const byte_set members(set, set_len);
+            for (cslt::size_t i = 0; i < num; ++i)
+                if (!members.contains(str[i]))
+                    return i;
+            return not_found;
+        }
+// --------------------------------------------------------------------------------
+
+        int compare_icase_scalar(const char* lhs, const char* rhs, cslt::size_t num) noexcept {
+            for (cslt::size_t i = 0; i < num; ++i) {
+                const unsigned char a = fold(lhs[i]);
+                const unsigned char b = fold(rhs[i]);
+                if (a != b)
+                    return a < b ? -1 : 1;
+            }
+            return 0;
+        }
+
+        const kernel_table scalar_table = {
+            kernel::scalar, find_char_scalar, rfind_char_scalar, find_scalar,
+            find_first_of_scalar, find_first_not_of_scalar, compare_icase_scalar
+        };
+// ================================================================================
+// ================================================================================
+// SSE2 KERNELS, 16 characters per step
+
+#if CSLT_SIMD_SSE2
+        // The memchr of glibc is already vectorized, with aligned and unrolled
+        // loads that the kernels below do not match, so the tables keep it
+        // for forward searches of one character there
+#if defined(__GLIBC__)
+        constexpr bool vector_memchr = true;
+#else
+        constexpr bool vector_memchr = false;
+#endif
+
+        inline __m128i load16(const char* str) noexcept {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(str));
+        }
+
+        inline unsigned match16(__m128i block, __m128i target) noexcept {
+            return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, target)));
+        }
+
+        // Marks the bytes that are equal or differ only in the case of a
+        // letter, which folds neither side.  A letter differs from its other
+        // case in bit 0x20 alone, and shifting 'a' to -128 turns the unsigned
+        // range test into one signed comparison.
+        inline __m128i same_icase16(__m128i lhs, __m128i rhs) noexcept {
+            const __m128i flip = _mm_set1_epi8(0x20);
+            const __m128i shifted = _mm_add_epi8(_mm_or_si128(lhs, flip), _mm_set1_epi8(static_cast<char>(0x80 - 'a')));
+            const __m128i letter = _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(-0x80 + 26)));
+            const __m128i case_only = _mm_and_si128(letter, _mm_cmpeq_epi8(_mm_xor_si128(lhs, rhs), flip));
+            return _mm_or_si128(_mm_cmpeq_epi8(lhs, rhs), case_only);
+        }
+// --------------------------------------------------------------------------------
+
+        cslt::size_t find_char_sse2(const char* str, cslt::size_t num, char chr) noexcept {
+            const __m128i target = _mm_set1_epi8(chr);
+            cslt::size_t i = 0;
+            // Four registers per step, tested together, keep long scans at
+            // the speed of the loads
+            for (; i + 64 <= num; i += 64) {
+                const __m128i a = _mm_cmpeq_epi8(load16(str + i), target);
+                const __m128i b = _mm_cmpeq_epi8(load16(str + i + 16), target);
+                const __m128i c = _mm_cmpeq_epi8(load16(str + i + 32), target);
+                const __m128i d = _mm_cmpeq_epi8(load16(str + i + 48), target);
+                if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))) != 0)
+                    break;
+            }
+            for (; i + 16 <= num; i += 16) {
+                const unsigned mask = match16(load16(str + i), target);
+                if (mask != 0)
+                    return i + lowest_bit(mask);
+            }
+            for (; i < num; ++i)
+                if (str[i] == chr)
+                    return i;
+            return not_found;
+        }
+// --------------------------------------------------------------------------------
+
+        cslt::size_t rfind_char_sse2(const char* str, cslt::size_t num, char chr) noexcept {
+            const __m128i target = _mm_set1_epi8(chr);
+            cslt::size_t i = num;
+            for (; i >= 16; i -= 16) {
+                const unsigned mask = match16(load16(str + i - 16), target);
+                if (mask != 0)
+                    return i - 16 + highest_bit(mask);
+            }
+            return rfind_char_scalar(str, i, chr);
+        }
+// --------------------------------------------------------------------------------
+
+        cslt::size_t find_sse2(const char* str, cslt::size_t num,
+                               const char* needle, cslt::size_t needle_len) noexcept {
+            cslt::size_t i = 0;
+            if (find_by_first(str, num, needle, needle_len, i))
+                return i;
+            const __m128i first = _mm_set1_epi8(needle[0]);
+            const __m128i last = _mm_set1_epi8(needle[needle_len - 1]);
+            for (; i + needle_len - 1 + 16 <= num; i += 16) {
+                const __m128i head = _mm_cmpeq_epi8(load16(str + i), first);
+                const __m128i tail = _mm_cmpeq_epi8(load16(str + i + needle_len - 1), last);
+                unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(head, tail)));
+                while (mask != 0) {
+                    const unsigned bit = lowest_bit(mask);
+                    if (std::memcmp(str + i + bit + 1, needle + 1, needle_len - 2) == 0)
+                        return i + bit;
+                    mask &= mask - 1;
+                }
+            }
+            return find_from(str, num, needle, needle_len, i);
+        }
+// --------------------------------------------------------------------------------
+
+        int compare_icase_sse2(const char* lhs, const char* rhs, cslt::size_t num) noexcept {
+            cslt::size_t i = 0;
+            for (; i + 16 <= num; i += 16) {
+                const unsigned same = static_cast<unsigned>(
+                    _mm_movemask_epi8(same_icase16(load16(lhs + i), load16(rhs + i))));
+                if (same != 0xFFFFu) {
+                    const unsigned bit = lowest_bit(~same & 0xFFFFu);
+                    return fold(lhs[i + bit]) < fold(rhs[i + bit]) ? -1 : 1;
+                }
+            }
+            return compare_icase_scalar(lhs + i, rhs + i, num - i);
+        }
+
+        const kernel_table sse2_table = {
+            kernel::sse2, vector_memchr ? find_char_scalar : find_char_sse2, rfind_char_sse2, find_sse2,
+            find_first_of_scalar, find_first_not_of_scalar, compare_icase_sse2
+        };
+#endif
+// ================================================================================
+// ================================================================================
+// SSE4.2 KERNELS, the string instructions test a set of up to 16 characters
+
+#if CSLT_X86_DISPATCH
+        template <int Mode>
+        CSLT_TARGET("sse4.2")
+        cslt::size_t scan_set_sse42(const char* str, cslt::size_t num,
+                                    const char* set, cslt::size_t set_len) noexcept {
+            char chars[16] = {};
+            std::memcpy(chars, set, set_len);
+            const __m128i members = load16(chars);
+            const int count = static_cast<int>(set_len);
+            cslt::size_t i = 0;
+            for (; i + 16 <= num; i += 16) {
+                const int index = _mm_cmpestri(members, count, load16(str + i), 16, Mode);
+                if (index < 16)
+                    return i + static_cast<cslt::size_t>(index);
+            }
+            if (i < num) {
+                // Copying the tail keeps the load inside the caller's memory
+                char tail[16] = {};
+                std::memcpy(tail, str + i, num - i);
+                const int index = _mm_cmpestri(members, count, load16(tail), static_cast<int>(num - i), Mode);
+                if (index < 16)
+                    return i + static_cast<cslt::size_t>(index);
+            }
+            return not_found;
+        }
+
+        cslt::size_t find_first_of_sse42(const char* str, cslt::size_t num,
+                                         const char* set, cslt::size_t set_len) noexcept {
+            if (set_len > 16)
+                return find_first_of_scalar(str, num, set, set_len);
+            return scan_set_sse42<_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT>(
+                str, num, set, set_len);
+        }
+
+        // The masked polarity inverts only the valid bytes, so the padding
+        // after a short tail never reads as a character outside the set
+        cslt::size_t find_first_not_of_sse42(const char* str, cslt::size_t num,
+                                             const char* set, cslt::size_t set_len) noexcept {
+            if (set_len > 16)
+                return find_first_not_of_scalar(str, num, set, set_len);
+            return scan_set_sse42<_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY |
+                                  _SIDD_MASKED_NEGATIVE_POLARITY | _SIDD_LEAST_SIGNIFICANT>(
+                str, num, set, set_len);
+        }
+
+        const kernel_table sse42_table = {
+            kernel::sse42, vector_memchr ? find_char_scalar : find_char_sse2, rfind_char_sse2, find_sse2,
+            find_first_of_sse42, find_first_not_of_sse42, compare_icase_sse2
+        };
+// ================================================================================
+// ================================================================================
+// AVX2 KERNELS, 32 characters per step with the SSE2 kernels for the tail
+//
+// GCC does not clear the upper halves of the registers before a tail call,
+// and SSE code running with them dirty is several times slower, so each
+// kernel calls _mm256_zeroupper itself before handing over.
+
+        CSLT_TARGET("avx2")
+        inline __m256i load32(const char* str) noexcept {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str));
+        }
+
+        CSLT_TARGET("avx2")
+        inline std::uint32_t match32(__m256i block, __m256i target) noexcept {
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, target)));
+        }
+
+        CSLT_TARGET("avx2")
+        inline __m256i same_icase32(__m256i lhs, __m256i rhs) noexcept {
+            const __m256i flip = _mm256_set1_epi8(0x20);
+            const __m256i shifted = _mm256_add_epi8(_mm256_or_si256(lhs, flip),
+                                                    _mm256_set1_epi8(static_cast<char>(0x80 - 'a')));
+            const __m256i letter = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(-0x80 + 26)), shifted);
+            const __m256i case_only = _mm256_and_si256(letter, _mm256_cmpeq_epi8(_mm256_xor_si256(lhs, rhs), flip));
+            return _mm256_or_si256(_mm256_cmpeq_epi8(lhs, rhs), case_only);
+        }
+// --------------------------------------------------------------------------------
+
+        CSLT_TARGET("avx2")
+        cslt::size_t find_char_avx2(const char* str, cslt::size_t num, char chr) noexcept {
+            const __m256i target = _mm256_set1_epi8(chr);
+            cslt::size_t i = 0;
+            for (; i + 128 <= num; i += 128) {
+                const __m256i a = _mm256_cmpeq_epi8(load32(str + i), target);
+                const __m256i b = _mm256_cmpeq_epi8(load32(str + i + 32), target);
+                const __m256i c = _mm256_cmpeq_epi8(load32(str + i + 64), target);
+                const __m256i d = _mm256_cmpeq_epi8(load32(str + i + 96), target);
+                if (_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d))) != 0)
+                    break;
+            }
+            for (; i + 32 <= num; i += 32) {
+                const std::uint32_t mask = match32(load32(str + i), target);
+                if (mask != 0)
+                    return i + lowest_bit(mask);
+            }
+            _mm256_zeroupper();
+            const cslt::size_t rest = find_char_sse2(str + i, num - i, chr);
+            return rest == not_found ? not_found : i + rest;
+        }
+// --------------------------------------------------------------------------------
+
+        CSLT_TARGET("avx2")
+        cslt::size_t rfind_char_avx2(const char* str, cslt::size_t num, char chr) noexcept {
+            const __m256i target = _mm256_set1_epi8(chr);
+            cslt::size_t i = num;
+            for (; i >= 32; i -= 32) {
+                const std::uint32_t mask = match32(load32(str + i - 32), target);
+                if (mask != 0)
+                    return i - 32 + highest_bit(mask);
+            }
+            _mm256_zeroupper();
+            return rfind_char_sse2(str, i, chr);
+        }
+// --------------------------------------------------------------------------------
+
+        CSLT_TARGET("avx2")
+        cslt::size_t find_avx2(const char* str, cslt::size_t num,
+                               const char* needle, cslt::size_t needle_len) noexcept {
+            cslt::size_t i = 0;
+            if (find_by_first(str, num, needle, needle_len, i))
+                return i;
+            const __m256i first = _mm256_set1_epi8(needle[0]);
+            const __m256i last = _mm256_set1_epi8(needle[needle_len - 1]);
+            for (; i + needle_len - 1 + 32 <= num; i += 32) {
+                const __m256i head = _mm256_cmpeq_epi8(load32(str + i), first);
+                const __m256i tail = _mm256_cmpeq_epi8(load32(str + i + needle_len - 1), last);
+                std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(head, tail)));
+                while (mask != 0) {
+                    const unsigned bit = lowest_bit(mask);
+                    if (std::memcmp(str + i + bit + 1, needle + 1, needle_len - 2) == 0)
+                        return i + bit;
+                    mask &= mask - 1;
+                }
+            }
+            _mm256_zeroupper();
+            return find_from(str, num, needle, needle_len, i);
+        }
+// --------------------------------------------------------------------------------
+
+        CSLT_TARGET("avx2")
+        int compare_icase_avx2(const char* lhs, const char* rhs, cslt::size_t num) noexcept {
+            cslt::size_t i = 0;
+            for (; i + 64 <= num; i += 64) {
+                const __m256i a = same_icase32(load32(lhs + i), load32(rhs + i));
+                const __m256i b = same_icase32(load32(lhs + i + 32), load32(rhs + i + 32));
+                if (_mm256_movemask_epi8(_mm256_and_si256(a, b)) != -1)
+                    break;
+            }
+            for (; i + 32 <= num; i += 32) {
+                const std::uint32_t same = static_cast<std::uint32_t>(
+                    _mm256_movemask_epi8(same_icase32(load32(lhs + i), load32(rhs + i))));
+                if (same != 0xFFFFFFFFu) {
+                    const unsigned bit = lowest_bit(~same);
+                    return fold(lhs[i + bit]) < fold(rhs[i + bit]) ? -1 : 1;
+                }
+            }
+            _mm256_zeroupper();
+            return compare_icase_sse2(lhs + i, rhs + i, num - i);
+        }
+
+        const kernel_table avx2_table = {
+            kernel::avx2, vector_memchr ? find_char_scalar : find_char_avx2, rfind_char_avx2, find_avx2,
+            find_first_of_sse42, find_first_not_of_sse42, compare_icase_avx2
+        };
+// --------------------------------------------------------------------------------
+
+        bool cpu_supports(kernel k) noexcept {
+            __builtin_cpu_init();
+            if (k == kernel::sse42)
+                return __builtin_cpu_supports("sse4.2");
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("sse4.2");
+        }
+#endif
+// ================================================================================
+// ================================================================================
+// NEON KERNELS, 16 characters per step
+//
+// NEON has no movemask, so a comparison is narrowed to four bits per byte,
+// which gives a 64 bit mask whose bit index divided by four is the byte index.
+
+#if CSLT_SIMD_NEON
+        inline uint8x16_t load16(const char* str) noexcept {
+            return vld1q_u8(reinterpret_cast<const std::uint8_t*>(str));
+        }
+
+        inline std::uint64_t nibble_mask(uint8x16_t matches) noexcept {
+            const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+            return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+        }
+
+        inline uint8x16_t same_icase16(uint8x16_t lhs, uint8x16_t rhs) noexcept {
+            const uint8x16_t flip = vdupq_n_u8(0x20);
+            const uint8x16_t letter = vcleq_u8(vsubq_u8(vorrq_u8(lhs, flip), vdupq_n_u8('a')), vdupq_n_u8(25));
+            const uint8x16_t case_only = vandq_u8(letter, vceqq_u8(veorq_u8(lhs, rhs), flip));
+            return vorrq_u8(vceqq_u8(lhs, rhs), case_only);
+        }
+// --------------------------------------------------------------------------------
+
+        cslt::size_t find_char_neon(const char* str, cslt::size_t num, char chr) noexcept {
+            const uint8x16_t target = vdupq_n_u8(static_cast<std::uint8_t>(chr));
+            cslt::size_t i = 0;
+            for (; i + 16 <= num; i += 16) {
+                const std::uint64_t mask = nibble_mask(vceqq_u8(load16(str + i), target));
+                if (mask != 0)
+                    return i + lowest_bit(mask) / 4;
+            }
+            for (; i < num; ++i)
+                if (str[i] == chr)
+                    return i;
+            return not_found;
+        }
+// --------------------------------------------------------------------------------
+
+        cslt::size_t rfind_char_neon(const char* str, cslt::size_t num, char chr) noexcept {
+            const uint8x16_t target = vdupq_n_u8(static_cast<std::uint8_t>(chr));
+            cslt::size_t i = num;
+            for (; i >= 16; i -= 16) {
+                const std::uint64_t mask = nibble_mask(vceqq_u8(load16(str + i - 16), target));
+                if (mask != 0)
+                    return i - 16 + highest_bit(mask) / 4;
+            }
+            return rfind_char_scalar(str, i, chr);
+        }
+// --------------------------------------------------------------------------------
+
+        cslt::size_t find_neon(const char* str, cslt::size_t num,
+                               const char* needle, cslt::size_t needle_len) noexcept {
+            cslt::size_t i = 0;
+            if (find_by_first(str, num, needle, needle_len, i))
+                return i;
+            const uint8x16_t first = vdupq_n_u8(static_cast<std::uint8_t>(needle[0]));
+            const uint8x16_t last = vdupq_n_u8(static_cast<std::uint8_t>(needle[needle_len - 1]));
+            for (; i + needle_len - 1 + 16 <= num; i += 16) {
+                const uint8x16_t head = vceqq_u8(load16(str + i), first);
+                const uint8x16_t tail = vceqq_u8(load16(str + i + needle_len - 1), last);
+                // One bit per byte, so clearing the lowest bit moves to the next byte
+                std::uint64_t mask = nibble_mask(vandq_u8(head, tail)) & 0x8888888888888888ULL;
+                while (mask != 0) {
+                    const unsigned byte = lowest_bit(mask) / 4;
+                    if (std::memcmp(str + i + byte + 1, needle + 1, needle_len - 2) == 0)
+                        return i + byte;
+                    mask &= mask - 1;
+                }
+            }
+            return find_from(str, num, needle, needle_len, i);
+        }
+// --------------------------------------------------------------------------------
+
+        int compare_icase_neon(const char* lhs, const char* rhs, cslt::size_t num) noexcept {
+            cslt::size_t i = 0;
+            for (; i + 16 <= num; i += 16) {
+                const uint8x16_t same = same_icase16(load16(lhs + i), load16(rhs + i));
+                const std::uint64_t differ = nibble_mask(vmvnq_u8(same));
+                if (differ != 0) {
+                    const unsigned byte = lowest_bit(differ) / 4;
+                    return fold(lhs[i + byte]) < fold(rhs[i + byte]) ? -1 : 1;
+                }
+            }
+            return compare_icase_scalar(lhs + i, rhs + i, num - i);
+        }
+
+        const kernel_table neon_table = {
+            kernel::neon, find_char_neon, rfind_char_neon, find_neon,
+            find_first_of_scalar, find_first_not_of_scalar, compare_icase_neon
+        };
+#endif
+// ================================================================================
+// ================================================================================
+// DISPATCH
+
+        const kernel_table* table_for(kernel k) noexcept {
+            switch (k) {
+                case kernel::scalar:
+                    return &scalar_table;
+#if CSLT_SIMD_SSE2
+                case kernel::sse2:
+                    return &sse2_table;
+#endif
+#if CSLT_X86_DISPATCH
+                case kernel::sse42:
+                    return cpu_supports(k) ? &sse42_table : nullptr;
+                case kernel::avx2:
+                    return cpu_supports(k) ? &avx2_table : nullptr;
+#endif
+#if CSLT_SIMD_NEON
+                case kernel::neon:
+                    return &neon_table;
+#endif
+                default:
+                    return nullptr;
+            }
+        }
+
+        const kernel_table* best_table() noexcept {
+            const kernel order[] = {kernel::avx2, kernel::sse42, kernel::sse2, kernel::neon};
+            for (kernel k : order)
+                if (const kernel_table* found = table_for(k))
+                    return found;
+            return &scalar_table;
+        }
+// --------------------------------------------------------------------------------
+
+        // Starts null, which is constant initialized, so searches made by the
+        // constructors of other static objects still find a table.  Two threads
+        // racing on the first call store the same pointer.
+        std::atomic<const kernel_table*> current{nullptr};
+
+        const kernel_table& table() noexcept {
+            const kernel_table* found = current.load(std::memory_order_acquire);
+            if (found == nullptr) {
+                found = best_table();
+                current.store(found, std::memory_order_release);
+            }
+            return *found;
+        }
+    } /* end of anonymous namespace */
+// ================================================================================
+// ================================================================================
+
+    const char* kernel_name(kernel k) noexcept {
+        switch (k) {
+            case kernel::scalar: return "scalar";
+            case kernel::sse2: return "sse2";
+            case kernel::sse42: return "sse4.2";
+            case kernel::avx2: return "avx2";
+            case kernel::neon: return "neon";
+        }
+        return "unknown";
+    }
+// --------------------------------------------------------------------------------
+
+    bool kernel_supported(kernel k) noexcept {
+        return table_for(k) != nullptr;
+    }
+// --------------------------------------------------------------------------------
+
+    kernel active_kernel() noexcept {
+        return table().kind;
+    }
+// --------------------------------------------------------------------------------
+
+    bool select_kernel(kernel k) noexcept {
+        const kernel_table* found = table_for(k);
+        if (found == nullptr)
+            return false;
+        current.store(found, std::memory_order_release);
+        return true;
+    }
+// ================================================================================
+// ================================================================================
+
+    cslt::size_t find_char(const char* str, cslt::size_t num, char chr) noexcept {
+        return num == 0 ? not_found : table().find_char(str, num, chr);
+    }
+// --------------------------------------------------------------------------------
+
+    cslt::size_t rfind_char(const char* str, cslt::size_t num, char chr) noexcept {
+        return num == 0 ? not_found : table().rfind_char(str, num, chr);
+    }
+// --------------------------------------------------------------------------------
+
+    cslt::size_t find(const char* str, cslt::size_t num,
+                      const char* needle, cslt::size_t needle_len) noexcept {
+        if (needle_len == 0)
+            return 0;
+        if (needle_len > num)
+            return not_found;
+        if (needle_len == 1)
+            return table().find_char(str, num, needle[0]);
+        return table().find(str, num, needle, needle_len);
+    }
+// --------------------------------------------------------------------------------
+
+    cslt::size_t rfind(const char* str, cslt::size_t num,
+                       const char* needle, cslt::size_t needle_len) noexcept {
+        if (needle_len == 0)
+            return num;
+        if (needle_len > num)
+            return not_found;
+        // Walks left over the occurrences of the first character among the
+        // positions where the whole needle would still fit
+        const kernel_table& kernels = table();
+        cslt::size_t end = num - needle_len + 1;
+        while (end > 0) {
+            const cslt::size_t pos = kernels.rfind_char(str, end, needle[0]);
+            if (pos == not_found)
+                return not_found;
+            if (std::memcmp(str + pos + 1, needle + 1, needle_len - 1) == 0)
+                return pos;
+            end = pos;
+        }
+        return not_found;
+    }
+// --------------------------------------------------------------------------------
+
+    cslt::size_t find_first_of(const char* str, cslt::size_t num,
+                               const char* set, cslt::size_t set_len) noexcept {
+        if (num == 0 || set_len == 0)
+            return not_found;
+        if (set_len == 1)
+            return table().find_char(str, num, set[0]);
+        return table().find_first_of(str, num, set, set_len);
+    }
+// --------------------------------------------------------------------------------
+
+    cslt::size_t find_first_not_of(const char* str, cslt::size_t num,
+                                   const char* set, cslt::size_t set_len) noexcept {
+        if (num == 0)
+            return not_found;
+        if (set_len == 0)
+            return 0;
+        return table().find_first_not_of(str, num, set, set_len);
+    }
+// --------------------------------------------------------------------------------
+
+    // The C library already provides vectorized memcmp for each platform,
+    // and a kernel of our own would only match it
+    int compare(const char* lhs, const char* rhs, cslt::size_t num) noexcept {
+        return num == 0 ? 0 : std::memcmp(lhs, rhs, num);
+    }
+// --------------------------------------------------------------------------------
+
+    bool equal(const char* lhs, const char* rhs, cslt::size_t num) noexcept {
+        return num == 0 || std::memcmp(lhs, rhs, num) == 0;
+    }
+// --------------------------------------------------------------------------------
+
+    int compare_icase(const char* lhs, const char* rhs, cslt::size_t num) noexcept {
+        return num == 0 ? 0 : table().compare_icase(lhs, rhs, num);
+    }
+} /* end of text namespace */
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,189 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_charconv.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the to_chars functions in charconv.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <clocale>
+#include <limits>
+#include <random>
+#include <string>
+#include "../include/charconv.hpp"
+
+template <typename T>
+static std::string integer_text(T value) {
+    char text[cslt::max_integer_chars];
+    const cslt::to_chars_result result = cslt::to_chars(text, text + sizeof(text), value);
+    EXPECT_EQ(std::errc(), result.ec);
+    return std::string(text, result.ptr);
+}
+
+static std::string double_text(double value) {
+    char text[cslt::max_double_chars];
+    const cslt::to_chars_result result = cslt::to_chars(text, text + sizeof(text), value);
+    EXPECT_EQ(std::errc(), result.ec);
+    return std::string(text, result.ptr);
+}
+
+static std::string fixed_text(double value, int precision) {
+    char text[512];
+    const cslt::to_chars_result result = cslt::to_chars(text, text + sizeof(text), value, precision);
+    EXPECT_EQ(std::errc(), result.ec);
+    return std::string(text, result.ptr);
+}
+
+static std::string printf_fixed(double value, int precision) {
+    char text[512];
+    const int num = std::snprintf(text, sizeof(text), "%.*f", precision, value);
+    return std::string(text, static_cast<std::size_t>(num));
+}
+// ================================================================================
+// ================================================================================
+
+TEST(CharconvTest, IntegerLimits) {
+    EXPECT_EQ("0", integer_text(0));
+    EXPECT_EQ("-1", integer_text(-1));
+    EXPECT_EQ("127", integer_text(std::numeric_limits<std::int8_t>::max()));
+    EXPECT_EQ("-128", integer_text(std::numeric_limits<std::int8_t>::min()));
+    EXPECT_EQ("4294967295", integer_text(std::numeric_limits<std::uint32_t>::max()));
+    EXPECT_EQ("-9223372036854775808", integer_text(std::numeric_limits<std::int64_t>::min()));
+    EXPECT_EQ("18446744073709551615", integer_text(std::numeric_limits<std::uint64_t>::max()));
+}
+// --------------------------------------------------------------------------------
+
+TEST(CharconvTest, IntegerEveryDigitCount) {
+    std::uint64_t value = 1;
+    for (int digits = 1; digits <= 19; ++digits) {
+        EXPECT_EQ(std::to_string(value), integer_text(value));
+        EXPECT_EQ(std::to_string(value - 1), integer_text(value - 1));
+        value *= 10;
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(CharconvTest, IntegerTooLarge) {
+    char text[4];
+    cslt::to_chars_result result = cslt::to_chars(text, text + 4, 12345);
+    EXPECT_EQ(std::errc::value_too_large, result.ec);
+    EXPECT_EQ(text + 4, result.ptr);
+    result = cslt::to_chars(text, text + 4, -999);
+    EXPECT_EQ(std::errc(), result.ec);
+    EXPECT_EQ("-999", std::string(text, result.ptr));
+}
+// --------------------------------------------------------------------------------
+
+TEST(CharconvTest, DoubleShortest) {
+    EXPECT_EQ("0", double_text(0.0));
+    EXPECT_EQ("-0", double_text(-0.0));
+    EXPECT_EQ("0.1", double_text(0.1));
+    EXPECT_EQ("1.5", double_text(1.5));
+    EXPECT_EQ("0.30000000000000004", double_text(0.1 + 0.2));
+    EXPECT_EQ("1e+100", double_text(1e100));
+    EXPECT_EQ("inf", double_text(std::numeric_limits<double>::infinity()));
+    EXPECT_EQ("-inf", double_text(-std::numeric_limits<double>::infinity()));
+    EXPECT_EQ("nan", double_text(std::numeric_limits<double>::quiet_NaN()));
+}
+// --------------------------------------------------------------------------------
+
+TEST(CharconvTest, DoubleRoundTrips) {
+    std::mt19937_64 gen(7);
+    std::uniform_real_distribution<double> exponent(-300.0, 300.0);
+    for (int i = 0; i < 10000; ++i) {
+        const double value = std::pow(10.0, exponent(gen)) * (i % 2 ? -1.0 : 1.0);
+        const std::string text = double_text(value);
+        EXPECT_EQ(value, std::strtod(text.c_str(), nullptr)) << text;
+    }
+    EXPECT_EQ(std::numeric_limits<double>::max(), std::strtod(double_text(std::numeric_limits<double>::max()).c_str(), nullptr));
+    EXPECT_EQ(std::numeric_limits<double>::denorm_min(), std::strtod(double_text(std::numeric_limits<double>::denorm_min()).c_str(), nullptr));
+}
+// --------------------------------------------------------------------------------
+
+TEST(CharconvTest, SubnormalShortest) {
+    EXPECT_EQ("5e-324", double_text(std::numeric_limits<double>::denorm_min()));
+    EXPECT_EQ("-1e-323", double_text(-2 * std::numeric_limits<double>::denorm_min()));
+    EXPECT_EQ("1e-310", double_text(1e-310));
+    EXPECT_EQ("2.225073858507201e-308", double_text(std::nextafter(std::numeric_limits<double>::min(), 0.0)));
+    // No shorter form of a random subnormal reads back as the same value
+    std::mt19937_64 gen(13);
+    std::uniform_int_distribution<std::uint64_t> bits(1, (std::uint64_t(1) << 52) - 1);
+    for (int i = 0; i < 2000; ++i) {
+        const double value = std::ldexp(static_cast<double>(bits(gen) >> (i % 52)), -1074);
+        const std::string text = double_text(value);
+        ASSERT_EQ(value, std::strtod(text.c_str(), nullptr)) << text;
+        const int digits = static_cast<int>(text.find_first_of('e')) - (text.find('.') == std::string::npos ? 0 : 1);
+        if (digits > 1) {
+            char shorter[320];
+            std::snprintf(shorter, sizeof(shorter), "%.*g", digits - 1, value);
+            EXPECT_NE(value, std::strtod(shorter, nullptr)) << text;
+        }
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(CharconvTest, IgnoresNumericLocale) {
+    const char* names[] = {"de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8", "fr_FR.utf8", "German"};
+    const std::string saved = std::setlocale(LC_NUMERIC, nullptr);
+    bool found = false;
+    for (const char* name : names) {
+        if (std::setlocale(LC_NUMERIC, name) != nullptr) {
+            found = true;
+            break;
+        }
+    }
+    if (!found)
+        GTEST_SKIP() << "no locale with a comma decimal point is installed";
+    const std::string shortest = double_text(1.5);
+    const std::string subnormal = double_text(1e-310);
+    const std::string fixed = fixed_text(2.5, 12);
+    std::setlocale(LC_NUMERIC, saved.c_str());
+    EXPECT_EQ("1.5", shortest);
+    EXPECT_EQ("1e-310", subnormal);
+    EXPECT_EQ("2.500000000000", fixed);
+}
+// --------------------------------------------------------------------------------
+
+TEST(CharconvTest, FixedMatchesPrintf) {
+    std::mt19937_64 gen(11);
+    std::uniform_real_distribution<double> small(-1000.0, 1000.0);
+    for (int i = 0; i < 20000; ++i) {
+        const double value = small(gen);
+        const int precision = i % 10;
+        EXPECT_EQ(printf_fixed(value, precision), fixed_text(value, precision)) << value;
+    }
+    // Exact ties, values close to the 1e15 limit and the printf fallbacks
+    const double values[] = {0.125, 2.5, -0.0, -0.001, 0.999999999, 999999999999999.0,
+                             1e15, 123456789.987654321, 1e300, -5e-320};
+    for (double value : values) {
+        for (int precision = 0; precision <= 12; ++precision)
+            EXPECT_EQ(printf_fixed(value, precision), fixed_text(value, precision)) << value;
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(CharconvTest, FixedTooLarge) {
+    char text[6];
+    cslt::to_chars_result result = cslt::to_chars(text, text + 6, 3.14159, 4);
+    EXPECT_EQ(std::errc(), result.ec);
+    EXPECT_EQ("3.1416", std::string(text, result.ptr));
+    result = cslt::to_chars(text, text + 6, -3.14159, 4);
+    EXPECT_EQ(std::errc::value_too_large, result.ec);
+    result = cslt::to_chars(text, text + 6, 1e300, 0);
+    EXPECT_EQ(std::errc::value_too_large, result.ec);
+}
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,295 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_concurrent_queue.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests spsc_queue and mpmc_queue in concurrent_queue.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+#include "../include/concurrent_queue.hpp"
+#include "../include/except.hpp"
+
+namespace {
+    // Counts live instances, so a test can see that no element leaked
+    struct tracked {
+        static int live;
+        int value = 0;
+
+        explicit tracked(int v = 0) : value(v) {++live;}
+        tracked(const tracked& other) : value(other.value) {++live;}
+        tracked(tracked&& other) noexcept : value(other.value) {++live;}
+        tracked& operator=(const tracked& other) {value = other.value; return *this;}
+        tracked& operator=(tracked&& other) noexcept {value = other.value; return *this;}
+        ~tracked() {--live;}
+    };
+
+    int tracked::live = 0;
+
+    // Construction from a negative value throws
+    struct picky {
+        int value = 0;
+
+        picky() = default;
+        explicit picky(int v) : value(v) {
+            if (v < 0)
+                throw cslt::invalid_argument("negative");
+        }
+        picky(picky&&) noexcept = default;
+        picky& operator=(picky&&) noexcept = default;
+    };
+}
+// ================================================================================
+// ================================================================================
+// SPSC_QUEUE TESTS
+
+TEST(SpscQueueTest, FifoAndCapacity) {
+    cslt::spsc_queue<int> queue(5);
+    EXPECT_EQ(8u, queue.capacity());
+    EXPECT_TRUE(queue.empty());
+    for (int i = 0; i < 8; ++i)
+        EXPECT_TRUE(queue.try_push(i));
+    EXPECT_FALSE(queue.try_push(8));
+    EXPECT_EQ(8u, queue.size_approx());
+    int value = -1;
+    for (int i = 0; i < 8; ++i) {
+        ASSERT_TRUE(queue.try_pop(value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_FALSE(queue.try_pop(value));
+    EXPECT_TRUE(queue.empty());
+}
+// --------------------------------------------------------------------------------
+
+TEST(SpscQueueTest, MoveOnlyElements) {
+    cslt::spsc_queue<cslt::unique_ptr<int>> queue(2);
+    EXPECT_TRUE(queue.try_push(cslt::unique_ptr<int>(new int(1))));
+    EXPECT_TRUE(queue.try_emplace(new int(2)));
+    // A full queue leaves the argument with its owner
+    cslt::unique_ptr<int> third(new int(3));
+    EXPECT_FALSE(queue.try_push(cslt::move(third)));
+    ASSERT_TRUE(static_cast<bool>(third));
+    cslt::unique_ptr<int> out(nullptr);
+    ASSERT_TRUE(queue.try_pop(out));
+    EXPECT_EQ(1, *out);
+    EXPECT_TRUE(queue.try_push(cslt::move(third)));
+    EXPECT_FALSE(static_cast<bool>(third));
+    ASSERT_TRUE(queue.try_pop(out));
+    EXPECT_EQ(2, *out);
+    ASSERT_TRUE(queue.try_pop(out));
+    EXPECT_EQ(3, *out);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SpscQueueTest, BatchedPushAndPop) {
+    cslt::spsc_queue<int> queue(16);
+    std::vector<int> source(40);
+    for (int i = 0; i < 40; ++i)
+        source[i] = i;
+    EXPECT_EQ(16u, queue.try_push_n(source.begin(), 40));
+    EXPECT_EQ(0u, queue.try_push_n(source.begin(), 1));
+    std::vector<int> sink(10, -1);
+    EXPECT_EQ(10u, queue.try_pop_n(sink.begin(), 10));
+    for (int i = 0; i < 10; ++i)
+        EXPECT_EQ(i, sink[i]);
+    // The batch wraps around the end of the ring
+    EXPECT_EQ(10u, queue.try_push_n(source.begin() + 16, 24));
+    std::vector<int> rest(20, -1);
+    EXPECT_EQ(16u, queue.try_pop_n(rest.begin(), 20));
+    for (int i = 0; i < 16; ++i)
+        EXPECT_EQ(i + 10, rest[i]);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SpscQueueTest, DestructorDestroysRemainingItems) {
+    tracked::live = 0;
+    {
+        cslt::spsc_queue<tracked> queue(8);
+        for (int i = 0; i < 6; ++i)
+            queue.try_emplace(i);
+        tracked out;
+        queue.try_pop(out);
+        EXPECT_EQ(6, tracked::live);
+    }
+    EXPECT_EQ(0, tracked::live);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SpscQueueTest, BlockingTransferKeepsOrder) {
+    const int total = 200000;
+    cslt::spsc_queue<int> queue(16);
+    std::thread producer([&queue] {
+        int block[7];
+        for (int i = 0; i < total;) {
+            if (i % 3 == 0 && total - i >= 7) {
+                for (int j = 0; j < 7; ++j)
+                    block[j] = i + j;
+                queue.push_n(block, 7);
+                i += 7;
+            }
+            else {
+                queue.push(i++);
+            }
+        }
+    });
+    int expected = 0;
+    bool ordered = true;
+    int batch[5];
+    while (expected < total) {
+        const cslt::size_t num = queue.pop_n(batch, 5);
+        for (cslt::size_t j = 0; j < num; ++j)
+            ordered = ordered && batch[j] == expected++;
+        if (expected < total) {
+            int value = 0;
+            queue.pop(value);
+            ordered = ordered && value == expected++;
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(queue.empty());
+}
+// --------------------------------------------------------------------------------
+
+TEST(SpscQueueTest, RejectsHugeCapacity) {
+    EXPECT_THROW(cslt::spsc_queue<int>(std::numeric_limits<cslt::size_t>::max()), cslt::length_error);
+}
+// ================================================================================
+// ================================================================================
+// MPMC_QUEUE TESTS
+
+TEST(MpmcQueueTest, FifoAndCapacity) {
+    cslt::mpmc_queue<int> queue(3);
+    EXPECT_EQ(4u, queue.capacity());
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(queue.try_push(i));
+    EXPECT_FALSE(queue.try_push(4));
+    int value = -1;
+    for (int lap = 0; lap < 3; ++lap) {
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(queue.try_pop(value));
+            EXPECT_EQ(lap * 4 + i, value);
+            EXPECT_TRUE(queue.try_push((lap + 1) * 4 + i));
+        }
+    }
+    EXPECT_EQ(4u, queue.size_approx());
+}
+// --------------------------------------------------------------------------------
+
+TEST(MpmcQueueTest, BatchesStopAtFullOrEmpty) {
+    cslt::mpmc_queue<cslt::unique_ptr<int>> queue(8);
+    std::vector<cslt::unique_ptr<int>> source;
+    for (int i = 0; i < 12; ++i)
+        source.push_back(cslt::unique_ptr<int>(new int(i)));
+    EXPECT_EQ(8u, queue.try_push_n(source.begin(), 12));
+    EXPECT_FALSE(static_cast<bool>(source[7]));
+    EXPECT_TRUE(static_cast<bool>(source[8]));
+    std::vector<cslt::unique_ptr<int>> sink;
+    for (int i = 0; i < 12; ++i)
+        sink.push_back(cslt::unique_ptr<int>(nullptr));
+    EXPECT_EQ(3u, queue.try_pop_n(sink.begin(), 3));
+    EXPECT_EQ(3u, queue.try_push_n(source.begin() + 8, 4));
+    EXPECT_EQ(8u, queue.try_pop_n(sink.begin() + 3, 9));
+    for (int i = 0; i < 11; ++i)
+        EXPECT_EQ(i, *sink[static_cast<cslt::size_t>(i)]);
+    EXPECT_EQ(0u, queue.try_pop_n(sink.begin(), 4));
+}
+// --------------------------------------------------------------------------------
+
+TEST(MpmcQueueTest, ThrowingConstructionLeavesQueueUsable) {
+    cslt::mpmc_queue<picky> queue(4);
+    EXPECT_TRUE(queue.try_emplace(1));
+    EXPECT_THROW(queue.try_emplace(-1), cslt::invalid_argument);
+    EXPECT_TRUE(queue.try_emplace(2));
+    picky out;
+    ASSERT_TRUE(queue.try_pop(out));
+    EXPECT_EQ(1, out.value);
+    ASSERT_TRUE(queue.try_pop(out));
+    EXPECT_EQ(2, out.value);
+    EXPECT_FALSE(queue.try_pop(out));
+}
+// --------------------------------------------------------------------------------
+
+TEST(MpmcQueueTest, DestructorDestroysRemainingItems) {
+    tracked::live = 0;
+    {
+        cslt::mpmc_queue<tracked> queue(8);
+        for (int i = 0; i < 5; ++i)
+            queue.try_push(tracked(i));
+        EXPECT_EQ(5, tracked::live);
+    }
+    EXPECT_EQ(0, tracked::live);
+}
+// --------------------------------------------------------------------------------
+
+TEST(MpmcQueueTest, ManyProducersManyConsumers) {
+    const int producers = 4;
+    const int consumers = 3;
+    const int per_producer = 50000;
+    cslt::mpmc_queue<int> queue(64);
+    std::vector<std::atomic<int>> seen(static_cast<cslt::size_t>(producers * per_producer));
+    std::atomic<int> consumed{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, p] {
+            int block[4];
+            for (int i = 0; i < per_producer; i += 4) {
+                const int base = p * per_producer + i;
+                if (p % 2 == 0) {
+                    for (int j = 0; j < 4; ++j)
+                        block[j] = base + j;
+                    queue.push_n(block, 4);
+                }
+                else {
+                    for (int j = 0; j < 4; ++j)
+                        queue.push(base + j);
+                }
+            }
+        });
+    }
+    const int stop = -1;
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c] {
+            int batch[8];
+            for (;;) {
+                const cslt::size_t num = c == 0 ? queue.pop_n(batch, 8) : (queue.pop(batch[0]), 1u);
+                for (cslt::size_t j = 0; j < num; ++j) {
+                    if (batch[j] == stop) {
+                        // Only markers follow; hand back any meant for the others
+                        for (cslt::size_t k = j + 1; k < num; ++k)
+                            queue.push(stop);
+                        return;
+                    }
+                    seen[static_cast<cslt::size_t>(batch[j])].fetch_add(1);
+                    consumed.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (int p = 0; p < producers; ++p)
+        threads[static_cast<cslt::size_t>(p)].join();
+    // The markers go in only after every item is out, one per consumer
+    while (consumed.load() < producers * per_producer)
+        std::this_thread::yield();
+    for (int c = 0; c < consumers; ++c)
+        queue.push(stop);
+    for (int c = 0; c < consumers; ++c)
+        threads[static_cast<cslt::size_t>(producers + c)].join();
+    for (cslt::size_t i = 0; i < seen.size(); ++i)
+        ASSERT_EQ(1, seen[i].load()) << "item " << i;
+}
+// ================================================================================
+// ================================================================================
+// eof
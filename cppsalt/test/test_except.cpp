@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 #include "../include/except.hpp"
+#include <cstring>
 
 // ================================================================================
 // ================================================================================ 
@@ -890,4 +891,93 @@ TEST_F(FormatErrorTest, CanBeCaughtAsBaseType) {
 }
 // ================================================================================
 // ================================================================================
+// TEST ERROR_MESSAGE STORAGE
+
+TEST(ErrorMessageTest, LiteralIsStoredByPointer) {
+    cslt::out_of_range error(CSLT_LITERAL("Index out of range"));
+    EXPECT_STREQ(error.what(), "Index out of range");
+    cslt::out_of_range copy(error);
+    EXPECT_EQ(copy.what(), error.what());
+    EXPECT_FALSE(cslt::error_message(CSLT_LITERAL("Index out of range")).is_shared());
+}
+// --------------------------------------------------------------------------------
+
+TEST(ErrorMessageTest, DefaultMessageIsNotCopied) {
+    cslt::length_error first;
+    cslt::length_error second;
+    EXPECT_EQ(first.what(), second.what());
+}
+// --------------------------------------------------------------------------------
+
+TEST(ErrorMessageTest, DynamicTextIsCopiedOnce) {
+    char buffer[32];
+    std::strcpy(buffer, "value 42 rejected");
+    cslt::invalid_argument error(buffer);
+    std::strcpy(buffer, "overwritten");
+    EXPECT_STREQ(error.what(), "value 42 rejected");
+
+    const char* pointer = buffer;
+    cslt::runtime_error from_pointer(pointer);
+    EXPECT_NE(from_pointer.what(), pointer);
+    EXPECT_STREQ(from_pointer.what(), "overwritten");
+}
+// --------------------------------------------------------------------------------
+
+TEST(ErrorMessageTest, CopiesShareTheBuffer) {
+    char buffer[] = "shared text";
+    cslt::runtime_error original(buffer);
+    cslt::runtime_error copy(original);
+    EXPECT_EQ(copy.what(), original.what());
+    cslt::runtime_error assigned;
+    assigned = copy;
+    EXPECT_EQ(assigned.what(), original.what());
+    {
+        cslt::runtime_error temp(original);
+    }
+    EXPECT_STREQ(original.what(), "shared text");
+}
+// --------------------------------------------------------------------------------
+
+TEST(ErrorMessageTest, MessageKindIsReported) {
+    char buffer[] = "dynamic";
+    cslt::error_message literal(CSLT_LITERAL("literal"));
+    cslt::error_message dynamic(buffer);
+    cslt::error_message unmarked("unmarked");
+    EXPECT_FALSE(literal.is_shared());
+    EXPECT_STREQ(literal.c_str(), "literal");
+    EXPECT_TRUE(dynamic.is_shared());
+    EXPECT_TRUE(unmarked.is_shared());
+    cslt::error_message empty(static_cast<const char*>(nullptr));
+    EXPECT_STREQ(empty.c_str(), "");
+}
+// --------------------------------------------------------------------------------
+
+// A const array may be a local buffer, so it is copied like any other text
+static cslt::runtime_error error_from_local_array() {
+    const char local[] = "local";
+    cslt::runtime_error error(local);
+    EXPECT_NE(error.what(), local);
+    return error;
+}
+
+TEST(ErrorMessageTest, ConstArrayIsCopied) {
+    const cslt::runtime_error error = error_from_local_array();
+    EXPECT_STREQ(error.what(), "local");
+    const cslt::runtime_error defaulted;
+    EXPECT_STREQ(defaulted.what(), "Runtime Error Raised!");
+}
+// --------------------------------------------------------------------------------
+
+TEST(ErrorMessageTest, EmergencyBadAlloc) {
+    const cslt::bad_alloc& emergency = cslt::emergency_bad_alloc();
+    EXPECT_EQ(&emergency, &cslt::emergency_bad_alloc());
+    try {
+        cslt::throw_bad_alloc();
+        FAIL() << "Expected cslt::bad_alloc";
+    } catch (const cslt::bad_alloc& e) {
+        EXPECT_EQ(e.what(), emergency.what());
+    }
+}
+// ================================================================================
+// ================================================================================
 // eof
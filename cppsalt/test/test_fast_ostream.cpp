@@ -0,0 +1,176 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_fast_ostream.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the fast_ostream class in fast_ostream.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <thread>
+#include "../include/fast_ostream.hpp"
+#include "../include/except.hpp"
+#include "../include/string.hpp"
+
+// A temporary file to write to through its descriptor
+class temp_output {
+    std::FILE* file = std::tmpfile();
+public:
+    ~temp_output() {std::fclose(file);}
+    int fd() const {return fileno(file);}
+
+    std::string contents() const {
+        std::string text;
+        std::rewind(file);
+        char block[4096];
+        std::size_t num;
+        while ((num = std::fread(block, 1, sizeof(block), file)) != 0)
+            text.append(block, num);
+        return text;
+    }
+};
+
+static_assert(cslt::format_field_count("{} and {}", 9) == 2, "two fields");
+static_assert(cslt::format_field_count("{{}} {}", 7) == 1, "escaped braces are not fields");
+static_assert(cslt::format_field_count("{x}", 3) == -1, "a field takes no specification");
+static_assert(cslt::format_field_count("}", 1) == -1, "unmatched close brace");
+// ================================================================================
+// ================================================================================
+
+TEST(FastOstreamTest, WritesValues) {
+    temp_output out;
+    {
+        cslt::fast_ostream os(out.fd());
+        os << "text " << cslt::string_view("view ") << cslt::String("string ") << 'c' << ' '
+           << true << ' ' << -42 << ' ' << std::numeric_limits<std::uint64_t>::max() << ' '
+           << 0.25 << ' ' << cslt::fixed(3.14159, 3) << ' ' << cslt::hex(255) << ' ' << cslt::hex(0);
+    }
+    EXPECT_EQ("text view string c true -42 18446744073709551615 0.25 3.142 ff 0", out.contents());
+}
+// --------------------------------------------------------------------------------
+
+TEST(FastOstreamTest, PrintFormat) {
+    temp_output out;
+    {
+        cslt::fast_ostream os(out.fd());
+        os.print(CSLT_FORMAT("id={} name={} ratio={}"), 7, "item", 0.5);
+        os.println(CSLT_FORMAT(" {{literal}} {}"), cslt::fixed(2.0, 2));
+        os.println(CSLT_FORMAT("no fields"));
+        os.print(CSLT_FORMAT("{}{}"), 1, 2);
+    }
+    EXPECT_EQ("id=7 name=item ratio=0.5 {literal} 2.00\nno fields\n12", out.contents());
+}
+// --------------------------------------------------------------------------------
+
+TEST(FastOstreamTest, BuffersUntilFlush) {
+    temp_output out;
+    cslt::fast_ostream os(out.fd());
+    os << "held" << 123;
+    EXPECT_EQ(7u, os.buffered());
+    EXPECT_EQ("", out.contents());
+    os.flush();
+    EXPECT_EQ(0u, os.buffered());
+    EXPECT_EQ("held123", out.contents());
+}
+// --------------------------------------------------------------------------------
+
+TEST(FastOstreamTest, FullBufferKeepsPartialLine) {
+    temp_output out;
+    cslt::fast_ostream os(out.fd(), 64);
+    EXPECT_EQ(64u, os.capacity());
+    std::string expected;
+    for (int i = 0; i < 100; ++i) {
+        os.print(CSLT_FORMAT("record {}\n"), i);
+        expected += "record " + std::to_string(i) + "\n";
+        // Whatever reached the file ends on a line boundary
+        const std::string written = out.contents();
+        EXPECT_TRUE(written.empty() || written.back() == '\n');
+    }
+    os.flush();
+    EXPECT_EQ(expected, out.contents());
+}
+// --------------------------------------------------------------------------------
+
+TEST(FastOstreamTest, LargeWriteGoesDirect) {
+    temp_output out;
+    cslt::fast_ostream os(out.fd(), 64);
+    os << "head ";
+    const std::string big(1000, 'z');
+    os.write(big.data(), big.size());
+    EXPECT_EQ(0u, os.buffered());
+    os << " tail";
+    os.flush();
+    EXPECT_EQ("head " + big + " tail", out.contents());
+}
+// --------------------------------------------------------------------------------
+
+TEST(FastOstreamTest, LineLongerThanBuffer) {
+    temp_output out;
+    cslt::fast_ostream os(out.fd(), 64);
+    std::string expected;
+    for (int i = 0; i < 40; ++i) {
+        os << "word" << i << ' ';
+        expected += "word" + std::to_string(i) + " ";
+    }
+    os.flush();
+    EXPECT_EQ(expected, out.contents());
+}
+// --------------------------------------------------------------------------------
+
+TEST(FastOstreamTest, EachLinePolicy) {
+    temp_output out;
+    cslt::fast_ostream os(out.fd(), 4096, cslt::flush_policy::each_line);
+    os << "partial";
+    EXPECT_EQ("", out.contents());
+    os << " line\n" << "next";
+    EXPECT_EQ("partial line\n", out.contents());
+    EXPECT_EQ(4u, os.buffered());
+}
+// --------------------------------------------------------------------------------
+
+TEST(FastOstreamTest, EachWritePolicy) {
+    temp_output out;
+    cslt::fast_ostream os(out.fd(), 4096, cslt::flush_policy::each_write);
+    os.print(CSLT_FORMAT("a={} b={}"), 1, 2);
+    EXPECT_EQ(0u, os.buffered());
+    EXPECT_EQ("a=1 b=2", out.contents());
+    os.policy(cslt::flush_policy::when_full);
+    os << "x";
+    EXPECT_EQ(1u, os.buffered());
+    EXPECT_EQ(cslt::flush_policy::when_full, os.policy());
+}
+// --------------------------------------------------------------------------------
+
+TEST(FastOstreamTest, BadDescriptorThrows) {
+    cslt::fast_ostream os(-1);
+    os << "text";
+    EXPECT_THROW(os.flush(), cslt::system_error);
+    EXPECT_EQ(0u, os.buffered());
+}
+// --------------------------------------------------------------------------------
+
+TEST(FastOstreamTest, ThreadLocalStreams) {
+    cslt::fast_ostream* main_out = &cslt::fast_out();
+    cslt::fast_ostream* other_out = nullptr;
+    std::thread worker([&other_out] {other_out = &cslt::fast_out();});
+    worker.join();
+    EXPECT_EQ(main_out, &cslt::fast_out());
+    EXPECT_NE(main_out, other_out);
+    EXPECT_EQ(1, cslt::fast_out().descriptor());
+    EXPECT_EQ(2, cslt::fast_err().descriptor());
+    EXPECT_EQ(cslt::flush_policy::each_write, cslt::fast_err().policy());
+}
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,370 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_flat_hash_map.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the classes in flat_hash_map.hpp and hash.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include "../include/flat_hash_map.hpp"
+#include "../include/memory_resource.hpp"
+#include "../include/string.hpp"
+
+// Sends every key to the same probe sequence so that lookups must rely on
+// the tags and the tombstones
+struct CollidingHash {
+    cslt::size_t operator()(int) const noexcept {return 42;}
+};
+
+// Throws once its shared countdown reaches zero; a negative count never throws
+struct ThrowingHash {
+    int* countdown;
+    cslt::size_t operator()(int key) const {
+        if (*countdown >= 0 && (*countdown)-- == 0)
+            throw std::runtime_error("hash failed");
+        return cslt::hash<int>()(key);
+    }
+};
+
+// A resource that forwards to new_delete_resource and counts allocations
+class TallyResource : public cslt::memory_resource {
+public:
+    int allocations = 0;
+    int deallocations = 0;
+
+private:
+    void* do_allocate(cslt::size_t bytes, cslt::size_t alignment) override {
+        ++allocations;
+        return cslt::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, cslt::size_t bytes, cslt::size_t alignment) override {
+        ++deallocations;
+        cslt::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const cslt::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+// ================================================================================
+// ================================================================================
+// TEST HASH
+
+TEST(HashTest, IntegersSpreadBits) {
+    cslt::hash<int> h;
+    EXPECT_EQ(h(7), h(7));
+    EXPECT_NE(h(1), h(2));
+    // Sequential keys must differ in the low bits used as tags
+    EXPECT_NE(h(1) & 0x7F, h(2) & 0x7F);
+}
+// --------------------------------------------------------------------------------
+
+TEST(HashTest, SignedZeroHashesEqual) {
+    cslt::hash<double> h;
+    EXPECT_EQ(h(0.0), h(-0.0));
+    EXPECT_NE(h(1.0), h(2.0));
+}
+// --------------------------------------------------------------------------------
+
+TEST(HashTest, StringMatchesCharPointer) {
+    cslt::hash<cslt::String> h;
+    cslt::String str("a key longer than the inline buffer of String");
+    EXPECT_EQ(h(str), h("a key longer than the inline buffer of String"));
+    EXPECT_NE(h(cslt::String("abc")), h("abd"));
+}
+// --------------------------------------------------------------------------------
+
+TEST(HashTest, HashBytesUsesTail) {
+    const char a[] = "abcdefghij";
+    const char b[] = "abcdefghik";
+    EXPECT_NE(cslt::hash_bytes(a, 10), cslt::hash_bytes(b, 10));
+    EXPECT_EQ(cslt::hash_bytes(a, 9), cslt::hash_bytes(b, 9));
+}
+// ================================================================================
+// ================================================================================
+// TEST FLAT_HASH_MAP
+
+TEST(FlatHashMapTest, DefaultDoesNotAllocate) {
+    cslt::flat_hash_map<int, int> map;
+    EXPECT_EQ(0u, map.size());
+    EXPECT_EQ(0u, map.capacity());
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_EQ(map.end(), map.find(3));
+    EXPECT_FALSE(map.contains(3));
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, InsertAndFind) {
+    cslt::flat_hash_map<int, int> map;
+    EXPECT_TRUE(map.insert(cslt::pair<int, int>(1, 10)).second);
+    EXPECT_FALSE(map.insert(cslt::pair<int, int>(1, 20)).second);
+    map[2] = 20;
+    EXPECT_EQ(2u, map.size());
+    EXPECT_EQ(10, map.at(1));
+    EXPECT_EQ(20, map.find(2)->second);
+    EXPECT_EQ(1u, map.count(1));
+    EXPECT_EQ(0u, map.count(3));
+    EXPECT_THROW(map.at(3), cslt::out_of_range);
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, TryEmplaceAndAssign) {
+    cslt::flat_hash_map<int, cslt::String> map;
+    auto first = map.try_emplace(5, "five");
+    EXPECT_TRUE(first.second);
+    auto second = map.try_emplace(5, "cinq");
+    EXPECT_FALSE(second.second);
+    EXPECT_EQ(map.at(5), "five");
+    map.insert_or_assign(5, cslt::String("cinq"));
+    EXPECT_EQ(map.at(5), "cinq");
+    EXPECT_EQ(1u, map.size());
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, GrowthKeepsEntries) {
+    cslt::flat_hash_map<int, int> map;
+    for (int i = 0; i < 10000; ++i)
+        map[i] = i * 2;
+    EXPECT_EQ(10000u, map.size());
+    EXPECT_LE(map.load_factor(), 0.875);
+    for (int i = 0; i < 10000; ++i)
+        ASSERT_EQ(i * 2, map.at(i));
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, ReserveAvoidsRehash) {
+    cslt::flat_hash_map<int, int> map;
+    map.reserve(1000);
+    const cslt::size_t capacity = map.capacity();
+    for (int i = 0; i < 1000; ++i)
+        map[i] = i;
+    EXPECT_EQ(capacity, map.capacity());
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, IterationVisitsEachEntryOnce) {
+    cslt::flat_hash_map<int, int> map;
+    for (int i = 0; i < 100; ++i)
+        map[i] = 1;
+    int sum = 0;
+    cslt::size_t visited = 0;
+    for (const auto& entry : map) {
+        sum += entry.first;
+        ++visited;
+    }
+    EXPECT_EQ(100u, visited);
+    EXPECT_EQ(4950, sum);
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, EraseWhileIterating) {
+    cslt::flat_hash_map<int, int> map;
+    for (int i = 0; i < 200; ++i)
+        map[i] = i;
+    for (auto it = map.begin(); it != map.end();) {
+        if (it->first % 2 == 0)
+            it = map.erase(it);
+        else
+            ++it;
+    }
+    EXPECT_EQ(100u, map.size());
+    for (int i = 0; i < 200; ++i)
+        EXPECT_EQ(i % 2 == 1, map.contains(i));
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, CollidingKeysUseTombstones) {
+    cslt::flat_hash_map<int, int, CollidingHash> map;
+    for (int i = 0; i < 40; ++i)
+        map[i] = i;
+    for (int i = 0; i < 40; i += 3)
+        EXPECT_EQ(1u, map.erase(i));
+    for (int i = 0; i < 40; ++i)
+        EXPECT_EQ(i % 3 != 0, map.contains(i));
+    // Reinserting reuses the erased slots
+    for (int i = 0; i < 40; i += 3)
+        map[i] = -i;
+    EXPECT_EQ(40u, map.size());
+    EXPECT_EQ(-3, map.at(3));
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, MatchesUnorderedMap) {
+    cslt::flat_hash_map<int, int> map;
+    std::unordered_map<int, int> reference;
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> key(0, 2000);
+    for (int step = 0; step < 50000; ++step) {
+        const int k = key(gen);
+        switch (step % 3) {
+            case 0:
+            case 1:
+                map[k] = step;
+                reference[k] = step;
+                break;
+            default:
+                EXPECT_EQ(reference.erase(k), map.erase(k));
+        }
+    }
+    ASSERT_EQ(reference.size(), map.size());
+    for (const auto& entry : reference)
+        ASSERT_EQ(entry.second, map.at(entry.first));
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, CopyAndMove) {
+    cslt::flat_hash_map<cslt::String, int> map;
+    map["alpha"] = 1;
+    map["a key that does not fit in the inline buffer"] = 2;
+    cslt::flat_hash_map<cslt::String, int> copy(map);
+    EXPECT_EQ(2u, copy.size());
+    EXPECT_EQ(2, copy.at("a key that does not fit in the inline buffer"));
+    copy["beta"] = 3;
+    EXPECT_FALSE(map.contains("beta"));
+
+    cslt::flat_hash_map<cslt::String, int> moved(cslt::move(copy));
+    EXPECT_EQ(3u, moved.size());
+    EXPECT_EQ(0u, copy.size());
+    map = moved;
+    EXPECT_EQ(3, map.at("beta"));
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    EXPECT_FALSE(moved.contains("alpha"));
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, ThrowingHashDuringRehashKeepsEntries) {
+    int countdown = -1;
+    cslt::flat_hash_map<int, std::string, ThrowingHash> map(20, ThrowingHash{&countdown});
+    int num = 0;
+    while (map.size() < map.capacity() - map.capacity() / 8) {
+        map[num] = std::to_string(num);
+        ++num;
+    }
+    const cslt::size_t capacity = map.capacity();
+    countdown = 5;
+    EXPECT_THROW(map[num] = "one more", std::runtime_error);
+    countdown = -1;
+    EXPECT_EQ(capacity, map.capacity());
+    ASSERT_EQ(static_cast<cslt::size_t>(num), map.size());
+    for (int i = 0; i < num; ++i)
+        EXPECT_EQ(std::to_string(i), map.at(i));
+    map[num] = "one more";
+    EXPECT_EQ("one more", map.at(num));
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, InsertCopyOfOwnValueWhileGrowing) {
+    const cslt::String value("a value well past the inline buffer of a String");
+    cslt::flat_hash_map<int, cslt::String> map;
+    map.try_emplace(0, value);
+    int grown = 0;
+    for (int i = 1; i < 200; ++i) {
+        const cslt::size_t capacity = map.capacity();
+        // Every insert copies an entry of the map, so those at the growth
+        // boundary read it while the table is rebuilt
+        if (i % 2) {
+            map.try_emplace(i, map.at(0));
+        } else {
+            const int key = i;
+            map.try_emplace(key, map.find(i - 1)->second);
+        }
+        if (map.capacity() != capacity)
+            ++grown;
+    }
+    EXPECT_GE(grown, 3);
+    for (int i = 0; i < 200; ++i)
+        EXPECT_EQ(value, map.at(i));
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, InitializerList) {
+    cslt::flat_hash_map<int, int> map = {{1, 2}, {3, 4}, {1, 5}};
+    EXPECT_EQ(2u, map.size());
+    EXPECT_EQ(2, map.at(1));
+    EXPECT_EQ(4, map.at(3));
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, CharPointerLookupBuildsNoString) {
+    TallyResource counter;
+    cslt::memory_resource* previous = cslt::set_default_resource(&counter);
+    {
+        cslt::flat_hash_map<cslt::String, int> map;
+        map[cslt::String("a key that does not fit in the inline buffer")] = 1;
+        map[cslt::String("another key much longer than twenty three characters")] = 2;
+        const int before = counter.allocations;
+        const char* key = "another key much longer than twenty three characters";
+        EXPECT_EQ(2, map.find(key)->second);
+        EXPECT_TRUE(map.contains("a key that does not fit in the inline buffer"));
+        EXPECT_FALSE(map.contains("a missing key that is also longer than the buffer"));
+        EXPECT_EQ(1u, map.erase(key));
+        EXPECT_EQ(before, counter.allocations);
+    }
+    cslt::set_default_resource(previous);
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, PolymorphicAllocator) {
+    cslt::monotonic_arena arena;
+    cslt::pmr::flat_hash_map<int, int> map{cslt::polymorphic_allocator<cslt::pair<int, int>>(&arena)};
+    for (int i = 0; i < 100; ++i)
+        map[i] = i;
+    EXPECT_EQ(&arena, map.get_allocator().resource());
+    EXPECT_GT(arena.bytes_allocated(), 100 * sizeof(cslt::pair<int, int>));
+    EXPECT_EQ(99, map.at(99));
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, CopyAssignmentKeepsTargetResource) {
+    TallyResource source_res, target_res;
+    {
+        cslt::pmr::flat_hash_map<int, int> source{cslt::polymorphic_allocator<cslt::pair<int, int>>(&source_res)};
+        cslt::pmr::flat_hash_map<int, int> target{cslt::polymorphic_allocator<cslt::pair<int, int>>(&target_res)};
+        for (int i = 0; i < 50; ++i)
+            source[i] = i * 2;
+        target[7] = 1;
+        const int source_allocations = source_res.allocations;
+        target = source;
+        EXPECT_EQ(&target_res, target.get_allocator().resource());
+        EXPECT_EQ(source_allocations, source_res.allocations);
+        EXPECT_EQ(50u, target.size());
+        EXPECT_EQ(98, target.at(49));
+    }
+    EXPECT_EQ(source_res.allocations, source_res.deallocations);
+    EXPECT_EQ(target_res.allocations, target_res.deallocations);
+}
+// --------------------------------------------------------------------------------
+
+TEST(FlatHashMapTest, SwapPolymorphicMaps) {
+    cslt::monotonic_arena arena;
+    const cslt::polymorphic_allocator<cslt::pair<int, int>> alloc(&arena);
+    cslt::pmr::flat_hash_map<int, int> first{alloc}, second{alloc};
+    first[1] = 10;
+    for (int i = 0; i < 20; ++i)
+        second[i] = -i;
+    first.swap(second);
+    EXPECT_EQ(20u, first.size());
+    EXPECT_EQ(-19, first.at(19));
+    EXPECT_EQ(1u, second.size());
+    EXPECT_EQ(10, second.at(1));
+    EXPECT_EQ(&arena, first.get_allocator().resource());
+    EXPECT_EQ(&arena, second.get_allocator().resource());
+}
+// ================================================================================
+// ================================================================================
+// eof
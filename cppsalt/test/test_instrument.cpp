@@ -0,0 +1,173 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_instrument.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the allocation counters in instrument.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "../include/instrument.hpp"
+#include "../include/memory.hpp"
+#include "../include/vec.hpp"
+#include "../include/string.hpp"
+#include "../include/except.hpp"
+
+using cslt::instrument::site;
+
+// Returns the counters the calling thread recorded for one site since start
+static cslt::instrument::counters since(const cslt::instrument::snapshot& start, site s) {
+    cslt::instrument::counters now = cslt::instrument::thread_snapshot()[s];
+    const cslt::instrument::counters& before = start[s];
+    now.allocations -= before.allocations;
+    now.deallocations -= before.deallocations;
+    now.reallocations -= before.reallocations;
+    now.bytes_allocated -= before.bytes_allocated;
+    now.bytes_freed -= before.bytes_freed;
+    return now;
+}
+// ================================================================================
+// ================================================================================
+
+TEST(InstrumentTest, SiteNames) {
+    EXPECT_STREQ("array_ptr", cslt::instrument::site_name(site::array_ptr));
+    EXPECT_STREQ("vector", cslt::instrument::site_name(site::vector));
+    EXPECT_STREQ("string", cslt::instrument::site_name(site::string));
+    EXPECT_STREQ("shared_ptr", cslt::instrument::site_name(site::shared_ptr));
+    EXPECT_STREQ("exception", cslt::instrument::site_name(site::exception));
+    EXPECT_STREQ("string_builder", cslt::instrument::site_name(site::string_builder));
+    EXPECT_STREQ("soa_vector", cslt::instrument::site_name(site::soa_vector));
+    EXPECT_STREQ("small_vector", cslt::instrument::site_name(site::small_vector));
+    EXPECT_STREQ("slot_map", cslt::instrument::site_name(site::slot_map));
+}
+// --------------------------------------------------------------------------------
+
+TEST(InstrumentTest, VectorGrowth) {
+    const cslt::instrument::snapshot start = cslt::instrument::thread_snapshot();
+    {
+        cslt::vector<int> vec(2);
+        for (int i = 0; i < 5; ++i)
+            vec.push_back(i);
+    }
+    const cslt::instrument::counters c = since(start, site::vector);
+    if (cslt::instrument::enabled) {
+        // Capacity 2, then 4, then 8
+        EXPECT_EQ(3u, c.allocations);
+        EXPECT_EQ(3u, c.deallocations);
+        EXPECT_EQ(2u, c.reallocations);
+        EXPECT_EQ((2u + 4u + 8u) * sizeof(int), c.bytes_allocated);
+        EXPECT_EQ(c.bytes_allocated, c.bytes_freed);
+    } else {
+        EXPECT_EQ(0u, c.allocations);
+        EXPECT_EQ(0u, c.reallocations);
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(InstrumentTest, ArrayPtrResize) {
+    const cslt::instrument::snapshot start = cslt::instrument::thread_snapshot();
+    {
+        cslt::array_ptr<int> arr(4);
+        arr.realloc(16);
+    }
+    const cslt::instrument::counters c = since(start, site::array_ptr);
+    if (cslt::instrument::enabled) {
+        EXPECT_EQ(2u, c.allocations);
+        EXPECT_EQ(2u, c.deallocations);
+        EXPECT_EQ(1u, c.reallocations);
+        EXPECT_EQ(20u * sizeof(int), c.bytes_allocated);
+    } else {
+        EXPECT_EQ(0u, c.allocations);
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(InstrumentTest, SharedPtrBlocks) {
+    const cslt::instrument::snapshot start = cslt::instrument::thread_snapshot();
+    {
+        cslt::shared_ptr<int> made = cslt::make_shared<int>(1);
+        cslt::shared_ptr<int> adopted(new int(2));
+        cslt::shared_ptr<int> copy(made);
+    }
+    const cslt::instrument::counters c = since(start, site::shared_ptr);
+    if (cslt::instrument::enabled) {
+        // One block per owned object; copies share it
+        EXPECT_EQ(2u, c.allocations);
+        EXPECT_EQ(2u, c.deallocations);
+        EXPECT_EQ(c.bytes_allocated, c.bytes_freed);
+    } else {
+        EXPECT_EQ(0u, c.allocations);
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(InstrumentTest, StringHeapBuffer) {
+    const cslt::instrument::snapshot start = cslt::instrument::thread_snapshot();
+    {
+        cslt::String small("short");
+        cslt::String large("a string that is far too long to fit in the inline buffer");
+    }
+    const cslt::instrument::counters c = since(start, site::string);
+    if (cslt::instrument::enabled) {
+        EXPECT_EQ(1u, c.allocations);
+        EXPECT_EQ(1u, c.deallocations);
+    } else {
+        EXPECT_EQ(0u, c.allocations);
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(InstrumentTest, ExceptionMessages) {
+    const cslt::instrument::snapshot start = cslt::instrument::thread_snapshot();
+    {
+        cslt::out_of_range literal(CSLT_LITERAL("literal message"));
+        const char* text = "runtime message";
+        cslt::out_of_range copied(text);
+    }
+    const cslt::instrument::counters c = since(start, site::exception);
+    if (cslt::instrument::enabled) {
+        // Only the message not marked with CSLT_LITERAL is copied
+        EXPECT_EQ(1u, c.allocations);
+        EXPECT_EQ(1u, c.deallocations);
+        EXPECT_EQ(c.bytes_allocated, c.bytes_freed);
+    } else {
+        EXPECT_EQ(0u, c.allocations);
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(InstrumentTest, GlobalSnapshotIncludesExitedThreads) {
+    const cslt::instrument::counters before = cslt::instrument::global_snapshot()[site::vector];
+    std::thread worker([] {
+        cslt::vector<int> vec(8);
+        vec.push_back(1);
+    });
+    worker.join();
+    const cslt::instrument::counters after = cslt::instrument::global_snapshot()[site::vector];
+    if (cslt::instrument::enabled)
+        EXPECT_EQ(before.allocations + 1, after.allocations);
+    else
+        EXPECT_EQ(0u, after.allocations);
+}
+// --------------------------------------------------------------------------------
+
+TEST(InstrumentTest, TotalSumsSites) {
+    cslt::instrument::snapshot snap;
+    snap.sites[0].allocations = 2;
+    snap.sites[1].allocations = 3;
+    snap.sites[2].bytes_freed = 7;
+    const cslt::instrument::counters sum = snap.total();
+    EXPECT_EQ(5u, sum.allocations);
+    EXPECT_EQ(7u, sum.bytes_freed);
+}
+// ================================================================================
+// ================================================================================
+// eof
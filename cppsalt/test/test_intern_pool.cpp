@@ -0,0 +1,144 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_intern_pool.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests intern_pool and interned_string in intern_pool.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../include/intern_pool.hpp"
+#include "../include/flat_hash_map.hpp"
+#include "../include/string.hpp"
+#include "../include/vec.hpp"
+// ================================================================================
+// ================================================================================
+// HANDLE TESTS
+
+TEST(InternPoolTest, EqualTextGivesTheSameHandle) {
+    cslt::intern_pool pool;
+    const std::string built = std::string("route.") + "latency";
+    const cslt::interned_string a = pool.intern("route.latency");
+    const cslt::interned_string b = pool.intern(cslt::string_view(built.data(), built.size()));
+    const cslt::interned_string c = pool.intern("route.errors");
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.data(), b.data());
+    EXPECT_NE(a, c);
+    EXPECT_EQ(2u, pool.size());
+    EXPECT_EQ(cslt::string_view("route.latency"), a.view());
+    EXPECT_STREQ("route.latency", a.c_str());
+    EXPECT_EQ(cslt::hash<cslt::string_view>()(a.view()), a.hash());
+    EXPECT_EQ(a.hash(), cslt::hash<cslt::interned_string>()(a));
+}
+// --------------------------------------------------------------------------------
+
+TEST(InternPoolTest, NullAndEmptyHandles) {
+    cslt::intern_pool pool;
+    const cslt::interned_string none;
+    EXPECT_FALSE(none);
+    EXPECT_TRUE(none.empty());
+    EXPECT_STREQ("", none.c_str());
+    EXPECT_FALSE(pool.find("missing"));
+
+    const cslt::interned_string empty = pool.intern("");
+    EXPECT_TRUE(empty);
+    EXPECT_TRUE(empty.empty());
+    EXPECT_NE(none, empty);
+    EXPECT_EQ(empty, pool.intern(cslt::string_view()));
+    EXPECT_EQ(empty, pool.find(""));
+}
+// --------------------------------------------------------------------------------
+
+TEST(InternPoolTest, HandlesSurviveGrowth) {
+    cslt::intern_pool pool;
+    const cslt::interned_string first = pool.intern("first");
+    const char* text = first.data();
+    std::vector<cslt::interned_string> handles;
+    for (int i = 0; i < 5000; ++i)
+        handles.push_back(pool.intern(cslt::string_view(std::to_string(i).c_str())));
+    EXPECT_EQ(5001u, pool.size());
+    EXPECT_EQ(text, pool.find("first").data());
+    for (int i = 0; i < 5000; i += 97)
+        EXPECT_EQ(handles[static_cast<std::size_t>(i)], pool.find(std::to_string(i).c_str()));
+
+    // Interning text that is present costs no memory
+    const cslt::size_t used = pool.memory();
+    for (int i = 0; i < 5000; ++i)
+        pool.intern(std::to_string(i).c_str());
+    EXPECT_EQ(used, pool.memory());
+}
+// --------------------------------------------------------------------------------
+
+TEST(InternPoolTest, SeedInternsEachStringOnce) {
+    cslt::intern_pool pool;
+    pool.seed({"cpu", "mem", "cpu", "disk"});
+    EXPECT_EQ(3u, pool.size());
+    EXPECT_TRUE(pool.find("disk"));
+
+    const cslt::vector<cslt::String> labels = {"net", "mem", "gpu"};
+    pool.seed(labels.begin(), labels.end());
+    EXPECT_EQ(5u, pool.size());
+    EXPECT_EQ(cslt::string_view("gpu"), pool.find("gpu").view());
+}
+// --------------------------------------------------------------------------------
+
+TEST(InternPoolTest, KeysAFlatHashMap) {
+    cslt::intern_pool pool;
+    cslt::flat_hash_map<cslt::interned_string, int> counts;
+    const char* labels[] = {"a", "b", "a", "c", "a", "b"};
+    for (const char* label : labels)
+        counts[pool.intern(label)] += 1;
+    EXPECT_EQ(3u, counts.size());
+    EXPECT_EQ(3, counts[pool.intern("a")]);
+    EXPECT_EQ(1, counts.at(pool.find("c")));
+}
+// ================================================================================
+// ================================================================================
+// CONCURRENCY TESTS
+
+TEST(InternPoolTest, ConcurrentInternAgreesOnHandles) {
+    cslt::intern_pool pool;
+    const int threads = 4;
+    const int labels = 2000;
+    std::vector<std::vector<cslt::interned_string>> results(threads);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&pool, &results, t, labels]() {
+            std::vector<cslt::interned_string>& mine = results[static_cast<std::size_t>(t)];
+            mine.resize(labels);
+            // Each thread walks the labels from a different start, so the
+            // same strings are added and looked up concurrently
+            for (int k = 0; k < labels; ++k) {
+                const int i = (k + t * labels / threads) % labels;
+                const std::string text = "label-" + std::to_string(i);
+                mine[static_cast<std::size_t>(i)] = pool.intern(text.c_str());
+                const cslt::interned_string seen = pool.find(text.c_str());
+                if (seen != mine[static_cast<std::size_t>(i)])
+                    mine[static_cast<std::size_t>(i)] = cslt::interned_string();
+            }
+        });
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+    EXPECT_EQ(static_cast<cslt::size_t>(labels), pool.size());
+    for (int i = 0; i < labels; ++i) {
+        const cslt::interned_string handle = results[0][static_cast<std::size_t>(i)];
+        ASSERT_TRUE(handle);
+        EXPECT_EQ(cslt::string_view(("label-" + std::to_string(i)).c_str()), handle.view());
+        for (int t = 1; t < threads; ++t)
+            EXPECT_EQ(handle, results[static_cast<std::size_t>(t)][static_cast<std::size_t>(i)]);
+    }
+}
+// ================================================================================
+// ================================================================================
+// eof
@@ -15,7 +15,11 @@
 
 #include <gtest/gtest.h>
 #include <sstream>
+#include <cstring>
+#include <string>
 #include "../include/io.hpp"
+#include "../include/except.hpp"
+#include "../include/util.hpp"
 // ================================================================================ 
 // ================================================================================
 // Test in, out, log and err functions 
@@ -138,4 +142,103 @@ TEST(CsltStreambufTest, StreambufFunctionality) {
 }
 // ================================================================================
 // ================================================================================
+// TEST MAPPED_FILE AND MMAP_STREAMBUF
+
+TEST(CsltMappedFileTest, MapsContents) {
+    {
+        cslt::ofstream outFile("mapped.txt");
+        outFile << "first line\nsecond line\n";
+    }
+    cslt::mapped_file file("mapped.txt");
+    EXPECT_TRUE(file.is_open());
+    ASSERT_EQ(23u, file.size());
+    EXPECT_EQ(std::string("first line\nsecond line\n"), std::string(file.begin(), file.end()));
+    EXPECT_EQ('s', file[11]);
+    file.advise(cslt::access_hint::random);
+    file.will_need(5, 100);
+    file.close();
+    EXPECT_FALSE(file.is_open());
+    EXPECT_EQ(nullptr, file.data());
+    std::remove("mapped.txt");
+}
+// --------------------------------------------------------------------------------
+
+TEST(CsltMappedFileTest, EmptyFile) {
+    {
+        cslt::ofstream outFile("mapped_empty.txt");
+    }
+    cslt::mapped_file file("mapped_empty.txt", cslt::access_hint::willneed);
+    EXPECT_TRUE(file.is_open());
+    EXPECT_TRUE(file.empty());
+    EXPECT_EQ(file.begin(), file.end());
+    std::remove("mapped_empty.txt");
+}
+// --------------------------------------------------------------------------------
+
+TEST(CsltMappedFileTest, MissingFileThrows) {
+    try {
+        cslt::mapped_file file("no_such_file.txt");
+        FAIL() << "Expected cslt::system_error";
+    } catch (const cslt::system_error& e) {
+        EXPECT_NE(nullptr, std::strstr(e.what(), "no_such_file.txt"));
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(CsltMappedFileTest, MoveTransfersMapping) {
+    {
+        cslt::ofstream outFile("mapped_move.txt");
+        outFile << "payload";
+    }
+    cslt::mapped_file first("mapped_move.txt");
+    const char* data = first.data();
+    cslt::mapped_file second(cslt::move(first));
+    EXPECT_FALSE(first.is_open());
+    EXPECT_EQ(data, second.data());
+    cslt::mapped_file third;
+    third = cslt::move(second);
+    EXPECT_EQ(7u, third.size());
+    std::remove("mapped_move.txt");
+}
+// --------------------------------------------------------------------------------
+
+TEST(CsltMmapStreambufTest, IstreamReadsMapping) {
+    {
+        cslt::ofstream outFile("mapped_stream.txt");
+        outFile << "alpha 12\nbeta 34\n";
+    }
+    cslt::mapped_file file("mapped_stream.txt");
+    cslt::mmap_streambuf buf(file);
+    std::istream in(&buf);
+    std::string word;
+    int value = 0;
+    in >> word >> value;
+    EXPECT_EQ("alpha", word);
+    EXPECT_EQ(12, value);
+    in.ignore();
+    std::string line;
+    std::getline(in, line);
+    EXPECT_EQ("beta 34", line);
+    EXPECT_FALSE(std::getline(in, line));
+    std::remove("mapped_stream.txt");
+}
+// --------------------------------------------------------------------------------
+
+TEST(CsltMmapStreambufTest, SeekAndPutback) {
+    const char text[] = "0123456789";
+    cslt::mmap_streambuf buf(text, 10);
+    std::istream in(&buf);
+    in.seekg(4);
+    EXPECT_EQ('4', in.get());
+    in.seekg(-2, std::ios_base::end);
+    EXPECT_EQ(8, static_cast<int>(in.tellg()));
+    EXPECT_EQ('8', in.get());
+    in.unget();
+    EXPECT_EQ('8', in.get());
+    in.seekg(20);
+    EXPECT_TRUE(in.fail());
+    EXPECT_STREQ("0123456789", text);
+}
+// ================================================================================
+// ================================================================================
 // eof
@@ -0,0 +1,189 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_line_reader.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests line_reader and field_splitter in line_reader.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../include/line_reader.hpp"
+#include "../include/io.hpp"
+
+static std::vector<std::string> read_all(cslt::line_reader& reader) {
+    std::vector<std::string> records;
+    reader.for_each([&records](cslt::string_view record) {
+        records.emplace_back(record.data(), record.size());
+    });
+    return records;
+}
+
+// The records std::getline finds in text
+static std::vector<std::string> getline_all(const std::string& text) {
+    std::vector<std::string> records;
+    std::istringstream in(text);
+    std::string line;
+    while (std::getline(in, line))
+        records.push_back(line);
+    return records;
+}
+
+static std::string numbered_lines(int lines) {
+    std::string text;
+    for (int i = 0; i < lines; ++i)
+        text += "record " + std::to_string(i) + std::string(static_cast<std::size_t>(i % 23), 'x') + "\n";
+    return text;
+}
+// ================================================================================
+// ================================================================================
+
+TEST(LineReaderTest, ReadsMemory) {
+    cslt::line_reader reader(cslt::string_view("alpha\nbeta\n\ngamma"));
+    const std::vector<std::string> expected = {"alpha", "beta", "", "gamma"};
+    EXPECT_EQ(expected, read_all(reader));
+    EXPECT_EQ(4u, reader.records());
+    cslt::string_view record("unchanged");
+    EXPECT_FALSE(reader.next(record));
+    EXPECT_EQ(cslt::string_view("unchanged"), record);
+}
+// --------------------------------------------------------------------------------
+
+TEST(LineReaderTest, EmptyInput) {
+    cslt::line_reader memory((cslt::string_view()));
+    EXPECT_TRUE(read_all(memory).empty());
+    std::istringstream in("");
+    cslt::line_reader stream(in);
+    EXPECT_TRUE(read_all(stream).empty());
+}
+// --------------------------------------------------------------------------------
+
+TEST(LineReaderTest, StreamMatchesGetline) {
+    // Block sizes that split records everywhere, including inside the delimiter search
+    const std::string text = numbered_lines(500);
+    for (cslt::size_t block : {1u, 2u, 7u, 16u, 64u, 1000u, 1u << 20}) {
+        std::istringstream in(text);
+        cslt::line_reader reader(in, block);
+        EXPECT_EQ(getline_all(text), read_all(reader)) << block;
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(LineReaderTest, RecordLongerThanBlock) {
+    const std::string big(5000, 'q');
+    const std::string text = "short\n" + big + "\nend";
+    std::istringstream in(text);
+    cslt::line_reader reader(in, 64);
+    const std::vector<std::string> expected = {"short", big, "end"};
+    EXPECT_EQ(expected, read_all(reader));
+}
+// --------------------------------------------------------------------------------
+
+TEST(LineReaderTest, CarriageReturns) {
+    cslt::line_reader reader(cslt::string_view("one\r\ntwo\r\nthree\r"));
+    EXPECT_TRUE(reader.strip_carriage_return());
+    const std::vector<std::string> expected = {"one", "two", "three"};
+    EXPECT_EQ(expected, read_all(reader));
+
+    cslt::line_reader kept(cslt::string_view("one\r\ntwo"));
+    kept.strip_carriage_return(false);
+    const std::vector<std::string> raw = {"one\r", "two"};
+    EXPECT_EQ(raw, read_all(kept));
+}
+// --------------------------------------------------------------------------------
+
+TEST(LineReaderTest, OtherDelimiter) {
+    std::istringstream in("a;b;;c;");
+    cslt::line_reader reader(in, 3, ';');
+    EXPECT_EQ(';', reader.delimiter());
+    EXPECT_FALSE(reader.strip_carriage_return());
+    const std::vector<std::string> expected = {"a", "b", "", "c"};
+    EXPECT_EQ(expected, read_all(reader));
+}
+// --------------------------------------------------------------------------------
+
+TEST(LineReaderTest, ReadsFileAndMapping) {
+    const std::string text = numbered_lines(2000);
+    {
+        std::ofstream out("line_reader.txt", std::ios::binary);
+        out << text;
+    }
+    {
+        cslt::ifstream in("line_reader.txt", std::ios::binary);
+        cslt::line_reader reader(in, 4096);
+        EXPECT_EQ(getline_all(text), read_all(reader));
+    }
+    {
+        cslt::mapped_file file("line_reader.txt");
+        cslt::line_reader reader(file);
+        cslt::string_view first;
+        ASSERT_TRUE(reader.next(first));
+        // Records from a mapping point into it
+        EXPECT_EQ(file.data(), first.data());
+        EXPECT_EQ(1999u, reader.for_each([](cslt::string_view) {}));
+    }
+    std::remove("line_reader.txt");
+}
+// ================================================================================
+// ================================================================================
+
+TEST(FieldSplitterTest, KeepsEmptyFields) {
+    cslt::field_splitter fields(cslt::string_view("id,,name,"), ',');
+    std::vector<std::string> found;
+    cslt::string_view field;
+    while (fields.next(field))
+        found.emplace_back(field.data(), field.size());
+    const std::vector<std::string> expected = {"id", "", "name", ""};
+    EXPECT_EQ(expected, found);
+}
+// --------------------------------------------------------------------------------
+
+TEST(FieldSplitterTest, SplitFields) {
+    const cslt::string_view record("2024-01-01\t42\tok");
+    cslt::string_view fields[2];
+    EXPECT_EQ(3u, cslt::split_fields(record, '\t', fields, 2));
+    EXPECT_EQ(cslt::string_view("2024-01-01"), fields[0]);
+    EXPECT_EQ(cslt::string_view("42"), fields[1]);
+    EXPECT_EQ(record.data() + 11, fields[1].data());
+    EXPECT_EQ(1u, cslt::split_fields(cslt::string_view(), '\t', fields, 2));
+    EXPECT_TRUE(fields[0].empty());
+}
+// --------------------------------------------------------------------------------
+
+TEST(FieldSplitterTest, SplitFieldsMatchesSplitter) {
+    // Records long enough to cross several 16 byte blocks, with delimiters on the edges
+    std::string record;
+    for (int i = 0; i < 60; ++i) {
+        record += std::string(static_cast<std::size_t>(i % 5), 'a' + i % 26);
+        record += '|';
+    }
+    for (std::size_t len = 0; len <= record.size(); ++len) {
+        const cslt::string_view view(record.data(), len);
+        cslt::string_view split[64];
+        const cslt::size_t count = cslt::split_fields(view, '|', split, 64);
+        cslt::field_splitter walker(view, '|');
+        cslt::string_view field;
+        cslt::size_t walked = 0;
+        while (walker.next(field)) {
+            ASSERT_LT(walked, count);
+            EXPECT_EQ(field.data(), split[walked].data());
+            EXPECT_EQ(field.size(), split[walked].size());
+            ++walked;
+        }
+        EXPECT_EQ(walked, count);
+    }
+}
+// ================================================================================
+// ================================================================================
+// eof
@@ -15,6 +15,12 @@
 
 #include <gtest/gtest.h>
 #include "../include/memory.hpp"
+#include "../include/string.hpp"
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
 
 class MyClass {
 public:
@@ -102,6 +108,18 @@ TEST_F(UniquePtrTst2, MoveAssignment) {
     EXPECT_EQ(movedTo->getValue(), 30);
 }
 
+// Move assignment onto a pointer that already owns an object
+TEST_F(UniquePtrTst2, MoveAssignmentReplacesTarget) {
+    cslt::unique_ptr<Resource> original(new Resource(31));
+    cslt::unique_ptr<Resource> target(new Resource(32));
+    EXPECT_EQ(Resource::count, 2);
+    target = cslt::move(original);
+    EXPECT_EQ(Resource::count, 1);
+    EXPECT_TRUE(!original);
+    ASSERT_TRUE(static_cast<bool>(target));
+    EXPECT_EQ(target->getValue(), 31);
+}
+
 // Dereference and Member Access
 TEST_F(UniquePtrTst2, DereferenceMemberAccess) {
     cslt::unique_ptr<Resource> ptr(new Resource(40));
@@ -314,6 +332,492 @@ TEST_F(ArrayPtrTest, CopyAssignment) {
     EXPECT_EQ(original.size(), 5); // Ensure original is unchanged
     EXPECT_EQ(0, 0);
 }
+// --------------------------------------------------------------------------------
+
+TEST_F(ArrayPtrTest, AtIsAlwaysChecked) {
+    cslt::array_ptr<int> arr(3);
+    arr.at(2) = 7;
+    EXPECT_EQ(arr[2], 7);
+    EXPECT_THROW(arr.at(3), cslt::out_of_range);
+#if CSLT_BOUNDS_CHECK == CSLT_BOUNDS_CHECKED
+    EXPECT_THROW(arr[3], cslt::out_of_range);
+#endif
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(ArrayPtrTest, RawPointerIteration) {
+    cslt::array_ptr<double> arr(4);
+    double value = 0.5;
+    for (double& element : arr)
+        element = value++;
+    EXPECT_EQ(arr.end() - arr.begin(), 4);
+    EXPECT_EQ(arr.data(), arr.get());
+    EXPECT_EQ(arr[3], 3.5);
+    cslt::array_ptr<double> empty;
+    EXPECT_EQ(empty.begin(), empty.end());
+}
+// ================================================================================
+// ================================================================================
+// ALIGNED ARRAY_PTR TESTS
+
+static bool aligned_to(const void* p, cslt::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+// --------------------------------------------------------------------------------
+
+TEST(AlignedArrayPtrTest, BlocksAreAlignedAndPadded) {
+    using alloc = cslt::aligned_allocator<float, 64>;
+    EXPECT_EQ(0u, alloc::padded_bytes(0));
+    EXPECT_EQ(64u, alloc::padded_bytes(1));
+    EXPECT_EQ(64u, alloc::padded_bytes(16));
+    EXPECT_EQ(128u, alloc::padded_bytes(17));
+    cslt::aligned_array_ptr<float> arr(17);
+    EXPECT_TRUE(aligned_to(arr.data(), 64));
+    for (float value : arr)
+        EXPECT_EQ(0.0f, value);
+    // The padding up to the next 64 bytes may be read and holds zeros
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(arr.get());
+    for (cslt::size_t i = 17 * sizeof(float); i < alloc::padded_bytes(17); ++i)
+        EXPECT_EQ(0u, bytes[i]);
+}
+// --------------------------------------------------------------------------------
+
+TEST(AlignedArrayPtrTest, ReallocKeepsAlignment) {
+    cslt::aligned_array_ptr<double, 128> arr(3);
+    for (cslt::size_t i = 0; i < arr.size(); ++i)
+        arr[i] = static_cast<double>(i) + 0.5;
+    for (cslt::size_t num : {10u, 1000u, 2u}) {
+        arr.realloc(num);
+        EXPECT_TRUE(aligned_to(arr.data(), 128));
+        EXPECT_EQ(num, arr.size());
+        EXPECT_EQ(0.5, arr[0]);
+        EXPECT_EQ(1.5, arr[1]);
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(AlignedArrayPtrTest, CopyMoveReleaseReset) {
+    cslt::aligned_array_ptr<int> arr(5);
+    arr[4] = 9;
+    cslt::aligned_array_ptr<int> copy(arr);
+    EXPECT_NE(copy.data(), arr.data());
+    EXPECT_TRUE(aligned_to(copy.data(), 64));
+    EXPECT_EQ(9, copy[4]);
+    int* block = arr.data();
+    cslt::aligned_array_ptr<int> moved(cslt::move(arr));
+    EXPECT_EQ(block, moved.data());
+    EXPECT_FALSE(arr);
+    copy = cslt::move(moved);
+    EXPECT_EQ(block, copy.data());
+    int* raw = copy.release();
+    EXPECT_EQ(0u, copy.size());
+    moved.reset(raw, 5);
+    EXPECT_EQ(9, moved[4]);
+    copy = moved;
+    EXPECT_TRUE(aligned_to(copy.data(), 64));
+    EXPECT_EQ(9, copy[4]);
+}
+// --------------------------------------------------------------------------------
+
+TEST(AlignedArrayPtrTest, NonTrivialElements) {
+    cslt::aligned_array_ptr<std::vector<int>, 32> arr(4);
+    arr[3].assign(100, 7);
+    arr.realloc(40);
+    EXPECT_TRUE(aligned_to(arr.data(), 32));
+    EXPECT_EQ(100u, arr[3].size());
+    EXPECT_TRUE(arr[39].empty());
+    EXPECT_THROW(cslt::aligned_allocator<double>().allocate(std::numeric_limits<cslt::size_t>::max() / 4),
+                 cslt::bad_array_new_length);
+}
+// --------------------------------------------------------------------------------
+
+// String is trivially relocatable, so realloc moves its bytes and keeps every heap buffer
+TEST(ArrayPtrRelocationTest, ReallocRelocatesStrings) {
+    cslt::array_ptr<cslt::String> arr(3);
+    const char* text[3] = {"0: a string too long for the inline buffer",
+                           "1: a string too long for the inline buffer",
+                           "2: a string too long for the inline buffer"};
+    const char* buffers[3];
+    for (cslt::size_t i = 0; i < 3; ++i) {
+        arr[i] = cslt::String(text[i]);
+        buffers[i] = arr[i].c_string();
+    }
+    arr.realloc(8);
+    for (cslt::size_t i = 0; i < 3; ++i)
+        EXPECT_EQ(buffers[i], arr[i].c_string());
+    EXPECT_STREQ(text[2], arr[2].c_string());
+    EXPECT_EQ(0u, arr[7].size());
+    arr.realloc(2);
+    EXPECT_EQ(buffers[1], arr[1].c_string());
+}
+// --------------------------------------------------------------------------------
+
+TEST(ArrayPtrRelocationTest, AllocatorReallocRelocatesStrings) {
+    cslt::aligned_array_ptr<cslt::String> arr(4);
+    arr[0] = cslt::String("short");
+    arr[3] = cslt::String("another string too long for the inline buffer");
+    const char* last = arr[3].c_string();
+    arr.realloc(64);
+    EXPECT_STREQ("short", arr[0].c_string());
+    EXPECT_EQ(last, arr[3].c_string());
+    arr.realloc(1);
+    EXPECT_EQ(1u, arr.size());
+    EXPECT_STREQ("short", arr[0].c_string());
+}
+// ================================================================================
+// ================================================================================
+// MAKE_SHARED AND ALLOCATE_SHARED TESTS
+
+// A resource that counts the allocations it serves
+class CountingResource : public cslt::memory_resource {
+public:
+    int allocations = 0;
+    int deallocations = 0;
+
+private:
+    void* do_allocate(cslt::size_t bytes, cslt::size_t alignment) override {
+        ++allocations;
+        return cslt::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, cslt::size_t bytes, cslt::size_t alignment) override {
+        ++deallocations;
+        cslt::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const cslt::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+// --------------------------------------------------------------------------------
+
+TEST_F(SharedPtrTest, MakeSharedConstructsObject) {
+    {
+        cslt::shared_ptr<Resource> ptr = cslt::make_shared<Resource>(7);
+        EXPECT_EQ(ptr->getValue(), 7);
+        EXPECT_EQ(ptr.use_count(), 1);
+        cslt::shared_ptr<Resource> copy = ptr;
+        EXPECT_EQ(ptr.use_count(), 2);
+        EXPECT_EQ(copy.get(), ptr.get());
+    }
+    EXPECT_EQ(Resource::count, 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(SharedPtrTest, AllocateSharedUsesOneAllocation) {
+    CountingResource resource;
+    {
+        cslt::polymorphic_allocator<Trackable> alloc(&resource);
+        cslt::shared_ptr<Trackable> ptr = cslt::allocate_shared<Trackable>(alloc);
+        EXPECT_EQ(resource.allocations, 1);
+        EXPECT_EQ(Trackable::instances, 1);
+        cslt::shared_ptr<Trackable> copy(ptr);
+        ptr.reset();
+        EXPECT_EQ(Trackable::instances, 1);
+        EXPECT_EQ(resource.deallocations, 0);
+    }
+    EXPECT_EQ(Trackable::instances, 0);
+    EXPECT_EQ(resource.deallocations, 1);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(SharedPtrTest, MakeSharedThrowingConstructor) {
+    struct Throws {
+        Throws() { throw cslt::runtime_error("constructor failed"); }
+    };
+    EXPECT_THROW(cslt::make_shared<Throws>(), cslt::runtime_error);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(SharedPtrTest, EmptyUseCount) {
+    cslt::shared_ptr<Trackable> ptr;
+    EXPECT_EQ(ptr.use_count(), 0);
+    ptr = new Trackable();
+    EXPECT_EQ(ptr.use_count(), 1);
+}
+// ================================================================================
+// ================================================================================
+// WEAK_PTR AND THREAD SAFETY TESTS
+
+TEST_F(SharedPtrTest, WeakPtrLocksLiveObject) {
+    cslt::shared_ptr<Resource> shared = cslt::make_shared<Resource>(4);
+    cslt::weak_ptr<Resource> weak(shared);
+    EXPECT_EQ(weak.use_count(), 1);
+    EXPECT_FALSE(weak.expired());
+    cslt::shared_ptr<Resource> locked = weak.lock();
+    ASSERT_TRUE(locked);
+    EXPECT_EQ(locked->getValue(), 4);
+    EXPECT_EQ(shared.use_count(), 2);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(SharedPtrTest, WeakPtrExpires) {
+    cslt::weak_ptr<Trackable> weak;
+    EXPECT_TRUE(weak.expired());
+    {
+        cslt::shared_ptr<Trackable> shared(new Trackable());
+        weak = shared;
+        EXPECT_FALSE(weak.expired());
+    }
+    EXPECT_EQ(Trackable::instances, 0);
+    EXPECT_TRUE(weak.expired());
+    EXPECT_FALSE(weak.lock());
+    EXPECT_THROW(cslt::shared_ptr<Trackable> shared(weak), cslt::bad_weak_ptr);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(SharedPtrTest, WeakPtrKeepsInplaceBlock) {
+    CountingResource resource;
+    cslt::polymorphic_allocator<Trackable> alloc(&resource);
+    cslt::weak_ptr<Trackable> weak;
+    {
+        cslt::shared_ptr<Trackable> shared = cslt::allocate_shared<Trackable>(alloc);
+        weak = shared;
+    }
+    EXPECT_EQ(Trackable::instances, 0);
+    EXPECT_EQ(resource.deallocations, 0);
+    cslt::weak_ptr<Trackable> copy(weak);
+    weak.reset();
+    EXPECT_EQ(resource.deallocations, 0);
+    copy.reset();
+    EXPECT_EQ(resource.deallocations, 1);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(SharedPtrTest, LocalSharedPtr) {
+    {
+        cslt::local_shared_ptr<Trackable> shared = cslt::make_local_shared<Trackable>();
+        cslt::local_shared_ptr<Trackable> copy = shared;
+        cslt::local_weak_ptr<Trackable> weak(copy);
+        EXPECT_EQ(shared.use_count(), 2);
+        EXPECT_EQ(weak.lock().get(), shared.get());
+    }
+    EXPECT_EQ(Trackable::instances, 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(SharedPtrTest, ConcurrentCopies) {
+    cslt::shared_ptr<Resource> shared = cslt::make_shared<Resource>(1);
+    cslt::weak_ptr<Resource> weak(shared);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&shared, &weak]() {
+            for (int i = 0; i < 10000; ++i) {
+                cslt::shared_ptr<Resource> copy(shared);
+                cslt::shared_ptr<Resource> locked = weak.lock();
+                EXPECT_EQ(locked->getValue(), 1);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    EXPECT_EQ(shared.use_count(), 1);
+    shared.reset();
+    EXPECT_TRUE(weak.expired());
+    EXPECT_EQ(Resource::count, 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(SharedPtrTest, ConcurrentLastRelease) {
+    for (int round = 0; round < 100; ++round) {
+        cslt::shared_ptr<Trackable> shared = cslt::make_shared<Trackable>();
+        std::vector<cslt::shared_ptr<Trackable>> copies(4, shared);
+        shared.reset();
+        std::vector<std::thread> threads;
+        for (cslt::shared_ptr<Trackable>& copy : copies)
+            threads.emplace_back([&copy]() { copy.reset(); });
+        for (std::thread& thread : threads)
+            thread.join();
+        EXPECT_EQ(Trackable::instances, 0);
+    }
+}
+// ================================================================================
+// ================================================================================
+// ATOMIC_SHARED_PTR TESTS
+
+TEST_F(SharedPtrTest, AtomicLoadStore) {
+    {
+        cslt::atomic_shared_ptr<Resource> atomic(cslt::make_shared<Resource>(1));
+        EXPECT_EQ(CSLT_ATOMIC_SHARED_PTR_LOCKED == 0, atomic.is_lock_free());
+        cslt::shared_ptr<Resource> first = atomic.load();
+        EXPECT_EQ(first->getValue(), 1);
+        EXPECT_EQ(first.use_count(), 2);
+
+        atomic.store(cslt::make_shared<Resource>(2));
+        EXPECT_EQ(first.use_count(), 1);
+        EXPECT_EQ(atomic.load()->getValue(), 2);
+
+        cslt::shared_ptr<Resource> previous = atomic.exchange(cslt::shared_ptr<Resource>());
+        EXPECT_EQ(previous->getValue(), 2);
+        EXPECT_EQ(previous.use_count(), 1);
+        EXPECT_FALSE(atomic.load());
+    }
+    EXPECT_EQ(Resource::count, 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(SharedPtrTest, AtomicCompareExchange) {
+    {
+        cslt::shared_ptr<Resource> original = cslt::make_shared<Resource>(1);
+        cslt::atomic_shared_ptr<Resource> atomic(original);
+        cslt::shared_ptr<Resource> stale = cslt::make_shared<Resource>(9);
+
+        EXPECT_FALSE(atomic.compare_exchange_strong(stale, cslt::make_shared<Resource>(3)));
+        EXPECT_EQ(stale.get(), original.get());
+
+        EXPECT_TRUE(atomic.compare_exchange_strong(stale, cslt::make_shared<Resource>(4)));
+        EXPECT_EQ(atomic.load()->getValue(), 4);
+        EXPECT_EQ(original.use_count(), 2);
+    }
+    EXPECT_EQ(Resource::count, 0);
+}
+// --------------------------------------------------------------------------------
+
+// Each snapshot holds a value and its negation, which a torn or freed
+// snapshot would fail to preserve
+struct Snapshot {
+    static std::atomic<int> live;
+    int value;
+    int check;
+    explicit Snapshot(int val) : value(val), check(-val) { ++live; }
+    ~Snapshot() { --live; }
+};
+std::atomic<int> Snapshot::live{0};
+// --------------------------------------------------------------------------------
+
+TEST_F(SharedPtrTest, AtomicReadersAndWriters) {
+    {
+        cslt::atomic_shared_ptr<Snapshot> current(cslt::make_shared<Snapshot>(0));
+        std::atomic<bool> done{false};
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 6; ++t) {
+            readers.emplace_back([&current, &done]() {
+                int last = 0;
+                while (!done.load()) {
+                    cslt::shared_ptr<Snapshot> snap = current.load();
+                    EXPECT_EQ(snap->value, -snap->check);
+                    EXPECT_GE(snap->value, last);
+                    last = snap->value;
+                }
+            });
+        }
+        std::thread swapper([&current, &done]() {
+            while (!done.load()) {
+                cslt::shared_ptr<Snapshot> expected = current.load();
+                current.compare_exchange_strong(expected, expected);
+            }
+        });
+        for (int i = 1; i <= 20000; ++i)
+            current.store(cslt::make_shared<Snapshot>(i));
+        done = true;
+        for (std::thread& reader : readers)
+            reader.join();
+        swapper.join();
+        EXPECT_EQ(current.load()->value, 20000);
+    }
+    EXPECT_EQ(Snapshot::live.load(), 0);
+}
+// --------------------------------------------------------------------------------
+
+// Starting from a null pointer, so that with CSLT_ATOMIC_SHARED_PTR_LOCKED the
+// first store switches to the locked path while readers are loading
+TEST_F(SharedPtrTest, AtomicFirstStoreUnderLoad) {
+    {
+        cslt::atomic_shared_ptr<Snapshot> current;
+        EXPECT_TRUE(current.is_lock_free());
+        std::atomic<bool> done{false};
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([&current, &done]() {
+                int last = 0;
+                while (!done.load()) {
+                    cslt::shared_ptr<Snapshot> snap = current.load();
+                    if (!snap)
+                        continue;
+                    EXPECT_EQ(snap->value, -snap->check);
+                    EXPECT_GE(snap->value, last);
+                    last = snap->value;
+                }
+            });
+        }
+        for (int i = 1; i <= 5000; ++i) {
+            cslt::shared_ptr<Snapshot> expected = current.load();
+            if (i % 2 == 0)
+                current.compare_exchange_strong(expected, cslt::make_shared<Snapshot>(i));
+            else
+                current.store(cslt::make_shared<Snapshot>(i));
+        }
+        done = true;
+        for (std::thread& reader : readers)
+            reader.join();
+        EXPECT_EQ(current.load()->value, 5000);
+        EXPECT_EQ(CSLT_ATOMIC_SHARED_PTR_LOCKED == 0, current.is_lock_free());
+    }
+    EXPECT_EQ(Snapshot::live.load(), 0);
+}
+// ================================================================================
+// ================================================================================
+// INTRUSIVE_PTR TESTS
+
+class Node : public cslt::intrusive_ref_counter<Node> {
+public:
+    static int instances;
+    int value;
+    explicit Node(int val) : value(val) { ++instances; }
+    ~Node() { --instances; }
+};
+int Node::instances = 0;
+// --------------------------------------------------------------------------------
+
+TEST(IntrusivePtrTest, SharedOwnership) {
+    Node::instances = 0;
+    {
+        cslt::intrusive_ptr<Node> a = cslt::make_intrusive<Node>(3);
+        EXPECT_EQ(a->use_count(), 1);
+        {
+            cslt::intrusive_ptr<Node> b = a;
+            EXPECT_EQ(a->use_count(), 2);
+            EXPECT_EQ(b->value, 3);
+        }
+        EXPECT_EQ(a->use_count(), 1);
+        EXPECT_EQ(Node::instances, 1);
+    }
+    EXPECT_EQ(Node::instances, 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST(IntrusivePtrTest, RawPointerSharesCount) {
+    Node::instances = 0;
+    cslt::intrusive_ptr<Node> a(new Node(1));
+    cslt::intrusive_ptr<Node> b(a.get());
+    EXPECT_EQ(a->use_count(), 2);
+    a.reset();
+    EXPECT_EQ(Node::instances, 1);
+    b = nullptr;
+    EXPECT_EQ(Node::instances, 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST(IntrusivePtrTest, MoveAndDetach) {
+    Node::instances = 0;
+    cslt::intrusive_ptr<Node> a(new Node(5));
+    cslt::intrusive_ptr<Node> b(cslt::move(a));
+    EXPECT_FALSE(a);
+    EXPECT_EQ(b->use_count(), 1);
+    Node* raw = b.detach();
+    EXPECT_FALSE(b);
+    EXPECT_EQ(raw->use_count(), 1);
+    cslt::intrusive_ptr<Node> c(raw, false);
+    EXPECT_EQ(c->use_count(), 1);
+}
+// --------------------------------------------------------------------------------
+
+TEST(IntrusivePtrTest, CopyDoesNotCopyCount) {
+    Node::instances = 0;
+    cslt::intrusive_ptr<Node> a(new Node(9));
+    cslt::intrusive_ptr<Node> copy(new Node(*a));
+    EXPECT_EQ(a->use_count(), 1);
+    EXPECT_EQ(copy->use_count(), 1);
+    EXPECT_EQ(copy->value, 9);
+}
 // ================================================================================
 // ================================================================================
 // eof
@@ -0,0 +1,247 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_memory_resource.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests classes and methods from memory_resource.hpp file
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include "../include/memory_resource.hpp"
+#include "../include/memory.hpp"
+#include "../include/vec.hpp"
+#include "../include/string.hpp"
+
+// A resource that forwards to new_delete_resource and counts every call
+class CountingResource : public cslt::memory_resource {
+public:
+    int allocations = 0;
+    int deallocations = 0;
+    cslt::size_t outstanding = 0;
+
+private:
+    void* do_allocate(cslt::size_t bytes, cslt::size_t alignment) override {
+        ++allocations;
+        outstanding += bytes;
+        return cslt::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, cslt::size_t bytes, cslt::size_t alignment) override {
+        ++deallocations;
+        outstanding -= bytes;
+        cslt::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const cslt::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+// --------------------------------------------------------------------------------
+
+static bool is_aligned(const void* p, cslt::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+// ================================================================================
+// ================================================================================
+// MONOTONIC ARENA TESTS
+
+TEST(MonotonicArenaTest, AllocationsAreAligned) {
+    cslt::monotonic_arena arena;
+    for (cslt::size_t align = 1; align <= 256; align *= 2) {
+        void* p = arena.allocate(3, align);
+        EXPECT_TRUE(is_aligned(p, align)) << "alignment " << align;
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(MonotonicArenaTest, ReleaseFreesChunksNotObjects) {
+    CountingResource upstream;
+    {
+        cslt::monotonic_arena arena(&upstream);
+        for (int i = 0; i < 10000; ++i)
+            arena.allocate(16, 8);
+        EXPECT_LT(upstream.allocations, 20);
+        EXPECT_EQ(arena.bytes_allocated(), 160000);
+    }
+    EXPECT_EQ(upstream.allocations, upstream.deallocations);
+    EXPECT_EQ(upstream.outstanding, 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST(MonotonicArenaTest, InitialBufferIsUsedFirst) {
+    alignas(16) char buffer[256];
+    cslt::monotonic_arena arena(buffer, sizeof(buffer), cslt::null_memory_resource());
+    void* p = arena.allocate(100, 8);
+    EXPECT_GE(static_cast<char*>(p), buffer);
+    EXPECT_LT(static_cast<char*>(p), buffer + sizeof(buffer));
+    EXPECT_THROW(arena.allocate(1000, 8), cslt::bad_alloc);
+    arena.release();
+    EXPECT_EQ(arena.allocate(200, 8), static_cast<void*>(buffer));
+}
+// --------------------------------------------------------------------------------
+
+TEST(MonotonicArenaTest, LargeRequestGetsOwnChunk) {
+    CountingResource upstream;
+    cslt::monotonic_arena arena(&upstream);
+    void* p = arena.allocate(1 << 20, 64);
+    EXPECT_TRUE(is_aligned(p, 64));
+    EXPECT_EQ(upstream.allocations, 1);
+    arena.release();
+    EXPECT_EQ(upstream.deallocations, 1);
+}
+// ================================================================================
+// ================================================================================
+// POOL RESOURCE TESTS
+
+TEST(PoolResourceTest, BlocksAreReused) {
+    cslt::pool_resource pool;
+    void* a = pool.allocate(24, 8);
+    pool.deallocate(a, 24, 8);
+    void* b = pool.allocate(32, 8);
+    EXPECT_EQ(a, b);
+    pool.deallocate(b, 32, 8);
+}
+// --------------------------------------------------------------------------------
+
+TEST(PoolResourceTest, SlabsAreSharedAcrossBlocks) {
+    CountingResource upstream;
+    {
+        cslt::pool_resource pool(512, 1024, &upstream);
+        void* blocks[1000];
+        for (int i = 0; i < 1000; ++i)
+            blocks[i] = pool.allocate(16, 8);
+        for (int i = 0; i < 1000; ++i)
+            EXPECT_TRUE(is_aligned(blocks[i], 16));
+        EXPECT_LT(upstream.allocations, 12);
+        for (int i = 0; i < 1000; ++i)
+            pool.deallocate(blocks[i], 16, 8);
+    }
+    EXPECT_EQ(upstream.outstanding, 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST(PoolResourceTest, LargeBlocksGoUpstream) {
+    CountingResource upstream;
+    cslt::pool_resource pool(256, 64, &upstream);
+    EXPECT_EQ(pool.max_block_size(), 256);
+    void* p = pool.allocate(4096, 64);
+    EXPECT_TRUE(is_aligned(p, 64));
+    EXPECT_EQ(upstream.allocations, 1);
+    pool.deallocate(p, 4096, 64);
+    EXPECT_EQ(upstream.deallocations, 1);
+    void* q = pool.allocate(10000, 8);
+    (void)q;
+    pool.release();
+    EXPECT_EQ(upstream.outstanding, 0);
+}
+// ================================================================================
+// ================================================================================
+// GLOBAL RESOURCE TESTS
+
+TEST(MemoryResourceTest, NewDeleteOverAligned) {
+    cslt::memory_resource* res = cslt::new_delete_resource();
+    void* p = res->allocate(100, 128);
+    EXPECT_TRUE(is_aligned(p, 128));
+    res->deallocate(p, 100, 128);
+}
+// --------------------------------------------------------------------------------
+
+TEST(MemoryResourceTest, SetDefaultResource) {
+    CountingResource counting;
+    cslt::memory_resource* previous = cslt::set_default_resource(&counting);
+    EXPECT_EQ(previous, cslt::new_delete_resource());
+    {
+        cslt::polymorphic_allocator<int> alloc;
+        EXPECT_EQ(alloc.resource(), &counting);
+        int* p = alloc.allocate(4);
+        alloc.deallocate(p, 4);
+    }
+    EXPECT_EQ(counting.allocations, 1);
+    cslt::set_default_resource(nullptr);
+    EXPECT_EQ(cslt::get_default_resource(), cslt::new_delete_resource());
+}
+// ================================================================================
+// ================================================================================
+// CONTAINER TESTS
+
+TEST(PolymorphicContainerTest, VectorInArena) {
+    CountingResource upstream;
+    {
+        cslt::monotonic_arena arena(&upstream);
+        cslt::pmr::vector<int> vec(&arena);
+        for (int i = 0; i < 1000; ++i)
+            vec.push_back(i);
+        EXPECT_EQ(vec[999], 999);
+        EXPECT_EQ(vec.get_allocator().resource(), &arena);
+        EXPECT_GT(upstream.allocations, 0);
+    }
+    EXPECT_EQ(upstream.outstanding, 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST(PolymorphicContainerTest, VectorMoveBetweenResources) {
+    cslt::monotonic_arena first;
+    cslt::monotonic_arena second;
+    cslt::pmr::vector<int> a(&first);
+    cslt::pmr::vector<int> b(&second);
+    for (int i = 0; i < 10; ++i)
+        a.push_back(i);
+    b = cslt::move(a);
+    EXPECT_EQ(b.size(), 10);
+    EXPECT_EQ(b[9], 9);
+    EXPECT_EQ(b.get_allocator().resource(), &second);
+}
+// --------------------------------------------------------------------------------
+
+TEST(PolymorphicContainerTest, ArrayPtrInPool) {
+    CountingResource upstream;
+    {
+        cslt::pool_resource pool(&upstream);
+        cslt::pmr::array_ptr<double> arr(8, &pool);
+        for (cslt::size_t i = 0; i < arr.size(); ++i)
+            EXPECT_EQ(arr[i], 0.0);
+        arr[3] = 1.5;
+        arr.realloc(16);
+        EXPECT_EQ(arr.size(), 16);
+        EXPECT_EQ(arr[3], 1.5);
+        cslt::pmr::array_ptr<double> moved(cslt::move(arr));
+        EXPECT_EQ(moved[3], 1.5);
+        EXPECT_EQ(moved.get_allocator().resource(), &pool);
+    }
+    EXPECT_EQ(upstream.outstanding, 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST(PolymorphicContainerTest, StringInArena) {
+    CountingResource upstream;
+    {
+        cslt::monotonic_arena arena(&upstream);
+        cslt::polymorphic_allocator<char> alloc(&arena);
+        cslt::String small("key", alloc);
+        EXPECT_EQ(upstream.allocations, 0);
+        cslt::String large("a string that is too long to be stored inline", alloc);
+        EXPECT_EQ(upstream.allocations, 1);
+        EXPECT_EQ(large.get_allocator().resource(), &arena);
+        large += " and keeps on growing";
+        EXPECT_STREQ(large.c_string(), "a string that is too long to be stored inline and keeps on growing");
+
+        cslt::String heap_copy(large);
+        EXPECT_EQ(heap_copy.get_allocator().resource(), cslt::get_default_resource());
+
+        cslt::String other(alloc);
+        other = cslt::move(heap_copy);
+        EXPECT_EQ(other.get_allocator().resource(), &arena);
+        EXPECT_TRUE(other == large);
+        EXPECT_TRUE(heap_copy.empty());
+    }
+    EXPECT_EQ(upstream.outstanding, 0);
+}
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,230 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_parallel_algorithm.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the algorithms in parallel_algorithm.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "../include/parallel_algorithm.hpp"
+#include "../include/span.hpp"
+#include "../include/vec.hpp"
+
+// One pool shared by the tests, with more workers than the sandbox has cores
+static cslt::thread_pool& test_pool() {
+    static cslt::thread_pool pool(4);
+    return pool;
+}
+
+static cslt::par::policy on_pool(cslt::size_t grain = 0) {
+    cslt::par::policy p;
+    p.pool = &test_pool();
+    p.grain = grain;
+    return p;
+}
+
+template <typename T>
+static cslt::vector<T> random_values(cslt::size_t num, T low, T high, unsigned seed) {
+    std::mt19937_64 engine(seed);
+    cslt::vector<T> values;
+    for (cslt::size_t i = 0; i < num; ++i) {
+        const double unit = std::uniform_real_distribution<double>(0.0, 1.0)(engine);
+        values.push_back(static_cast<T>(static_cast<double>(low) + (static_cast<double>(high) - static_cast<double>(low)) * unit));
+    }
+    return values;
+}
+// ================================================================================
+// ================================================================================
+// ELEMENT-WISE TESTS
+
+TEST(ParallelAlgorithmTest, ForEachAndTransform) {
+    cslt::vector<int> values;
+    for (int i = 0; i < 100000; ++i)
+        values.push_back(i);
+    cslt::par::for_each(values, [](int& v) {v *= 2;}, on_pool());
+    cslt::array_ptr<long> out(values.size());
+    cslt::par::transform(values, out, [](int v) {return static_cast<long>(v) + 1;}, on_pool());
+    for (int i = 0; i < 100000; ++i)
+        ASSERT_EQ(2L * i + 1, out[i]);
+    // A span over part of the array, transformed in place
+    cslt::span<long> head(out.data(), 10);
+    cslt::par::transform(head, head, [](long v) {return -v;}, on_pool());
+    EXPECT_EQ(-19L, out[9]);
+    EXPECT_EQ(21L, out[10]);
+    cslt::array_ptr<long> small(5);
+    EXPECT_THROW(cslt::par::transform(values, small, [](int v) {return static_cast<long>(v);}, on_pool()),
+                 cslt::invalid_argument);
+}
+// ================================================================================
+// ================================================================================
+// REDUCE AND SCAN TESTS
+
+TEST(ParallelAlgorithmTest, ReduceSums) {
+    cslt::vector<std::int64_t> values;
+    for (std::int64_t i = 1; i <= 200000; ++i)
+        values.push_back(i);
+    EXPECT_EQ(200000ll * 200001ll / 2 + 7, cslt::par::reduce(values, std::int64_t(7), std::plus<>(), on_pool()));
+    cslt::vector<std::int64_t> empty;
+    EXPECT_EQ(5, cslt::par::reduce(empty, std::int64_t(5)));
+    const std::int64_t largest = cslt::par::reduce(values, std::int64_t(0),
+        [](std::int64_t a, std::int64_t b) {return std::max(a, b);}, on_pool(100));
+    EXPECT_EQ(200000, largest);
+}
+// --------------------------------------------------------------------------------
+
+TEST(ParallelAlgorithmTest, DeterministicReduceIgnoresThreads) {
+    const cslt::vector<double> values = random_values<double>(300001, -1e6, 1e6, 11);
+    cslt::par::policy one;
+    cslt::thread_pool single(1);
+    one.pool = &single;
+    one.deterministic = true;
+    cslt::par::policy four = on_pool();
+    four.deterministic = true;
+    const double a = cslt::par::reduce(values, 0.0, std::plus<>(), one);
+    const double b = cslt::par::reduce(values, 0.0, std::plus<>(), four);
+    const double c = cslt::par::reduce(values, 0.0, std::plus<>(), four);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(b, c);
+    double serial = 0.0;
+    for (double v : values)
+        serial += v;
+    EXPECT_NEAR(serial, a, 1e-3);
+}
+// --------------------------------------------------------------------------------
+
+TEST(ParallelAlgorithmTest, InclusiveScan) {
+    for (cslt::size_t num : {1u, 100u, 16384u, 16385u, 100000u}) {
+        cslt::vector<std::int64_t> values;
+        for (cslt::size_t i = 0; i < num; ++i)
+            values.push_back(static_cast<std::int64_t>(i % 7) - 3);
+        cslt::array_ptr<std::int64_t> out(num);
+        cslt::par::inclusive_scan(values, out, std::plus<>(), on_pool());
+        std::int64_t running = 0;
+        for (cslt::size_t i = 0; i < num; ++i) {
+            running += values[i];
+            ASSERT_EQ(running, out[i]) << "num " << num << " index " << i;
+        }
+        // In place, with small blocks
+        cslt::par::inclusive_scan(values, values, std::plus<>(), on_pool(10));
+        for (cslt::size_t i = 0; i < num; ++i)
+            ASSERT_EQ(out[i], values[i]);
+    }
+    cslt::vector<std::string> words;
+    for (const char* w : {"a", "b", "c", "d"})
+        words.push_back(w);
+    cslt::par::inclusive_scan(words, words, std::plus<>(), on_pool(1));
+    EXPECT_EQ("abcd", words[3]);
+    EXPECT_EQ("ab", words[1]);
+}
+// ================================================================================
+// ================================================================================
+// SORT TESTS
+
+TEST(ParallelAlgorithmTest, MergeSortMatchesStdSort) {
+    for (cslt::size_t num : {0u, 1u, 5000u, 40000u, 250001u}) {
+        cslt::vector<int> values = random_values<int>(num, -1000, 1000, static_cast<unsigned>(num));
+        std::vector<int> expected(values.begin(), values.end());
+        std::sort(expected.begin(), expected.end());
+        cslt::par::sort(values, std::less<>(), on_pool(1000));
+        for (cslt::size_t i = 0; i < num; ++i)
+            ASSERT_EQ(expected[i], values[i]) << "num " << num << " index " << i;
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(ParallelAlgorithmTest, MergeSortComparatorAndStrings) {
+    cslt::vector<std::string> words;
+    for (int i = 0; i < 30000; ++i)
+        words.push_back(std::to_string((i * 7919) % 30011));
+    std::vector<std::string> expected(words.begin(), words.end());
+    std::sort(expected.begin(), expected.end(), std::greater<>());
+    cslt::par::sort(words, std::greater<>(), on_pool(500));
+    for (cslt::size_t i = 0; i < words.size(); ++i)
+        ASSERT_EQ(expected[i], words[i]);
+}
+// --------------------------------------------------------------------------------
+
+TEST(ParallelAlgorithmTest, RadixSortIntegers) {
+    cslt::vector<std::int32_t> signed_values = random_values<std::int32_t>(100000, -2000000000, 2000000000, 3);
+    signed_values.push_back(std::numeric_limits<std::int32_t>::min());
+    signed_values.push_back(std::numeric_limits<std::int32_t>::max());
+    std::vector<std::int32_t> expected(signed_values.begin(), signed_values.end());
+    std::sort(expected.begin(), expected.end());
+    cslt::par::radix_sort(signed_values, on_pool(1000));
+    for (cslt::size_t i = 0; i < expected.size(); ++i)
+        ASSERT_EQ(expected[i], signed_values[i]);
+
+    cslt::array_ptr<std::uint64_t> wide(50000);
+    for (cslt::size_t i = 0; i < wide.size(); ++i)
+        wide[i] = (static_cast<std::uint64_t>(i) * 0x9e3779b97f4a7c15ull) >> (i % 40);
+    std::vector<std::uint64_t> sorted(wide.begin(), wide.end());
+    std::sort(sorted.begin(), sorted.end());
+    cslt::par::radix_sort(wide, on_pool());
+    for (cslt::size_t i = 0; i < sorted.size(); ++i)
+        ASSERT_EQ(sorted[i], wide[i]);
+
+    cslt::vector<std::int8_t> tiny;
+    for (int v : {5, -128, 127, 0, -1, 3})
+        tiny.push_back(static_cast<std::int8_t>(v));
+    cslt::par::radix_sort(tiny, on_pool());
+    EXPECT_EQ(-128, tiny[0]);
+    EXPECT_EQ(-1, tiny[1]);
+    EXPECT_EQ(127, tiny[5]);
+}
+// --------------------------------------------------------------------------------
+
+TEST(ParallelAlgorithmTest, RadixSortFloats) {
+    cslt::vector<double> values = random_values<double>(80000, -1e9, 1e9, 5);
+    values.push_back(0.0);
+    values.push_back(-std::numeric_limits<double>::infinity());
+    values.push_back(std::numeric_limits<double>::infinity());
+    values.push_back(-1e-300);
+    std::vector<double> expected(values.begin(), values.end());
+    std::sort(expected.begin(), expected.end());
+    cslt::par::radix_sort(values, on_pool());
+    for (cslt::size_t i = 0; i < expected.size(); ++i)
+        ASSERT_EQ(expected[i], values[i]);
+
+    cslt::vector<float> floats = random_values<float>(20000, -5.0f, 5.0f, 6);
+    std::vector<float> expected_floats(floats.begin(), floats.end());
+    std::sort(expected_floats.begin(), expected_floats.end());
+    cslt::par::radix_sort(floats, on_pool(100));
+    for (cslt::size_t i = 0; i < expected_floats.size(); ++i)
+        ASSERT_EQ(expected_floats[i], floats[i]);
+}
+// --------------------------------------------------------------------------------
+
+TEST(ParallelAlgorithmTest, RadixSortByKeyIsStable) {
+    struct record {
+        std::uint16_t key;
+        int order;
+    };
+    cslt::vector<record> records;
+    for (int i = 0; i < 60000; ++i)
+        records.push_back(record{static_cast<std::uint16_t>((i * 37) % 101), i});
+    cslt::par::radix_sort_by_key(records, [](const record& r) {return r.key;}, on_pool(1000));
+    for (cslt::size_t i = 1; i < records.size(); ++i) {
+        ASSERT_LE(records[i - 1].key, records[i].key);
+        if (records[i - 1].key == records[i].key) {
+            ASSERT_LT(records[i - 1].order, records[i].order);
+        }
+    }
+}
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,143 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_prefetch_filebuf.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the prefetch_filebuf class in prefetch_filebuf.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <string>
+#include "../include/prefetch_filebuf.hpp"
+#include "../include/except.hpp"
+#include "../include/line_reader.hpp"
+
+static std::string write_file(const char* path, cslt::size_t size) {
+    std::string text;
+    for (cslt::size_t i = 0; text.size() < size; ++i)
+        text += "line " + std::to_string(i) + "\n";
+    text.resize(size);
+    std::ofstream out(path, std::ios::binary);
+    out << text;
+    return text;
+}
+
+static std::string read_blocks(cslt::prefetch_filebuf& buf) {
+    std::string text;
+    for (cslt::span<const char> block = buf.next_block(); !block.empty(); block = buf.next_block())
+        text.append(block.data(), block.size());
+    return text;
+}
+// ================================================================================
+// ================================================================================
+
+TEST(PrefetchFilebufTest, BlocksCoverFile) {
+    const std::string expected = write_file("prefetch_blocks.txt", 100000);
+    for (cslt::size_t depth : {2u, 3u, 8u}) {
+        cslt::prefetch_filebuf buf("prefetch_blocks.txt", 4096, depth);
+        EXPECT_TRUE(buf.is_open());
+        EXPECT_EQ(depth, buf.depth());
+        EXPECT_EQ(expected, read_blocks(buf));
+        // The end stays the end
+        EXPECT_TRUE(buf.next_block().empty());
+    }
+    std::remove("prefetch_blocks.txt");
+}
+// --------------------------------------------------------------------------------
+
+TEST(PrefetchFilebufTest, ExactMultipleOfBlock) {
+    const std::string expected = write_file("prefetch_exact.txt", 8192);
+    cslt::prefetch_filebuf buf("prefetch_exact.txt", 1024, 2);
+    EXPECT_EQ(expected, read_blocks(buf));
+    std::remove("prefetch_exact.txt");
+}
+// --------------------------------------------------------------------------------
+
+TEST(PrefetchFilebufTest, IstreamReadsThrough) {
+    const std::string expected = write_file("prefetch_stream.txt", 50000);
+    cslt::prefetch_filebuf buf("prefetch_stream.txt", 1000, 3);
+    std::istream in(&buf);
+    const std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(expected, text);
+    std::remove("prefetch_stream.txt");
+}
+// --------------------------------------------------------------------------------
+
+TEST(PrefetchFilebufTest, StreamThenBlocks) {
+    const std::string expected = write_file("prefetch_mixed.txt", 10000);
+    cslt::prefetch_filebuf buf("prefetch_mixed.txt", 1000, 2);
+    std::istream in(&buf);
+    char head[10];
+    in.read(head, sizeof(head));
+    // The rest of the block the stream started comes back first
+    const cslt::span<const char> rest = buf.next_block();
+    EXPECT_EQ(990u, rest.size());
+    std::string text(head, sizeof(head));
+    text.append(rest.data(), rest.size());
+    text += read_blocks(buf);
+    EXPECT_EQ(expected, text);
+    std::remove("prefetch_mixed.txt");
+}
+// --------------------------------------------------------------------------------
+
+TEST(PrefetchFilebufTest, FeedsLineReader) {
+    const std::string expected = write_file("prefetch_lines.txt", 30001);
+    cslt::prefetch_filebuf buf("prefetch_lines.txt", 512, 4);
+    std::istream in(&buf);
+    cslt::line_reader reader(in, 700);
+    std::string text;
+    reader.for_each([&text](cslt::string_view line) {
+        text.append(line.data(), line.size());
+        text += '\n';
+    });
+    // The file was cut in the middle of a line, which gets no newline back
+    text.pop_back();
+    EXPECT_EQ(expected, text);
+    std::remove("prefetch_lines.txt");
+}
+// --------------------------------------------------------------------------------
+
+TEST(PrefetchFilebufTest, EmptyFile) {
+    write_file("prefetch_empty.txt", 0);
+    cslt::prefetch_filebuf buf("prefetch_empty.txt");
+    EXPECT_TRUE(buf.next_block().empty());
+    std::istream in(&buf);
+    EXPECT_EQ(std::char_traits<char>::eof(), in.get());
+    std::remove("prefetch_empty.txt");
+}
+// --------------------------------------------------------------------------------
+
+TEST(PrefetchFilebufTest, MissingFileThrows) {
+    cslt::prefetch_filebuf buf;
+    EXPECT_FALSE(buf.is_open());
+    EXPECT_TRUE(buf.next_block().empty());
+    EXPECT_THROW(buf.open("prefetch_missing_file.txt"), cslt::system_error);
+    EXPECT_FALSE(buf.is_open());
+}
+// --------------------------------------------------------------------------------
+
+TEST(PrefetchFilebufTest, CloseWhileReadingAhead) {
+    const std::string expected = write_file("prefetch_close.txt", 200000);
+    cslt::prefetch_filebuf buf("prefetch_close.txt", 1024, 4);
+    EXPECT_EQ(1024u, buf.next_block().size());
+    // The worker is waiting for a free block and must still stop
+    buf.close();
+    EXPECT_FALSE(buf.is_open());
+    buf.open("prefetch_close.txt", 4096, 2);
+    EXPECT_EQ(expected, read_blocks(buf));
+    std::remove("prefetch_close.txt");
+}
+// ================================================================================
+// ================================================================================
+// eof
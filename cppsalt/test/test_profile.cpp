@@ -0,0 +1,235 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_profile.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the histograms, timers and probes in profile.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include "../include/profile.hpp"
+#include "../include/fast_ostream.hpp"
+#include "../include/vec.hpp"
+
+using cslt::profile::histogram;
+using cslt::profile::probe_id;
+
+// A temporary file to write to through its descriptor
+class temp_output {
+    std::FILE* file = std::tmpfile();
+public:
+    ~temp_output() {std::fclose(file);}
+    int fd() const {return fileno(file);}
+
+    std::string contents() const {
+        std::string text;
+        std::rewind(file);
+        char block[4096];
+        std::size_t num;
+        while ((num = std::fread(block, 1, sizeof(block), file)) != 0)
+            text.append(block, num);
+        return text;
+    }
+};
+
+// Returns the samples the calling thread recorded under id so far
+static std::uint64_t thread_count(probe_id id) {
+    const cslt::profile::snapshot snap = cslt::profile::thread_snapshot();
+    return id < snap.size() ? snap[id].count() : 0;
+}
+// ================================================================================
+// ================================================================================
+// HISTOGRAM TESTS
+
+TEST(ProfileTest, SmallValuesHaveExactBuckets) {
+    for (std::uint64_t value = 0; value < 32; ++value) {
+        EXPECT_EQ(value, histogram::bucket_of(value));
+        EXPECT_EQ(value, histogram::bucket_limit(value));
+    }
+    EXPECT_EQ(histogram::bucket_count - 1, histogram::bucket_of(UINT64_MAX));
+    EXPECT_EQ(UINT64_MAX, histogram::bucket_limit(histogram::bucket_count - 1));
+}
+// --------------------------------------------------------------------------------
+
+TEST(ProfileTest, BucketLimitsBoundRelativeError) {
+    for (std::size_t i = 0; i < histogram::bucket_count; ++i)
+        ASSERT_EQ(i, histogram::bucket_of(histogram::bucket_limit(i))) << "bucket " << i;
+    for (std::size_t i = 1; i < histogram::bucket_count; ++i)
+        ASSERT_EQ(i, histogram::bucket_of(histogram::bucket_limit(i - 1) + 1)) << "bucket " << i;
+
+    std::uint64_t value = 1;
+    while (value < UINT64_MAX / 3) {
+        const std::uint64_t limit = histogram::bucket_limit(histogram::bucket_of(value));
+        EXPECT_LE(value, limit);
+        EXPECT_LE(limit - value, value / 16);
+        value = value * 3 + 1;
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(ProfileTest, PercentilesOfUniformValues) {
+    histogram h;
+    EXPECT_EQ(0u, h.percentile(50.0));
+    EXPECT_EQ(0u, h.min());
+    for (std::uint64_t value = 1; value <= 1000; ++value)
+        h.record(value);
+    EXPECT_EQ(1000u, h.count());
+    EXPECT_EQ(500500u, h.sum());
+    EXPECT_EQ(1u, h.min());
+    EXPECT_EQ(1000u, h.max());
+    EXPECT_DOUBLE_EQ(500.5, h.mean());
+
+    EXPECT_GE(h.percentile(50.0), 500u);
+    EXPECT_LE(h.percentile(50.0), 500u + 500u / 16);
+    EXPECT_GE(h.percentile(99.0), 990u);
+    EXPECT_LE(h.percentile(99.9), 1000u);
+    EXPECT_EQ(1000u, h.percentile(100.0));
+    EXPECT_EQ(1u, h.percentile(0.0));
+}
+// --------------------------------------------------------------------------------
+
+TEST(ProfileTest, MergeAddsCounts) {
+    histogram a, b;
+    a.record(10, 3);
+    b.record(5000);
+    b.record(2);
+    a += b;
+    EXPECT_EQ(5u, a.count());
+    EXPECT_EQ(2u, a.min());
+    EXPECT_EQ(5000u, a.max());
+    EXPECT_EQ(3u, a.bucket(histogram::bucket_of(10)));
+    EXPECT_EQ(10u, a.percentile(50.0));
+    EXPECT_EQ(5000u, a.percentile(99.0));
+}
+// ================================================================================
+// ================================================================================
+// PROBE TESTS
+
+TEST(ProfileTest, RegisterProbeReturnsOneIdPerName) {
+    const probe_id alpha = cslt::profile::register_probe("test.alpha");
+    const probe_id beta = cslt::profile::register_probe("test.beta");
+    std::string copy = "test.alpha";
+    EXPECT_NE(alpha, beta);
+    EXPECT_EQ(alpha, cslt::profile::register_probe(copy.c_str()));
+    EXPECT_STREQ("test.beta", cslt::profile::probe_name(beta));
+    EXPECT_LT(beta, cslt::profile::probe_count());
+    EXPECT_EQ(cslt::profile::no_probe, cslt::profile::register_probe(nullptr));
+    EXPECT_STREQ("unknown", cslt::profile::probe_name(cslt::profile::no_probe));
+}
+// --------------------------------------------------------------------------------
+
+TEST(ProfileTest, ScopedTimerRecordsOnCallingThread) {
+    const probe_id id = cslt::profile::register_probe("test.timer");
+    const std::uint64_t before = thread_count(id);
+    for (int i = 0; i < 3; ++i) {
+        cslt::profile::scoped_timer timer(id);
+    }
+    cslt::profile::record(cslt::profile::no_probe, 5);
+    if (cslt::profile::enabled)
+        EXPECT_EQ(before + 3, thread_count(id));
+    else
+        EXPECT_EQ(0u, thread_count(id));
+}
+// --------------------------------------------------------------------------------
+
+TEST(ProfileTest, GlobalSnapshotKeepsExitedThreads) {
+    const probe_id id = cslt::profile::register_probe("test.thread");
+    const auto count = [id] {
+        const cslt::profile::snapshot snap = cslt::profile::global_snapshot();
+        return id < snap.size() ? snap[id].count() : 0;
+    };
+    const std::uint64_t before = count();
+    std::thread worker([id] {
+        for (std::uint64_t i = 0; i < 100; ++i)
+            cslt::profile::record(id, i);
+    });
+    worker.join();
+    EXPECT_EQ(thread_count(id), 0u);
+    if (cslt::profile::enabled)
+        EXPECT_EQ(before + 100, count());
+    else
+        EXPECT_EQ(0u, count());
+}
+// --------------------------------------------------------------------------------
+
+TEST(ProfileTest, VectorGrowthHitsProbe) {
+    {
+        cslt::vector<int> vec;
+        for (int i = 0; i < 100; ++i)
+            vec.push_back(i);
+    }
+    const probe_id id = cslt::profile::register_probe("vector.realloc");
+    if (cslt::profile::enabled)
+        EXPECT_LT(0u, thread_count(id));
+    else
+        EXPECT_EQ(0u, thread_count(id));
+}
+// --------------------------------------------------------------------------------
+
+TEST(ProfileTest, ScopeMacroCompiles) {
+    int calls = 0;
+    for (int i = 0; i < 2; ++i) {
+        CSLT_PROFILE_SCOPE("test.macro");
+        ++calls;
+    }
+    EXPECT_EQ(2, calls);
+    const probe_id id = cslt::profile::register_probe("test.macro");
+    EXPECT_EQ(cslt::profile::enabled ? 2u : 0u, thread_count(id));
+}
+// ================================================================================
+// ================================================================================
+// REPORT TESTS
+
+TEST(ProfileTest, WriteTextListsProbesWithSamples) {
+    const probe_id quiet = cslt::profile::register_probe("test.quiet");
+    const probe_id busy = cslt::profile::register_probe("test.busy");
+    cslt::profile::snapshot snap(cslt::profile::probe_count(), 2.0);
+    for (std::uint64_t i = 1; i <= 10; ++i)
+        snap[busy].record(i);
+    EXPECT_EQ(0u, snap[quiet].count());
+
+    temp_output file;
+    {
+        cslt::fast_ostream out(file.fd());
+        cslt::profile::write_text(out, snap);
+    }
+    EXPECT_EQ("test.busy: count=10 mean=11.0ns p50=10.0ns p99=20.0ns p999=20.0ns max=20.0ns\n",
+              file.contents());
+}
+// --------------------------------------------------------------------------------
+
+TEST(ProfileTest, WriteJsonEscapesNames) {
+    const probe_id odd = cslt::profile::register_probe("test.\"odd\"\\name");
+    cslt::profile::snapshot snap(cslt::profile::probe_count(), 1.0);
+    snap[odd].record(4);
+
+    temp_output file;
+    {
+        cslt::fast_ostream out(file.fd());
+        cslt::profile::write_json(out, snap);
+    }
+    EXPECT_EQ("{\"unit\":\"ns\",\"probes\":[{\"name\":\"test.\\\"odd\\\"\\\\name\",\"count\":1,"
+              "\"min\":4.0,\"mean\":4.0,\"p50\":4.0,\"p90\":4.0,\"p99\":4.0,\"p999\":4.0,\"max\":4.0}]}\n",
+              file.contents());
+
+    temp_output empty;
+    {
+        cslt::fast_ostream out(empty.fd());
+        cslt::profile::write_json(out, cslt::profile::snapshot());
+    }
+    EXPECT_EQ("{\"unit\":\"ns\",\"probes\":[]}\n", empty.contents());
+}
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,219 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_serialize.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the binary layout and readers in serialize.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include "../include/serialize.hpp"
+#include "../include/io.hpp"
+
+namespace {
+    using record = cslt::pair<cslt::String, cslt::vector<double>>;
+
+    cslt::vector<record> sample_records() {
+        cslt::vector<record> rows;
+        rows.push_back(record(cslt::String("alpha"), cslt::vector<double>{1.5, 2.5}));
+        rows.push_back(record(cslt::String("a name too long for the inline buffer"), cslt::vector<double>{}));
+        rows.push_back(record(cslt::String(""), cslt::vector<double>{-3.0}));
+        return rows;
+    }
+
+    // Copies bytes into storage aligned to 8, with room to shift or extend them
+    struct aligned_copy {
+        alignas(8) char block[512];
+        cslt::size_t len;
+
+        explicit aligned_copy(const cslt::vector<char>& bytes, cslt::size_t num) : len(num) {
+            std::memcpy(block, bytes.data(), num);
+        }
+        cslt::span<const char> bytes(cslt::size_t offset = 0) const {
+            return cslt::span<const char>(block + offset, len);
+        }
+    };
+}
+// ================================================================================
+// ================================================================================
+// LAYOUT TESTS
+
+TEST(SerializeTest, HeaderAndLittleEndianScalar) {
+    const cslt::vector<char> bytes = cslt::serialize(std::uint32_t(0x01020304), 7);
+    ASSERT_EQ(cslt::serial_header_size + 4, bytes.size());
+    EXPECT_EQ(0, std::memcmp(bytes.data(), "CSLT", 4));
+    EXPECT_EQ(1, bytes[4]);
+    EXPECT_EQ(7, bytes[8]);
+    EXPECT_EQ(0, bytes[12]);
+    EXPECT_EQ(4, bytes[16]);
+    EXPECT_EQ(3, bytes[17]);
+    EXPECT_EQ(2, bytes[18]);
+    EXPECT_EQ(1, bytes[19]);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SerializeTest, BitwiseArrayIsOneAlignedBlock) {
+    const cslt::vector<double> values = {1.0, 2.0, 3.0};
+    cslt::serial_writer out;
+    out.write(std::uint8_t(9));
+    out.write(values);
+    // tag byte, padding to 8, count, then the block
+    ASSERT_EQ(cslt::serial_header_size + 8 + 8 + 3 * sizeof(double), out.size());
+    EXPECT_EQ(0, std::memcmp(out.data() + cslt::serial_header_size + 16, values.data(), 3 * sizeof(double)));
+}
+// ================================================================================
+// ================================================================================
+// ROUND TRIP TESTS
+
+TEST(SerializeTest, RoundTripScalarsAndStrings) {
+    EXPECT_EQ(-42, cslt::deserialize<int>(cslt::serialize(-42)));
+    EXPECT_DOUBLE_EQ(0.25, cslt::deserialize<double>(cslt::serialize(0.25)));
+    EXPECT_TRUE(cslt::deserialize<bool>(cslt::serialize(true)));
+    const cslt::String text("a string long enough to need the heap");
+    EXPECT_EQ(text, cslt::deserialize<cslt::String>(cslt::serialize(text)));
+    EXPECT_EQ(cslt::String(""), cslt::deserialize<cslt::String>(cslt::serialize(cslt::String(""))));
+}
+// --------------------------------------------------------------------------------
+
+TEST(SerializeTest, RoundTripNestedContainers) {
+    const cslt::vector<record> rows = sample_records();
+    const cslt::vector<record> copy = cslt::deserialize<cslt::vector<record>>(cslt::serialize(rows, 3), 3);
+    ASSERT_EQ(rows.size(), copy.size());
+    for (cslt::size_t i = 0; i < rows.size(); ++i) {
+        EXPECT_EQ(rows[i].first, copy[i].first);
+        ASSERT_EQ(rows[i].second.size(), copy[i].second.size());
+        for (cslt::size_t j = 0; j < rows[i].second.size(); ++j)
+            EXPECT_DOUBLE_EQ(rows[i].second[j], copy[i].second[j]);
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(SerializeTest, ArrayPtrSharesTheVectorLayout) {
+    const cslt::vector<int> values = {5, 6, 7, 8};
+    const cslt::array_ptr<int> arr = cslt::deserialize<cslt::array_ptr<int>>(cslt::serialize(values));
+    ASSERT_EQ(4u, arr.size());
+    EXPECT_EQ(8, arr[3]);
+
+    cslt::array_ptr<cslt::String> names(2);
+    names[0] = cslt::String("x");
+    names[1] = cslt::String("yz");
+    const cslt::vector<cslt::String> back = cslt::deserialize<cslt::vector<cslt::String>>(cslt::serialize(names));
+    ASSERT_EQ(2u, back.size());
+    EXPECT_EQ(cslt::String("yz"), back[1]);
+}
+// ================================================================================
+// ================================================================================
+// VIEW TESTS
+
+TEST(SerializeTest, ViewPointsIntoTheBuffer) {
+    const cslt::vector<double> values = {1.0, 2.0, 3.0, 4.0};
+    const cslt::vector<char> bytes = cslt::serialize(values);
+    const cslt::span<const double> view = cslt::deserialize_view<cslt::vector<double>>(bytes);
+    ASSERT_EQ(4u, view.size());
+    EXPECT_GE(reinterpret_cast<const char*>(view.data()), bytes.data());
+    EXPECT_LT(reinterpret_cast<const char*>(view.data()), bytes.data() + bytes.size());
+    EXPECT_DOUBLE_EQ(4.0, view[3]);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SerializeTest, ViewOfNestedRecords) {
+    const cslt::vector<char> bytes = cslt::serialize(sample_records());
+    const cslt::serial_array_view<record> rows = cslt::deserialize_view<cslt::vector<record>>(bytes);
+    ASSERT_EQ(3u, rows.size());
+    EXPECT_EQ(cslt::string_view("a name too long for the inline buffer"), rows[1].first);
+    EXPECT_TRUE(rows[1].second.empty());
+    EXPECT_DOUBLE_EQ(2.5, rows[0].second[1]);
+    EXPECT_THROW(rows.at(3), cslt::out_of_range);
+
+    cslt::size_t count = 0;
+    for (const auto& row : rows) {
+        EXPECT_GE(row.first.data(), bytes.data());
+        ++count;
+    }
+    EXPECT_EQ(3u, count);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SerializeTest, ViewOfMappedFile) {
+    const cslt::vector<char> bytes = cslt::serialize(sample_records());
+    {
+        cslt::ofstream out("serialized.bin", std::ios::binary);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+    {
+        cslt::mapped_file file("serialized.bin");
+        const auto rows = cslt::deserialize_view<cslt::vector<record>>(file);
+        EXPECT_EQ(cslt::string_view("alpha"), rows[0].first);
+        EXPECT_DOUBLE_EQ(-3.0, rows[2].second[0]);
+        EXPECT_GE(rows[2].first.data(), file.data());
+    }
+    std::remove("serialized.bin");
+}
+// ================================================================================
+// ================================================================================
+// VALIDATION TESTS
+
+TEST(SerializeTest, EveryTruncationThrows) {
+    const cslt::vector<char> bytes = cslt::serialize(sample_records());
+    for (cslt::size_t len = 0; len < bytes.size(); ++len) {
+        const aligned_copy copy(bytes, len);
+        EXPECT_THROW(cslt::deserialize<cslt::vector<record>>(copy.bytes()), cslt::format_error) << len;
+        EXPECT_THROW(cslt::deserialize_view<cslt::vector<record>>(copy.bytes()), cslt::format_error) << len;
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(SerializeTest, HeaderErrorsThrow) {
+    const cslt::vector<char> bytes = cslt::serialize(cslt::String("abc"), 2);
+    EXPECT_THROW(cslt::deserialize<cslt::String>(bytes, 3), cslt::format_error);
+
+    aligned_copy bad_tag(bytes, bytes.size());
+    bad_tag.block[0] = 'X';
+    EXPECT_THROW(cslt::deserialize<cslt::String>(bad_tag.bytes(), 2), cslt::format_error);
+
+    aligned_copy bad_version(bytes, bytes.size());
+    bad_version.block[4] = 9;
+    EXPECT_THROW(cslt::deserialize<cslt::String>(bad_version.bytes(), 2), cslt::format_error);
+
+    // One byte past an aligned address
+    aligned_copy shifted(bytes, bytes.size());
+    std::memmove(shifted.block + 1, shifted.block, bytes.size());
+    EXPECT_THROW(cslt::deserialize<cslt::String>(shifted.bytes(1), 2), cslt::format_error);
+
+    const cslt::serial_reader in(bytes);
+    EXPECT_EQ(2u, in.schema_version());
+}
+// --------------------------------------------------------------------------------
+
+TEST(SerializeTest, CorruptValuesThrow) {
+    cslt::vector<char> trailing = cslt::serialize(1);
+    trailing.push_back('\0');
+    EXPECT_THROW(cslt::deserialize<int>(trailing), cslt::format_error);
+
+    aligned_copy bad_bool(cslt::serialize(true), cslt::serial_header_size + 1);
+    bad_bool.block[cslt::serial_header_size] = 2;
+    EXPECT_THROW(cslt::deserialize<bool>(bad_bool.bytes()), cslt::format_error);
+
+    // A count far larger than the buffer must fail before anything is allocated
+    const cslt::vector<char> huge = cslt::serialize(std::uint64_t(1) << 60);
+    EXPECT_THROW(cslt::deserialize<cslt::vector<double>>(huge), cslt::format_error);
+    EXPECT_THROW(cslt::deserialize<cslt::vector<cslt::String>>(huge), cslt::format_error);
+
+    // The first entry of the offset table no longer points at the first element
+    const cslt::vector<char> names = cslt::serialize(cslt::vector<cslt::String>{"a", "b"});
+    aligned_copy bad_table(names, names.size());
+    bad_table.block[cslt::serial_header_size + 8] += 1;
+    EXPECT_THROW(cslt::deserialize<cslt::vector<cslt::String>>(bad_table.bytes()), cslt::format_error);
+}
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,282 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_simd.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the numeric kernels in simd.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <climits>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "../include/simd.hpp"
+#include "../include/except.hpp"
+#include "../include/memory.hpp"
+
+using cslt::simd::compare;
+using cslt::simd::kernel;
+
+static const kernel all_kernels[] = {
+    kernel::scalar, kernel::sse2, kernel::avx2, kernel::avx512, kernel::neon
+};
+
+// Runs check once with each kernel this machine supports, then restores the
+// kernel that was active
+template <typename Check>
+static void for_each_kernel(Check check) {
+    const kernel previous = cslt::simd::active_kernel();
+    for (kernel k : all_kernels) {
+        if (!cslt::simd::select_kernel(k))
+            continue;
+        SCOPED_TRACE(cslt::simd::kernel_name(k));
+        check();
+    }
+    cslt::simd::select_kernel(previous);
+}
+
+// Small whole numbers, so that floating point sums and products are exact in
+// any order and every kernel must match the plain loop
+template <typename T>
+static std::vector<T> make_values(std::size_t len, int seed) {
+    std::vector<T> values(len);
+    for (std::size_t i = 0; i < len; ++i)
+        values[i] = static_cast<T>(static_cast<int>((i * 7 + static_cast<std::size_t>(seed)) % 19) - 9);
+    return values;
+}
+
+// Lengths that cover empty input, tails alone, and several unrolled blocks of
+// the widest register
+static const std::size_t max_len = 100;
+// ================================================================================
+// ================================================================================
+// DISPATCH TESTS
+
+TEST(SimdTest, ScalarAlwaysSupported) {
+    EXPECT_TRUE(cslt::simd::kernel_supported(kernel::scalar));
+    EXPECT_STREQ("avx512", cslt::simd::kernel_name(kernel::avx512));
+    EXPECT_TRUE(cslt::simd::kernel_supported(cslt::simd::active_kernel()));
+}
+// --------------------------------------------------------------------------------
+
+TEST(SimdTest, SelectKernelRejectsUnsupported) {
+    const kernel previous = cslt::simd::active_kernel();
+    for (kernel k : all_kernels) {
+        EXPECT_EQ(cslt::simd::kernel_supported(k), cslt::simd::select_kernel(k));
+        if (cslt::simd::kernel_supported(k)) {
+            EXPECT_EQ(k, cslt::simd::active_kernel());
+        }
+    }
+    cslt::simd::select_kernel(previous);
+}
+// ================================================================================
+// ================================================================================
+// REDUCTION TESTS
+
+template <typename T>
+static void check_reductions() {
+    for (std::size_t len = 0; len <= max_len; ++len) {
+        const std::vector<T> x = make_values<T>(len, 3);
+        const std::vector<T> y = make_values<T>(len, 11);
+        T total = 0, products = 0;
+        for (std::size_t i = 0; i < len; ++i) {
+            total += x[i];
+            products += x[i] * y[i];
+        }
+        EXPECT_EQ(total, cslt::simd::sum(x)) << "len " << len;
+        EXPECT_EQ(products, cslt::simd::dot(x, y)) << "len " << len;
+        if (len == 0)
+            continue;
+        T low = x[0], high = x[0];
+        for (T value : x) {
+            low = value < low ? value : low;
+            high = value > high ? value : high;
+        }
+        EXPECT_EQ(low, cslt::simd::min(x)) << "len " << len;
+        EXPECT_EQ(high, cslt::simd::max(x)) << "len " << len;
+    }
+}
+
+TEST(SimdTest, ReductionsMatchLoops) {
+    for_each_kernel([] {
+        check_reductions<float>();
+        check_reductions<double>();
+        check_reductions<int>();
+    });
+}
+// --------------------------------------------------------------------------------
+
+TEST(SimdTest, MinAndMaxFindExtremesInTail) {
+    for_each_kernel([] {
+        std::vector<int> x(67, 5);
+        x.back() = -40;
+        x[x.size() - 2] = 90;
+        EXPECT_EQ(-40, cslt::simd::min(x));
+        EXPECT_EQ(90, cslt::simd::max(x));
+
+        std::vector<double> y(67, -1.5);
+        y[0] = 8.25;
+        EXPECT_EQ(8.25, cslt::simd::max(y));
+        EXPECT_EQ(-1.5, cslt::simd::min(y));
+    });
+}
+// --------------------------------------------------------------------------------
+
+TEST(SimdTest, IntSumWraps) {
+    for_each_kernel([] {
+        const std::vector<int> x(40, INT_MAX);
+        const unsigned expected = 40u * static_cast<unsigned>(INT_MAX);
+        EXPECT_EQ(static_cast<int>(expected), cslt::simd::sum(x));
+    });
+}
+// --------------------------------------------------------------------------------
+
+TEST(SimdTest, CountIfMatchesLoops) {
+    const compare ops[] = {compare::equal, compare::not_equal, compare::less,
+                           compare::less_equal, compare::greater, compare::greater_equal};
+    for_each_kernel([&ops] {
+        for (std::size_t len = 0; len <= max_len; len += 7) {
+            const std::vector<int> x = make_values<int>(len, 5);
+            const std::vector<float> f = make_values<float>(len, 5);
+            const std::vector<double> d = make_values<double>(len, 5);
+            for (compare op : ops) {
+                for (int value : {-9, 0, 4, 20}) {
+                    std::size_t expected = 0;
+                    for (int e : x) {
+                        switch (op) {
+                            case compare::equal: expected += e == value; break;
+                            case compare::not_equal: expected += e != value; break;
+                            case compare::less: expected += e < value; break;
+                            case compare::less_equal: expected += e <= value; break;
+                            case compare::greater: expected += e > value; break;
+                            case compare::greater_equal: expected += e >= value; break;
+                        }
+                    }
+                    EXPECT_EQ(expected, cslt::simd::count_if(x, op, value));
+                    EXPECT_EQ(expected, cslt::simd::count_if(f, op, static_cast<float>(value)));
+                    EXPECT_EQ(expected, cslt::simd::count_if(d, op, static_cast<double>(value)));
+                }
+            }
+        }
+    });
+}
+// --------------------------------------------------------------------------------
+
+TEST(SimdTest, CountIfNaNOnlyNotEqual) {
+    for_each_kernel([] {
+        std::vector<float> x(37, std::numeric_limits<float>::quiet_NaN());
+        x[3] = 1.0f;
+        EXPECT_EQ(36u, cslt::simd::count_if(x, compare::not_equal, 1.0f));
+        EXPECT_EQ(1u, cslt::simd::count_if(x, compare::equal, 1.0f));
+        EXPECT_EQ(0u, cslt::simd::count_if(x, compare::less, 1.0f));
+        EXPECT_EQ(1u, cslt::simd::count_if(x, compare::greater_equal, 1.0f));
+    });
+}
+// ================================================================================
+// ================================================================================
+// ELEMENTWISE TESTS
+
+template <typename T>
+static void check_elementwise() {
+    for (std::size_t len = 0; len <= max_len; ++len) {
+        const std::vector<T> x = make_values<T>(len, 1);
+        const std::vector<T> y = make_values<T>(len, 8);
+        std::vector<T> out(len);
+
+        cslt::simd::add(x, y, out);
+        for (std::size_t i = 0; i < len; ++i)
+            ASSERT_EQ(x[i] + y[i], out[i]) << "len " << len;
+        cslt::simd::sub(x, y, out);
+        for (std::size_t i = 0; i < len; ++i)
+            ASSERT_EQ(x[i] - y[i], out[i]) << "len " << len;
+        cslt::simd::mul(x, y, out);
+        for (std::size_t i = 0; i < len; ++i)
+            ASSERT_EQ(x[i] * y[i], out[i]) << "len " << len;
+
+        std::vector<T> acc = y;
+        cslt::simd::axpy(T(3), x, acc);
+        for (std::size_t i = 0; i < len; ++i)
+            ASSERT_EQ(T(3) * x[i] + y[i], acc[i]) << "len " << len;
+
+        cslt::simd::fill(out, T(7));
+        for (T value : out)
+            ASSERT_EQ(T(7), value) << "len " << len;
+    }
+}
+
+TEST(SimdTest, ElementwiseMatchesLoops) {
+    for_each_kernel([] {
+        check_elementwise<float>();
+        check_elementwise<double>();
+        check_elementwise<int>();
+    });
+}
+// --------------------------------------------------------------------------------
+
+TEST(SimdTest, IntMultiplyKeepsLowBits) {
+    for_each_kernel([] {
+        const std::vector<int> x(21, 65537);
+        const std::vector<int> y(21, -65535);
+        std::vector<int> out(21);
+        cslt::simd::mul(x, y, out);
+        const unsigned expected = 65537u * static_cast<unsigned>(-65535);
+        for (int value : out)
+            EXPECT_EQ(static_cast<int>(expected), value);
+    });
+}
+// --------------------------------------------------------------------------------
+
+TEST(SimdTest, OutputMayBeAnInput) {
+    for_each_kernel([] {
+        std::vector<double> x = make_values<double>(45, 2);
+        const std::vector<double> original = x;
+        cslt::simd::add(x, x, x);
+        for (std::size_t i = 0; i < x.size(); ++i)
+            EXPECT_EQ(2.0 * original[i], x[i]);
+    });
+}
+// --------------------------------------------------------------------------------
+
+TEST(SimdTest, AcceptsArrayPtrAndSubspans) {
+    for_each_kernel([] {
+        cslt::array_ptr<float> data(50);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<float>(i);
+        EXPECT_EQ(1225.0f, cslt::simd::sum(data));
+        const cslt::span<const float> middle(data.get() + 10, 5);
+        EXPECT_EQ(60.0f, cslt::simd::sum(middle));
+        EXPECT_EQ(14.0f, cslt::simd::max(middle));
+    });
+}
+// ================================================================================
+// ================================================================================
+// ARGUMENT TESTS
+
+TEST(SimdTest, MismatchedSizesThrow) {
+    std::vector<float> x(8), y(9), out(8);
+    EXPECT_THROW(cslt::simd::dot(x, y), cslt::invalid_argument);
+    EXPECT_THROW(cslt::simd::axpy(1.0f, x, y), cslt::invalid_argument);
+    EXPECT_THROW(cslt::simd::add(x, y, out), cslt::invalid_argument);
+    EXPECT_THROW(cslt::simd::sub(x, x, y), cslt::invalid_argument);
+    EXPECT_THROW(cslt::simd::mul(y, x, out), cslt::invalid_argument);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SimdTest, EmptyMinAndMaxThrow) {
+    const std::vector<int> empty;
+    EXPECT_THROW(cslt::simd::min(empty), cslt::invalid_argument);
+    EXPECT_THROW(cslt::simd::max(empty), cslt::invalid_argument);
+    EXPECT_EQ(0, cslt::simd::sum(empty));
+    EXPECT_EQ(0u, cslt::simd::count_if(empty, compare::equal, 0));
+}
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,328 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_slot_map.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests slot_map and slot_handle in slot_map.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "../include/slot_map.hpp"
+#include "../include/flat_hash_map.hpp"
+#include "../include/memory_resource.hpp"
+
+namespace {
+    // Counts live instances, so a test can see that no element leaked
+    struct tracked {
+        static int live;
+        int value = 0;
+
+        tracked(int v = 0) : value(v) {++live;}
+        tracked(const tracked& other) : value(other.value) {++live;}
+        tracked(tracked&& other) noexcept : value(other.value) {++live; other.value = -1;}
+        tracked& operator=(const tracked& other) {value = other.value; return *this;}
+        tracked& operator=(tracked&& other) noexcept {value = other.value; other.value = -1; return *this;}
+        ~tracked() {--live;}
+    };
+
+    int tracked::live = 0;
+
+    // Forwards to new_delete_resource and counts the allocations
+    class counting_resource : public cslt::memory_resource {
+    public:
+        int allocations = 0;
+
+    private:
+        void* do_allocate(cslt::size_t bytes, cslt::size_t alignment) override {
+            ++allocations;
+            return cslt::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, cslt::size_t bytes, cslt::size_t alignment) override {
+            cslt::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const cslt::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    struct throws_on_seven {
+        int value;
+
+        explicit throws_on_seven(int v) : value(v) {
+            if (v == 7)
+                throw std::runtime_error("seven");
+        }
+    };
+}
+// ================================================================================
+// ================================================================================
+// HANDLE TESTS
+
+TEST(SlotMapTest, InsertAndLookup) {
+    cslt::slot_map<std::string> map;
+    EXPECT_TRUE(map.empty());
+    const auto a = map.insert("alpha");
+    const auto b = map.emplace(3, 'b');
+    EXPECT_EQ(2u, map.size());
+    EXPECT_NE(a, b);
+    EXPECT_TRUE(map.contains(a));
+    EXPECT_EQ("alpha", map.at(a));
+    EXPECT_EQ("bbb", *map.get(b));
+    const cslt::slot_map<std::string>& view = map;
+    EXPECT_EQ("bbb", view.at(b));
+}
+// --------------------------------------------------------------------------------
+
+TEST(SlotMapTest, DefaultHandleIsNeverValid) {
+    cslt::slot_map<int> map;
+    map.insert(1);
+    const cslt::slot_handle none;
+    EXPECT_FALSE(map.contains(none));
+    EXPECT_EQ(nullptr, map.get(none));
+    EXPECT_THROW(map.at(none), cslt::out_of_range);
+    EXPECT_FALSE(map.erase(none));
+}
+// --------------------------------------------------------------------------------
+
+TEST(SlotMapTest, StaleHandleIsDetectedAfterReuse) {
+    cslt::slot_map<int> map;
+    const auto old = map.insert(10);
+    EXPECT_TRUE(map.erase(old));
+    EXPECT_FALSE(map.erase(old));
+    const auto reused = map.insert(20);
+    EXPECT_EQ(old.index, reused.index);
+    EXPECT_NE(old.generation, reused.generation);
+    EXPECT_FALSE(map.contains(old));
+    EXPECT_EQ(nullptr, map.get(old));
+    EXPECT_THROW(map.at(old), cslt::out_of_range);
+    EXPECT_EQ(20, map.at(reused));
+}
+// --------------------------------------------------------------------------------
+
+TEST(SlotMapTest, HandlesKeyAFlatHashMap) {
+    cslt::slot_map<int> map;
+    cslt::flat_hash_map<cslt::slot_handle, int> tags;
+    const auto a = map.insert(1);
+    const auto b = map.insert(2);
+    tags[a] = 100;
+    tags[b] = 200;
+    EXPECT_EQ(100, tags.at(a));
+    EXPECT_EQ(200, tags.at(b));
+}
+// ================================================================================
+// ================================================================================
+// ERASE AND STORAGE TESTS
+
+TEST(SlotMapTest, EraseMovesLastIntoHole) {
+    cslt::slot_map<int> map;
+    std::vector<cslt::slot_handle> handles;
+    for (int i = 0; i < 5; ++i)
+        handles.push_back(map.insert(i));
+    EXPECT_TRUE(map.erase(handles[1]));
+    EXPECT_EQ(4u, map.size());
+
+    // The dense order is now 0 4 2 3 and every other handle still resolves
+    std::vector<int> order;
+    for (int value : map)
+        order.push_back(value);
+    EXPECT_EQ((std::vector<int>{0, 4, 2, 3}), order);
+    for (int i : {0, 2, 3, 4})
+        EXPECT_EQ(i, map.at(handles[static_cast<std::size_t>(i)]));
+    EXPECT_EQ(handles[0], map.begin().get_handle());
+    EXPECT_EQ(handles[4], map.handle_at(1));
+}
+// --------------------------------------------------------------------------------
+
+TEST(SlotMapTest, GrowthNeverMovesElements) {
+    cslt::slot_map<int, cslt::allocator<int>, 16> map;
+    const auto first = map.insert(-1);
+    const int* address = map.get(first);
+    std::vector<cslt::slot_handle> handles;
+    for (int i = 0; i < 1000; ++i)
+        handles.push_back(map.insert(i));
+    EXPECT_EQ(address, map.get(first));
+    EXPECT_EQ(0u, map.capacity() % 16);
+    EXPECT_LE(map.size(), map.capacity());
+    for (int i = 0; i < 1000; i += 37)
+        EXPECT_EQ(i, map.at(handles[static_cast<std::size_t>(i)]));
+}
+// --------------------------------------------------------------------------------
+
+TEST(SlotMapTest, ChurnKeepsEveryLiveHandleValid) {
+    cslt::slot_map<int, cslt::allocator<int>, 8> map;
+    std::vector<std::pair<cslt::slot_handle, int>> live;
+    std::vector<cslt::slot_handle> dead;
+    unsigned state = 1;
+    for (int step = 0; step < 5000; ++step) {
+        state = state * 1103515245u + 12345u;
+        if (live.empty() || (state >> 16) % 3 != 0) {
+            live.push_back({map.insert(step), step});
+        }
+        else {
+            const std::size_t pick = (state >> 8) % live.size();
+            EXPECT_TRUE(map.erase(live[pick].first));
+            dead.push_back(live[pick].first);
+            live[pick] = live.back();
+            live.pop_back();
+        }
+    }
+    ASSERT_EQ(live.size(), map.size());
+    for (const auto& entry : live)
+        EXPECT_EQ(entry.second, map.at(entry.first));
+    for (const cslt::slot_handle& h : dead)
+        EXPECT_FALSE(map.contains(h));
+
+    // Each dense position names the slot that points back at it
+    cslt::size_t pos = 0;
+    for (auto it = map.begin(); it != map.end(); ++it, ++pos) {
+        EXPECT_EQ(&*it, map.get(it.get_handle()));
+        EXPECT_EQ(it.get_handle(), map.handle_at(pos));
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(SlotMapTest, ClearInvalidatesHandlesAndKeepsChunks) {
+    tracked::live = 0;
+    {
+        cslt::slot_map<tracked> map;
+        const auto a = map.insert(tracked(1));
+        map.insert(tracked(2));
+        const cslt::size_t capacity = map.capacity();
+        map.clear();
+        EXPECT_EQ(0, tracked::live);
+        EXPECT_TRUE(map.empty());
+        EXPECT_FALSE(map.contains(a));
+        EXPECT_EQ(capacity, map.capacity());
+        const auto b = map.insert(tracked(3));
+        EXPECT_FALSE(map.contains(a));
+        EXPECT_EQ(3, map.at(b).value);
+        EXPECT_EQ(1, tracked::live);
+    }
+    EXPECT_EQ(0, tracked::live);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SlotMapTest, ForEachVisitsEveryElement) {
+    cslt::slot_map<int, cslt::allocator<int>, 4> map;
+    for (int i = 1; i <= 10; ++i)
+        map.insert(i);
+    int sum = 0;
+    map.for_each([&sum](int& value) {sum += value; value = 0;});
+    EXPECT_EQ(55, sum);
+    const cslt::slot_map<int, cslt::allocator<int>, 4>& view = map;
+    view.for_each([&sum](const int& value) {sum += value;});
+    EXPECT_EQ(55, sum);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SlotMapTest, FailedEmplaceLeavesMapUnchanged) {
+    cslt::slot_map<throws_on_seven> map;
+    const auto a = map.emplace(1);
+    EXPECT_THROW(map.emplace(7), std::runtime_error);
+    EXPECT_EQ(1u, map.size());
+    const auto b = map.emplace(2);
+    EXPECT_EQ(a.index + 1, b.index);
+    EXPECT_EQ(2, map.at(b).value);
+}
+// ================================================================================
+// ================================================================================
+// COPY AND MOVE TESTS
+
+TEST(SlotMapTest, CopyKeepsHandles) {
+    tracked::live = 0;
+    {
+        cslt::slot_map<tracked> map;
+        const auto a = map.insert(tracked(1));
+        const auto b = map.insert(tracked(2));
+        map.erase(a);
+        const auto c = map.insert(tracked(3));
+
+        cslt::slot_map<tracked> copy(map);
+        EXPECT_EQ(2, copy.at(b).value);
+        EXPECT_EQ(3, copy.at(c).value);
+        EXPECT_FALSE(copy.contains(a));
+
+        cslt::slot_map<tracked> assigned;
+        assigned.insert(tracked(9));
+        assigned = map;
+        EXPECT_EQ(2u, assigned.size());
+        EXPECT_EQ(3, assigned.at(c).value);
+        EXPECT_EQ(6, tracked::live);
+    }
+    EXPECT_EQ(0, tracked::live);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SlotMapTest, MoveStealsStorage) {
+    cslt::slot_map<std::string> map;
+    const auto a = map.insert("value");
+    const std::string* address = map.get(a);
+    cslt::slot_map<std::string> moved(cslt::move(map));
+    EXPECT_EQ(address, moved.get(a));
+    EXPECT_TRUE(map.empty());
+
+    cslt::slot_map<std::string> assigned;
+    assigned = cslt::move(moved);
+    EXPECT_EQ(address, assigned.get(a));
+    EXPECT_TRUE(moved.empty());
+}
+// ================================================================================
+// ================================================================================
+// MEMORY RESOURCE TESTS
+
+TEST(SlotMapTest, ChunksComeFromPoolResource) {
+    cslt::monotonic_arena arena(1 << 16);
+    cslt::pool_resource pool(4096, 64, &arena);
+    {
+        cslt::pmr::slot_map<int, 64> map(&pool);
+        for (int i = 0; i < 200; ++i)
+            map.insert(i);
+        EXPECT_EQ(256u, map.capacity());
+        EXPECT_LT(0u, arena.bytes_allocated());
+        EXPECT_EQ(&pool, map.get_allocator().resource());
+    }
+    // A second map reuses the chunks returned to the pool
+    const cslt::size_t used = arena.bytes_allocated();
+    cslt::pmr::slot_map<int, 64> again(&pool);
+    for (int i = 0; i < 200; ++i)
+        again.insert(i);
+    EXPECT_EQ(used, arena.bytes_allocated());
+}
+// --------------------------------------------------------------------------------
+
+TEST(SlotMapTest, FillGrowsTablesGeometrically) {
+    counting_resource counter;
+    cslt::pmr::slot_map<int, 16> map(&counter);
+    for (int i = 0; i < 4096; ++i)
+        map.insert(i);
+    // 256 chunks, plus a logarithmic number of allocations for each table
+    EXPECT_LT(counter.allocations, 256 + 3 * 16);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SlotMapTest, MoveAcrossResourcesMovesElements) {
+    cslt::monotonic_arena first(4096);
+    cslt::monotonic_arena second(4096);
+    cslt::pmr::slot_map<std::string, 8> src(&first);
+    const auto a = src.insert("kept");
+    cslt::pmr::slot_map<std::string, 8> dest(&second);
+    dest = cslt::move(src);
+    EXPECT_EQ(&second, dest.get_allocator().resource());
+    EXPECT_EQ("kept", dest.at(a));
+    EXPECT_TRUE(src.empty());
+    EXPECT_FALSE(src.contains(a));
+}
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,252 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_small_vector.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests small_vector and static_vector in small_vector.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <string>
+#include "../include/small_vector.hpp"
+#include "../include/memory_resource.hpp"
+
+namespace {
+    // Counts live instances, so a test can see that no element leaked
+    struct tracked {
+        static int live;
+        int value = 0;
+
+        tracked(int v = 0) : value(v) {++live;}
+        tracked(const tracked& other) : value(other.value) {++live;}
+        tracked(tracked&& other) noexcept : value(other.value) {++live; other.value = -1;}
+        tracked& operator=(const tracked& other) {value = other.value; return *this;}
+        tracked& operator=(tracked&& other) noexcept {value = other.value; other.value = -1; return *this;}
+        ~tracked() {--live;}
+    };
+
+    int tracked::live = 0;
+
+    // A stateful allocator that propagates on copy assignment and counts the
+    // blocks each id has outstanding
+    template <typename T>
+    struct copied_alloc {
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+
+        int id;
+        int* live;
+
+        copied_alloc(int i, int* counts) noexcept : id(i), live(counts) {}
+        template <typename U>
+        copied_alloc(const copied_alloc<U>& other) noexcept : id(other.id), live(other.live) {}
+
+        T* allocate(std::size_t num) {
+            ++live[id];
+            return static_cast<T*>(::operator new(num * sizeof(T)));
+        }
+        void deallocate(T* block, std::size_t) noexcept {
+            --live[id];
+            ::operator delete(block);
+        }
+    };
+
+    template <typename T, typename U>
+    bool operator==(const copied_alloc<T>& a, const copied_alloc<U>& b) noexcept {return a.id == b.id;}
+    template <typename T, typename U>
+    bool operator!=(const copied_alloc<T>& a, const copied_alloc<U>& b) noexcept {return a.id != b.id;}
+
+    // Filled entirely at compile time
+    constexpr cslt::static_vector<int, 8> squares(int count) {
+        cslt::static_vector<int, 8> v;
+        for (int i = 0; i < count; ++i)
+            v.push_back(i * i);
+        v.push_back(-1, 0);
+        return v;
+    }
+}
+// ================================================================================
+// ================================================================================
+// VECTOR DEFAULT CONSTRUCTION
+
+TEST(SmallVectorTest, DefaultVectorDoesNotAllocate) {
+    cslt::vector<std::string> vec;
+    EXPECT_EQ(0u, vec.alloc());
+    EXPECT_EQ(nullptr, vec.data());
+    EXPECT_EQ(vec.begin(), vec.end());
+    vec.push_back("first");
+    EXPECT_EQ(1u, vec.alloc());
+    EXPECT_EQ("first", vec[0]);
+}
+// ================================================================================
+// ================================================================================
+// SMALL_VECTOR TESTS
+
+TEST(SmallVectorTest, StaysInlineUpToN) {
+    cslt::small_vector<int, 4> vec;
+    EXPECT_TRUE(vec.is_inline());
+    EXPECT_EQ(4u, vec.alloc());
+    const int* inline_data = vec.data();
+    for (int i = 0; i < 4; ++i)
+        vec.push_back(i);
+    EXPECT_TRUE(vec.is_inline());
+    EXPECT_EQ(inline_data, vec.data());
+    vec.push_back(4);
+    EXPECT_FALSE(vec.is_inline());
+    EXPECT_EQ(8u, vec.alloc());
+    for (int i = 0; i < 5; ++i)
+        EXPECT_EQ(i, vec[i]);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SmallVectorTest, ShrinkReturnsInline) {
+    tracked::live = 0;
+    {
+        cslt::small_vector<tracked, 3> vec;
+        for (int i = 0; i < 10; ++i)
+            vec.emplace_back(i);
+        EXPECT_EQ(10, tracked::live);
+        while (vec.size() > 2)
+            vec.pop_back();
+        vec.shrink_to_fit();
+        EXPECT_TRUE(vec.is_inline());
+        EXPECT_EQ(3u, vec.alloc());
+        EXPECT_EQ(1, vec[1].value);
+        EXPECT_EQ(2, tracked::live);
+    }
+    EXPECT_EQ(0, tracked::live);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SmallVectorTest, InsertAtIndexInlineAndSpilling) {
+    cslt::small_vector<std::string, 3> vec = {"a", "c"};
+    vec.push_back("b", 1);
+    EXPECT_TRUE(vec.is_inline());
+    // The inserted value refers to an element of the vector as it spills
+    vec.push_back(vec[0], 0);
+    EXPECT_FALSE(vec.is_inline());
+    ASSERT_EQ(4u, vec.size());
+    EXPECT_EQ("a", vec[0]);
+    EXPECT_EQ("a", vec[1]);
+    EXPECT_EQ("b", vec[2]);
+    EXPECT_EQ("c", vec[3]);
+    EXPECT_THROW(vec.push_back("x", 9), cslt::out_of_range);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SmallVectorTest, CopyAndMove) {
+    cslt::small_vector<std::string, 2> small = {"x"};
+    cslt::small_vector<std::string, 2> big = {"a", "b", "c"};
+    cslt::small_vector<std::string, 2> small_copy(small);
+    cslt::small_vector<std::string, 2> big_copy(big);
+    EXPECT_TRUE(small_copy.is_inline());
+    EXPECT_EQ(3u, big_copy.alloc());
+    EXPECT_EQ("c", big_copy[2]);
+
+    // A heap block is stolen, inline elements are moved one by one
+    const std::string* block = big.data();
+    cslt::small_vector<std::string, 2> big_moved(cslt::move(big));
+    EXPECT_EQ(block, big_moved.data());
+    EXPECT_TRUE(big.empty());
+    EXPECT_TRUE(big.is_inline());
+    cslt::small_vector<std::string, 2> small_moved(cslt::move(small));
+    EXPECT_TRUE(small_moved.is_inline());
+    EXPECT_EQ("x", small_moved[0]);
+    EXPECT_TRUE(small.empty());
+
+    small_moved = big_copy;
+    EXPECT_EQ(3u, small_moved.size());
+    EXPECT_EQ("b", small_moved[1]);
+    big_moved = cslt::move(small_copy);
+    EXPECT_TRUE(big_moved.is_inline());
+    EXPECT_EQ(1u, big_moved.size());
+    EXPECT_EQ("x", big_moved[0]);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SmallVectorTest, SpillsThroughMemoryResource) {
+    cslt::monotonic_arena arena(4096);
+    cslt::pmr::small_vector<int, 4> vec(&arena);
+    for (int i = 0; i < 4; ++i)
+        vec.push_back(i);
+    EXPECT_EQ(0u, arena.bytes_allocated());
+    vec.push_back(4);
+    EXPECT_LT(0u, arena.bytes_allocated());
+    EXPECT_EQ(4, vec.at(4));
+}
+// --------------------------------------------------------------------------------
+
+TEST(SmallVectorTest, CopyAssignmentPropagatesAllocator) {
+    int live[3] = {0, 0, 0};
+    using vec_t = cslt::small_vector<std::string, 2, copied_alloc<std::string>>;
+    vec_t source(std::initializer_list<std::string>{"a", "b", "c"}, copied_alloc<std::string>(2, live));
+    vec_t target(std::initializer_list<std::string>{"v", "w", "x", "y"}, copied_alloc<std::string>(1, live));
+    ASSERT_EQ(1, live[1]);
+    target = source;
+    EXPECT_EQ(2, target.get_allocator().id);
+    EXPECT_EQ(0, live[1]);
+    EXPECT_EQ(2, live[2]);
+    ASSERT_EQ(3u, target.size());
+    EXPECT_EQ("c", target[2]);
+}
+// ================================================================================
+// ================================================================================
+// STATIC_VECTOR TESTS
+
+TEST(StaticVectorTest, BuiltAtCompileTime) {
+    constexpr cslt::static_vector<int, 8> v = squares(5);
+    static_assert(v.size() == 6, "the constexpr vector holds six elements");
+    static_assert(v[0] == -1 && v[4] == 9, "elements are set at compile time");
+    EXPECT_EQ(16, v.at(5));
+    EXPECT_EQ(8u, v.alloc());
+}
+// --------------------------------------------------------------------------------
+
+TEST(StaticVectorTest, ThrowsWhenFull) {
+    cslt::static_vector<int, 3> v = {1, 2, 3};
+    EXPECT_TRUE(v.full());
+    EXPECT_THROW(v.push_back(4), cslt::length_error);
+    EXPECT_THROW(v.push_back(0, 0), cslt::length_error);
+    EXPECT_THROW(v.reserve(4), cslt::length_error);
+    v.pop_back();
+    v.push_back(0, 0);
+    EXPECT_EQ(0, v[0]);
+    EXPECT_EQ(2, v[2]);
+    using too_long = cslt::static_vector<int, 2>;
+    EXPECT_THROW(too_long({1, 2, 3}), cslt::length_error);
+}
+// --------------------------------------------------------------------------------
+
+TEST(StaticVectorTest, NonTrivialElements) {
+    tracked::live = 0;
+    {
+        cslt::static_vector<tracked, 6> v;
+        for (int i = 0; i < 4; ++i)
+            v.emplace_back(i);
+        v.push_back(tracked(9), 1);
+        EXPECT_EQ(5, tracked::live);
+        EXPECT_EQ(9, v[1].value);
+        EXPECT_EQ(3, v[4].value);
+
+        cslt::static_vector<tracked, 6> copy(v);
+        EXPECT_EQ(10, tracked::live);
+        cslt::static_vector<tracked, 6> moved(cslt::move(copy));
+        EXPECT_TRUE(copy.empty());
+        EXPECT_EQ(10, tracked::live);
+        moved.clear();
+        EXPECT_EQ(5, tracked::live);
+        moved = v;
+        EXPECT_EQ(2, moved[3].value);
+    }
+    EXPECT_EQ(0, tracked::live);
+}
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,223 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_soa_vector.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the soa_vector class in soa_vector.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include "../include/soa_vector.hpp"
+#include "../include/instrument.hpp"
+#include "../include/memory_resource.hpp"
+
+using particles = cslt::soa_vector<float, float, int>;
+
+// Throws from its copy constructor once the countdown reaches zero
+struct fragile {
+    static int countdown;
+    int value = 0;
+    fragile() = default;
+    explicit fragile(int v) : value(v) {}
+    fragile(const fragile& other) : value(other.value) {
+        if (countdown-- == 0)
+            throw std::runtime_error("copy failed");
+    }
+    fragile& operator=(const fragile&) = default;
+};
+int fragile::countdown = -1;
+// ================================================================================
+// ================================================================================
+
+TEST(SoaVectorTest, DefaultAllocatesNothing) {
+    particles p;
+    EXPECT_TRUE(p.empty());
+    EXPECT_EQ(0u, p.capacity());
+    EXPECT_EQ(nullptr, p.data<0>());
+    EXPECT_EQ(3u, particles::columns);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SoaVectorTest, PushBackFillsColumns) {
+    particles p;
+    for (int i = 0; i < 100; ++i)
+        p.push_back(static_cast<float>(i), static_cast<float>(i) * 2.0f, i * 3);
+    EXPECT_EQ(100u, p.size());
+    const cslt::span<float> x = p.column<0>();
+    const cslt::span<const int> id = static_cast<const particles&>(p).column<2>();
+    ASSERT_EQ(100u, x.size());
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(static_cast<float>(i), x[i]);
+        EXPECT_EQ(i * 3, id[i]);
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(SoaVectorTest, GrowsLikeVector) {
+    particles p;
+    cslt::vector<int> v;
+    for (int i = 0; i < 40; ++i) {
+        p.push_back(0.0f, 0.0f, i);
+        v.push_back(i);
+        EXPECT_EQ(v.alloc(), p.capacity());
+    }
+    p.reserve(1000);
+    EXPECT_EQ(1000u, p.capacity());
+    EXPECT_EQ(39, p[39].get<2>());
+}
+// --------------------------------------------------------------------------------
+
+TEST(SoaVectorTest, ColumnsAreAligned) {
+    cslt::soa_vector<char, double, std::int16_t> v;
+    v.push_back('a', 1.0, std::int16_t(2));
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(v.data<0>()) % cslt::soa_vector<char>::column_alignment);
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(v.data<1>()) % 64);
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(v.data<2>()) % 64);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SoaVectorTest, ProxyReference) {
+    particles p;
+    p.push_back(1.0f, 2.0f, 3);
+    p.push_back(4.0f, 5.0f, 6);
+    p[0].get<1>() = 20.0f;
+    EXPECT_EQ(20.0f, p.data<1>()[0]);
+    p[1] = std::make_tuple(7.0f, 8.0f, 9);
+    EXPECT_EQ(9, cslt::get<2>(p.back()));
+    p[0] = p[1];
+    const std::tuple<float, float, int> copy = p.front();
+    EXPECT_EQ(std::make_tuple(7.0f, 8.0f, 9), copy);
+    const particles& view = p;
+    EXPECT_EQ(8.0f, view[1].get<1>());
+    EXPECT_THROW(p.at(2), cslt::out_of_range);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SoaVectorTest, PushBackOwnElementWhileGrowing) {
+    cslt::soa_vector<std::string, int> v;
+    v.push_back(std::string(100, 'x'), 1);
+    ASSERT_EQ(v.size(), v.capacity());
+    v.push_back(v[0].get<0>(), v[0].get<1>());
+    EXPECT_EQ(std::string(100, 'x'), v[1].get<0>());
+    EXPECT_EQ(std::string(100, 'x'), v[0].get<0>());
+}
+// --------------------------------------------------------------------------------
+
+TEST(SoaVectorTest, HoldsNonTrivialFields) {
+    cslt::soa_vector<std::string, int> v;
+    for (int i = 0; i < 50; ++i)
+        v.push_back(std::make_tuple(std::to_string(i) + std::string(30, 'y'), i));
+    cslt::soa_vector<std::string, int> copy(v);
+    v.clear();
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(50u, copy.size());
+    EXPECT_EQ("49" + std::string(30, 'y'), copy.back().get<0>());
+    cslt::soa_vector<std::string, int> moved(cslt::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(0u, copy.capacity());
+    moved.pop_back();
+    moved.resize(60);
+    EXPECT_EQ(60u, moved.size());
+    EXPECT_EQ("", moved[59].get<0>());
+    EXPECT_EQ(0, moved[59].get<1>());
+    moved.resize(10);
+    EXPECT_EQ("9" + std::string(30, 'y'), moved.back().get<0>());
+    v = moved;
+    EXPECT_EQ(10u, v.size());
+}
+// --------------------------------------------------------------------------------
+
+TEST(SoaVectorTest, FailedGrowthLeavesVector) {
+    cslt::soa_vector<int, fragile> v;
+    v.push_back(1, fragile(10));
+    v.push_back(2, fragile(20));
+    ASSERT_EQ(2u, v.capacity());
+    // The relocation copies fragile, since its move may throw; the second copy fails
+    fragile::countdown = 1;
+    EXPECT_THROW(v.push_back(3, fragile(30)), std::runtime_error);
+    fragile::countdown = -1;
+    EXPECT_EQ(2u, v.size());
+    EXPECT_EQ(2u, v.capacity());
+    EXPECT_EQ(20, v[1].get<1>().value);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SoaVectorTest, ArenaColumns) {
+    cslt::monotonic_arena arena;
+    cslt::soa_vector<double, double> v(&arena);
+    for (int i = 0; i < 1000; ++i)
+        v.push_back(1.0 * i, 2.0 * i);
+    EXPECT_EQ(&arena, v.resource());
+    EXPECT_GE(arena.bytes_allocated(), 1000u * 16u);
+    double sum = 0.0;
+    for (double value : v.column<1>())
+        sum += value;
+    EXPECT_EQ(999.0 * 1000.0, sum);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SoaVectorTest, CopyDoesNotSpreadResource) {
+    cslt::monotonic_arena arena;
+    cslt::soa_vector<double, int> v(&arena);
+    for (int i = 0; i < 100; ++i)
+        v.push_back(0.5 * i, i);
+    const cslt::soa_vector<double, int> copy(v);
+    EXPECT_EQ(cslt::get_default_resource(), copy.resource());
+    EXPECT_EQ(99, copy.back().get<1>());
+    cslt::soa_vector<double, int> chosen(copy, &arena);
+    EXPECT_EQ(&arena, chosen.resource());
+    EXPECT_EQ(49.5, chosen.back().get<0>());
+
+    cslt::monotonic_arena other;
+    cslt::soa_vector<double, int> target(&other);
+    target.push_back(1.0, 1);
+    const cslt::size_t used = other.bytes_allocated();
+    target = v;
+    EXPECT_EQ(&other, target.resource());
+    EXPECT_EQ(100u, target.size());
+    EXPECT_GT(other.bytes_allocated(), used);
+}
+// --------------------------------------------------------------------------------
+
+TEST(SoaVectorTest, SingleColumnTakesTuple) {
+    cslt::soa_vector<std::string> v;
+    const std::tuple<std::string> element(std::string(40, 'a'));
+    v.push_back(element);
+    v.push_back(std::make_tuple(std::string("b")));
+    v.push_back(std::string("c"));
+    ASSERT_EQ(3u, v.size());
+    EXPECT_EQ(std::string(40, 'a'), v[0].get<0>());
+    EXPECT_EQ("b", v[1].get<0>());
+    EXPECT_EQ("c", v[2].get<0>());
+    // A column whose field is itself a tuple still builds it from one
+    cslt::soa_vector<std::tuple<int>> nested;
+    nested.push_back(std::make_tuple(7));
+    EXPECT_EQ(7, std::get<0>(nested[0].get<0>()));
+}
+// --------------------------------------------------------------------------------
+
+TEST(SoaVectorTest, CountsAllocations) {
+    const auto before = cslt::instrument::thread_snapshot()[cslt::instrument::site::soa_vector];
+    {
+        particles p;
+        p.reserve(8);
+    }
+    const auto after = cslt::instrument::thread_snapshot()[cslt::instrument::site::soa_vector];
+    if (cslt::instrument::enabled) {
+        EXPECT_EQ(before.allocations + 3, after.allocations);
+        EXPECT_EQ(before.deallocations + 3, after.deallocations);
+    }
+}
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,82 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_span.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the span class in span.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "../include/span.hpp"
+#include "../include/vec.hpp"
+#include "../include/memory.hpp"
+
+// One function serves every contiguous container
+static int sum(cslt::span<const int> values) {
+    int total = 0;
+    for (int value : values)
+        total += value;
+    return total;
+}
+// ================================================================================
+// ================================================================================
+
+TEST(SpanTest, FromContainers) {
+    int array[] = {1, 2, 3};
+    cslt::vector<int> vec = {4, 5, 6};
+    cslt::array_ptr<int> arr(2);
+    arr[0] = 7;
+    arr[1] = 8;
+    std::vector<int> std_vec = {9, 10};
+    EXPECT_EQ(6, sum(array));
+    EXPECT_EQ(15, sum(vec));
+    EXPECT_EQ(15, sum(arr));
+    EXPECT_EQ(19, sum(std_vec));
+    EXPECT_EQ(0, sum(cslt::span<const int>()));
+}
+// --------------------------------------------------------------------------------
+
+TEST(SpanTest, WritesThroughToContainer) {
+    cslt::vector<int> vec = {1, 2, 3};
+    cslt::span<int> view(vec);
+    view[1] = 20;
+    EXPECT_EQ(20, vec[1]);
+    EXPECT_EQ(vec.data(), view.data());
+    cslt::span<const int> read_only = view;
+    EXPECT_EQ(3u, read_only.size());
+    EXPECT_EQ(3 * sizeof(int), read_only.size_bytes());
+}
+// --------------------------------------------------------------------------------
+
+TEST(SpanTest, Subviews) {
+    int array[] = {0, 1, 2, 3, 4, 5};
+    cslt::span<int> view(array);
+    EXPECT_EQ(2u, view.first(2).size());
+    EXPECT_EQ(4, view.last(2).front());
+    cslt::span<int> middle = view.subspan(2, 3);
+    EXPECT_EQ(2, middle.front());
+    EXPECT_EQ(4, middle.back());
+    EXPECT_EQ(3u, view.subspan(3).size());
+    EXPECT_THROW(middle.at(3), cslt::out_of_range);
+    EXPECT_EQ(3, middle.at(1));
+}
+// --------------------------------------------------------------------------------
+
+TEST(SpanTest, PointerRange) {
+    const double values[] = {1.5, 2.5, 3.5};
+    cslt::span<const double> view(values, values + 3);
+    EXPECT_EQ(3u, view.size());
+    EXPECT_DOUBLE_EQ(2.5, view[1]);
+    EXPECT_EQ(values + 3, view.end());
+}
+// ================================================================================
+// ================================================================================
+// eof
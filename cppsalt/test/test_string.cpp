@@ -0,0 +1,151 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_string.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the String class from the string.hpp file
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include "../include/string.hpp"
+// ================================================================================
+// ================================================================================
+
+TEST(StringTest, DefaultIsEmpty) {
+    cslt::String str;
+    EXPECT_EQ(str.size(), 0);
+    EXPECT_TRUE(str.empty());
+    EXPECT_STREQ(str.c_string(), "");
+    EXPECT_EQ(str.memory(), 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringTest, ShortStringIsInline) {
+    cslt::String str("short key");
+    EXPECT_EQ(str.size(), 9);
+    EXPECT_STREQ(str.c_string(), "short key");
+    EXPECT_EQ(str.memory(), 0);
+    EXPECT_EQ(str.capacity(), cslt::String::sso_capacity);
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringTest, BoundaryOfInlineBuffer) {
+    cslt::String fits("abcdefghijklmnopqrstuvw");   // 23 characters
+    cslt::String spills("abcdefghijklmnopqrstuvwx"); // 24 characters
+    EXPECT_EQ(fits.memory(), 0);
+    EXPECT_EQ(spills.memory(), 25);
+    EXPECT_EQ(spills.size(), 24);
+    EXPECT_STREQ(spills.c_string(), "abcdefghijklmnopqrstuvwx");
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringTest, CopyConstructor) {
+    cslt::String small("hello");
+    cslt::String large("this string is far too long for the inline buffer");
+    cslt::String small_copy(small);
+    cslt::String large_copy(large);
+    EXPECT_STREQ(small_copy.c_string(), "hello");
+    EXPECT_STREQ(large_copy.c_string(), large.c_string());
+    EXPECT_NE(large_copy.c_string(), large.c_string());
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringTest, MoveStealsHeapBlock) {
+    cslt::String large("this string is far too long for the inline buffer");
+    const char* block = large.c_string();
+    cslt::String moved(cslt::move(large));
+    EXPECT_EQ(moved.c_string(), block);
+    EXPECT_TRUE(large.empty());
+    EXPECT_EQ(large.memory(), 0);
+
+    cslt::String assigned;
+    assigned = cslt::move(moved);
+    EXPECT_EQ(assigned.c_string(), block);
+    EXPECT_TRUE(moved.empty());
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringTest, MoveInlineString) {
+    cslt::String small("abc");
+    cslt::String moved(cslt::move(small));
+    EXPECT_STREQ(moved.c_string(), "abc");
+    EXPECT_STREQ(small.c_string(), "");
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringTest, CopyAssignment) {
+    cslt::String str("first");
+    cslt::String other("a much longer replacement string for the first");
+    str = other;
+    EXPECT_TRUE(str == other);
+    str = cslt::String("tiny");
+    EXPECT_STREQ(str.c_string(), "tiny");
+    str = str;
+    EXPECT_STREQ(str.c_string(), "tiny");
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringTest, AppendGrowsGeometrically) {
+    cslt::String str;
+    cslt::size_t reallocations = 0;
+    cslt::size_t last = str.capacity();
+    for (int i = 0; i < 1000; ++i) {
+        str += 'x';
+        if (str.capacity() != last) {
+            ++reallocations;
+            last = str.capacity();
+        }
+    }
+    EXPECT_EQ(str.size(), 1000);
+    EXPECT_LE(reallocations, 6);
+    EXPECT_GE(str.capacity(), 1000);
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringTest, AppendSelf) {
+    cslt::String str("abcdefghijklmnop");
+    str.append(str);
+    EXPECT_STREQ(str.c_string(), "abcdefghijklmnopabcdefghijklmnop");
+    str += str;
+    EXPECT_EQ(str.size(), 64);
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringTest, ReserveKeepsContents) {
+    cslt::String str("keep");
+    str.reserve(100);
+    EXPECT_EQ(str.capacity(), 100);
+    EXPECT_EQ(str.memory(), 101);
+    EXPECT_STREQ(str.c_string(), "keep");
+    str.reserve(10);
+    EXPECT_EQ(str.capacity(), 100);
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringTest, Concatenation) {
+    cslt::String first("Hello");
+    cslt::String result = first + ", " + cslt::String("World");
+    EXPECT_STREQ(result.c_string(), "Hello, World");
+    EXPECT_TRUE(result == "Hello, World");
+    EXPECT_TRUE(result != first);
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringTest, Clear) {
+    cslt::String str("a much longer string that lives on the heap");
+    cslt::size_t cap = str.capacity();
+    str.clear();
+    EXPECT_TRUE(str.empty());
+    EXPECT_EQ(str.capacity(), cap);
+    EXPECT_STREQ(str.c_string(), "");
+}
+// ================================================================================
+// ================================================================================
+// eof
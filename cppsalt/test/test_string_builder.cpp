@@ -0,0 +1,184 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_string_builder.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the string_builder class in string_builder.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include "../include/string_builder.hpp"
+#include "../include/instrument.hpp"
+#include "../include/memory_resource.hpp"
+
+// The text of line i as appended by the tests below
+static std::string numbered_line(int i) {
+    return "line " + std::to_string(i) + " of the response body\n";
+}
+
+static std::string fill(cslt::string_builder& builder, int lines) {
+    std::string expected;
+    for (int i = 0; i < lines; ++i) {
+        const std::string line = numbered_line(i);
+        builder.append(line.data(), line.size());
+        expected += line;
+    }
+    return expected;
+}
+// ================================================================================
+// ================================================================================
+
+TEST(StringBuilderTest, DefaultAllocatesNothing) {
+    cslt::string_builder builder;
+    EXPECT_TRUE(builder.empty());
+    EXPECT_EQ(0u, builder.chunk_count());
+    EXPECT_EQ(cslt::string_builder::default_chunk_size, builder.chunk_size());
+    EXPECT_EQ(cslt::String(""), builder.str());
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringBuilderTest, AppendAcrossChunks) {
+    cslt::string_builder builder(64);
+    const std::string expected = fill(builder, 100);
+    EXPECT_EQ(expected.size(), builder.size());
+    EXPECT_GT(builder.chunk_count(), expected.size() / 64);
+    EXPECT_EQ(cslt::String(expected.c_str()), builder.str());
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringBuilderTest, ChunksFillCompletely) {
+    cslt::string_builder builder(16);
+    builder << "0123456789" << "abcdefghij" << 'X';
+    cslt::size_t pieces = 0;
+    std::string joined;
+    builder.for_each_chunk([&](cslt::string_view piece) {
+        ++pieces;
+        joined.append(piece.data(), piece.size());
+    });
+    EXPECT_EQ(2u, pieces);
+    EXPECT_EQ("0123456789abcdefghijX", joined);
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringBuilderTest, LargeAppendGetsOwnChunk) {
+    cslt::string_builder builder(32);
+    builder << "head ";
+    const std::string big(1000, 'z');
+    builder.append(big.data(), big.size());
+    builder << " tail";
+    EXPECT_EQ(3u, builder.chunk_count());
+    EXPECT_EQ(1010u, builder.size());
+    const cslt::String text = builder.str();
+    EXPECT_EQ(0, std::strncmp("head zzz", text.c_string(), 8));
+    EXPECT_TRUE(text.view().ends_with("z tail"));
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringBuilderTest, WriteToStream) {
+    cslt::string_builder builder(100);
+    const std::string expected = fill(builder, 50);
+    std::ostringstream os;
+    os << builder;
+    EXPECT_EQ(expected, os.str());
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringBuilderTest, CopyToBuffer) {
+    cslt::string_builder builder(8);
+    builder << "split over several chunks";
+    std::string buffer(builder.size(), '\0');
+    builder.copy_to(&buffer[0]);
+    EXPECT_EQ("split over several chunks", buffer);
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringBuilderTest, ClearKeepsFirstChunk) {
+    cslt::string_builder builder(32);
+    fill(builder, 20);
+    builder.clear();
+    EXPECT_TRUE(builder.empty());
+    EXPECT_EQ(1u, builder.chunk_count());
+    builder << "again";
+    EXPECT_EQ(cslt::String("again"), builder.str());
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringBuilderTest, MoveTakesChunks) {
+    cslt::string_builder builder(32);
+    const std::string expected = fill(builder, 10);
+    cslt::string_builder moved(cslt::move(builder));
+    EXPECT_TRUE(builder.empty());
+    EXPECT_EQ(0u, builder.chunk_count());
+    builder << "reused";
+    EXPECT_EQ(cslt::String("reused"), builder.str());
+    EXPECT_EQ(cslt::String(expected.c_str()), moved.str());
+    builder = cslt::move(moved);
+    EXPECT_EQ(expected.size(), builder.size());
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringBuilderTest, ArenaChunks) {
+    cslt::monotonic_arena arena;
+    {
+        cslt::string_builder builder(256, &arena);
+        fill(builder, 100);
+        EXPECT_EQ(&arena, builder.resource());
+        cslt::String text = builder.str(cslt::polymorphic_allocator<char>(&arena));
+        EXPECT_EQ(builder.size(), text.size());
+    }
+    EXPECT_GT(arena.bytes_allocated(), 100u * 20u);
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringBuilderTest, StrCopiesOnce) {
+    cslt::string_builder builder(1024);
+    fill(builder, 1000);
+    const cslt::instrument::counters before = cslt::instrument::thread_snapshot()[cslt::instrument::site::string];
+    cslt::String text = builder.str();
+    const cslt::instrument::counters after = cslt::instrument::thread_snapshot()[cslt::instrument::site::string];
+    EXPECT_EQ(builder.size(), text.size());
+    // One heap block of the final size and no reallocations
+    if (cslt::instrument::enabled) {
+        EXPECT_EQ(before.allocations + 1, after.allocations);
+        EXPECT_EQ(before.reallocations, after.reallocations);
+    }
+}
+// --------------------------------------------------------------------------------
+
+#if !defined(_WIN32)
+TEST(StringBuilderTest, WritevToDescriptor) {
+    // More chunks than one writev call takes
+    cslt::string_builder builder(50);
+    const std::string expected = fill(builder, 400);
+    ASSERT_GT(builder.chunk_count(), 64u);
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(nullptr, file);
+    EXPECT_EQ(expected.size(), builder.writev(fileno(file)));
+    std::rewind(file);
+    std::string contents(expected.size() + 1, '\0');
+    EXPECT_EQ(expected.size(), std::fread(&contents[0], 1, contents.size(), file));
+    contents.resize(expected.size());
+    std::fclose(file);
+    EXPECT_EQ(expected, contents);
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringBuilderTest, WritevBadDescriptorThrows) {
+    cslt::string_builder builder;
+    builder << "text";
+    EXPECT_THROW(builder.writev(-1), cslt::system_error);
+}
+#endif
+// ================================================================================
+// ================================================================================
+// eof
@@ -0,0 +1,212 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_string_search.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the search kernels in string_search.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <cctype>
+#include <cstring>
+#include <random>
+#include <string>
+#include "../include/string_search.hpp"
+#include "../include/string.hpp"
+
+using cslt::text::kernel;
+
+static const kernel all_kernels[] = {
+    kernel::scalar, kernel::sse2, kernel::sse42, kernel::avx2, kernel::neon
+};
+
+// Runs check once with each kernel this machine supports, then restores the
+// kernel that was active
+template <typename Check>
+static void for_each_kernel(Check check) {
+    const kernel previous = cslt::text::active_kernel();
+    for (kernel k : all_kernels) {
+        if (!cslt::text::select_kernel(k))
+            continue;
+        SCOPED_TRACE(cslt::text::kernel_name(k));
+        check();
+    }
+    cslt::text::select_kernel(previous);
+}
+
+// Text over a small alphabet, so that partial matches of a needle are common
+static std::string random_text(std::mt19937& gen, std::size_t len) {
+    std::uniform_int_distribution<int> letter(0, 3);
+    std::string text(len, 'a');
+    for (char& chr : text)
+        chr = static_cast<char>('a' + letter(gen));
+    return text;
+}
+
+static std::size_t expected(std::size_t pos) {
+    return pos == std::string::npos ? cslt::text::not_found : pos;
+}
+// ================================================================================
+// ================================================================================
+
+TEST(StringSearchTest, ScalarAlwaysSupported) {
+    EXPECT_TRUE(cslt::text::kernel_supported(kernel::scalar));
+    EXPECT_STREQ("avx2", cslt::text::kernel_name(kernel::avx2));
+    EXPECT_TRUE(cslt::text::kernel_supported(cslt::text::active_kernel()));
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringSearchTest, FindCharMatchesStd) {
+    for_each_kernel([] {
+        std::mt19937 gen(1);
+        for (std::size_t len = 0; len < 200; ++len) {
+            const std::string text = random_text(gen, len) + "xyz";
+            // Every offset shifts the loads against the register width
+            for (std::size_t offset = 0; offset < 3; ++offset) {
+                const std::string hay = text.substr(offset);
+                for (char chr : {'a', 'd', 'x', 'z', 'q'}) {
+                    ASSERT_EQ(expected(hay.find(chr)), cslt::text::find_char(hay.data(), hay.size(), chr));
+                    ASSERT_EQ(expected(hay.rfind(chr)), cslt::text::rfind_char(hay.data(), hay.size(), chr));
+                }
+            }
+        }
+    });
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringSearchTest, FindMatchesStd) {
+    for_each_kernel([] {
+        std::mt19937 gen(2);
+        for (int round = 0; round < 300; ++round) {
+            const std::string hay = random_text(gen, static_cast<std::size_t>(round));
+            for (std::size_t needle_len = 1; needle_len < 40; needle_len += 3) {
+                const std::string needle = random_text(gen, needle_len);
+                ASSERT_EQ(expected(hay.find(needle)),
+                          cslt::text::find(hay.data(), hay.size(), needle.data(), needle.size()));
+                ASSERT_EQ(expected(hay.rfind(needle)),
+                          cslt::text::rfind(hay.data(), hay.size(), needle.data(), needle.size()));
+            }
+        }
+    });
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringSearchTest, FindAtEnds) {
+    for_each_kernel([] {
+        std::string hay(300, '.');
+        hay.replace(hay.size() - 5, 5, "needl");
+        EXPECT_EQ(cslt::text::not_found, cslt::text::find(hay.data(), hay.size(), "needle", 6));
+        hay += "e";
+        EXPECT_EQ(295u, cslt::text::find(hay.data(), hay.size(), "needle", 6));
+        EXPECT_EQ(0u, cslt::text::find(hay.data(), hay.size(), "", 0));
+        EXPECT_EQ(hay.size(), cslt::text::rfind(hay.data(), hay.size(), "", 0));
+        EXPECT_EQ(0u, cslt::text::find(hay.data(), hay.size(), "..", 2));
+        EXPECT_EQ(cslt::text::not_found, cslt::text::find(hay.data(), 3, "....", 4));
+    });
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringSearchTest, FindFirstOfMatchesStd) {
+    for_each_kernel([] {
+        std::mt19937 gen(3);
+        const std::string sets[] = {"", "d", "cd", "xd", "0123456789abcdef", "0123456789ABCDEFGHd"};
+        for (std::size_t len = 0; len < 100; ++len) {
+            const std::string hay = random_text(gen, len);
+            for (const std::string& set : sets) {
+                ASSERT_EQ(expected(hay.find_first_of(set)),
+                          cslt::text::find_first_of(hay.data(), hay.size(), set.data(), set.size()));
+                ASSERT_EQ(expected(hay.find_first_not_of(set)),
+                          cslt::text::find_first_not_of(hay.data(), hay.size(), set.data(), set.size()));
+            }
+            const std::string abc = "abc";
+            ASSERT_EQ(expected(hay.find_first_not_of(abc)),
+                      cslt::text::find_first_not_of(hay.data(), hay.size(), abc.data(), abc.size()));
+        }
+    });
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringSearchTest, CompareIcase) {
+    for_each_kernel([] {
+        std::string lower(100, 'q');
+        std::string upper(100, 'Q');
+        EXPECT_EQ(0, cslt::text::compare_icase(lower.data(), upper.data(), 100));
+        // The characters on either side of the letters must not fold
+        EXPECT_NE(0, cslt::text::compare_icase("@", "`", 1));
+        EXPECT_NE(0, cslt::text::compare_icase("[", "{", 1));
+        EXPECT_EQ(0, cslt::text::compare_icase("\xC1", "\xC1", 1));
+        EXPECT_NE(0, cslt::text::compare_icase("\xC1", "\xE1", 1));
+        for (std::size_t i = 0; i < 100; i += 7) {
+            std::string other = upper;
+            other[i] = 'R';
+            EXPECT_LT(cslt::text::compare_icase(lower.data(), other.data(), 100), 0);
+            EXPECT_GT(cslt::text::compare_icase(other.data(), lower.data(), 100), 0);
+            EXPECT_EQ(0, cslt::text::compare_icase(lower.data(), other.data(), i));
+        }
+        // Every byte value against its lower case form, a register at a time
+        std::string bytes(256, '\0');
+        std::string folded(256, '\0');
+        for (int chr = 0; chr < 256; ++chr) {
+            bytes[chr] = static_cast<char>(chr);
+            folded[chr] = static_cast<char>(chr < 128 ? std::tolower(chr) : chr);
+        }
+        EXPECT_EQ(0, cslt::text::compare_icase(bytes.data(), folded.data(), 256));
+        EXPECT_NE(0, cslt::text::compare_icase(bytes.data(), folded.data() + 1, 255));
+    });
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringSearchTest, CompareAndEqual) {
+    EXPECT_EQ(0, cslt::text::compare(nullptr, nullptr, 0));
+    EXPECT_TRUE(cslt::text::equal(nullptr, nullptr, 0));
+    EXPECT_LT(cslt::text::compare("abc", "abd", 3), 0);
+    EXPECT_GT(cslt::text::compare("\xFF", "a", 1), 0);
+    EXPECT_FALSE(cslt::text::equal("abc", "abd", 3));
+}
+// ================================================================================
+// ================================================================================
+// TEST THE STRING AND STRING_VIEW MEMBERS
+
+TEST(StringSearchTest, StringMembers) {
+    cslt::String str("GET /index.html HTTP/1.1 and a line long enough to leave the inline buffer");
+    EXPECT_EQ(4u, str.find('/'));
+    EXPECT_EQ(20u, str.rfind('/'));
+    EXPECT_EQ(16u, str.find("HTTP"));
+    EXPECT_EQ(cslt::String::npos, str.find("HTTP", 17));
+    EXPECT_EQ(3u, str.find_first_of(" /"));
+    EXPECT_EQ(3u, str.find_first_not_of("GET"));
+    EXPECT_TRUE(str.contains("inline"));
+    EXPECT_EQ(0, str.compare(str.view()));
+    EXPECT_LT(str.compare("HEAD"), 0);
+    EXPECT_TRUE(cslt::String("Content-Length").equals_icase("content-length"));
+    EXPECT_FALSE(cslt::String("Content-Length").equals_icase("content-lengths"));
+    EXPECT_LT(cslt::String("abc").compare_icase("ABD"), 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringSearchTest, ViewMatchesCompileTimeResult) {
+    constexpr cslt::string_view text("Accept-Encoding: gzip");
+    static_assert(text.find(':') == 15, "constexpr find");
+    static_assert(text.rfind("zip") == 18, "constexpr rfind");
+    static_assert(text.equals_icase("ACCEPT-ENCODING: GZIP"), "constexpr equals_icase");
+    static_assert(text.find_first_of(" :") == 15, "constexpr find_first_of");
+    const cslt::string_view runtime(text.data(), text.size());
+    EXPECT_EQ(15u, runtime.find(':'));
+    EXPECT_EQ(18u, runtime.rfind("zip"));
+    EXPECT_EQ(18u, runtime.rfind("zip", 18));
+    EXPECT_EQ(cslt::string_view::npos, runtime.rfind("zip", 17));
+    EXPECT_TRUE(runtime.equals_icase("ACCEPT-ENCODING: GZIP"));
+    EXPECT_EQ(15u, runtime.find_first_of(" :"));
+    EXPECT_EQ(cslt::string_view::npos, runtime.find(':', 16));
+    EXPECT_EQ(cslt::string_view::npos, runtime.find_first_of(":", 30));
+}
+// ================================================================================
+// ================================================================================
+// eof
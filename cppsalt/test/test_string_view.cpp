@@ -0,0 +1,155 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_string_view.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the string_view class in string_view.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include "../include/string_view.hpp"
+#include "../include/string.hpp"
+#include "../include/flat_hash_map.hpp"
+
+// The searches are constexpr, so they may run at compile time
+static_assert(cslt::string_view("key=value").find('=') == 3, "constexpr find");
+static_assert(cslt::string_view("key=value").find("val") == 4, "constexpr find view");
+static_assert(cslt::string_view("abc").compare("abd") < 0, "constexpr compare");
+static_assert(cslt::string_view("prefix.name").starts_with("prefix"), "constexpr starts_with");
+static_assert(cslt::string_view("key=value").substr(4) == cslt::string_view("value"), "constexpr substr");
+static_assert(cslt::string_view("key=value").substr(0, 3).size() == 3, "constexpr substr count");
+static_assert(cslt::string_view("key").at(2) == 'y', "constexpr at");
+// ================================================================================
+// ================================================================================
+
+TEST(StringViewTest, Construction) {
+    cslt::string_view empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(nullptr, empty.data());
+    cslt::string_view literal("hello");
+    EXPECT_EQ(5u, literal.size());
+    cslt::string_view part("hello world", 5);
+    EXPECT_EQ(literal, part);
+    const char* null_text = nullptr;
+    EXPECT_EQ(0u, cslt::string_view(null_text).size());
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringViewTest, ElementAccess) {
+    cslt::string_view view("abc");
+    EXPECT_EQ('a', view.front());
+    EXPECT_EQ('c', view.back());
+    EXPECT_EQ('b', view[1]);
+    EXPECT_EQ('b', view.at(1));
+    EXPECT_THROW(view.at(3), cslt::out_of_range);
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringViewTest, SubstrAndTrim) {
+    cslt::string_view view("  token  ");
+    view.remove_prefix(view.find_first_not_of(" "));
+    view.remove_suffix(view.size() - view.rfind('n') - 1);
+    EXPECT_EQ(cslt::string_view("token"), view);
+    EXPECT_EQ(cslt::string_view("ok"), view.substr(1, 2));
+    EXPECT_EQ(cslt::string_view("en"), view.substr(3));
+    EXPECT_TRUE(view.substr(5).empty());
+    EXPECT_THROW(view.substr(6), cslt::out_of_range);
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringViewTest, RemoveClampsToSize) {
+    const char* text = "abc";
+    cslt::string_view view(text);
+    view.remove_prefix(view.find('z'));
+    EXPECT_TRUE(view.empty());
+    EXPECT_EQ(text + 3, view.data());
+    cslt::string_view tail(text);
+    tail.remove_suffix(5);
+    EXPECT_TRUE(tail.empty());
+    EXPECT_EQ(text, tail.data());
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringViewTest, Searching) {
+    cslt::string_view view("a,b;;c,d");
+    EXPECT_EQ(1u, view.find(','));
+    EXPECT_EQ(6u, view.find(',', 2));
+    EXPECT_EQ(6u, view.rfind(','));
+    EXPECT_EQ(1u, view.rfind(',', 5));
+    EXPECT_EQ(3u, view.find(";;"));
+    EXPECT_EQ(cslt::string_view::npos, view.find(";;;"));
+    EXPECT_EQ(4u, view.rfind(";"));
+    EXPECT_EQ(1u, view.find_first_of(";,"));
+    EXPECT_EQ(0u, view.find(""));
+    EXPECT_TRUE(view.contains("c,d"));
+    EXPECT_FALSE(view.contains('x'));
+    EXPECT_TRUE(view.ends_with(",d"));
+    EXPECT_EQ(cslt::string_view::npos, cslt::string_view().rfind('a'));
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringViewTest, Comparison) {
+    EXPECT_TRUE(cslt::string_view("abc") < cslt::string_view("abd"));
+    EXPECT_TRUE(cslt::string_view("ab") < cslt::string_view("abc"));
+    EXPECT_TRUE(cslt::string_view("b") > cslt::string_view("abc"));
+    EXPECT_EQ(0, cslt::string_view("same").compare("same"));
+    EXPECT_TRUE(cslt::string_view("x") != cslt::string_view("y"));
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringViewTest, TokenizeWithoutCopies) {
+    cslt::string_view line("GET /index.html HTTP/1.1");
+    cslt::string_view tokens[3];
+    cslt::size_t count = 0;
+    while (!line.empty() && count < 3) {
+        const cslt::size_t space = line.find(' ');
+        tokens[count++] = line.substr(0, space);
+        line.remove_prefix(space == cslt::string_view::npos ? line.size() : space + 1);
+    }
+    EXPECT_EQ(3u, count);
+    EXPECT_EQ(cslt::string_view("/index.html"), tokens[1]);
+    EXPECT_EQ(cslt::string_view("HTTP/1.1"), tokens[2]);
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringViewTest, StringConversions) {
+    cslt::String str("a string longer than the inline buffer of String");
+    cslt::string_view view = str;
+    EXPECT_EQ(str.c_string(), view.data());
+    EXPECT_EQ(str.size(), view.size());
+    EXPECT_TRUE(str == cslt::string_view("a string longer than the inline buffer of String"));
+    cslt::String copy(view.substr(2, 6));
+    EXPECT_EQ(copy, "string");
+    copy.append(cslt::string_view(" view!", 5));
+    EXPECT_EQ(copy, "string view");
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringViewTest, HashMapLookupByView) {
+    cslt::flat_hash_map<cslt::String, int> map;
+    map["alpha"] = 1;
+    map["beta"] = 2;
+    cslt::string_view text("alpha,beta");
+    EXPECT_EQ(1, map.find(text.substr(0, 5))->second);
+    EXPECT_EQ(2, map.find(text.substr(6))->second);
+    EXPECT_EQ(cslt::hash<cslt::String>()(map.find("beta")->first),
+              cslt::hash<cslt::string_view>()(text.substr(6)));
+}
+// --------------------------------------------------------------------------------
+
+TEST(StringViewTest, StreamOutput) {
+    std::ostringstream os;
+    os << cslt::string_view("printed text", 7);
+    EXPECT_EQ("printed", os.str());
+}
+// ================================================================================
+// ================================================================================
+// eof
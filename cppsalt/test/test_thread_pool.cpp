@@ -0,0 +1,248 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_thread_pool.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the thread_pool class in thread_pool.hpp
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../include/thread_pool.hpp"
+#include "../include/except.hpp"
+// ================================================================================
+// ================================================================================
+// WORK_STEALING_DEQUE TESTS
+
+TEST(WorkStealingDequeTest, OwnerTakesNewestThiefTakesOldest) {
+    cslt::work_stealing_deque<int> deque(4);
+    for (int i = 0; i < 10; ++i)
+        deque.push(i);
+    EXPECT_EQ(10u, deque.size());
+    int value = -1;
+    ASSERT_TRUE(deque.take(value));
+    EXPECT_EQ(9, value);
+    ASSERT_TRUE(deque.steal(value));
+    EXPECT_EQ(0, value);
+    EXPECT_EQ(8u, deque.size());
+    while (deque.take(value)) {}
+    EXPECT_TRUE(deque.empty());
+    EXPECT_FALSE(deque.steal(value));
+}
+// --------------------------------------------------------------------------------
+
+TEST(WorkStealingDequeTest, EveryItemTakenExactlyOnce) {
+    const int total = 200000;
+    cslt::work_stealing_deque<int> deque(16);
+    std::vector<std::atomic<int>> seen(total);
+    std::atomic<bool> done{false};
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; ++t) {
+        thieves.emplace_back([&] {
+            int value = 0;
+            while (!done.load() || !deque.empty()) {
+                if (deque.steal(value))
+                    seen[value].fetch_add(1);
+            }
+        });
+    }
+    int value = 0;
+    for (int i = 0; i < total; ++i) {
+        deque.push(i);
+        // Take back about a third, so the owner and the thieves meet often
+        if (i % 3 == 0 && deque.take(value))
+            seen[value].fetch_add(1);
+    }
+    while (deque.take(value))
+        seen[value].fetch_add(1);
+    done.store(true);
+    for (std::thread& thief : thieves)
+        thief.join();
+    for (int i = 0; i < total; ++i)
+        ASSERT_EQ(1, seen[i].load()) << "item " << i;
+}
+// ================================================================================
+// ================================================================================
+// SUBMIT AND FUTURE TESTS
+
+TEST(ThreadPoolTest, SubmitReturnsValues) {
+    cslt::thread_pool pool(4);
+    EXPECT_EQ(4u, pool.size());
+    EXPECT_EQ(-1, pool.current_worker());
+    std::vector<cslt::task_future<int>> futures;
+    for (int i = 0; i < 1000; ++i)
+        futures.push_back(pool.submit([i] {return i * i;}));
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_EQ(i * i, futures[i].get());
+    cslt::task_future<std::string> text = pool.submit([] {return std::string(50, 'z');});
+    EXPECT_EQ(std::string(50, 'z'), text.get());
+}
+// --------------------------------------------------------------------------------
+
+TEST(ThreadPoolTest, VoidTasksAndWorkerIndex) {
+    cslt::thread_pool pool(2);
+    std::atomic<int> count{0};
+    std::atomic<bool> inside{true};
+    std::vector<cslt::task_future<void>> futures;
+    for (int i = 0; i < 100; ++i) {
+        futures.push_back(pool.submit([&] {
+            // A worker, or the waiting test thread helping out
+            const long index = pool.current_worker();
+            if (index < -1 || index >= 2)
+                inside.store(false);
+            count.fetch_add(1);
+        }));
+    }
+    for (cslt::task_future<void>& future : futures)
+        future.wait();
+    EXPECT_EQ(100, count.load());
+    EXPECT_TRUE(inside.load());
+    EXPECT_TRUE(futures[0].ready());
+}
+// --------------------------------------------------------------------------------
+
+TEST(ThreadPoolTest, ExceptionsReachGet) {
+    cslt::thread_pool pool(2);
+    cslt::task_future<int> future = pool.submit([]() -> int {throw cslt::runtime_error("task failed");});
+    EXPECT_THROW(future.get(), cslt::runtime_error);
+    // The result was consumed, so the future is empty now
+    EXPECT_FALSE(future.valid());
+    EXPECT_THROW(future.get(), cslt::future_error);
+    cslt::task_future<int> empty;
+    EXPECT_THROW(empty.wait(), cslt::future_error);
+    EXPECT_THROW(empty.ready(), cslt::future_error);
+}
+// --------------------------------------------------------------------------------
+
+TEST(ThreadPoolTest, NestedTasksDoNotDeadlock) {
+    // Each level waits on its children from inside a worker, which must help
+    // rather than block the only thread
+    cslt::thread_pool pool(1);
+    struct fib {
+        cslt::thread_pool& pool;
+        long operator()(int n) const {
+            if (n < 2)
+                return n;
+            const fib self = *this;
+            cslt::task_future<long> left = pool.submit([self, n] {return self(n - 1);});
+            const long right = (*this)(n - 2);
+            return left.get() + right;
+        }
+    };
+    const fib f{pool};
+    EXPECT_EQ(6765, pool.submit([f] {return f(20);}).get());
+}
+// --------------------------------------------------------------------------------
+
+TEST(ThreadPoolTest, DestructorRunsQueuedTasks) {
+    std::atomic<int> count{0};
+    {
+        cslt::thread_pool pool(2);
+        for (int i = 0; i < 500; ++i)
+            pool.submit([&count] {count.fetch_add(1);});
+    }
+    EXPECT_EQ(500, count.load());
+}
+// --------------------------------------------------------------------------------
+
+TEST(ThreadPoolTest, PinnedWorkers) {
+    cslt::thread_pool_options options;
+    options.threads = 2;
+    options.pin_threads = true;
+    cslt::thread_pool pool(options);
+    EXPECT_EQ(42, pool.submit([] {return 42;}).get());
+    // Pinning is a request; a worker the system would not pin reports -1
+    for (cslt::size_t i = 0; i < pool.size(); ++i)
+        EXPECT_GE(pool.worker_cpu(i), -1);
+    EXPECT_THROW(pool.worker_cpu(2), cslt::out_of_range);
+}
+// ================================================================================
+// ================================================================================
+// PARALLEL_FOR TESTS
+
+TEST(ThreadPoolTest, ParallelForCoversRangeOnce) {
+    cslt::thread_pool pool(4);
+    for (cslt::size_t total : {0u, 1u, 7u, 1000u, 100003u}) {
+        std::vector<std::atomic<int>> seen(total);
+        pool.parallel_for(0, total, [&seen](cslt::size_t begin, cslt::size_t end) {
+            for (cslt::size_t i = begin; i < end; ++i)
+                seen[i].fetch_add(1);
+        });
+        for (cslt::size_t i = 0; i < total; ++i)
+            ASSERT_EQ(1, seen[i].load()) << "total " << total << " index " << i;
+    }
+}
+// --------------------------------------------------------------------------------
+
+TEST(ThreadPoolTest, ParallelForRespectsGrain) {
+    cslt::thread_pool pool(3);
+    std::atomic<cslt::size_t> smallest{1000000};
+    std::atomic<std::uint64_t> sum{0};
+    pool.parallel_for(10, 10010, [&](cslt::size_t begin, cslt::size_t end) {
+        cslt::size_t size = end - begin;
+        cslt::size_t current = smallest.load();
+        while (size < current && !smallest.compare_exchange_weak(current, size)) {}
+        std::uint64_t local = 0;
+        for (cslt::size_t i = begin; i < end; ++i)
+            local += i;
+        sum.fetch_add(local);
+    }, 100);
+    EXPECT_GE(smallest.load(), 50u);
+    EXPECT_EQ(10009ull * 10010ull / 2 - 9ull * 10ull / 2, sum.load());
+}
+// --------------------------------------------------------------------------------
+
+TEST(ThreadPoolTest, NestedParallelFor) {
+    cslt::thread_pool pool(2);
+    std::atomic<int> count{0};
+    pool.parallel_for(0, 20, [&](cslt::size_t begin, cslt::size_t end) {
+        for (cslt::size_t i = begin; i < end; ++i) {
+            pool.parallel_for(0, 100, [&count](cslt::size_t b, cslt::size_t e) {
+                count.fetch_add(static_cast<int>(e - b));
+            }, 1);
+        }
+    }, 1);
+    EXPECT_EQ(2000, count.load());
+}
+// --------------------------------------------------------------------------------
+
+TEST(ThreadPoolTest, ParallelForRethrows) {
+    cslt::thread_pool pool(4);
+    std::atomic<int> chunks{0};
+    EXPECT_THROW(pool.parallel_for(0, 100000, [&chunks](cslt::size_t begin, cslt::size_t) {
+        chunks.fetch_add(1);
+        if (begin == 0)
+            throw cslt::invalid_argument("bad chunk");
+    }, 10), cslt::invalid_argument);
+    // The pool is still usable afterwards
+    EXPECT_EQ(3, pool.submit([] {return 3;}).get());
+}
+// --------------------------------------------------------------------------------
+
+TEST(ThreadPoolTest, DefaultPool) {
+    cslt::thread_pool& pool = cslt::default_thread_pool();
+    EXPECT_EQ(&pool, &cslt::default_thread_pool());
+    EXPECT_GE(pool.size(), 1u);
+    std::atomic<long> sum{0};
+    pool.parallel_for(0, 1000, [&sum](cslt::size_t begin, cslt::size_t end) {
+        long local = 0;
+        for (cslt::size_t i = begin; i < end; ++i)
+            local += static_cast<long>(i);
+        sum.fetch_add(local);
+    });
+    EXPECT_EQ(499500, sum.load());
+}
+// ================================================================================
+// ================================================================================
+// eof
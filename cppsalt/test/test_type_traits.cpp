@@ -15,6 +15,8 @@
 
 #include <gtest/gtest.h>
 #include "../include/type_traits.hpp"
+#include "../include/small_vector.hpp"
+#include "../include/string.hpp"
 // ================================================================================
 // ================================================================================
 
@@ -63,4 +65,71 @@ TEST(IsNothrowMoveConstructibleTest, ValidatesNoexceptMoveConstructor) {
 }
 // ================================================================================
 // ================================================================================
+
+TEST(IsTriviallyRelocatableTest, TriviallyCopyableTypes) {
+    static_assert(cslt::is_trivially_relocatable<int>::value, "int should be trivially relocatable");
+    static_assert(cslt::is_trivially_relocatable<double*>::value, "pointers should be trivially relocatable");
+    static_assert(cslt::is_trivially_relocatable<cslt::pair<int, float>>::value,
+                  "a pair of scalars should be trivially relocatable");
+    static_assert(!cslt::is_trivially_relocatable<NoexceptMoveClass>::value,
+                  "a user provided move constructor should not be trivially relocatable");
+}
+// --------------------------------------------------------------------------------
+
+TEST(IsTriviallyRelocatableTest, LibraryTypes) {
+    static_assert(cslt::is_trivially_relocatable<cslt::unique_ptr<int>>::value, "unique_ptr should opt in");
+    static_assert(cslt::is_trivially_relocatable<cslt::shared_ptr<int>>::value, "shared_ptr should opt in");
+    static_assert(cslt::is_trivially_relocatable<cslt::array_ptr<int>>::value, "array_ptr should opt in");
+    static_assert(cslt::is_trivially_relocatable<cslt::String>::value, "String should opt in");
+    static_assert(cslt::is_trivially_relocatable<cslt::vector<cslt::String>>::value, "vector should opt in");
+    static_assert(cslt::is_trivially_relocatable<cslt::pmr::vector<int>>::value,
+                  "a vector with a polymorphic_allocator should opt in");
+    static_assert(cslt::is_trivially_relocatable<cslt::pair<cslt::String, cslt::vector<int>>>::value,
+                  "a pair of relocatable types should be relocatable");
+    static_assert(!cslt::is_trivially_relocatable<cslt::small_vector<int, 4>>::value,
+                  "small_vector points into itself and must not opt in");
+    static_assert(!cslt::is_trivially_relocatable<cslt::pair<int, NoexceptMoveClass>>::value,
+                  "a pair is only relocatable when both members are");
+}
+// ================================================================================
+// ================================================================================
+
+static long add_one(int value) {return value + 1;}
+
+struct Overloaded {
+    int operator()() & {return 0;}
+    double operator()() && {return 0.0;}
+    const char* operator()(int) const {return "";}
+};
+// --------------------------------------------------------------------------------
+
+template <typename F, typename = void>
+struct callable_without_arguments : std::false_type {};
+
+template <typename F>
+struct callable_without_arguments<F, decltype(void(std::declval<cslt::invoke_result_t<F>>()))> : std::true_type {};
+// --------------------------------------------------------------------------------
+
+TEST(InvokeResultTest, CallableTypes) {
+    static_assert(std::is_same<cslt::invoke_result_t<long (*)(int), int>, long>::value,
+                  "a function pointer should give its return type");
+    static_assert(std::is_same<cslt::invoke_result_t<decltype(add_one)&, short>, long>::value,
+                  "a function reference should give its return type");
+    static_assert(std::is_same<cslt::invoke_result_t<Overloaded&>, int>::value,
+                  "an lvalue should select the lvalue overload");
+    static_assert(std::is_same<cslt::invoke_result_t<Overloaded>, double>::value,
+                  "an rvalue should select the rvalue overload");
+    static_assert(std::is_same<cslt::invoke_result_t<const Overloaded&, int>, const char*>::value,
+                  "the arguments should select the overload");
+}
+// --------------------------------------------------------------------------------
+
+TEST(InvokeResultTest, IllFormedCallHasNoType) {
+    static_assert(callable_without_arguments<Overloaded&>::value, "Overloaded& is callable without arguments");
+    static_assert(!callable_without_arguments<const Overloaded&>::value,
+                  "a const Overloaded has no call without arguments");
+    static_assert(!callable_without_arguments<int>::value, "an int is not callable");
+}
+// ================================================================================
+// ================================================================================
 // eof
@@ -21,6 +21,13 @@
 // ================================================================================
 // ================================================================================
 
+// A type whose move operations may throw
+struct ThrowingMoveClassFwd {
+    ThrowingMoveClassFwd(ThrowingMoveClassFwd&&) {}
+    ThrowingMoveClassFwd& operator=(ThrowingMoveClassFwd&&) {return *this;}
+};
+// --------------------------------------------------------------------------------
+
 // Define a simple class directly in the test file
 class MyClass {
 public:
@@ -89,6 +96,51 @@ TEST(TestPair, TestSwapMethod) {
     EXPECT_EQ(two.first, 1);
     EXPECT_EQ(two.second, 2);
 }
+// --------------------------------------------------------------------------------
+
+// Counts copies and moves, so a test can see which one swap and pair use
+struct CopyCounter {
+    static int copies;
+    static int moves;
+    int value;
+
+    CopyCounter(int val = 0) : value(val) {}
+    CopyCounter(const CopyCounter& other) : value(other.value) {++copies;}
+    CopyCounter(CopyCounter&& other) noexcept : value(other.value) {++moves;}
+    CopyCounter& operator=(const CopyCounter& other) {value = other.value; ++copies; return *this;}
+    CopyCounter& operator=(CopyCounter&& other) noexcept {value = other.value; ++moves; return *this;}
+};
+int CopyCounter::copies = 0;
+int CopyCounter::moves = 0;
+// --------------------------------------------------------------------------------
+
+TEST(TestSwap, SwapMovesInsteadOfCopying) {
+    CopyCounter a(1);
+    CopyCounter b(2);
+    CopyCounter::copies = CopyCounter::moves = 0;
+    cslt::swap(a, b);
+    EXPECT_EQ(a.value, 2);
+    EXPECT_EQ(b.value, 1);
+    EXPECT_EQ(CopyCounter::copies, 0);
+    EXPECT_EQ(CopyCounter::moves, 3);
+    static_assert(noexcept(cslt::swap(a, b)), "swap of a nothrow movable type is noexcept");
+    static_assert(!noexcept(cslt::swap(std::declval<ThrowingMoveClassFwd&>(), std::declval<ThrowingMoveClassFwd&>())),
+                  "swap of a throwing movable type is not noexcept");
+}
+// --------------------------------------------------------------------------------
+
+TEST(TestPair, MoveAndMakePairDoNotCopy) {
+    CopyCounter::copies = CopyCounter::moves = 0;
+    cslt::pair<CopyCounter, CopyCounter> one = cslt::make_pair(CopyCounter(1), CopyCounter(2));
+    cslt::pair<CopyCounter, CopyCounter> two(cslt::move(one));
+    one = cslt::move(two);
+    cslt::swap(one, two);
+    EXPECT_EQ(CopyCounter::copies, 0);
+    EXPECT_EQ(two.first.value, 1);
+    EXPECT_EQ(two.second.value, 2);
+    static_assert(std::is_trivially_copyable<cslt::pair<int, double>>::value,
+                  "a pair of trivially copyable types is trivially copyable");
+}
 // ================================================================================
 // ================================================================================
 // TEST MOVE 
@@ -0,0 +1,373 @@
+// ================================================================================
+// ================================================================================
+// - File:    test_vec.cpp
+// - Purpose: This file implements google test as a method to test C++ code.
+//            This file tests the vector class from the vec.hpp file
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// - Begin test
+
+#include <gtest/gtest.h>
+#include "../include/vec.hpp"
+#include "../include/memory.hpp"
+#include <string>
+
+// Helper class to count constructor and assignment calls
+class Tracked {
+public:
+    static int constructed;
+    static int destroyed;
+    static int copies;
+    static int moves;
+    int value;
+
+    Tracked() : value(0) { ++constructed; }
+    Tracked(int val) : value(val) { ++constructed; }
+    Tracked(const Tracked& other) : value(other.value) { ++constructed; ++copies; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++constructed; ++moves; other.value = -1; }
+    Tracked& operator=(const Tracked& other) { value = other.value; ++copies; return *this; }
+    Tracked& operator=(Tracked&& other) noexcept { value = other.value; ++moves; other.value = -1; return *this; }
+    ~Tracked() { ++destroyed; }
+
+    static void reset() { constructed = destroyed = copies = moves = 0; }
+    static int alive() { return constructed - destroyed; }
+};
+int Tracked::constructed = 0;
+int Tracked::destroyed = 0;
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+// --------------------------------------------------------------------------------
+
+// A type whose move constructor may throw, forcing copies during growth
+class ThrowingMove {
+public:
+    int value;
+    ThrowingMove(int val) : value(val) {}
+    ThrowingMove(const ThrowingMove& other) : value(other.value) {}
+    ThrowingMove(ThrowingMove&& other) : value(other.value) { other.value = -1; }
+};
+// --------------------------------------------------------------------------------
+
+// A move only type
+class MoveOnly {
+public:
+    int value;
+    explicit MoveOnly(int val) : value(val) {}
+    MoveOnly(const MoveOnly&) = delete;
+    MoveOnly(MoveOnly&& other) noexcept : value(other.value) { other.value = -1; }
+    MoveOnly& operator=(MoveOnly&& other) noexcept { value = other.value; other.value = -1; return *this; }
+};
+// --------------------------------------------------------------------------------
+
+// Opts in to bitwise relocation, so growth must never move or destroy it
+class Relocated {
+public:
+    static int moves;
+    static int destroyed;
+    int value;
+    explicit Relocated(int val) : value(val) {}
+    Relocated(const Relocated& other) : value(other.value) {}
+    Relocated(Relocated&& other) noexcept : value(other.value) { ++moves; }
+    Relocated& operator=(Relocated&& other) noexcept { value = other.value; ++moves; return *this; }
+    ~Relocated() { ++destroyed; }
+};
+int Relocated::moves = 0;
+int Relocated::destroyed = 0;
+
+namespace cslt {
+    template <>
+    struct is_trivially_relocatable<Relocated> : std::true_type {};
+}
+// --------------------------------------------------------------------------------
+
+// A stateful allocator that propagates on copy assignment and counts the
+// blocks each id has outstanding
+template <typename T>
+struct copied_alloc {
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+
+    int id;
+    int* live;
+
+    copied_alloc(int i, int* counts) noexcept : id(i), live(counts) {}
+    template <typename U>
+    copied_alloc(const copied_alloc<U>& other) noexcept : id(other.id), live(other.live) {}
+
+    T* allocate(std::size_t num) {
+        ++live[id];
+        return static_cast<T*>(::operator new(num * sizeof(T)));
+    }
+    void deallocate(T* block, std::size_t) noexcept {
+        --live[id];
+        ::operator delete(block);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const copied_alloc<T>& a, const copied_alloc<U>& b) noexcept {return a.id == b.id;}
+template <typename T, typename U>
+bool operator!=(const copied_alloc<T>& a, const copied_alloc<U>& b) noexcept {return a.id != b.id;}
+// --------------------------------------------------------------------------------
+
+class VectorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Tracked::reset();
+    }
+};
+// ================================================================================
+// ================================================================================
+
+TEST_F(VectorTest, ReserveDoesNotConstructElements) {
+    cslt::vector<Tracked> vec(100);
+    EXPECT_EQ(vec.alloc(), 100);
+    EXPECT_EQ(vec.size(), 0);
+    EXPECT_EQ(Tracked::constructed, 0);
+    vec.reserve(1000);
+    EXPECT_EQ(vec.alloc(), 1000);
+    EXPECT_EQ(Tracked::constructed, 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, PushBackGrowthMovesElements) {
+    {
+        cslt::vector<Tracked> vec;
+        for (int i = 0; i < 100; ++i)
+            vec.push_back(Tracked(i));
+        EXPECT_EQ(vec.size(), 100);
+        EXPECT_EQ(vec.alloc(), 128);
+        EXPECT_EQ(Tracked::copies, 0);
+        for (int i = 0; i < 100; ++i)
+            EXPECT_EQ(vec[i].value, i);
+        EXPECT_EQ(Tracked::alive(), 100);
+    }
+    EXPECT_EQ(Tracked::alive(), 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, PushBackLvalueCopiesOnce) {
+    cslt::vector<Tracked> vec;
+    Tracked item(5);
+    vec.push_back(item);
+    EXPECT_EQ(Tracked::copies, 1);
+    EXPECT_EQ(item.value, 5);
+    EXPECT_EQ(vec[0].value, 5);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, PushBackOwnElement) {
+    cslt::vector<Tracked> vec;
+    vec.push_back(Tracked(1));
+    for (int i = 0; i < 10; ++i)
+        vec.push_back(vec[0]);
+    EXPECT_EQ(vec.size(), 11);
+    for (cslt::size_t i = 0; i < vec.size(); ++i)
+        EXPECT_EQ(vec[i].value, 1);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, EmplaceBackConstructsInPlace) {
+    cslt::vector<Tracked> vec(4);
+    Tracked& ref = vec.emplace_back(42);
+    EXPECT_EQ(ref.value, 42);
+    EXPECT_EQ(Tracked::constructed, 1);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, ThrowingMoveFallsBackToCopy) {
+    cslt::vector<ThrowingMove> vec;
+    for (int i = 0; i < 20; ++i)
+        vec.emplace_back(i);
+    for (int i = 0; i < 20; ++i)
+        EXPECT_EQ(vec[i].value, i);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, MoveOnlyElements) {
+    cslt::vector<MoveOnly> vec;
+    for (int i = 0; i < 10; ++i)
+        vec.push_back(MoveOnly(i));
+    vec.push_back(MoveOnly(99), 3);
+    EXPECT_EQ(vec.size(), 11);
+    EXPECT_EQ(vec[3].value, 99);
+    EXPECT_EQ(vec[4].value, 3);
+    EXPECT_EQ(vec[10].value, 9);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, InsertAtIndex) {
+    cslt::vector<int> vec = {1, 2, 4, 5};
+    vec.push_back(3, 2);
+    vec.push_back(0, 0);
+    vec.push_back(6, vec.size());
+    ASSERT_EQ(vec.size(), 7);
+    for (int i = 0; i < 7; ++i)
+        EXPECT_EQ(vec[i], i);
+    EXPECT_THROW(vec.push_back(1, 20), cslt::out_of_range);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, InsertNonTrivial) {
+    cslt::vector<Tracked> vec(10);
+    for (int i = 0; i < 5; ++i)
+        vec.emplace_back(i);
+    vec.push_back(Tracked(100), 1);
+    ASSERT_EQ(vec.size(), 6);
+    EXPECT_EQ(vec[0].value, 0);
+    EXPECT_EQ(vec[1].value, 100);
+    EXPECT_EQ(vec[2].value, 1);
+    EXPECT_EQ(vec[5].value, 4);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, ShrinkToFit) {
+    cslt::vector<Tracked> vec(64);
+    for (int i = 0; i < 10; ++i)
+        vec.emplace_back(i);
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.alloc(), 10);
+    EXPECT_EQ(vec.size(), 10);
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(vec[9].value, 9);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, TriviallyCopyableGrowth) {
+    cslt::vector<double> vec;
+    for (int i = 0; i < 1000; ++i)
+        vec.push_back(i * 0.5);
+    EXPECT_EQ(vec.size(), 1000);
+    EXPECT_DOUBLE_EQ(vec[999], 499.5);
+    vec.reserve(5000);
+    EXPECT_DOUBLE_EQ(vec[500], 250.0);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, CopyAndMove) {
+    cslt::vector<Tracked> vec;
+    for (int i = 0; i < 5; ++i)
+        vec.emplace_back(i);
+    cslt::vector<Tracked> copy(vec);
+    EXPECT_EQ(copy.size(), 5);
+    EXPECT_EQ(copy[4].value, 4);
+
+    cslt::vector<Tracked> moved(cslt::move(copy));
+    EXPECT_EQ(moved.size(), 5);
+    EXPECT_EQ(copy.size(), 0);
+
+    cslt::vector<Tracked> assigned;
+    assigned = vec;
+    EXPECT_EQ(assigned.size(), 5);
+    assigned = cslt::move(moved);
+    EXPECT_EQ(assigned.size(), 5);
+    EXPECT_EQ(moved.size(), 0);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, PopBackAndClear) {
+    cslt::vector<Tracked> vec;
+    for (int i = 0; i < 5; ++i)
+        vec.emplace_back(i);
+    vec.pop_back();
+    EXPECT_EQ(vec.size(), 4);
+    EXPECT_EQ(Tracked::alive(), 4);
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(Tracked::alive(), 0);
+    EXPECT_THROW(vec.pop_back(), cslt::out_of_range);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, IndexOutOfRange) {
+    cslt::vector<int> vec = {1, 2, 3};
+    EXPECT_THROW(vec.at(3), cslt::out_of_range);
+    EXPECT_EQ(vec.at(2), 3);
+#if CSLT_BOUNDS_CHECK == CSLT_BOUNDS_CHECKED
+    EXPECT_THROW(vec[3], cslt::out_of_range);
+#endif
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, RawPointerIteration) {
+    cslt::vector<int> vec = {1, 2, 3, 4};
+    int sum = 0;
+    for (int value : vec)
+        sum += value;
+    EXPECT_EQ(sum, 10);
+    EXPECT_EQ(vec.end() - vec.begin(), 4);
+    EXPECT_EQ(vec.begin(), vec.data());
+    const cslt::vector<int>& ref = vec;
+    EXPECT_EQ(*(ref.end() - 1), 4);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, TriviallyRelocatableGrowth) {
+    Relocated::moves = Relocated::destroyed = 0;
+    {
+        cslt::vector<Relocated> vec;
+        for (int i = 0; i < 100; ++i)
+            vec.emplace_back(i);
+        vec.push_back(Relocated(-1), 0);
+        vec.reserve(1000);
+        EXPECT_EQ(Relocated::moves, 1);
+        EXPECT_EQ(Relocated::destroyed, 1);
+        ASSERT_EQ(vec.size(), 101);
+        EXPECT_EQ(vec[0].value, -1);
+        EXPECT_EQ(vec[1].value, 0);
+        EXPECT_EQ(vec[100].value, 99);
+    }
+    EXPECT_EQ(Relocated::destroyed, 102);
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, AppendRange) {
+    cslt::vector<int> vec = {1, 2, 3};
+    const int more[] = {4, 5};
+    vec.append(more, 2);
+    ASSERT_EQ(vec.size(), 5);
+    EXPECT_EQ(vec[4], 5);
+    // The source lies inside the vector and the append reallocates
+    vec.append(vec.data(), vec.size());
+    ASSERT_EQ(vec.size(), 10);
+    EXPECT_EQ(vec[5], 1);
+    EXPECT_EQ(vec[9], 5);
+
+    cslt::vector<std::string> names = {"a"};
+    names.append(names.data(), 1);
+    names.append(names.data(), 2);
+    ASSERT_EQ(names.size(), 4);
+    EXPECT_EQ(names[3], "a");
+}
+// --------------------------------------------------------------------------------
+
+TEST_F(VectorTest, CopyAssignmentPropagatesAllocator) {
+    int live[3] = {0, 0, 0};
+    using vec_t = cslt::vector<std::string, copied_alloc<std::string>>;
+    vec_t source(std::initializer_list<std::string>{"a", "b", "c"}, copied_alloc<std::string>(2, live));
+    vec_t target(std::initializer_list<std::string>{"x"}, copied_alloc<std::string>(1, live));
+    ASSERT_EQ(1, live[1]);
+    target = source;
+    EXPECT_EQ(2, target.get_allocator().id);
+    EXPECT_EQ(0, live[1]);
+    EXPECT_EQ(2, live[2]);
+    ASSERT_EQ(3u, target.size());
+    EXPECT_EQ("c", target[2]);
+    // An equal allocator keeps the buffer, which already has room
+    vec_t shorter(std::initializer_list<std::string>{"y"}, copied_alloc<std::string>(2, live));
+    target = shorter;
+    EXPECT_EQ(3, live[2]);
+    EXPECT_EQ(1u, target.size());
+    EXPECT_EQ(3u, target.alloc());
+}
+// ================================================================================
+// ================================================================================
+// eof
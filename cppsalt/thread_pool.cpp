@@ -0,0 +1,352 @@
+// ================================================================================
+// ================================================================================
+// - File:    thread_pool.cpp
+// - Purpose: The worker loop, scheduling, waiting and CPU placement of thread_pool
+//
+// Source Metadata
+// - Author:  Jonathan A. Webb
+// - Date:    October 14, 2026
+// - Version: 1.0
+// - Copyright: Copyright 2024, Jon Webb Inc.
+// ================================================================================
+// ================================================================================
+// Include modules here
+
+#include "include/thread_pool.hpp"
+#include "include/vec.hpp"
+#include <algorithm>
+#include <cstdio>
+
+#if defined(__linux__)
+    #include <sched.h>
+#endif
+
+namespace cslt {
+
+    namespace {
+        // The pool and worker the calling thread belongs to, if any
+        thread_local thread_pool* tls_pool = nullptr;
+        thread_local cslt::size_t tls_index = 0;
+
+        // Failed searches a thread makes, yielding between them, before it sleeps
+        constexpr unsigned spin_limit = 64;
+// --------------------------------------------------------------------------------
+
+        std::uint64_t next_random(std::uint64_t& state) noexcept {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        }
+// --------------------------------------------------------------------------------
+
+        struct cpu_slot {
+            int cpu;
+            int node;
+        };
+
+#if defined(__linux__)
+        /**
+         * Reads a sysfs cpulist such as "0-3,8-11" and records node for each
+         * CPU it names
+         */
+        void read_cpulist(const char* path, int node, vector<int>& node_of) {
+            std::FILE* file = std::fopen(path, "r");
+            if (!file)
+                return;
+            int low = 0;
+            while (std::fscanf(file, "%d", &low) == 1) {
+                int high = low;
+                const int next = std::fgetc(file);
+                if (next == '-') {
+                    if (std::fscanf(file, "%d", &high) != 1)
+                        break;
+                    std::fgetc(file);
+                }
+                for (int cpu = low; cpu <= high && cpu < static_cast<int>(node_of.size()); ++cpu)
+                    if (cpu >= 0)
+                        node_of[static_cast<cslt::size_t>(cpu)] = node;
+            }
+            std::fclose(file);
+        }
+// --------------------------------------------------------------------------------
+
+        /**
+         * The CPUs this process may run on, ordered by NUMA node and then by
+         * number, so consecutive workers share a node
+         */
+        vector<cpu_slot> cpu_layout() {
+            vector<cpu_slot> slots;
+            cpu_set_t allowed;
+            CPU_ZERO(&allowed);
+            if (::sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+                return slots;
+            vector<int> node_of;
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+                node_of.push_back(0);
+            for (int node = 0; node < 64; ++node) {
+                char path[96];
+                std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+                read_cpulist(path, node, node_of);
+            }
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+                if (CPU_ISSET(cpu, &allowed))
+                    slots.push_back(cpu_slot{cpu, node_of[static_cast<cslt::size_t>(cpu)]});
+            std::stable_sort(slots.begin(), slots.end(),
+                             [](const cpu_slot& a, const cpu_slot& b) {return a.node < b.node;});
+            return slots;
+        }
+// --------------------------------------------------------------------------------
+
+        bool pin_to(int cpu) noexcept {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            return ::sched_setaffinity(0, sizeof(set), &set) == 0;
+        }
+#else
+        vector<cpu_slot> cpu_layout() {return vector<cpu_slot>();}
+        bool pin_to(int) noexcept {return false;}
+#endif
+    } /* end of unnamed namespace */
+// ================================================================================
+// ================================================================================
+// COMPLETION
+
+    void detail::completion::finish(thread_pool& pool) noexcept {
+        if (_state.exchange(done, std::memory_order_acq_rel) == waited)
+            pool._wake_waiters();
+    }
+// ================================================================================
+// ================================================================================
+// CONSTRUCTION AND DESTRUCTION
+
+    cslt::size_t thread_pool::_worker_count(cslt::size_t threads) noexcept {
+        if (threads > 0)
+            return threads;
+        const unsigned hardware = std::thread::hardware_concurrency();
+        return hardware > 0 ? hardware : 1;
+    }
+// --------------------------------------------------------------------------------
+
+    thread_pool::thread_pool(cslt::size_t threads) : _workers(_worker_count(threads)) {
+        thread_pool_options options;
+        options.threads = threads;
+        _start(options);
+    }
+// --------------------------------------------------------------------------------
+
+    thread_pool::thread_pool(const thread_pool_options& options) : _workers(_worker_count(options.threads)) {
+        _start(options);
+    }
+// --------------------------------------------------------------------------------
+
+    void thread_pool::_start(const thread_pool_options& options) {
+        if (options.pin_threads) {
+            const vector<cpu_slot> layout = cpu_layout();
+            for (cslt::size_t i = 0; i < size() && layout.size() > 0; ++i) {
+                const cpu_slot& slot = layout[i % layout.size()];
+                _workers[i].cpu = slot.cpu;
+                _workers[i].node = slot.node;
+            }
+        }
+        cslt::size_t started = 0;
+        try {
+            for (; started < size(); ++started) {
+                _workers[started].seed = 0x9e3779b97f4a7c15ull * (started + 1);
+                _workers[started].thread = std::thread([this, started] {_worker_loop(started);});
+            }
+        } catch (...) {
+            _stopping.store(true);
+            {
+                std::lock_guard<std::mutex> guard(_lock);
+            }
+            _sleep.notify_all();
+            for (cslt::size_t i = 0; i < started; ++i)
+                _workers[i].thread.join();
+            throw;
+        }
+    }
+// --------------------------------------------------------------------------------
+
+    thread_pool::~thread_pool() {
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            _stopping.store(true);
+        }
+        _sleep.notify_all();
+        for (cslt::size_t i = 0; i < size(); ++i)
+            _workers[i].thread.join();
+    }
+// ================================================================================
+// ================================================================================
+// SCHEDULING
+
+    thread_pool::worker* thread_pool::_local_worker() noexcept {
+        return tls_pool == this ? _workers.data() + tls_index : nullptr;
+    }
+// --------------------------------------------------------------------------------
+
+    long thread_pool::current_worker() const noexcept {
+        return tls_pool == this ? static_cast<long>(tls_index) : -1;
+    }
+// --------------------------------------------------------------------------------
+
+    void thread_pool::_schedule(detail::pool_task* task) {
+        worker* self = _local_worker();
+        if (self) {
+            self->tasks.push(task);
+        }
+        else {
+            std::lock_guard<std::mutex> guard(_inject_lock);
+            _injected.push_back(task);
+            _inject_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        // Pairs with the fence in _park: either the sleeper sees the task or we see the sleeper
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_sleepers.load(std::memory_order_relaxed) > 0) {
+            {
+                std::lock_guard<std::mutex> guard(_lock);
+                ++_epoch;
+            }
+            _sleep.notify_one();
+        }
+    }
+// --------------------------------------------------------------------------------
+
+    detail::pool_task* thread_pool::_find_task(worker* self) noexcept {
+        detail::pool_task* task = nullptr;
+        if (self && self->tasks.take(task))
+            return task;
+        if (_inject_count.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> guard(_inject_lock);
+            if (!_injected.empty()) {
+                task = _injected.front();
+                _injected.pop_front();
+                _inject_count.fetch_sub(1, std::memory_order_relaxed);
+                return task;
+            }
+        }
+        // Victims on the thief's own node first, then the rest
+        std::uint64_t local_seed = 0x2545f4914f6cdd1dull;
+        std::uint64_t& seed = self ? self->seed : local_seed;
+        const int node = self ? self->node : 0;
+        const cslt::size_t start = static_cast<cslt::size_t>(next_random(seed) % size());
+        for (int pass = 0; pass < 2; ++pass) {
+            for (cslt::size_t i = 0; i < size(); ++i) {
+                worker& victim = _workers[(start + i) % size()];
+                if (&victim == self || (victim.node == node) != (pass == 0))
+                    continue;
+                if (victim.tasks.steal(task))
+                    return task;
+            }
+        }
+        return nullptr;
+    }
+// --------------------------------------------------------------------------------
+
+    bool thread_pool::_has_work() const noexcept {
+        if (_inject_count.load(std::memory_order_relaxed) > 0)
+            return true;
+        for (cslt::size_t i = 0; i < size(); ++i)
+            if (!_workers.get()[i].tasks.empty())
+                return true;
+        return false;
+    }
+// --------------------------------------------------------------------------------
+
+    void thread_pool::_execute(detail::pool_task* task) noexcept {
+        task->run(*this);
+        intrusive_ptr_release(task);
+    }
+// --------------------------------------------------------------------------------
+
+    bool thread_pool::run_pending_task() {
+        detail::pool_task* task = _find_task(_local_worker());
+        if (!task)
+            return false;
+        _execute(task);
+        return true;
+    }
+// ================================================================================
+// ================================================================================
+// WORKERS AND WAITING
+
+    void thread_pool::_worker_loop(cslt::size_t index) noexcept {
+        tls_pool = this;
+        tls_index = index;
+        worker& self = _workers[index];
+        if (self.cpu >= 0 && !pin_to(self.cpu))
+            self.cpu = -1;
+        unsigned idle = 0;
+        for (;;) {
+            if (detail::pool_task* task = _find_task(&self)) {
+                _execute(task);
+                idle = 0;
+                continue;
+            }
+            if (_stopping.load(std::memory_order_acquire) && !_has_work())
+                break;
+            if (++idle < spin_limit) {
+                std::this_thread::yield();
+                continue;
+            }
+            _park(nullptr);
+            idle = 0;
+        }
+        tls_pool = nullptr;
+    }
+// --------------------------------------------------------------------------------
+
+    void thread_pool::_park(const detail::completion* c) {
+        std::unique_lock<std::mutex> guard(_lock);
+        const cslt::size_t epoch = _epoch;
+        _sleepers.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!_has_work()) {
+            _sleep.wait(guard, [this, c, epoch] {
+                return _epoch != epoch || _stopping.load(std::memory_order_relaxed) || (c && c->ready());
+            });
+        }
+        _sleepers.fetch_sub(1, std::memory_order_relaxed);
+    }
+// --------------------------------------------------------------------------------
+
+    void thread_pool::_wake_waiters() noexcept {
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+        }
+        _sleep.notify_all();
+    }
+// --------------------------------------------------------------------------------
+
+    void thread_pool::_wait(detail::completion& c) {
+        worker* self = _local_worker();
+        unsigned idle = 0;
+        while (!c.ready()) {
+            if (detail::pool_task* task = _find_task(self)) {
+                _execute(task);
+                idle = 0;
+                continue;
+            }
+            if (++idle < spin_limit) {
+                std::this_thread::yield();
+                continue;
+            }
+            if (!c.mark_waiting())
+                break;
+            _park(&c);
+            idle = 0;
+        }
+    }
+// ================================================================================
+// ================================================================================
+
+    thread_pool& default_thread_pool() {
+        static thread_pool pool;
+        return pool;
+    }
+} /* end of cslt namespace */
+// ================================================================================
+// ================================================================================
+// eof